@@ -0,0 +1,148 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <new>
+#include <limits>
+#include <utility>
+#include <cstddef>
+
+#include "ZTWorkspace.h"
+#include "ZTAlignedAllocator.h"
+
+/**
+ * Constructor : Constructs a stateless aligned allocator
+ *
+ * @param  nothing
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTAlignedAllocator<T>::ZTAlignedAllocator() noexcept {
+
+}
+
+/**
+ * Converting Constructor : allows rebinding between element types
+ *
+ * @param  ZTAlignedAllocator<U> cp allocator to be copied
+ * @return nothing
+ *
+ */
+template <typename T>
+template <typename U>
+ZTAlignedAllocator<T>::ZTAlignedAllocator(const ZTAlignedAllocator<U>&) noexcept {
+
+}
+
+/**
+ * allocate : allocates storage for n elements on a 64-byte boundary, from the
+ *            active ZTWorkspace of the calling thread if there is one
+ *
+ * @param  std::size_t n number of elements
+ * @return T* pointer to uninitialized storage
+ *
+ */
+template <typename T>
+T* ZTAlignedAllocator<T>::allocate(std::size_t n) {
+
+    if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+    {
+        throw std::bad_array_new_length();
+    }
+    return static_cast<T*>(ZTWorkspace::allocate(n * sizeof(T)));
+
+}
+
+/**
+ * deallocate : releases storage obtained from allocate to the workspace or heap
+ *              it came from
+ *
+ * @param  T* p pointer returned by allocate
+ * @param  std::size_t n number of elements
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTAlignedAllocator<T>::deallocate(T* p, std::size_t) noexcept {
+
+    ZTWorkspace::deallocate(p);
+
+}
+
+/**
+ * construct : default-initializes an element, so that sizing a container of
+ *             arithmetic types does not zero-fill memory that is about to be
+ *             overwritten
+ *
+ * @param  U* p location of the element
+ * @return nothing
+ *
+ */
+template <typename T>
+template <typename U>
+void ZTAlignedAllocator<T>::construct(U* p) {
+
+    ::new (static_cast<void*>(p)) U;
+
+}
+
+/**
+ * construct : constructs an element from the given arguments
+ *
+ * @param  U* p location of the element
+ * @param  Args&&... args constructor arguments
+ * @return nothing
+ *
+ */
+template <typename T>
+template <typename U, typename... Args>
+void ZTAlignedAllocator<T>::construct(U* p, Args&&... args) {
+
+    ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+
+}
+
+/**
+ * == operator : every block records the workspace or heap it came from, so any
+ *              aligned allocator can release it
+ *
+ */
+template <typename T, typename U>
+inline bool operator==(const ZTAlignedAllocator<T>&, const ZTAlignedAllocator<U>&) noexcept {
+
+    return true;
+
+}
+
+/**
+ * != operator : every block records the workspace or heap it came from, so any
+ *              aligned allocator can release it
+ *
+ */
+template <typename T, typename U>
+inline bool operator!=(const ZTAlignedAllocator<T>&, const ZTAlignedAllocator<U>&) noexcept {
+
+    return false;
+
+}
@@ -0,0 +1,63 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ZTALIGNEDALLOCATOR_H
+#define ZTALIGNEDALLOCATOR_H
+
+#include <cstddef>
+
+template <typename T>
+class ZTAlignedAllocator {
+
+public:
+    typedef T value_type;
+
+    static constexpr std::size_t alignment = 64; // cache line / AVX-512 register width
+
+    template <typename U>
+    struct rebind {
+        typedef ZTAlignedAllocator<U> other;
+    };
+
+    ZTAlignedAllocator() noexcept;
+    template <typename U>
+    ZTAlignedAllocator(const ZTAlignedAllocator<U>& cp) noexcept;
+
+    T* allocate(std::size_t n);
+    void deallocate(T* p, std::size_t n) noexcept;
+
+    template <typename U>
+    void construct(U* p);
+    template <typename U, typename... Args>
+    void construct(U* p, Args&&... args);
+
+};
+
+template <typename T, typename U>
+bool operator ==(const ZTAlignedAllocator<T>& a, const ZTAlignedAllocator<U>& b) noexcept;
+
+template <typename T, typename U>
+bool operator !=(const ZTAlignedAllocator<T>& a, const ZTAlignedAllocator<U>& b) noexcept;
+
+#endif /* ZTALIGNEDALLOCATOR_H */
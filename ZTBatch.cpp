@@ -0,0 +1,1097 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cmath>
+#include <vector>
+#include <cstddef>
+#include <sstream>
+#include <utility>
+#include <stdexcept>
+#include <algorithm>
+
+#include "ZTBatch.h"
+#include "ZTBlas.h"
+#include "ZTError.h"
+#include "ZTThreadPool.h"
+
+/**
+ * zt_batch_stride : distance between planes, count rounded up to whole
+ *                   cache lines so that every plane starts aligned
+ *
+ * @param  std::size_t count number of items
+ * @return std::size_t
+ *
+ */
+template <typename T>
+std::size_t zt_batch_stride(std::size_t count) {
+
+    const std::size_t line = std::max<std::size_t>(1, ZTAlignedAllocator<T>::alignment / sizeof(T));
+    return (count + line - 1) / line * line;
+
+}
+
+/**
+ * Constructor : Constructs count vectors of the given size
+ *
+ * @param  std::size_t count number of vectors
+ * @param  std::size_t size size of every vector
+ * @param  T& elements numeric for initialization
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTVectorBatch<T>::ZTVectorBatch(std::size_t count, std::size_t size, const T& elements) : batch_count(count),
+                                                                                       vector_size(size),
+                                                                                       batch_stride(zt_batch_stride<T>(count)) {
+
+    batch_data.assign(size * batch_stride, T(0));
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        std::fill(plane(i), plane(i) + count, elements);
+    }
+
+}
+
+/**
+ * get_batch_count : gets the number of vectors
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTVectorBatch<T>::get_batch_count() const {
+
+    return batch_count;
+
+}
+
+/**
+ * get_vector_size : gets the size of every vector
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTVectorBatch<T>::get_vector_size() const {
+
+    return vector_size;
+
+}
+
+/**
+ * stride : distance between planes
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTVectorBatch<T>::stride() const {
+
+    return batch_stride;
+
+}
+
+/**
+ * plane : element i of every vector, count contiguous values
+ *
+ * @param  std::size_t i zero-based element
+ * @return T* plane
+ *
+ */
+template <typename T>
+inline T* ZTVectorBatch<T>::plane(std::size_t i) {
+
+    return batch_data.data() + i * batch_stride;
+
+}
+
+/**
+ * plane : element i of every vector, count contiguous values
+ *
+ * @param  std::size_t i zero-based element
+ * @return const T* plane
+ *
+ */
+template <typename T>
+inline const T* ZTVectorBatch<T>::plane(std::size_t i) const {
+
+    return batch_data.data() + i * batch_stride;
+
+}
+
+/**
+ * at : element of one vector, always checked
+ *
+ * @param  std::size_t item zero-based vector
+ * @param  std::size_t i zero-based element
+ * @return T& element
+ *
+ */
+template <typename T>
+T& ZTVectorBatch<T>::at(std::size_t item, std::size_t i) {
+
+    valid_index(item, i);
+    return batch_data[i * batch_stride + item];
+
+}
+
+/**
+ * at : element of one vector, always checked
+ *
+ * @param  std::size_t item zero-based vector
+ * @param  std::size_t i zero-based element
+ * @return const T& element
+ *
+ */
+template <typename T>
+const T& ZTVectorBatch<T>::at(std::size_t item, std::size_t i) const {
+
+    valid_index(item, i);
+    return batch_data[i * batch_stride + item];
+
+}
+
+/**
+ * unsafe_get : element of one vector, unchecked
+ *
+ * @param  std::size_t item zero-based vector
+ * @param  std::size_t i zero-based element
+ * @return T& element
+ *
+ */
+template <typename T>
+inline T& ZTVectorBatch<T>::unsafe_get(std::size_t item, std::size_t i) {
+
+    return batch_data[i * batch_stride + item];
+
+}
+
+/**
+ * unsafe_get : element of one vector, unchecked
+ *
+ * @param  std::size_t item zero-based vector
+ * @param  std::size_t i zero-based element
+ * @return const T& element
+ *
+ */
+template <typename T>
+inline const T& ZTVectorBatch<T>::unsafe_get(std::size_t item, std::size_t i) const {
+
+    return batch_data[i * batch_stride + item];
+
+}
+
+/**
+ * get : copies one vector out of the batch
+ *
+ * @param  std::size_t item zero-based vector
+ * @return ZTVector<T> result
+ *
+ */
+template <typename T>
+ZTVector<T> ZTVectorBatch<T>::get(std::size_t item) const {
+
+    ZT_VALIDATE(valid_item(item));
+    ZTVector<T> result((std::vector<T>()));
+    result.set_vector_size(vector_size);
+    for (std::size_t i = 0; i < vector_size; ++i)
+    {
+        result.data()[i] = batch_data[i * batch_stride + item];
+    }
+    return result;
+
+}
+
+/**
+ * set : copies a vector into the batch
+ *
+ * @param  std::size_t item zero-based vector
+ * @param  ZTVectorView<const T> v vector of the batch size
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTVectorBatch<T>::set(std::size_t item, const ZTVectorView<const T>& v) {
+
+    ZT_VALIDATE(valid_item(item));
+    if (v.size() != vector_size)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "vector of size " << v.size() << " does not fit a batch of vectors of size " << vector_size << "!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+    for (std::size_t i = 0; i < vector_size; ++i)
+    {
+        batch_data[i * batch_stride + item] = v[i];
+    }
+
+}
+
+/**
+ * add : performs vector batch to vector batch addition
+ *
+ * @param  ZTVectorBatch<T> v
+ * @return ZTVectorBatch<T> result
+ *
+ */
+template <typename T>
+ZTVectorBatch<T> ZTVectorBatch<T>::add(const ZTVectorBatch<T>& v) const {
+
+    ZT_VALIDATE(valid_same_batch(v));
+    ZTVectorBatch<T> result(*this);
+    ZTBlas<T>::kernels().add(batch_data.size(), batch_data.data(), v.batch_data.data(), result.batch_data.data());
+    return result;
+
+}
+
+/**
+ * minus : performs vector batch to vector batch subtraction
+ *
+ * @param  ZTVectorBatch<T> v
+ * @return ZTVectorBatch<T> result
+ *
+ */
+template <typename T>
+ZTVectorBatch<T> ZTVectorBatch<T>::minus(const ZTVectorBatch<T>& v) const {
+
+    ZT_VALIDATE(valid_same_batch(v));
+    ZTVectorBatch<T> result(*this);
+    ZTBlas<T>::kernels().minus(batch_data.size(), batch_data.data(), v.batch_data.data(), result.batch_data.data());
+    return result;
+
+}
+
+/**
+ * multiply : performs vector batch to scalar multiplication
+ *
+ * @param  T& scalar
+ * @return ZTVectorBatch<T> result
+ *
+ */
+template <typename T>
+ZTVectorBatch<T> ZTVectorBatch<T>::multiply(const T& scalar) const {
+
+    ZTVectorBatch<T> result(*this);
+    ZTBlas<T>::kernels().multiply_scalar(batch_data.size(), batch_data.data(), scalar, result.batch_data.data());
+    return result;
+
+}
+
+/**
+ * dot : dot product of every pair of vectors
+ *
+ * @param  ZTVectorBatch<T> v
+ * @return ZTVector<T> one value per item
+ *
+ */
+template <typename T>
+ZTVector<T> ZTVectorBatch<T>::dot(const ZTVectorBatch<T>& v) const {
+
+    ZT_VALIDATE(valid_same_batch(v));
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    ZTVector<T> result((std::vector<T>()));
+    result.set_vector_size(batch_count);
+    std::fill(result.data(), result.data() + batch_count, T(0));
+    for (std::size_t i = 0; i < vector_size; ++i)
+    {
+        blas.hadamard_add(batch_count, plane(i), v.plane(i), result.data());
+    }
+    return result;
+
+}
+
+/**
+ * norm : Euclidean norm of every vector
+ *
+ * @param  nothing
+ * @return ZTVector<T> one value per item
+ *
+ */
+template <typename T>
+ZTVector<T> ZTVectorBatch<T>::norm() const {
+
+    ZTVector<T> result = dot(*this);
+    T* r = result.data();
+    _Pragma("GCC ivdep")
+    for (std::size_t k = 0; k < batch_count; ++k)
+    {
+        r[k] = std::sqrt(r[k]);
+    }
+    return result;
+
+}
+
+/**
+ * valid_same_batch : checks that two vector batches have the same count and size
+ *
+ * @param  ZTVectorBatch<T> v
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTVectorBatch<T>::valid_same_batch(const ZTVectorBatch<T>& v) const {
+
+    if (batch_count != v.batch_count || vector_size != v.vector_size)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Batches of " << batch_count << " vectors of size " << vector_size << " and " << v.batch_count << " vectors of size " << v.vector_size << " do not match!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * valid_item : checks a zero-based item
+ *
+ * @param  std::size_t item
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTVectorBatch<T>::valid_item(std::size_t item) const {
+
+    if (item >= batch_count)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Batch item " << item << " out of range for " << batch_count << " vectors!.";
+        zt_raise<std::out_of_range>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * valid_index : checks a zero-based item and element
+ *
+ * @param  std::size_t item
+ * @param  std::size_t i
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTVectorBatch<T>::valid_index(std::size_t item, std::size_t i) const {
+
+    if (item >= batch_count || i >= vector_size)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Batch index (" << item << ", " << i << ") out of range for " << batch_count << " vectors of size " << vector_size << "!.";
+        zt_raise<std::out_of_range>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * Constructor : Constructs count matrices of dimensions rows by cols
+ *
+ * @param  std::size_t count number of matrices
+ * @param  std::size_t rows rows of every matrix
+ * @param  std::size_t cols cols of every matrix
+ * @param  T& elements numeric for initialization
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTMatrixBatch<T>::ZTMatrixBatch(std::size_t count, std::size_t rows, std::size_t cols, const T& elements) :
+                                                batch_count(count),
+                                                matrix_rows(rows),
+                                                matrix_cols(cols),
+                                                batch_stride(zt_batch_stride<T>(count)) {
+
+    batch_data.assign(rows * cols * batch_stride, T(0));
+    for (std::size_t p = 0; p < rows * cols; ++p)
+    {
+        std::fill(batch_data.data() + p * batch_stride, batch_data.data() + p * batch_stride + count, elements);
+    }
+
+}
+
+/**
+ * blocks : calls fn(first, lanes) for consecutive blocks of at most
+ *          block_size items, the blocks spread over the thread pool
+ *
+ * @param  std::size_t count number of items
+ * @param  F fn block operation
+ * @return nothing
+ *
+ */
+template <typename T>
+template <typename F>
+void ZTMatrixBatch<T>::blocks(std::size_t count, const F& fn) {
+
+    const std::size_t lanes = block_size;
+    const std::size_t total = (count + lanes - 1) / lanes;
+    if (total <= 1)
+    {
+        fn(0, count);
+        return;
+    }
+    ZTThreadPool::instance().parallel_for(total, [&](std::size_t block) {
+        const std::size_t first = block * lanes;
+        fn(first, std::min(lanes, count - first));
+    });
+
+}
+
+/**
+ * get_batch_count : gets the number of matrices
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTMatrixBatch<T>::get_batch_count() const {
+
+    return batch_count;
+
+}
+
+/**
+ * get_matrix_rows : gets the rows of every matrix
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTMatrixBatch<T>::get_matrix_rows() const {
+
+    return matrix_rows;
+
+}
+
+/**
+ * get_matrix_cols : gets the cols of every matrix
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTMatrixBatch<T>::get_matrix_cols() const {
+
+    return matrix_cols;
+
+}
+
+/**
+ * stride : distance between planes
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTMatrixBatch<T>::stride() const {
+
+    return batch_stride;
+
+}
+
+/**
+ * plane : element (row, col) of every matrix, count contiguous values
+ *
+ * @param  std::size_t row zero-based
+ * @param  std::size_t col zero-based
+ * @return T* plane
+ *
+ */
+template <typename T>
+inline T* ZTMatrixBatch<T>::plane(std::size_t row, std::size_t col) {
+
+    return batch_data.data() + (row * matrix_cols + col) * batch_stride;
+
+}
+
+/**
+ * plane : element (row, col) of every matrix, count contiguous values
+ *
+ * @param  std::size_t row zero-based
+ * @param  std::size_t col zero-based
+ * @return const T* plane
+ *
+ */
+template <typename T>
+inline const T* ZTMatrixBatch<T>::plane(std::size_t row, std::size_t col) const {
+
+    return batch_data.data() + (row * matrix_cols + col) * batch_stride;
+
+}
+
+/**
+ * at : element of one matrix, always checked
+ *
+ * @param  std::size_t item zero-based matrix
+ * @param  std::size_t row zero-based
+ * @param  std::size_t col zero-based
+ * @return T& element
+ *
+ */
+template <typename T>
+T& ZTMatrixBatch<T>::at(std::size_t item, std::size_t row, std::size_t col) {
+
+    valid_index(item, row, col);
+    return plane(row, col)[item];
+
+}
+
+/**
+ * at : element of one matrix, always checked
+ *
+ * @param  std::size_t item zero-based matrix
+ * @param  std::size_t row zero-based
+ * @param  std::size_t col zero-based
+ * @return const T& element
+ *
+ */
+template <typename T>
+const T& ZTMatrixBatch<T>::at(std::size_t item, std::size_t row, std::size_t col) const {
+
+    valid_index(item, row, col);
+    return plane(row, col)[item];
+
+}
+
+/**
+ * unsafe_get : element of one matrix, unchecked
+ *
+ * @param  std::size_t item zero-based matrix
+ * @param  std::size_t row zero-based
+ * @param  std::size_t col zero-based
+ * @return T& element
+ *
+ */
+template <typename T>
+inline T& ZTMatrixBatch<T>::unsafe_get(std::size_t item, std::size_t row, std::size_t col) {
+
+    return plane(row, col)[item];
+
+}
+
+/**
+ * unsafe_get : element of one matrix, unchecked
+ *
+ * @param  std::size_t item zero-based matrix
+ * @param  std::size_t row zero-based
+ * @param  std::size_t col zero-based
+ * @return const T& element
+ *
+ */
+template <typename T>
+inline const T& ZTMatrixBatch<T>::unsafe_get(std::size_t item, std::size_t row, std::size_t col) const {
+
+    return plane(row, col)[item];
+
+}
+
+/**
+ * get : copies one matrix out of the batch
+ *
+ * @param  std::size_t item zero-based matrix
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTMatrixBatch<T>::get(std::size_t item) const {
+
+    ZT_VALIDATE(valid_item(item));
+    ZTMatrix<T> result(matrix_rows, matrix_cols, T(0));
+    for (std::size_t i = 0; i < matrix_rows; ++i)
+    {
+        for (std::size_t j = 0; j < matrix_cols; ++j)
+        {
+            result[i][j] = plane(i, j)[item];
+        }
+    }
+    return result;
+
+}
+
+/**
+ * set : copies a matrix into the batch
+ *
+ * @param  std::size_t item zero-based matrix
+ * @param  ZTMatrixView<const T> m matrix of the batch dimensions
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTMatrixBatch<T>::set(std::size_t item, const ZTMatrixView<const T>& m) {
+
+    ZT_VALIDATE(valid_item(item));
+    if (m.get_matrix_rows() != matrix_rows || m.get_matrix_cols() != matrix_cols)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Matrix of dimensions: " << m.get_matrix_rows() << "x" << m.get_matrix_cols() << " does not fit a batch of " << matrix_rows << "x" << matrix_cols << " matrices!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+    for (std::size_t i = 0; i < matrix_rows; ++i)
+    {
+        for (std::size_t j = 0; j < matrix_cols; ++j)
+        {
+            plane(i, j)[item] = m.unsafe_get(i, j);
+        }
+    }
+
+}
+
+/**
+ * add : performs matrix batch to matrix batch addition
+ *
+ * @param  ZTMatrixBatch<T> m
+ * @return ZTMatrixBatch<T> result
+ *
+ */
+template <typename T>
+ZTMatrixBatch<T> ZTMatrixBatch<T>::add(const ZTMatrixBatch<T>& m) const {
+
+    ZT_VALIDATE(valid_matrix_add_minus(m));
+    ZTMatrixBatch<T> result(*this);
+    ZTBlas<T>::kernels().add(batch_data.size(), batch_data.data(), m.batch_data.data(), result.batch_data.data());
+    return result;
+
+}
+
+/**
+ * minus : performs matrix batch to matrix batch subtraction
+ *
+ * @param  ZTMatrixBatch<T> m
+ * @return ZTMatrixBatch<T> result
+ *
+ */
+template <typename T>
+ZTMatrixBatch<T> ZTMatrixBatch<T>::minus(const ZTMatrixBatch<T>& m) const {
+
+    ZT_VALIDATE(valid_matrix_add_minus(m));
+    ZTMatrixBatch<T> result(*this);
+    ZTBlas<T>::kernels().minus(batch_data.size(), batch_data.data(), m.batch_data.data(), result.batch_data.data());
+    return result;
+
+}
+
+/**
+ * multiply : performs matrix batch to scalar multiplication
+ *
+ * @param  T& scalar
+ * @return ZTMatrixBatch<T> result
+ *
+ */
+template <typename T>
+ZTMatrixBatch<T> ZTMatrixBatch<T>::multiply(const T& scalar) const {
+
+    ZTMatrixBatch<T> result(*this);
+    ZTBlas<T>::kernels().multiply_scalar(batch_data.size(), batch_data.data(), scalar, result.batch_data.data());
+    return result;
+
+}
+
+/**
+ * multiply : performs the matrix product of every pair of matrices, plane
+ *            (i, j) of the result accumulating plane (i, k) times plane
+ *            (k, j) across the block
+ *
+ * @param  ZTMatrixBatch<T> m
+ * @return ZTMatrixBatch<T> result
+ *
+ */
+template <typename T>
+ZTMatrixBatch<T> ZTMatrixBatch<T>::multiply(const ZTMatrixBatch<T>& m) const {
+
+    ZT_VALIDATE(valid_same_batch(m.batch_count));
+    ZT_VALIDATE(valid_matrix_product(m.matrix_rows, m.matrix_cols));
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    ZTMatrixBatch<T> result(batch_count, matrix_rows, m.matrix_cols);
+    blocks(batch_count, [&](std::size_t first, std::size_t lanes) {
+        for (std::size_t i = 0; i < matrix_rows; ++i)
+        {
+            for (std::size_t j = 0; j < m.matrix_cols; ++j)
+            {
+                T* c = result.plane(i, j) + first;
+                for (std::size_t k = 0; k < matrix_cols; ++k)
+                {
+                    blas.hadamard_add(lanes, plane(i, k) + first, m.plane(k, j) + first, c);
+                }
+            }
+        }
+    });
+    return result;
+
+}
+
+/**
+ * matvec : performs the matrix-vector product of every matrix and vector
+ *
+ * @param  ZTVectorBatch<T> v
+ * @return ZTVectorBatch<T> result
+ *
+ */
+template <typename T>
+ZTVectorBatch<T> ZTMatrixBatch<T>::matvec(const ZTVectorBatch<T>& v) const {
+
+    ZT_VALIDATE(valid_same_batch(v.batch_count));
+    ZT_VALIDATE(valid_matrix_product(v.vector_size, 1));
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    ZTVectorBatch<T> result(batch_count, matrix_rows);
+    blocks(batch_count, [&](std::size_t first, std::size_t lanes) {
+        for (std::size_t i = 0; i < matrix_rows; ++i)
+        {
+            T* y = result.plane(i) + first;
+            for (std::size_t j = 0; j < matrix_cols; ++j)
+            {
+                blas.hadamard_add(lanes, plane(i, j) + first, v.plane(j) + first, y);
+            }
+        }
+    });
+    return result;
+
+}
+
+/**
+ * gauss_jordan : reduces every matrix to the identity with partial
+ *                pivoting chosen per item, applying the same row
+ *                operations to the right-hand sides. The block is copied
+ *                to scratch so the batch is left untouched; pivot search
+ *                and row swaps run item by item, the eliminations run
+ *                across the block
+ *
+ * @param  std::size_t rhs_cols number of right-hand sides per item
+ * @param  T* rhs right-hand side planes, plane (i, c) at (i * rhs_cols + c) * stride()
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTMatrixBatch<T>::gauss_jordan(std::size_t rhs_cols, T* rhs) const {
+
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    const std::size_t n = matrix_rows;
+    std::vector<std::size_t> singular((batch_count + block_size - 1) / block_size, batch_count);
+    blocks(batch_count, [&](std::size_t first, std::size_t lanes) {
+        std::vector<T, ZTAlignedAllocator<T> > a(n * n * lanes);
+        std::vector<T, ZTAlignedAllocator<T> > scale(lanes);
+        std::vector<T, ZTAlignedAllocator<T> > multiplier(lanes);
+        std::vector<std::size_t> pivot(lanes);
+        for (std::size_t p = 0; p < n * n; ++p)
+        {
+            std::copy(batch_data.data() + p * batch_stride + first, batch_data.data() + p * batch_stride + first + lanes, a.data() + p * lanes);
+        }
+        auto matrix = [&](std::size_t i, std::size_t j) { return a.data() + (i * n + j) * lanes; };
+        auto right = [&](std::size_t i, std::size_t c) { return rhs + (i * rhs_cols + c) * batch_stride + first; };
+
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            const T* column = matrix(k, k);
+            for (std::size_t l = 0; l < lanes; ++l)
+            {
+                scale[l] = std::abs(column[l]);
+                pivot[l] = k;
+            }
+            for (std::size_t i = k + 1; i < n; ++i)
+            {
+                column = matrix(i, k);
+                for (std::size_t l = 0; l < lanes; ++l)
+                {
+                    if (std::abs(column[l]) > scale[l])
+                    {
+                        scale[l] = std::abs(column[l]);
+                        pivot[l] = i;
+                    }
+                }
+            }
+            for (std::size_t l = 0; l < lanes; ++l)
+            {
+                if (pivot[l] == k)
+                {
+                    continue;
+                }
+                for (std::size_t j = k; j < n; ++j)
+                {
+                    std::swap(matrix(k, j)[l], matrix(pivot[l], j)[l]);
+                }
+                for (std::size_t c = 0; c < rhs_cols; ++c)
+                {
+                    std::swap(right(k, c)[l], right(pivot[l], c)[l]);
+                }
+            }
+            const T* diagonal = matrix(k, k);
+            for (std::size_t l = 0; l < lanes; ++l)
+            {
+                if (diagonal[l] == T(0))
+                {
+                    singular[first / block_size] = std::min(singular[first / block_size], first + l);
+                    scale[l] = T(0);
+                }
+                else
+                {
+                    scale[l] = T(1) / diagonal[l];
+                }
+            }
+            for (std::size_t j = k + 1; j < n; ++j)
+            {
+                blas.hadamard(lanes, matrix(k, j), scale.data(), matrix(k, j));
+            }
+            for (std::size_t c = 0; c < rhs_cols; ++c)
+            {
+                blas.hadamard(lanes, right(k, c), scale.data(), right(k, c));
+            }
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                if (i == k)
+                {
+                    continue;
+                }
+                blas.multiply_scalar(lanes, matrix(i, k), T(-1), multiplier.data());
+                for (std::size_t j = k + 1; j < n; ++j)
+                {
+                    blas.hadamard_add(lanes, multiplier.data(), matrix(k, j), matrix(i, j));
+                }
+                for (std::size_t c = 0; c < rhs_cols; ++c)
+                {
+                    blas.hadamard_add(lanes, multiplier.data(), right(k, c), right(i, c));
+                }
+            }
+        }
+    });
+    const std::size_t item = *std::min_element(singular.begin(), singular.end());
+    if (item < batch_count)
+    {
+        std::ostringstream singular_matrix;
+        singular_matrix << "Matrix " << item << " of the batch is singular, the system has no unique solution!.";
+        zt_raise<std::domain_error>(singular_matrix.str());
+    }
+
+}
+
+/**
+ * solve : solves A_k * x_k = b_k for every item of the batch
+ *
+ * @param  ZTVectorBatch<T> b right-hand sides
+ * @return ZTVectorBatch<T> result
+ *
+ */
+template <typename T>
+ZTVectorBatch<T> ZTMatrixBatch<T>::solve(const ZTVectorBatch<T>& b) const {
+
+    ZT_VALIDATE(valid_sqaure_matrix());
+    ZT_VALIDATE(valid_same_batch(b.batch_count));
+    ZT_VALIDATE(valid_matrix_product(b.vector_size, 1));
+    ZTVectorBatch<T> result(b);
+    gauss_jordan(1, result.batch_data.data());
+    return result;
+
+}
+
+/**
+ * solve : solves A_k * X_k = B_k for every item of the batch
+ *
+ * @param  ZTMatrixBatch<T> b right-hand sides
+ * @return ZTMatrixBatch<T> result
+ *
+ */
+template <typename T>
+ZTMatrixBatch<T> ZTMatrixBatch<T>::solve(const ZTMatrixBatch<T>& b) const {
+
+    ZT_VALIDATE(valid_sqaure_matrix());
+    ZT_VALIDATE(valid_same_batch(b.batch_count));
+    ZT_VALIDATE(valid_matrix_product(b.matrix_rows, b.matrix_cols));
+    ZTMatrixBatch<T> result(b);
+    gauss_jordan(b.matrix_cols, result.batch_data.data());
+    return result;
+
+}
+
+/**
+ * trace : trace of every matrix
+ *
+ * @param  nothing
+ * @return ZTVector<T> one value per item
+ *
+ */
+template <typename T>
+ZTVector<T> ZTMatrixBatch<T>::trace() const {
+
+    ZT_VALIDATE(valid_sqaure_matrix());
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    ZTVector<T> result((std::vector<T>()));
+    result.set_vector_size(batch_count);
+    std::fill(result.data(), result.data() + batch_count, T(0));
+    for (std::size_t i = 0; i < matrix_rows; ++i)
+    {
+        blas.add(batch_count, result.data(), plane(i, i), result.data());
+    }
+    return result;
+
+}
+
+/**
+ * norm : Frobenius norm of every matrix
+ *
+ * @param  nothing
+ * @return ZTVector<T> one value per item
+ *
+ */
+template <typename T>
+ZTVector<T> ZTMatrixBatch<T>::norm() const {
+
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    ZTVector<T> result((std::vector<T>()));
+    result.set_vector_size(batch_count);
+    std::fill(result.data(), result.data() + batch_count, T(0));
+    blocks(batch_count, [&](std::size_t first, std::size_t lanes) {
+        T* r = result.data() + first;
+        for (std::size_t p = 0; p < matrix_rows * matrix_cols; ++p)
+        {
+            const T* x = batch_data.data() + p * batch_stride + first;
+            blas.hadamard_add(lanes, x, x, r);
+        }
+        _Pragma("GCC ivdep")
+        for (std::size_t l = 0; l < lanes; ++l)
+        {
+            r[l] = std::sqrt(r[l]);
+        }
+    });
+    return result;
+
+}
+
+/**
+ * valid_same_batch : checks that an operand holds as many items
+ *
+ * @param  std::size_t count items of the operand
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTMatrixBatch<T>::valid_same_batch(std::size_t count) const {
+
+    if (count != batch_count)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Batches of " << batch_count << " and " << count << " items do not match!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * valid_sqaure_matrix : checks that the matrices of the batch are square
+ *
+ * @param  nothing
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTMatrixBatch<T>::valid_sqaure_matrix() const {
+
+    if (matrix_rows != matrix_cols)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Matrices of dimensions: " << matrix_rows << "x" << matrix_cols << " is not a sqaure matrix!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * valid_matrix_product : checks that the matrices of the batch can
+ *                        multiply operands of rows x cols
+ *
+ * @param  std::size_t rows rows of the operand
+ * @param  std::size_t cols cols of the operand
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTMatrixBatch<T>::valid_matrix_product(std::size_t rows, std::size_t cols) const {
+
+    if (matrix_cols != rows)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Matrices of dimensions: " << matrix_rows << "x" << matrix_cols << " and " << rows << "x" << cols << " are not suitable for matrix product!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * valid_matrix_add_minus : checks that two matrix batches have the same
+ *                          count and dimensions
+ *
+ * @param  ZTMatrixBatch<T> m
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTMatrixBatch<T>::valid_matrix_add_minus(const ZTMatrixBatch<T>& m) const {
+
+    valid_same_batch(m.batch_count);
+    if (matrix_rows != m.matrix_rows || matrix_cols != m.matrix_cols)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Matrices of dimensions: " << matrix_rows << "x" << matrix_cols << " and " << m.matrix_rows << "x" << m.matrix_cols << " are not suitable for matrix add or minus!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * valid_item : checks a zero-based item
+ *
+ * @param  std::size_t item
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTMatrixBatch<T>::valid_item(std::size_t item) const {
+
+    if (item >= batch_count)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Batch item " << item << " out of range for " << batch_count << " matrices!.";
+        zt_raise<std::out_of_range>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * valid_index : checks a zero-based item, row and col
+ *
+ * @param  std::size_t item
+ * @param  std::size_t row
+ * @param  std::size_t col
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTMatrixBatch<T>::valid_index(std::size_t item, std::size_t row, std::size_t col) const {
+
+    if (item >= batch_count || row >= matrix_rows || col >= matrix_cols)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Batch index (" << item << ", " << row << ", " << col << ") out of range for " << batch_count << " matrices of dimensions " << matrix_rows << "x" << matrix_cols << "!.";
+        zt_raise<std::out_of_range>(invalid_dimensions.str());
+    }
+
+}
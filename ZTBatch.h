@@ -0,0 +1,160 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ZTBATCH_H
+#define ZTBATCH_H
+
+#include <vector>
+#include <cstddef>
+
+#include "ZTAlignedAllocator.h"
+#include "ZTMatrix.h"
+#include "ZTVector.h"
+#include "ZTVectorView.h"
+#include "ZTMatrixView.h"
+
+template <typename T> class ZTMatrixBatch;
+
+/*
+ * ZTVectorBatch : count vectors of one size in structure-of-arrays form.
+ *                 Element i of every vector sits in its own plane of count
+ *                 contiguous values, so a batched operation is a handful of
+ *                 BLAS-1 kernel calls that run across the batch with one
+ *                 vector per SIMD lane. Planes start on a cache line and
+ *                 the padding lanes past count stay zero.
+ */
+template <typename T>
+class ZTVectorBatch {
+
+private:
+    std::vector<T, ZTAlignedAllocator<T> > batch_data; // plane i at i * batch_stride
+    std::size_t batch_count;
+    std::size_t vector_size;
+    std::size_t batch_stride;                         // count rounded up to whole cache lines
+
+    template <typename U> friend class ZTMatrixBatch;
+
+public:
+    typedef T value_type;
+
+    ZTVectorBatch(std::size_t count, std::size_t size, const T& elements = T());
+
+    std::size_t get_batch_count() const;
+    std::size_t get_vector_size() const;
+    std::size_t stride() const;
+
+    T* plane(std::size_t i);                                   // element i of every vector
+    const T* plane(std::size_t i) const;
+
+    T& at(std::size_t item, std::size_t i);                    // zero-based, always checked
+    const T& at(std::size_t item, std::size_t i) const;
+
+    T& unsafe_get(std::size_t item, std::size_t i);            // zero-based, unchecked
+    const T& unsafe_get(std::size_t item, std::size_t i) const;
+
+    ZTVector<T> get(std::size_t item) const;                   // copies one vector out
+    void set(std::size_t item, const ZTVectorView<const T>& v);
+
+    ZTVectorBatch<T> add(const ZTVectorBatch<T>& v) const;
+    ZTVectorBatch<T> minus(const ZTVectorBatch<T>& v) const;
+    ZTVectorBatch<T> multiply(const T& scalar) const;
+
+    ZTVector<T> dot(const ZTVectorBatch<T>& v) const;          // one dot product per item
+    ZTVector<T> norm() const;                                  // one norm per item
+
+    void valid_same_batch(const ZTVectorBatch<T>& v) const;
+    void valid_item(std::size_t item) const;
+    void valid_index(std::size_t item, std::size_t i) const;
+
+};
+
+/*
+ * ZTMatrixBatch : count rows x cols matrices in structure-of-arrays form,
+ *                 the plane of element (i, j) holding that element of every
+ *                 matrix. Products, solves and norms run over blocks of
+ *                 the batch small enough for every plane of a block to
+ *                 stay in cache, the blocks shared out over the thread pool.
+ *                 solve() is Gauss-Jordan elimination with partial pivoting
+ *                 chosen per item.
+ */
+template <typename T>
+class ZTMatrixBatch {
+
+private:
+    std::vector<T, ZTAlignedAllocator<T> > batch_data; // plane (i, j) at (i * cols + j) * batch_stride
+    std::size_t batch_count;
+    std::size_t matrix_rows;
+    std::size_t matrix_cols;
+    std::size_t batch_stride;                         // count rounded up to whole cache lines
+
+    template <typename F>
+    static void blocks(std::size_t count, const F& fn); // fn(first, lanes) over blocks of the batch, in parallel
+    void gauss_jordan(std::size_t rhs_cols, T* rhs) const;
+
+public:
+    typedef T value_type;
+
+    static constexpr std::size_t block_size = 256; // items per block, every plane of a block stays in cache
+
+    ZTMatrixBatch(std::size_t count, std::size_t rows, std::size_t cols, const T& elements = T());
+
+    std::size_t get_batch_count() const;
+    std::size_t get_matrix_rows() const;
+    std::size_t get_matrix_cols() const;
+    std::size_t stride() const;
+
+    T* plane(std::size_t row, std::size_t col);                // element (row, col) of every matrix
+    const T* plane(std::size_t row, std::size_t col) const;
+
+    T& at(std::size_t item, std::size_t row, std::size_t col); // zero-based, always checked
+    const T& at(std::size_t item, std::size_t row, std::size_t col) const;
+
+    T& unsafe_get(std::size_t item, std::size_t row, std::size_t col); // zero-based, unchecked
+    const T& unsafe_get(std::size_t item, std::size_t row, std::size_t col) const;
+
+    ZTMatrix<T> get(std::size_t item) const;                   // copies one matrix out
+    void set(std::size_t item, const ZTMatrixView<const T>& m);
+
+    ZTMatrixBatch<T> add(const ZTMatrixBatch<T>& m) const;
+    ZTMatrixBatch<T> minus(const ZTMatrixBatch<T>& m) const;
+    ZTMatrixBatch<T> multiply(const T& scalar) const;
+    ZTMatrixBatch<T> multiply(const ZTMatrixBatch<T>& m) const;   // one matrix product per item
+    ZTVectorBatch<T> matvec(const ZTVectorBatch<T>& v) const;     // one matrix-vector product per item
+
+    ZTVectorBatch<T> solve(const ZTVectorBatch<T>& b) const;      // A_k * x_k = b_k for every item
+    ZTMatrixBatch<T> solve(const ZTMatrixBatch<T>& b) const;      // A_k * X_k = B_k for every item
+
+    ZTVector<T> trace() const;                                 // one trace per item
+    ZTVector<T> norm() const;                                  // one Frobenius norm per item
+
+    void valid_same_batch(std::size_t count) const;
+    void valid_sqaure_matrix() const;
+    void valid_matrix_product(std::size_t rows, std::size_t cols) const;
+    void valid_matrix_add_minus(const ZTMatrixBatch<T>& m) const;
+    void valid_item(std::size_t item) const;
+    void valid_index(std::size_t item, std::size_t row, std::size_t col) const;
+
+};
+
+#endif /* ZTBATCH_H */
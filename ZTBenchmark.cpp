@@ -0,0 +1,414 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <map>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <ostream>
+#include <sstream>
+#include <algorithm>
+#include <stdexcept>
+#include <functional>
+
+#include "ZTAlignedAllocator.h"
+#include "ZTCpu.h"
+#include "ZTError.h"
+#include "ZTThreadPool.h"
+#include "ZTBenchmark.h"
+
+/**
+ * zt_benchmark_field : raw value of a key in a flat JSON object, without
+ *                      the quotes of a string
+ *
+ * @param  std::string object text between the braces
+ * @param  std::string key
+ * @return std::string value, empty when absent
+ *
+ */
+inline std::string zt_benchmark_field(const std::string& object, const std::string& key) {
+
+    std::size_t p = object.find("\"" + key + "\"");
+    p = p == std::string::npos ? p : object.find(':', p + key.size() + 2);
+    if (p == std::string::npos)
+    {
+        return std::string();
+    }
+    p = object.find_first_not_of(" \t\r\n", p + 1);
+    if (p == std::string::npos)
+    {
+        return std::string();
+    }
+    if (object[p] == '"')
+    {
+        const std::size_t close = object.find('"', p + 1);
+        return close == std::string::npos ? std::string() : object.substr(p + 1, close - p - 1);
+    }
+    const std::size_t end = object.find_first_of(",} \t\r\n", p);
+    return object.substr(p, end == std::string::npos ? std::string::npos : end - p);
+
+}
+
+/**
+ * Constructor : runner with no cases yet
+ *
+ * @param  double min_time seconds a timed batch runs for at the least
+ * @param  std::size_t repeats batches timed per case
+ * @param  std::size_t stream_size doubles in each STREAM array
+ *
+ */
+ZTBenchmark::ZTBenchmark(double min_time, std::size_t repeats, std::size_t stream_size) :
+                         minimum_time(min_time),
+                         repetitions(std::max<std::size_t>(repeats, 1)),
+                         stream_elements(std::max<std::size_t>(stream_size, 1)) {
+
+}
+
+/**
+ * add : registers a case
+ *
+ * @param  std::string operation
+ * @param  std::string type
+ * @param  std::size_t elements
+ * @param  double flops per iteration
+ * @param  double bytes per iteration
+ * @param  std::function setup allocates the operands
+ * @param  std::function run one iteration
+ * @param  std::function release frees the operands
+ * @return nothing
+ *
+ */
+void ZTBenchmark::add(const std::string& operation, const std::string& type, std::size_t elements, double flops, double bytes,
+                      const std::function<void()>& setup, const std::function<void()>& run, const std::function<void()>& release) {
+
+    cases.push_back({ operation, type, elements, flops, bytes, setup, run, release });
+
+}
+
+/**
+ * size : number of cases registered
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+std::size_t ZTBenchmark::size() const {
+
+    return cases.size();
+
+}
+
+/**
+ * time_batch : seconds taken by iterations runs of a case
+ *
+ * @param  std::function run
+ * @param  std::size_t iterations
+ * @return double seconds
+ *
+ */
+double ZTBenchmark::time_batch(const std::function<void()>& run, std::size_t iterations) const {
+
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        run();
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+}
+
+/**
+ * stream_triad : STREAM triad a = b + s * c over the thread pool, counting
+ *                the 24 bytes per element that STREAM counts
+ *
+ * @param  nothing
+ * @return double GB/s of the best of five runs
+ *
+ */
+double ZTBenchmark::stream_triad() {
+
+    ZTThreadPool& pool = ZTThreadPool::instance();
+    const std::size_t n = stream_elements;
+    const std::size_t chunks = 4 * pool.get_num_threads();
+    const std::size_t chunk = (n + chunks - 1) / chunks;
+    std::vector<double, ZTAlignedAllocator<double> > a(n), b(n), c(n);
+    double* pa = a.data();
+    const double* pb = b.data();
+    const double* pc = c.data();
+    pool.parallel_for(chunks, [&](std::size_t k) {
+        for (std::size_t i = k * chunk; i < std::min(n, (k + 1) * chunk); ++i)
+        {
+            a[i] = 1.0;
+            b[i] = 2.0;
+            c[i] = 0.5;
+        }
+    });
+
+    const double scalar = 3.0;
+    double best = 0.0;
+    for (std::size_t run = 0; run < 5; ++run)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        pool.parallel_for(chunks, [&](std::size_t k) {
+            const std::size_t last = std::min(n, (k + 1) * chunk);
+            _Pragma("GCC ivdep")
+            for (std::size_t i = k * chunk; i < last; ++i)
+            {
+                pa[i] = pb[i] + scalar * pc[i];
+            }
+        });
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        best = std::max(best, 24.0 * double(n) / seconds / 1e9);
+    }
+    zt_benchmark_keep(a[n / 2]);
+    return best;
+
+}
+
+/**
+ * run : times every case whose name contains filter at every thread count,
+ *       logging a line per case
+ *
+ * @param  std::vector<std::size_t> threads
+ * @param  std::string filter empty for all cases
+ * @param  std::ostream log
+ * @return std::vector<ZTBenchmarkResult> results
+ *
+ */
+std::vector<ZTBenchmarkResult> ZTBenchmark::run(const std::vector<std::size_t>& threads, const std::string& filter, std::ostream& log) {
+
+    ZTThreadPool& pool = ZTThreadPool::instance();
+    const std::size_t restore = pool.get_num_threads();
+    std::vector<ZTBenchmarkResult> results;
+    char line[256];
+    for (std::size_t t : threads)
+    {
+        pool.set_num_threads(t);
+        const double stream = stream_triad();
+        stream_bandwidth[t] = stream;
+        std::snprintf(line, sizeof(line), "STREAM triad, %zu threads: %.2f GB/s (%s)\n", t, stream, ZTCpu::instruction_set_name());
+        log << line;
+        std::snprintf(line, sizeof(line), "%-52s %14s %12s %10s %10s %8s\n", "Benchmark", "Time", "Iterations", "GFLOP/s", "GB/s", "STREAM");
+        log << line << std::string(111, '-') << "\n";
+
+        for (ZTBenchmarkCase& c : cases)
+        {
+            ZTBenchmarkResult result;
+            result.operation = c.operation;
+            result.type = c.type;
+            result.elements = c.elements;
+            result.threads = t;
+            result.name = c.operation + "/" + c.type + "/" + std::to_string(c.elements) + "/threads:" + std::to_string(t);
+            if (!filter.empty() && result.name.find(filter) == std::string::npos)
+            {
+                continue;
+            }
+
+            c.setup();
+            c.run();  // warm up caches and workspaces
+            std::size_t iterations = 1;
+            for (;;)
+            {
+                const double seconds = time_batch(c.run, iterations);
+                if (seconds >= minimum_time || iterations >= (std::size_t(1) << 30))
+                {
+                    break;
+                }
+                // grow towards min_time like Google Benchmark, at most tenfold a step
+                const double estimate = seconds > 0.0 ? 1.4 * minimum_time / seconds : 10.0;
+                iterations = std::size_t(double(iterations) * std::min(std::max(estimate, 2.0), 10.0));
+            }
+            std::vector<double> times;
+            for (std::size_t r = 0; r < repetitions; ++r)
+            {
+                times.push_back(time_batch(c.run, iterations) / double(iterations));
+            }
+            c.release();
+
+            std::sort(times.begin(), times.end());
+            const double median = times.size() % 2 ? times[times.size() / 2] : 0.5 * (times[times.size() / 2 - 1] + times[times.size() / 2]);
+            result.iterations = iterations;
+            result.real_time = median * 1e9;
+            result.min_time = times.front() * 1e9;
+            result.gflops = c.flops / median / 1e9;
+            result.gbps = c.bytes / median / 1e9;
+            result.stream_fraction = stream > 0.0 ? result.gbps / stream : 0.0;
+            results.push_back(result);
+
+            std::snprintf(line, sizeof(line), "%-52s %11.0f ns %12zu %10.3f %10.3f %7.1f%%\n", result.name.c_str(),
+                          result.real_time, result.iterations, result.gflops, result.gbps, 100.0 * result.stream_fraction);
+            log << line;
+            log.flush();
+        }
+        log << "\n";
+    }
+    pool.set_num_threads(restore);
+    return results;
+
+}
+
+/**
+ * write_json : writes results in the layout read_json() reads, with the
+ *              machine and the STREAM bandwidths as context
+ *
+ * @param  std::ostream out
+ * @param  std::vector<ZTBenchmarkResult> results
+ * @param  std::map<std::size_t, double> stream GB/s by thread count
+ * @return nothing
+ *
+ */
+void ZTBenchmark::write_json(std::ostream& out, const std::vector<ZTBenchmarkResult>& results, const std::map<std::size_t, double>& stream) {
+
+    char line[512];
+    out << "{\n  \"context\": {\n";
+    out << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n";
+    out << "    \"instruction_set\": \"" << ZTCpu::instruction_set_name() << "\",\n";
+    out << "    \"stream_triad_gbps\": {";
+    for (auto it = stream.begin(); it != stream.end(); ++it)
+    {
+        std::snprintf(line, sizeof(line), "%s\"%zu\": %.3f", it == stream.begin() ? "" : ", ", it->first, it->second);
+        out << line;
+    }
+    out << "}\n  },\n  \"benchmarks\": [\n";
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        const ZTBenchmarkResult& r = results[i];
+        std::snprintf(line, sizeof(line),
+                      "    {\"name\": \"%s\", \"operation\": \"%s\", \"type\": \"%s\", \"elements\": %zu, \"threads\": %zu, "
+                      "\"iterations\": %zu, \"real_time\": %.3f, \"min_time\": %.3f, \"time_unit\": \"ns\", "
+                      "\"gflops\": %.6g, \"gbps\": %.6g, \"stream_fraction\": %.6g}%s\n",
+                      r.name.c_str(), r.operation.c_str(), r.type.c_str(), r.elements, r.threads,
+                      r.iterations, r.real_time, r.min_time, r.gflops, r.gbps, r.stream_fraction,
+                      i + 1 < results.size() ? "," : "");
+        out << line;
+    }
+    out << "  ]\n}\n";
+
+}
+
+/**
+ * read_json : reads the results of a file written by write_json()
+ *
+ * @param  std::string path
+ * @return std::vector<ZTBenchmarkResult> results
+ *
+ */
+std::vector<ZTBenchmarkResult> ZTBenchmark::read_json(const std::string& path) {
+
+    std::ifstream file(path);
+    if (!file)
+    {
+        zt_raise<std::runtime_error>("File " + path + " cannot be opened for reading!.");
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    const std::string text = buffer.str();
+
+    const std::size_t list = text.find("\"benchmarks\"");
+    std::size_t p = list == std::string::npos ? list : text.find('[', list);
+    const std::size_t end = p == std::string::npos ? p : text.find(']', p);
+    if (end == std::string::npos)
+    {
+        zt_raise<std::runtime_error>("File " + path + " has no benchmarks list!.");
+    }
+    std::vector<ZTBenchmarkResult> results;
+    while ((p = text.find('{', p)) < end)
+    {
+        const std::size_t close = text.find('}', p);
+        const std::string object = text.substr(p + 1, close - p - 1);
+        ZTBenchmarkResult r;
+        r.name = zt_benchmark_field(object, "name");
+        r.operation = zt_benchmark_field(object, "operation");
+        r.type = zt_benchmark_field(object, "type");
+        r.elements = std::strtoull(zt_benchmark_field(object, "elements").c_str(), nullptr, 10);
+        r.threads = std::strtoull(zt_benchmark_field(object, "threads").c_str(), nullptr, 10);
+        r.iterations = std::strtoull(zt_benchmark_field(object, "iterations").c_str(), nullptr, 10);
+        r.real_time = std::strtod(zt_benchmark_field(object, "real_time").c_str(), nullptr);
+        r.min_time = std::strtod(zt_benchmark_field(object, "min_time").c_str(), nullptr);
+        r.gflops = std::strtod(zt_benchmark_field(object, "gflops").c_str(), nullptr);
+        r.gbps = std::strtod(zt_benchmark_field(object, "gbps").c_str(), nullptr);
+        r.stream_fraction = std::strtod(zt_benchmark_field(object, "stream_fraction").c_str(), nullptr);
+        if (r.name.empty() || !(r.real_time > 0.0))
+        {
+            zt_raise<std::runtime_error>("File " + path + " has a benchmark without a name or a time!.");
+        }
+        results.push_back(r);
+        p = close;
+    }
+    return results;
+
+}
+
+/**
+ * compare : matches results to a baseline by name; a case regressed when
+ *           its time exceeds the baseline time by more than tolerance, as
+ *           a fraction. Cases missing from either side are left out
+ *
+ * @param  std::vector<ZTBenchmarkResult> current
+ * @param  std::vector<ZTBenchmarkResult> baseline
+ * @param  double tolerance e.g. 0.1 for ten percent
+ * @return std::vector<ZTBenchmarkComparison> comparisons in the order of current
+ *
+ */
+std::vector<ZTBenchmarkComparison> ZTBenchmark::compare(const std::vector<ZTBenchmarkResult>& current,
+                                                        const std::vector<ZTBenchmarkResult>& baseline, double tolerance) {
+
+    std::map<std::string, double> times;
+    for (const ZTBenchmarkResult& r : baseline)
+    {
+        times[r.name] = r.real_time;
+    }
+    std::vector<ZTBenchmarkComparison> comparisons;
+    for (const ZTBenchmarkResult& r : current)
+    {
+        const auto found = times.find(r.name);
+        if (found == times.end())
+        {
+            continue;
+        }
+        const double ratio = r.real_time / found->second;
+        comparisons.push_back({ r.name, found->second, r.real_time, ratio, ratio > 1.0 + tolerance });
+    }
+    return comparisons;
+
+}
+
+/**
+ * get_stream_bandwidth : gets the STREAM triad GB/s measured by run(), by
+ *                        thread count
+ *
+ * @param  nothing
+ * @return std::map<std::size_t, double>
+ *
+ */
+const std::map<std::size_t, double>& ZTBenchmark::get_stream_bandwidth() const {
+
+    return stream_bandwidth;
+
+}
@@ -0,0 +1,138 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ZTBENCHMARK_H
+#define ZTBENCHMARK_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <ostream>
+#include <functional>
+
+/*
+ * ZTBenchmarkResult : timing of one benchmark at one thread count. Times are
+ *                     nanoseconds per iteration, the median of the
+ *                     repetitions; rates derive from the flops and bytes
+ *                     one iteration needs at the least, so a kernel that
+ *                     moves more data than that shows a lower GB/s.
+ */
+struct ZTBenchmarkResult {
+    std::string name;          // operation/type/elements/threads:n, the key for comparisons
+    std::string operation;
+    std::string type;
+    std::size_t elements;
+    std::size_t threads;
+    std::size_t iterations;    // per repetition
+    double real_time;          // median
+    double min_time;
+    double gflops;
+    double gbps;
+    double stream_fraction;    // gbps over the STREAM triad at the same thread count
+};
+
+/*
+ * ZTBenchmarkComparison : a result against the baseline of the same name;
+ *                         ratio is the current time over the baseline time.
+ */
+struct ZTBenchmarkComparison {
+    std::string name;
+    double baseline_time;
+    double current_time;
+    double ratio;
+    bool regressed;
+};
+
+/*
+ * ZTBenchmark : micro-benchmark runner in the manner of Google Benchmark.
+ *               Each case doubles its iteration count until a batch runs
+ *               for at least min_time seconds, then times that batch
+ *               repetitions times and keeps the median. Cases are run at
+ *               every thread count of the shared ZTThreadPool, after a
+ *               STREAM triad at the same count has measured the memory
+ *               bandwidth the rates are held against.
+ *
+ *               Results are written as JSON that read_json() reads back, so
+ *               a stored run serves as the baseline of a later one;
+ *               compare() flags the cases that got slower than the
+ *               baseline by more than a relative tolerance.
+ */
+class ZTBenchmark {
+
+private:
+    struct ZTBenchmarkCase {
+        std::string operation;
+        std::string type;
+        std::size_t elements;
+        double flops;                  // per iteration
+        double bytes;                  // per iteration
+        std::function<void()> setup;   // allocates the operands, outside the timing
+        std::function<void()> run;     // one iteration
+        std::function<void()> release; // frees the operands
+    };
+
+    std::vector<ZTBenchmarkCase> cases;
+    double minimum_time;
+    std::size_t repetitions;
+    std::size_t stream_elements;
+    std::map<std::size_t, double> stream_bandwidth;  // GB/s by thread count
+
+    double time_batch(const std::function<void()>& run, std::size_t iterations) const;
+
+public:
+    ZTBenchmark(double min_time = 0.05, std::size_t repeats = 3, std::size_t stream_size = std::size_t(1) << 25);
+
+    void add(const std::string& operation, const std::string& type, std::size_t elements, double flops, double bytes,
+             const std::function<void()>& setup, const std::function<void()>& run, const std::function<void()>& release);
+    std::size_t size() const;
+
+    double stream_triad();  // GB/s at the current thread count, best of several runs
+    std::vector<ZTBenchmarkResult> run(const std::vector<std::size_t>& threads, const std::string& filter, std::ostream& log);
+
+    static void write_json(std::ostream& out, const std::vector<ZTBenchmarkResult>& results, const std::map<std::size_t, double>& stream);
+    static std::vector<ZTBenchmarkResult> read_json(const std::string& path);
+    static std::vector<ZTBenchmarkComparison> compare(const std::vector<ZTBenchmarkResult>& current,
+                                                      const std::vector<ZTBenchmarkResult>& baseline, double tolerance);
+
+    const std::map<std::size_t, double>& get_stream_bandwidth() const;
+
+};
+
+/**
+ * zt_benchmark_keep : keeps the compiler from discarding a value whose
+ *                     computation is being timed
+ *
+ * @param  U value
+ * @return nothing
+ *
+ */
+template <typename U>
+inline void zt_benchmark_keep(const U& value) {
+
+    asm volatile("" : : "r"(&value) : "memory");
+
+}
+
+#endif /* ZTBENCHMARK_H */
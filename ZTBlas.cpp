@@ -0,0 +1,1738 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstddef>
+#include <algorithm>
+
+#include "ZTBlas.h"
+#include "ZTCpu.h"
+#include "ZTSimd.h"
+
+/**
+ * zt_blas_scalar_add_scalar : performs z = x + alpha
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x input
+ * @param  T alpha scalar
+ * @param  T* z output (may alias x)
+ * @return nothing
+ *
+ */
+template <typename T>
+void zt_blas_scalar_add_scalar(std::size_t n, const T* x, T alpha, T* z) {
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        z[i] = x[i] + alpha;
+    }
+
+}
+
+/**
+ * zt_blas_scalar_multiply_scalar : performs z = alpha * x
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x input
+ * @param  T alpha scalar
+ * @param  T* z output (may alias x)
+ * @return nothing
+ *
+ */
+template <typename T>
+void zt_blas_scalar_multiply_scalar(std::size_t n, const T* x, T alpha, T* z) {
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        z[i] = x[i] * alpha;
+    }
+
+}
+
+/**
+ * zt_blas_scalar_add : performs z = x + y
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x first input
+ * @param  T* y second input
+ * @param  T* z output (may alias x or y)
+ * @return nothing
+ *
+ */
+template <typename T>
+void zt_blas_scalar_add(std::size_t n, const T* x, const T* y, T* z) {
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        z[i] = x[i] + y[i];
+    }
+
+}
+
+/**
+ * zt_blas_scalar_minus : performs z = x - y
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x first input
+ * @param  T* y second input
+ * @param  T* z output (may alias x or y)
+ * @return nothing
+ *
+ */
+template <typename T>
+void zt_blas_scalar_minus(std::size_t n, const T* x, const T* y, T* z) {
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        z[i] = x[i] - y[i];
+    }
+
+}
+
+/**
+ * zt_blas_scalar_axpy : performs y = alpha * x + y
+ *
+ * @param  std::size_t n number of elements
+ * @param  T alpha scalar
+ * @param  T* x input
+ * @param  T* y input and output
+ * @return nothing
+ *
+ */
+template <typename T>
+void zt_blas_scalar_axpy(std::size_t n, T alpha, const T* x, T* y) {
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        y[i] += alpha * x[i];
+    }
+
+}
+
+/**
+ * zt_blas_scalar_dot : performs the dot product x . y with four independent
+ *                      partial sums
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x first input
+ * @param  T* y second input
+ * @return T result
+ *
+ */
+template <typename T>
+T zt_blas_scalar_dot(std::size_t n, const T* x, const T* y) {
+
+    T s0 = T(0), s1 = T(0), s2 = T(0), s3 = T(0);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        s0 += x[i] * y[i];
+        s1 += x[i + 1] * y[i + 1];
+        s2 += x[i + 2] * y[i + 2];
+        s3 += x[i + 3] * y[i + 3];
+    }
+    for (; i < n; ++i)
+    {
+        s0 += x[i] * y[i];
+    }
+    return (s0 + s1) + (s2 + s3);
+
+}
+
+/**
+ * zt_blas_scalar_axpy_dot : performs y = alpha * x + y and returns y . y in
+ *                           the same pass
+ *
+ * @param  std::size_t n number of elements
+ * @param  T alpha scalar
+ * @param  T* x input
+ * @param  T* y input and output
+ * @return T result
+ *
+ */
+template <typename T>
+T zt_blas_scalar_axpy_dot(std::size_t n, T alpha, const T* x, T* y) {
+
+    T result = T(0);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        y[i] += alpha * x[i];
+        result += y[i] * y[i];
+    }
+    return result;
+
+}
+
+/**
+ * zt_blas_scalar_dot2 : performs x . y and x . z in one pass over x
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x shared input
+ * @param  T* y first input
+ * @param  T* z second input
+ * @param  T* result x . y and x . z
+ * @return nothing
+ *
+ */
+template <typename T>
+void zt_blas_scalar_dot2(std::size_t n, const T* x, const T* y, const T* z, T* result) {
+
+    T xy = T(0), xz = T(0);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        xy += x[i] * y[i];
+        xz += x[i] * z[i];
+    }
+    result[0] = xy;
+    result[1] = xz;
+
+}
+
+/**
+ * zt_blas_scalar_xpby : performs y = x + beta * y
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x input
+ * @param  T beta scalar
+ * @param  T* y input and output
+ * @return nothing
+ *
+ */
+template <typename T>
+void zt_blas_scalar_xpby(std::size_t n, const T* x, T beta, T* y) {
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        y[i] = x[i] + beta * y[i];
+    }
+
+}
+
+/**
+ * zt_blas_scalar_hadamard : performs the element-wise product z = x * y
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x input
+ * @param  T* y input
+ * @param  T* z output
+ * @return nothing
+ *
+ */
+template <typename T>
+void zt_blas_scalar_hadamard(std::size_t n, const T* x, const T* y, T* z) {
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        z[i] = x[i] * y[i];
+    }
+
+}
+
+/**
+ * zt_blas_scalar_hadamard_add : performs the element-wise z = x * y + z
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x input
+ * @param  T* y input
+ * @param  T* z input and output
+ * @return nothing
+ *
+ */
+template <typename T>
+void zt_blas_scalar_hadamard_add(std::size_t n, const T* x, const T* y, T* z) {
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        z[i] += x[i] * y[i];
+    }
+
+}
+
+#ifdef ZT_SIMD_X86
+
+/**
+ * zt_blas_sse2_add_scalar : SSE2 kernel for z = x + alpha
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x input
+ * @param  T alpha scalar
+ * @param  T* z output (may alias x)
+ * @return nothing
+ *
+ */
+template <typename T>
+ZT_SSE2_TARGET void zt_blas_sse2_add_scalar(std::size_t n, const T* x, T alpha, T* z) {
+
+    const std::size_t width = 16 / sizeof(T);
+    const auto a = zt_sse2_set1(alpha);
+    std::size_t i = 0;
+    for (; i + 2 * width <= n; i += 2 * width)
+    {
+        zt_sse2_store(z + i, zt_sse2_add(zt_sse2_load(x + i), a));
+        zt_sse2_store(z + i + width, zt_sse2_add(zt_sse2_load(x + i + width), a));
+    }
+    for (; i < n; ++i)
+    {
+        z[i] = x[i] + alpha;
+    }
+
+}
+
+/**
+ * zt_blas_sse2_multiply_scalar : SSE2 kernel for z = alpha * x
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x input
+ * @param  T alpha scalar
+ * @param  T* z output (may alias x)
+ * @return nothing
+ *
+ */
+template <typename T>
+ZT_SSE2_TARGET void zt_blas_sse2_multiply_scalar(std::size_t n, const T* x, T alpha, T* z) {
+
+    const std::size_t width = 16 / sizeof(T);
+    const auto a = zt_sse2_set1(alpha);
+    std::size_t i = 0;
+    for (; i + 2 * width <= n; i += 2 * width)
+    {
+        zt_sse2_store(z + i, zt_sse2_mul(zt_sse2_load(x + i), a));
+        zt_sse2_store(z + i + width, zt_sse2_mul(zt_sse2_load(x + i + width), a));
+    }
+    for (; i < n; ++i)
+    {
+        z[i] = x[i] * alpha;
+    }
+
+}
+
+/**
+ * zt_blas_sse2_add : SSE2 kernel for z = x + y
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x first input
+ * @param  T* y second input
+ * @param  T* z output (may alias x or y)
+ * @return nothing
+ *
+ */
+template <typename T>
+ZT_SSE2_TARGET void zt_blas_sse2_add(std::size_t n, const T* x, const T* y, T* z) {
+
+    const std::size_t width = 16 / sizeof(T);
+    std::size_t i = 0;
+    for (; i + 2 * width <= n; i += 2 * width)
+    {
+        zt_sse2_store(z + i, zt_sse2_add(zt_sse2_load(x + i), zt_sse2_load(y + i)));
+        zt_sse2_store(z + i + width, zt_sse2_add(zt_sse2_load(x + i + width), zt_sse2_load(y + i + width)));
+    }
+    for (; i < n; ++i)
+    {
+        z[i] = x[i] + y[i];
+    }
+
+}
+
+/**
+ * zt_blas_sse2_minus : SSE2 kernel for z = x - y
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x first input
+ * @param  T* y second input
+ * @param  T* z output (may alias x or y)
+ * @return nothing
+ *
+ */
+template <typename T>
+ZT_SSE2_TARGET void zt_blas_sse2_minus(std::size_t n, const T* x, const T* y, T* z) {
+
+    const std::size_t width = 16 / sizeof(T);
+    std::size_t i = 0;
+    for (; i + 2 * width <= n; i += 2 * width)
+    {
+        zt_sse2_store(z + i, zt_sse2_sub(zt_sse2_load(x + i), zt_sse2_load(y + i)));
+        zt_sse2_store(z + i + width, zt_sse2_sub(zt_sse2_load(x + i + width), zt_sse2_load(y + i + width)));
+    }
+    for (; i < n; ++i)
+    {
+        z[i] = x[i] - y[i];
+    }
+
+}
+
+/**
+ * zt_blas_sse2_axpy : SSE2 kernel for y = alpha * x + y
+ *
+ * @param  std::size_t n number of elements
+ * @param  T alpha scalar
+ * @param  T* x input
+ * @param  T* y input and output
+ * @return nothing
+ *
+ */
+template <typename T>
+ZT_SSE2_TARGET void zt_blas_sse2_axpy(std::size_t n, T alpha, const T* x, T* y) {
+
+    const std::size_t width = 16 / sizeof(T);
+    const auto a = zt_sse2_set1(alpha);
+    std::size_t i = 0;
+    for (; i + 2 * width <= n; i += 2 * width)
+    {
+        zt_sse2_store(y + i, zt_sse2_fmadd(a, zt_sse2_load(x + i), zt_sse2_load(y + i)));
+        zt_sse2_store(y + i + width, zt_sse2_fmadd(a, zt_sse2_load(x + i + width), zt_sse2_load(y + i + width)));
+    }
+    for (; i < n; ++i)
+    {
+        y[i] += alpha * x[i];
+    }
+
+}
+
+/**
+ * zt_blas_sse2_dot : SSE2 kernel for x . y, four accumulators hide the
+ *                     latency of the fused multiply-adds
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x first input
+ * @param  T* y second input
+ * @return T result
+ *
+ */
+template <typename T>
+ZT_SSE2_TARGET T zt_blas_sse2_dot(std::size_t n, const T* x, const T* y) {
+
+    const std::size_t width = 16 / sizeof(T);
+    auto s0 = zt_sse2_set1(T(0));
+    auto s1 = s0, s2 = s0, s3 = s0;
+    std::size_t i = 0;
+    for (; i + 4 * width <= n; i += 4 * width)
+    {
+        s0 = zt_sse2_fmadd(zt_sse2_load(x + i), zt_sse2_load(y + i), s0);
+        s1 = zt_sse2_fmadd(zt_sse2_load(x + i + width), zt_sse2_load(y + i + width), s1);
+        s2 = zt_sse2_fmadd(zt_sse2_load(x + i + 2 * width), zt_sse2_load(y + i + 2 * width), s2);
+        s3 = zt_sse2_fmadd(zt_sse2_load(x + i + 3 * width), zt_sse2_load(y + i + 3 * width), s3);
+    }
+    for (; i + width <= n; i += width)
+    {
+        s0 = zt_sse2_fmadd(zt_sse2_load(x + i), zt_sse2_load(y + i), s0);
+    }
+    T result = zt_sse2_sum(zt_sse2_add(zt_sse2_add(s0, s1), zt_sse2_add(s2, s3)));
+    for (; i < n; ++i)
+    {
+        result += x[i] * y[i];
+    }
+    return result;
+
+}
+
+/**
+ * zt_blas_sse2_axpy_dot : SSE2 kernel for y = alpha * x + y returning y . y, the
+ *                      updated y is squared while still in registers
+ *
+ * @param  std::size_t n number of elements
+ * @param  T alpha scalar
+ * @param  T* x input
+ * @param  T* y input and output
+ * @return T result
+ *
+ */
+template <typename T>
+ZT_SSE2_TARGET T zt_blas_sse2_axpy_dot(std::size_t n, T alpha, const T* x, T* y) {
+
+    const std::size_t width = 16 / sizeof(T);
+    const auto a = zt_sse2_set1(alpha);
+    auto s0 = zt_sse2_set1(T(0));
+    auto s1 = s0;
+    std::size_t i = 0;
+    for (; i + 2 * width <= n; i += 2 * width)
+    {
+        const auto y0 = zt_sse2_fmadd(a, zt_sse2_load(x + i), zt_sse2_load(y + i));
+        const auto y1 = zt_sse2_fmadd(a, zt_sse2_load(x + i + width), zt_sse2_load(y + i + width));
+        zt_sse2_store(y + i, y0);
+        zt_sse2_store(y + i + width, y1);
+        s0 = zt_sse2_fmadd(y0, y0, s0);
+        s1 = zt_sse2_fmadd(y1, y1, s1);
+    }
+    T result = zt_sse2_sum(zt_sse2_add(s0, s1));
+    for (; i < n; ++i)
+    {
+        y[i] += alpha * x[i];
+        result += y[i] * y[i];
+    }
+    return result;
+
+}
+
+/**
+ * zt_blas_sse2_dot2 : SSE2 kernel for x . y and x . z in one pass over x
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x shared input
+ * @param  T* y first input
+ * @param  T* z second input
+ * @param  T* result x . y and x . z
+ * @return nothing
+ *
+ */
+template <typename T>
+ZT_SSE2_TARGET void zt_blas_sse2_dot2(std::size_t n, const T* x, const T* y, const T* z, T* result) {
+
+    const std::size_t width = 16 / sizeof(T);
+    auto s0 = zt_sse2_set1(T(0));
+    auto s1 = s0, t0 = s0, t1 = s0;
+    std::size_t i = 0;
+    for (; i + 2 * width <= n; i += 2 * width)
+    {
+        const auto x0 = zt_sse2_load(x + i);
+        const auto x1 = zt_sse2_load(x + i + width);
+        s0 = zt_sse2_fmadd(x0, zt_sse2_load(y + i), s0);
+        s1 = zt_sse2_fmadd(x1, zt_sse2_load(y + i + width), s1);
+        t0 = zt_sse2_fmadd(x0, zt_sse2_load(z + i), t0);
+        t1 = zt_sse2_fmadd(x1, zt_sse2_load(z + i + width), t1);
+    }
+    T xy = zt_sse2_sum(zt_sse2_add(s0, s1));
+    T xz = zt_sse2_sum(zt_sse2_add(t0, t1));
+    for (; i < n; ++i)
+    {
+        xy += x[i] * y[i];
+        xz += x[i] * z[i];
+    }
+    result[0] = xy;
+    result[1] = xz;
+
+}
+
+/**
+ * zt_blas_sse2_xpby : SSE2 kernel for y = x + beta * y
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x input
+ * @param  T beta scalar
+ * @param  T* y input and output
+ * @return nothing
+ *
+ */
+template <typename T>
+ZT_SSE2_TARGET void zt_blas_sse2_xpby(std::size_t n, const T* x, T beta, T* y) {
+
+    const std::size_t width = 16 / sizeof(T);
+    const auto b = zt_sse2_set1(beta);
+    std::size_t i = 0;
+    for (; i + 2 * width <= n; i += 2 * width)
+    {
+        zt_sse2_store(y + i, zt_sse2_fmadd(b, zt_sse2_load(y + i), zt_sse2_load(x + i)));
+        zt_sse2_store(y + i + width, zt_sse2_fmadd(b, zt_sse2_load(y + i + width), zt_sse2_load(x + i + width)));
+    }
+    for (; i < n; ++i)
+    {
+        y[i] = x[i] + beta * y[i];
+    }
+
+}
+
+/**
+ * zt_blas_sse2_hadamard : SSE2 kernel for the element-wise product z = x * y
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x input
+ * @param  T* y input
+ * @param  T* z output
+ * @return nothing
+ *
+ */
+template <typename T>
+ZT_SSE2_TARGET void zt_blas_sse2_hadamard(std::size_t n, const T* x, const T* y, T* z) {
+
+    const std::size_t width = 16 / sizeof(T);
+    std::size_t i = 0;
+    for (; i + 2 * width <= n; i += 2 * width)
+    {
+        zt_sse2_store(z + i, zt_sse2_mul(zt_sse2_load(x + i), zt_sse2_load(y + i)));
+        zt_sse2_store(z + i + width, zt_sse2_mul(zt_sse2_load(x + i + width), zt_sse2_load(y + i + width)));
+    }
+    for (; i < n; ++i)
+    {
+        z[i] = x[i] * y[i];
+    }
+
+}
+
+/**
+ * zt_blas_sse2_hadamard_add : SSE2 kernel for the element-wise z = x * y + z
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x input
+ * @param  T* y input
+ * @param  T* z input and output
+ * @return nothing
+ *
+ */
+template <typename T>
+ZT_SSE2_TARGET void zt_blas_sse2_hadamard_add(std::size_t n, const T* x, const T* y, T* z) {
+
+    const std::size_t width = 16 / sizeof(T);
+    std::size_t i = 0;
+    for (; i + 2 * width <= n; i += 2 * width)
+    {
+        zt_sse2_store(z + i, zt_sse2_fmadd(zt_sse2_load(x + i), zt_sse2_load(y + i), zt_sse2_load(z + i)));
+        zt_sse2_store(z + i + width, zt_sse2_fmadd(zt_sse2_load(x + i + width), zt_sse2_load(y + i + width), zt_sse2_load(z + i + width)));
+    }
+    for (; i < n; ++i)
+    {
+        z[i] += x[i] * y[i];
+    }
+
+}
+
+/**
+ * zt_blas_avx2_add_scalar : AVX2/FMA kernel for z = x + alpha
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x input
+ * @param  T alpha scalar
+ * @param  T* z output (may alias x)
+ * @return nothing
+ *
+ */
+template <typename T>
+ZT_AVX2_TARGET void zt_blas_avx2_add_scalar(std::size_t n, const T* x, T alpha, T* z) {
+
+    const std::size_t width = 32 / sizeof(T);
+    const auto a = zt_avx2_set1(alpha);
+    std::size_t i = 0;
+    for (; i + 2 * width <= n; i += 2 * width)
+    {
+        zt_avx2_store(z + i, zt_avx2_add(zt_avx2_load(x + i), a));
+        zt_avx2_store(z + i + width, zt_avx2_add(zt_avx2_load(x + i + width), a));
+    }
+    for (; i < n; ++i)
+    {
+        z[i] = x[i] + alpha;
+    }
+
+}
+
+/**
+ * zt_blas_avx2_multiply_scalar : AVX2/FMA kernel for z = alpha * x
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x input
+ * @param  T alpha scalar
+ * @param  T* z output (may alias x)
+ * @return nothing
+ *
+ */
+template <typename T>
+ZT_AVX2_TARGET void zt_blas_avx2_multiply_scalar(std::size_t n, const T* x, T alpha, T* z) {
+
+    const std::size_t width = 32 / sizeof(T);
+    const auto a = zt_avx2_set1(alpha);
+    std::size_t i = 0;
+    for (; i + 2 * width <= n; i += 2 * width)
+    {
+        zt_avx2_store(z + i, zt_avx2_mul(zt_avx2_load(x + i), a));
+        zt_avx2_store(z + i + width, zt_avx2_mul(zt_avx2_load(x + i + width), a));
+    }
+    for (; i < n; ++i)
+    {
+        z[i] = x[i] * alpha;
+    }
+
+}
+
+/**
+ * zt_blas_avx2_add : AVX2/FMA kernel for z = x + y
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x first input
+ * @param  T* y second input
+ * @param  T* z output (may alias x or y)
+ * @return nothing
+ *
+ */
+template <typename T>
+ZT_AVX2_TARGET void zt_blas_avx2_add(std::size_t n, const T* x, const T* y, T* z) {
+
+    const std::size_t width = 32 / sizeof(T);
+    std::size_t i = 0;
+    for (; i + 2 * width <= n; i += 2 * width)
+    {
+        zt_avx2_store(z + i, zt_avx2_add(zt_avx2_load(x + i), zt_avx2_load(y + i)));
+        zt_avx2_store(z + i + width, zt_avx2_add(zt_avx2_load(x + i + width), zt_avx2_load(y + i + width)));
+    }
+    for (; i < n; ++i)
+    {
+        z[i] = x[i] + y[i];
+    }
+
+}
+
+/**
+ * zt_blas_avx2_minus : AVX2/FMA kernel for z = x - y
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x first input
+ * @param  T* y second input
+ * @param  T* z output (may alias x or y)
+ * @return nothing
+ *
+ */
+template <typename T>
+ZT_AVX2_TARGET void zt_blas_avx2_minus(std::size_t n, const T* x, const T* y, T* z) {
+
+    const std::size_t width = 32 / sizeof(T);
+    std::size_t i = 0;
+    for (; i + 2 * width <= n; i += 2 * width)
+    {
+        zt_avx2_store(z + i, zt_avx2_sub(zt_avx2_load(x + i), zt_avx2_load(y + i)));
+        zt_avx2_store(z + i + width, zt_avx2_sub(zt_avx2_load(x + i + width), zt_avx2_load(y + i + width)));
+    }
+    for (; i < n; ++i)
+    {
+        z[i] = x[i] - y[i];
+    }
+
+}
+
+/**
+ * zt_blas_avx2_axpy : AVX2/FMA kernel for y = alpha * x + y
+ *
+ * @param  std::size_t n number of elements
+ * @param  T alpha scalar
+ * @param  T* x input
+ * @param  T* y input and output
+ * @return nothing
+ *
+ */
+template <typename T>
+ZT_AVX2_TARGET void zt_blas_avx2_axpy(std::size_t n, T alpha, const T* x, T* y) {
+
+    const std::size_t width = 32 / sizeof(T);
+    const auto a = zt_avx2_set1(alpha);
+    std::size_t i = 0;
+    for (; i + 2 * width <= n; i += 2 * width)
+    {
+        zt_avx2_store(y + i, zt_avx2_fmadd(a, zt_avx2_load(x + i), zt_avx2_load(y + i)));
+        zt_avx2_store(y + i + width, zt_avx2_fmadd(a, zt_avx2_load(x + i + width), zt_avx2_load(y + i + width)));
+    }
+    for (; i < n; ++i)
+    {
+        y[i] += alpha * x[i];
+    }
+
+}
+
+/**
+ * zt_blas_avx2_dot : AVX2/FMA kernel for x . y, four accumulators hide the
+ *                     latency of the fused multiply-adds
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x first input
+ * @param  T* y second input
+ * @return T result
+ *
+ */
+template <typename T>
+ZT_AVX2_TARGET T zt_blas_avx2_dot(std::size_t n, const T* x, const T* y) {
+
+    const std::size_t width = 32 / sizeof(T);
+    auto s0 = zt_avx2_set1(T(0));
+    auto s1 = s0, s2 = s0, s3 = s0;
+    std::size_t i = 0;
+    for (; i + 4 * width <= n; i += 4 * width)
+    {
+        s0 = zt_avx2_fmadd(zt_avx2_load(x + i), zt_avx2_load(y + i), s0);
+        s1 = zt_avx2_fmadd(zt_avx2_load(x + i + width), zt_avx2_load(y + i + width), s1);
+        s2 = zt_avx2_fmadd(zt_avx2_load(x + i + 2 * width), zt_avx2_load(y + i + 2 * width), s2);
+        s3 = zt_avx2_fmadd(zt_avx2_load(x + i + 3 * width), zt_avx2_load(y + i + 3 * width), s3);
+    }
+    for (; i + width <= n; i += width)
+    {
+        s0 = zt_avx2_fmadd(zt_avx2_load(x + i), zt_avx2_load(y + i), s0);
+    }
+    T result = zt_avx2_sum(zt_avx2_add(zt_avx2_add(s0, s1), zt_avx2_add(s2, s3)));
+    for (; i < n; ++i)
+    {
+        result += x[i] * y[i];
+    }
+    return result;
+
+}
+
+/**
+ * zt_blas_avx2_axpy_dot : AVX2/FMA kernel for y = alpha * x + y returning y . y, the
+ *                      updated y is squared while still in registers
+ *
+ * @param  std::size_t n number of elements
+ * @param  T alpha scalar
+ * @param  T* x input
+ * @param  T* y input and output
+ * @return T result
+ *
+ */
+template <typename T>
+ZT_AVX2_TARGET T zt_blas_avx2_axpy_dot(std::size_t n, T alpha, const T* x, T* y) {
+
+    const std::size_t width = 32 / sizeof(T);
+    const auto a = zt_avx2_set1(alpha);
+    auto s0 = zt_avx2_set1(T(0));
+    auto s1 = s0;
+    std::size_t i = 0;
+    for (; i + 2 * width <= n; i += 2 * width)
+    {
+        const auto y0 = zt_avx2_fmadd(a, zt_avx2_load(x + i), zt_avx2_load(y + i));
+        const auto y1 = zt_avx2_fmadd(a, zt_avx2_load(x + i + width), zt_avx2_load(y + i + width));
+        zt_avx2_store(y + i, y0);
+        zt_avx2_store(y + i + width, y1);
+        s0 = zt_avx2_fmadd(y0, y0, s0);
+        s1 = zt_avx2_fmadd(y1, y1, s1);
+    }
+    T result = zt_avx2_sum(zt_avx2_add(s0, s1));
+    for (; i < n; ++i)
+    {
+        y[i] += alpha * x[i];
+        result += y[i] * y[i];
+    }
+    return result;
+
+}
+
+/**
+ * zt_blas_avx2_dot2 : AVX2/FMA kernel for x . y and x . z in one pass over x
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x shared input
+ * @param  T* y first input
+ * @param  T* z second input
+ * @param  T* result x . y and x . z
+ * @return nothing
+ *
+ */
+template <typename T>
+ZT_AVX2_TARGET void zt_blas_avx2_dot2(std::size_t n, const T* x, const T* y, const T* z, T* result) {
+
+    const std::size_t width = 32 / sizeof(T);
+    auto s0 = zt_avx2_set1(T(0));
+    auto s1 = s0, t0 = s0, t1 = s0;
+    std::size_t i = 0;
+    for (; i + 2 * width <= n; i += 2 * width)
+    {
+        const auto x0 = zt_avx2_load(x + i);
+        const auto x1 = zt_avx2_load(x + i + width);
+        s0 = zt_avx2_fmadd(x0, zt_avx2_load(y + i), s0);
+        s1 = zt_avx2_fmadd(x1, zt_avx2_load(y + i + width), s1);
+        t0 = zt_avx2_fmadd(x0, zt_avx2_load(z + i), t0);
+        t1 = zt_avx2_fmadd(x1, zt_avx2_load(z + i + width), t1);
+    }
+    T xy = zt_avx2_sum(zt_avx2_add(s0, s1));
+    T xz = zt_avx2_sum(zt_avx2_add(t0, t1));
+    for (; i < n; ++i)
+    {
+        xy += x[i] * y[i];
+        xz += x[i] * z[i];
+    }
+    result[0] = xy;
+    result[1] = xz;
+
+}
+
+/**
+ * zt_blas_avx2_xpby : AVX2/FMA kernel for y = x + beta * y
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x input
+ * @param  T beta scalar
+ * @param  T* y input and output
+ * @return nothing
+ *
+ */
+template <typename T>
+ZT_AVX2_TARGET void zt_blas_avx2_xpby(std::size_t n, const T* x, T beta, T* y) {
+
+    const std::size_t width = 32 / sizeof(T);
+    const auto b = zt_avx2_set1(beta);
+    std::size_t i = 0;
+    for (; i + 2 * width <= n; i += 2 * width)
+    {
+        zt_avx2_store(y + i, zt_avx2_fmadd(b, zt_avx2_load(y + i), zt_avx2_load(x + i)));
+        zt_avx2_store(y + i + width, zt_avx2_fmadd(b, zt_avx2_load(y + i + width), zt_avx2_load(x + i + width)));
+    }
+    for (; i < n; ++i)
+    {
+        y[i] = x[i] + beta * y[i];
+    }
+
+}
+
+/**
+ * zt_blas_avx2_hadamard : AVX2/FMA kernel for the element-wise product z = x * y
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x input
+ * @param  T* y input
+ * @param  T* z output
+ * @return nothing
+ *
+ */
+template <typename T>
+ZT_AVX2_TARGET void zt_blas_avx2_hadamard(std::size_t n, const T* x, const T* y, T* z) {
+
+    const std::size_t width = 32 / sizeof(T);
+    std::size_t i = 0;
+    for (; i + 2 * width <= n; i += 2 * width)
+    {
+        zt_avx2_store(z + i, zt_avx2_mul(zt_avx2_load(x + i), zt_avx2_load(y + i)));
+        zt_avx2_store(z + i + width, zt_avx2_mul(zt_avx2_load(x + i + width), zt_avx2_load(y + i + width)));
+    }
+    for (; i < n; ++i)
+    {
+        z[i] = x[i] * y[i];
+    }
+
+}
+
+/**
+ * zt_blas_avx2_hadamard_add : AVX2/FMA kernel for the element-wise z = x * y + z
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x input
+ * @param  T* y input
+ * @param  T* z input and output
+ * @return nothing
+ *
+ */
+template <typename T>
+ZT_AVX2_TARGET void zt_blas_avx2_hadamard_add(std::size_t n, const T* x, const T* y, T* z) {
+
+    const std::size_t width = 32 / sizeof(T);
+    std::size_t i = 0;
+    for (; i + 2 * width <= n; i += 2 * width)
+    {
+        zt_avx2_store(z + i, zt_avx2_fmadd(zt_avx2_load(x + i), zt_avx2_load(y + i), zt_avx2_load(z + i)));
+        zt_avx2_store(z + i + width, zt_avx2_fmadd(zt_avx2_load(x + i + width), zt_avx2_load(y + i + width), zt_avx2_load(z + i + width)));
+    }
+    for (; i < n; ++i)
+    {
+        z[i] += x[i] * y[i];
+    }
+
+}
+
+/**
+ * zt_blas_avx512_add_scalar : AVX-512 kernel for z = x + alpha
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x input
+ * @param  T alpha scalar
+ * @param  T* z output (may alias x)
+ * @return nothing
+ *
+ */
+template <typename T>
+ZT_AVX512_TARGET void zt_blas_avx512_add_scalar(std::size_t n, const T* x, T alpha, T* z) {
+
+    const std::size_t width = 64 / sizeof(T);
+    const auto a = zt_avx512_set1(alpha);
+    std::size_t i = 0;
+    for (; i + 2 * width <= n; i += 2 * width)
+    {
+        zt_avx512_store(z + i, zt_avx512_add(zt_avx512_load(x + i), a));
+        zt_avx512_store(z + i + width, zt_avx512_add(zt_avx512_load(x + i + width), a));
+    }
+    for (; i < n; ++i)
+    {
+        z[i] = x[i] + alpha;
+    }
+
+}
+
+/**
+ * zt_blas_avx512_multiply_scalar : AVX-512 kernel for z = alpha * x
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x input
+ * @param  T alpha scalar
+ * @param  T* z output (may alias x)
+ * @return nothing
+ *
+ */
+template <typename T>
+ZT_AVX512_TARGET void zt_blas_avx512_multiply_scalar(std::size_t n, const T* x, T alpha, T* z) {
+
+    const std::size_t width = 64 / sizeof(T);
+    const auto a = zt_avx512_set1(alpha);
+    std::size_t i = 0;
+    for (; i + 2 * width <= n; i += 2 * width)
+    {
+        zt_avx512_store(z + i, zt_avx512_mul(zt_avx512_load(x + i), a));
+        zt_avx512_store(z + i + width, zt_avx512_mul(zt_avx512_load(x + i + width), a));
+    }
+    for (; i < n; ++i)
+    {
+        z[i] = x[i] * alpha;
+    }
+
+}
+
+/**
+ * zt_blas_avx512_add : AVX-512 kernel for z = x + y
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x first input
+ * @param  T* y second input
+ * @param  T* z output (may alias x or y)
+ * @return nothing
+ *
+ */
+template <typename T>
+ZT_AVX512_TARGET void zt_blas_avx512_add(std::size_t n, const T* x, const T* y, T* z) {
+
+    const std::size_t width = 64 / sizeof(T);
+    std::size_t i = 0;
+    for (; i + 2 * width <= n; i += 2 * width)
+    {
+        zt_avx512_store(z + i, zt_avx512_add(zt_avx512_load(x + i), zt_avx512_load(y + i)));
+        zt_avx512_store(z + i + width, zt_avx512_add(zt_avx512_load(x + i + width), zt_avx512_load(y + i + width)));
+    }
+    for (; i < n; ++i)
+    {
+        z[i] = x[i] + y[i];
+    }
+
+}
+
+/**
+ * zt_blas_avx512_minus : AVX-512 kernel for z = x - y
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x first input
+ * @param  T* y second input
+ * @param  T* z output (may alias x or y)
+ * @return nothing
+ *
+ */
+template <typename T>
+ZT_AVX512_TARGET void zt_blas_avx512_minus(std::size_t n, const T* x, const T* y, T* z) {
+
+    const std::size_t width = 64 / sizeof(T);
+    std::size_t i = 0;
+    for (; i + 2 * width <= n; i += 2 * width)
+    {
+        zt_avx512_store(z + i, zt_avx512_sub(zt_avx512_load(x + i), zt_avx512_load(y + i)));
+        zt_avx512_store(z + i + width, zt_avx512_sub(zt_avx512_load(x + i + width), zt_avx512_load(y + i + width)));
+    }
+    for (; i < n; ++i)
+    {
+        z[i] = x[i] - y[i];
+    }
+
+}
+
+/**
+ * zt_blas_avx512_axpy : AVX-512 kernel for y = alpha * x + y
+ *
+ * @param  std::size_t n number of elements
+ * @param  T alpha scalar
+ * @param  T* x input
+ * @param  T* y input and output
+ * @return nothing
+ *
+ */
+template <typename T>
+ZT_AVX512_TARGET void zt_blas_avx512_axpy(std::size_t n, T alpha, const T* x, T* y) {
+
+    const std::size_t width = 64 / sizeof(T);
+    const auto a = zt_avx512_set1(alpha);
+    std::size_t i = 0;
+    for (; i + 2 * width <= n; i += 2 * width)
+    {
+        zt_avx512_store(y + i, zt_avx512_fmadd(a, zt_avx512_load(x + i), zt_avx512_load(y + i)));
+        zt_avx512_store(y + i + width, zt_avx512_fmadd(a, zt_avx512_load(x + i + width), zt_avx512_load(y + i + width)));
+    }
+    for (; i < n; ++i)
+    {
+        y[i] += alpha * x[i];
+    }
+
+}
+
+/**
+ * zt_blas_avx512_dot : AVX-512 kernel for x . y, four accumulators hide the
+ *                     latency of the fused multiply-adds
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x first input
+ * @param  T* y second input
+ * @return T result
+ *
+ */
+template <typename T>
+ZT_AVX512_TARGET T zt_blas_avx512_dot(std::size_t n, const T* x, const T* y) {
+
+    const std::size_t width = 64 / sizeof(T);
+    auto s0 = zt_avx512_set1(T(0));
+    auto s1 = s0, s2 = s0, s3 = s0;
+    std::size_t i = 0;
+    for (; i + 4 * width <= n; i += 4 * width)
+    {
+        s0 = zt_avx512_fmadd(zt_avx512_load(x + i), zt_avx512_load(y + i), s0);
+        s1 = zt_avx512_fmadd(zt_avx512_load(x + i + width), zt_avx512_load(y + i + width), s1);
+        s2 = zt_avx512_fmadd(zt_avx512_load(x + i + 2 * width), zt_avx512_load(y + i + 2 * width), s2);
+        s3 = zt_avx512_fmadd(zt_avx512_load(x + i + 3 * width), zt_avx512_load(y + i + 3 * width), s3);
+    }
+    for (; i + width <= n; i += width)
+    {
+        s0 = zt_avx512_fmadd(zt_avx512_load(x + i), zt_avx512_load(y + i), s0);
+    }
+    T result = zt_avx512_sum(zt_avx512_add(zt_avx512_add(s0, s1), zt_avx512_add(s2, s3)));
+    for (; i < n; ++i)
+    {
+        result += x[i] * y[i];
+    }
+    return result;
+
+}
+
+/**
+ * zt_blas_avx512_axpy_dot : AVX-512 kernel for y = alpha * x + y returning y . y, the
+ *                      updated y is squared while still in registers
+ *
+ * @param  std::size_t n number of elements
+ * @param  T alpha scalar
+ * @param  T* x input
+ * @param  T* y input and output
+ * @return T result
+ *
+ */
+template <typename T>
+ZT_AVX512_TARGET T zt_blas_avx512_axpy_dot(std::size_t n, T alpha, const T* x, T* y) {
+
+    const std::size_t width = 64 / sizeof(T);
+    const auto a = zt_avx512_set1(alpha);
+    auto s0 = zt_avx512_set1(T(0));
+    auto s1 = s0;
+    std::size_t i = 0;
+    for (; i + 2 * width <= n; i += 2 * width)
+    {
+        const auto y0 = zt_avx512_fmadd(a, zt_avx512_load(x + i), zt_avx512_load(y + i));
+        const auto y1 = zt_avx512_fmadd(a, zt_avx512_load(x + i + width), zt_avx512_load(y + i + width));
+        zt_avx512_store(y + i, y0);
+        zt_avx512_store(y + i + width, y1);
+        s0 = zt_avx512_fmadd(y0, y0, s0);
+        s1 = zt_avx512_fmadd(y1, y1, s1);
+    }
+    T result = zt_avx512_sum(zt_avx512_add(s0, s1));
+    for (; i < n; ++i)
+    {
+        y[i] += alpha * x[i];
+        result += y[i] * y[i];
+    }
+    return result;
+
+}
+
+/**
+ * zt_blas_avx512_dot2 : AVX-512 kernel for x . y and x . z in one pass over x
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x shared input
+ * @param  T* y first input
+ * @param  T* z second input
+ * @param  T* result x . y and x . z
+ * @return nothing
+ *
+ */
+template <typename T>
+ZT_AVX512_TARGET void zt_blas_avx512_dot2(std::size_t n, const T* x, const T* y, const T* z, T* result) {
+
+    const std::size_t width = 64 / sizeof(T);
+    auto s0 = zt_avx512_set1(T(0));
+    auto s1 = s0, t0 = s0, t1 = s0;
+    std::size_t i = 0;
+    for (; i + 2 * width <= n; i += 2 * width)
+    {
+        const auto x0 = zt_avx512_load(x + i);
+        const auto x1 = zt_avx512_load(x + i + width);
+        s0 = zt_avx512_fmadd(x0, zt_avx512_load(y + i), s0);
+        s1 = zt_avx512_fmadd(x1, zt_avx512_load(y + i + width), s1);
+        t0 = zt_avx512_fmadd(x0, zt_avx512_load(z + i), t0);
+        t1 = zt_avx512_fmadd(x1, zt_avx512_load(z + i + width), t1);
+    }
+    T xy = zt_avx512_sum(zt_avx512_add(s0, s1));
+    T xz = zt_avx512_sum(zt_avx512_add(t0, t1));
+    for (; i < n; ++i)
+    {
+        xy += x[i] * y[i];
+        xz += x[i] * z[i];
+    }
+    result[0] = xy;
+    result[1] = xz;
+
+}
+
+/**
+ * zt_blas_avx512_xpby : AVX-512 kernel for y = x + beta * y
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x input
+ * @param  T beta scalar
+ * @param  T* y input and output
+ * @return nothing
+ *
+ */
+template <typename T>
+ZT_AVX512_TARGET void zt_blas_avx512_xpby(std::size_t n, const T* x, T beta, T* y) {
+
+    const std::size_t width = 64 / sizeof(T);
+    const auto b = zt_avx512_set1(beta);
+    std::size_t i = 0;
+    for (; i + 2 * width <= n; i += 2 * width)
+    {
+        zt_avx512_store(y + i, zt_avx512_fmadd(b, zt_avx512_load(y + i), zt_avx512_load(x + i)));
+        zt_avx512_store(y + i + width, zt_avx512_fmadd(b, zt_avx512_load(y + i + width), zt_avx512_load(x + i + width)));
+    }
+    for (; i < n; ++i)
+    {
+        y[i] = x[i] + beta * y[i];
+    }
+
+}
+
+/**
+ * zt_blas_avx512_hadamard : AVX-512 kernel for the element-wise product z = x * y
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x input
+ * @param  T* y input
+ * @param  T* z output
+ * @return nothing
+ *
+ */
+template <typename T>
+ZT_AVX512_TARGET void zt_blas_avx512_hadamard(std::size_t n, const T* x, const T* y, T* z) {
+
+    const std::size_t width = 64 / sizeof(T);
+    std::size_t i = 0;
+    for (; i + 2 * width <= n; i += 2 * width)
+    {
+        zt_avx512_store(z + i, zt_avx512_mul(zt_avx512_load(x + i), zt_avx512_load(y + i)));
+        zt_avx512_store(z + i + width, zt_avx512_mul(zt_avx512_load(x + i + width), zt_avx512_load(y + i + width)));
+    }
+    for (; i < n; ++i)
+    {
+        z[i] = x[i] * y[i];
+    }
+
+}
+
+/**
+ * zt_blas_avx512_hadamard_add : AVX-512 kernel for the element-wise z = x * y + z
+ *
+ * @param  std::size_t n number of elements
+ * @param  T* x input
+ * @param  T* y input
+ * @param  T* z input and output
+ * @return nothing
+ *
+ */
+template <typename T>
+ZT_AVX512_TARGET void zt_blas_avx512_hadamard_add(std::size_t n, const T* x, const T* y, T* z) {
+
+    const std::size_t width = 64 / sizeof(T);
+    std::size_t i = 0;
+    for (; i + 2 * width <= n; i += 2 * width)
+    {
+        zt_avx512_store(z + i, zt_avx512_fmadd(zt_avx512_load(x + i), zt_avx512_load(y + i), zt_avx512_load(z + i)));
+        zt_avx512_store(z + i + width, zt_avx512_fmadd(zt_avx512_load(x + i + width), zt_avx512_load(y + i + width), zt_avx512_load(z + i + width)));
+    }
+    for (; i < n; ++i)
+    {
+        z[i] += x[i] * y[i];
+    }
+
+}
+
+#endif /* ZT_SIMD_X86 */
+
+/**
+ * zt_blas_select_float_kernels : fills the kernel table for float or double
+ *                                with the widest instruction set available
+ *
+ * @param  nothing
+ * @return ZTBlasKernels<T> kernels
+ *
+ */
+template <typename T>
+ZTBlasKernels<T> zt_blas_select_float_kernels() {
+
+    ZTBlasKernels<T> k = {
+        zt_blas_scalar_add_scalar<T>, zt_blas_scalar_multiply_scalar<T>,
+        zt_blas_scalar_add<T>, zt_blas_scalar_minus<T>,
+        zt_blas_scalar_axpy<T>, zt_blas_scalar_dot<T>,
+        zt_blas_scalar_axpy_dot<T>, zt_blas_scalar_dot2<T>, zt_blas_scalar_xpby<T>,
+        zt_blas_scalar_hadamard<T>, zt_blas_scalar_hadamard_add<T>, ZT_ISA_SCALAR
+    };
+#ifdef ZT_SIMD_X86
+    switch (ZTCpu::instruction_set())
+    {
+        case ZT_ISA_AVX512:
+        {
+            ZTBlasKernels<T> avx512 = {
+                zt_blas_avx512_add_scalar<T>, zt_blas_avx512_multiply_scalar<T>,
+                zt_blas_avx512_add<T>, zt_blas_avx512_minus<T>,
+                zt_blas_avx512_axpy<T>, zt_blas_avx512_dot<T>,
+        zt_blas_avx512_axpy_dot<T>, zt_blas_avx512_dot2<T>, zt_blas_avx512_xpby<T>,
+        zt_blas_avx512_hadamard<T>, zt_blas_avx512_hadamard_add<T>, ZT_ISA_AVX512
+            };
+            return avx512;
+        }
+        case ZT_ISA_AVX2:
+        {
+            ZTBlasKernels<T> avx2 = {
+                zt_blas_avx2_add_scalar<T>, zt_blas_avx2_multiply_scalar<T>,
+                zt_blas_avx2_add<T>, zt_blas_avx2_minus<T>,
+                zt_blas_avx2_axpy<T>, zt_blas_avx2_dot<T>,
+        zt_blas_avx2_axpy_dot<T>, zt_blas_avx2_dot2<T>, zt_blas_avx2_xpby<T>,
+        zt_blas_avx2_hadamard<T>, zt_blas_avx2_hadamard_add<T>, ZT_ISA_AVX2
+            };
+            return avx2;
+        }
+        case ZT_ISA_SSE2:
+        {
+            ZTBlasKernels<T> sse2 = {
+                zt_blas_sse2_add_scalar<T>, zt_blas_sse2_multiply_scalar<T>,
+                zt_blas_sse2_add<T>, zt_blas_sse2_minus<T>,
+                zt_blas_sse2_axpy<T>, zt_blas_sse2_dot<T>,
+        zt_blas_sse2_axpy_dot<T>, zt_blas_sse2_dot2<T>, zt_blas_sse2_xpby<T>,
+        zt_blas_sse2_hadamard<T>, zt_blas_sse2_hadamard_add<T>, ZT_ISA_SSE2
+            };
+            return sse2;
+        }
+        default:
+            break;
+    }
+#endif
+    return k;
+
+}
+
+/**
+ * zt_blas_widened_add_scalar : z = x + alpha for a 16-bit storage type, in
+ *                              float blocks
+ *
+ * @param  std::size_t n number of elements
+ * @param  S* x input
+ * @param  S alpha scalar
+ * @param  S* z output
+ * @return nothing
+ *
+ */
+template <typename S>
+void zt_blas_widened_add_scalar(std::size_t n, const S* x, S alpha, S* z) {
+
+    const ZTBlasKernels<float>& blas = ZTBlas<float>::kernels();
+    alignas(64) float wx[ZTHalfConvert::chunk_size];
+    for (std::size_t i = 0; i < n; i += ZTHalfConvert::chunk_size)
+    {
+        const std::size_t len = std::min<std::size_t>(ZTHalfConvert::chunk_size, n - i);
+        ZTHalfConvert::widen(len, x + i, wx);
+        blas.add_scalar(len, wx, float(alpha), wx);
+        ZTHalfConvert::narrow(len, wx, z + i);
+    }
+
+}
+
+/**
+ * zt_blas_widened_multiply_scalar : z = alpha * x for a 16-bit storage
+ *                                   type, in float blocks
+ *
+ * @param  std::size_t n number of elements
+ * @param  S* x input
+ * @param  S alpha scalar
+ * @param  S* z output
+ * @return nothing
+ *
+ */
+template <typename S>
+void zt_blas_widened_multiply_scalar(std::size_t n, const S* x, S alpha, S* z) {
+
+    const ZTBlasKernels<float>& blas = ZTBlas<float>::kernels();
+    alignas(64) float wx[ZTHalfConvert::chunk_size];
+    for (std::size_t i = 0; i < n; i += ZTHalfConvert::chunk_size)
+    {
+        const std::size_t len = std::min<std::size_t>(ZTHalfConvert::chunk_size, n - i);
+        ZTHalfConvert::widen(len, x + i, wx);
+        blas.multiply_scalar(len, wx, float(alpha), wx);
+        ZTHalfConvert::narrow(len, wx, z + i);
+    }
+
+}
+
+/**
+ * zt_blas_widened_add : z = x + y for a 16-bit storage type, in float blocks
+ *
+ * @param  std::size_t n number of elements
+ * @param  S* x first input
+ * @param  S* y second input
+ * @param  S* z output
+ * @return nothing
+ *
+ */
+template <typename S>
+void zt_blas_widened_add(std::size_t n, const S* x, const S* y, S* z) {
+
+    const ZTBlasKernels<float>& blas = ZTBlas<float>::kernels();
+    alignas(64) float wx[ZTHalfConvert::chunk_size];
+    alignas(64) float wy[ZTHalfConvert::chunk_size];
+    for (std::size_t i = 0; i < n; i += ZTHalfConvert::chunk_size)
+    {
+        const std::size_t len = std::min<std::size_t>(ZTHalfConvert::chunk_size, n - i);
+        ZTHalfConvert::widen(len, x + i, wx);
+        ZTHalfConvert::widen(len, y + i, wy);
+        blas.add(len, wx, wy, wx);
+        ZTHalfConvert::narrow(len, wx, z + i);
+    }
+
+}
+
+/**
+ * zt_blas_widened_minus : z = x - y for a 16-bit storage type, in float blocks
+ *
+ * @param  std::size_t n number of elements
+ * @param  S* x first input
+ * @param  S* y second input
+ * @param  S* z output
+ * @return nothing
+ *
+ */
+template <typename S>
+void zt_blas_widened_minus(std::size_t n, const S* x, const S* y, S* z) {
+
+    const ZTBlasKernels<float>& blas = ZTBlas<float>::kernels();
+    alignas(64) float wx[ZTHalfConvert::chunk_size];
+    alignas(64) float wy[ZTHalfConvert::chunk_size];
+    for (std::size_t i = 0; i < n; i += ZTHalfConvert::chunk_size)
+    {
+        const std::size_t len = std::min<std::size_t>(ZTHalfConvert::chunk_size, n - i);
+        ZTHalfConvert::widen(len, x + i, wx);
+        ZTHalfConvert::widen(len, y + i, wy);
+        blas.minus(len, wx, wy, wx);
+        ZTHalfConvert::narrow(len, wx, z + i);
+    }
+
+}
+
+/**
+ * zt_blas_widened_axpy : y = alpha * x + y for a 16-bit storage type, in
+ *                        float blocks
+ *
+ * @param  std::size_t n number of elements
+ * @param  S alpha scalar
+ * @param  S* x input
+ * @param  S* y input and output
+ * @return nothing
+ *
+ */
+template <typename S>
+void zt_blas_widened_axpy(std::size_t n, S alpha, const S* x, S* y) {
+
+    const ZTBlasKernels<float>& blas = ZTBlas<float>::kernels();
+    alignas(64) float wx[ZTHalfConvert::chunk_size];
+    alignas(64) float wy[ZTHalfConvert::chunk_size];
+    for (std::size_t i = 0; i < n; i += ZTHalfConvert::chunk_size)
+    {
+        const std::size_t len = std::min<std::size_t>(ZTHalfConvert::chunk_size, n - i);
+        ZTHalfConvert::widen(len, x + i, wx);
+        ZTHalfConvert::widen(len, y + i, wy);
+        blas.axpy(len, float(alpha), wx, wy);
+        ZTHalfConvert::narrow(len, wy, y + i);
+    }
+
+}
+
+/**
+ * zt_blas_widened_dot : x . y for a 16-bit storage type, accumulated in float
+ *
+ * @param  std::size_t n number of elements
+ * @param  S* x first input
+ * @param  S* y second input
+ * @return float result
+ *
+ */
+template <typename S>
+float zt_blas_widened_dot(std::size_t n, const S* x, const S* y) {
+
+    const ZTBlasKernels<float>& blas = ZTBlas<float>::kernels();
+    alignas(64) float wx[ZTHalfConvert::chunk_size];
+    alignas(64) float wy[ZTHalfConvert::chunk_size];
+    float result = 0.0f;
+    for (std::size_t i = 0; i < n; i += ZTHalfConvert::chunk_size)
+    {
+        const std::size_t len = std::min<std::size_t>(ZTHalfConvert::chunk_size, n - i);
+        ZTHalfConvert::widen(len, x + i, wx);
+        ZTHalfConvert::widen(len, y + i, wy);
+        result += blas.dot(len, wx, wy);
+    }
+    return result;
+
+}
+
+/**
+ * zt_blas_widened_axpy_dot : y = alpha * x + y returning y . y for a 16-bit
+ *                            storage type, the products taken of the
+ *                            rounded y
+ *
+ * @param  std::size_t n number of elements
+ * @param  S alpha scalar
+ * @param  S* x input
+ * @param  S* y input and output
+ * @return float result
+ *
+ */
+template <typename S>
+float zt_blas_widened_axpy_dot(std::size_t n, S alpha, const S* x, S* y) {
+
+    const ZTBlasKernels<float>& blas = ZTBlas<float>::kernels();
+    alignas(64) float wx[ZTHalfConvert::chunk_size];
+    alignas(64) float wy[ZTHalfConvert::chunk_size];
+    float result = 0.0f;
+    for (std::size_t i = 0; i < n; i += ZTHalfConvert::chunk_size)
+    {
+        const std::size_t len = std::min<std::size_t>(ZTHalfConvert::chunk_size, n - i);
+        ZTHalfConvert::widen(len, x + i, wx);
+        ZTHalfConvert::widen(len, y + i, wy);
+        blas.axpy(len, float(alpha), wx, wy);
+        ZTHalfConvert::narrow(len, wy, y + i);
+        ZTHalfConvert::widen(len, y + i, wy);
+        result += blas.dot(len, wy, wy);
+    }
+    return result;
+
+}
+
+/**
+ * zt_blas_widened_dot2 : x . y and x . z for a 16-bit storage type,
+ *                        accumulated in float
+ *
+ * @param  std::size_t n number of elements
+ * @param  S* x shared input
+ * @param  S* y first input
+ * @param  S* z second input
+ * @param  float* result x . y and x . z
+ * @return nothing
+ *
+ */
+template <typename S>
+void zt_blas_widened_dot2(std::size_t n, const S* x, const S* y, const S* z, float* result) {
+
+    const ZTBlasKernels<float>& blas = ZTBlas<float>::kernels();
+    alignas(64) float wx[ZTHalfConvert::chunk_size];
+    alignas(64) float wy[ZTHalfConvert::chunk_size];
+    alignas(64) float wz[ZTHalfConvert::chunk_size];
+    float partial[2];
+    result[0] = 0.0f;
+    result[1] = 0.0f;
+    for (std::size_t i = 0; i < n; i += ZTHalfConvert::chunk_size)
+    {
+        const std::size_t len = std::min<std::size_t>(ZTHalfConvert::chunk_size, n - i);
+        ZTHalfConvert::widen(len, x + i, wx);
+        ZTHalfConvert::widen(len, y + i, wy);
+        ZTHalfConvert::widen(len, z + i, wz);
+        blas.dot2(len, wx, wy, wz, partial);
+        result[0] += partial[0];
+        result[1] += partial[1];
+    }
+
+}
+
+/**
+ * zt_blas_widened_xpby : y = x + beta * y for a 16-bit storage type, in
+ *                        float blocks
+ *
+ * @param  std::size_t n number of elements
+ * @param  S* x input
+ * @param  S beta scalar
+ * @param  S* y input and output
+ * @return nothing
+ *
+ */
+template <typename S>
+void zt_blas_widened_xpby(std::size_t n, const S* x, S beta, S* y) {
+
+    const ZTBlasKernels<float>& blas = ZTBlas<float>::kernels();
+    alignas(64) float wx[ZTHalfConvert::chunk_size];
+    alignas(64) float wy[ZTHalfConvert::chunk_size];
+    for (std::size_t i = 0; i < n; i += ZTHalfConvert::chunk_size)
+    {
+        const std::size_t len = std::min<std::size_t>(ZTHalfConvert::chunk_size, n - i);
+        ZTHalfConvert::widen(len, x + i, wx);
+        ZTHalfConvert::widen(len, y + i, wy);
+        blas.xpby(len, wx, float(beta), wy);
+        ZTHalfConvert::narrow(len, wy, y + i);
+    }
+
+}
+
+/**
+ * zt_blas_widened_hadamard : z = x * y element-wise for a 16-bit storage
+ *                            type, in float blocks
+ *
+ * @param  std::size_t n number of elements
+ * @param  S* x input
+ * @param  S* y input
+ * @param  S* z output
+ * @return nothing
+ *
+ */
+template <typename S>
+void zt_blas_widened_hadamard(std::size_t n, const S* x, const S* y, S* z) {
+
+    const ZTBlasKernels<float>& blas = ZTBlas<float>::kernels();
+    alignas(64) float wx[ZTHalfConvert::chunk_size];
+    alignas(64) float wy[ZTHalfConvert::chunk_size];
+    for (std::size_t i = 0; i < n; i += ZTHalfConvert::chunk_size)
+    {
+        const std::size_t len = std::min<std::size_t>(ZTHalfConvert::chunk_size, n - i);
+        ZTHalfConvert::widen(len, x + i, wx);
+        ZTHalfConvert::widen(len, y + i, wy);
+        blas.hadamard(len, wx, wy, wx);
+        ZTHalfConvert::narrow(len, wx, z + i);
+    }
+
+}
+
+/**
+ * zt_blas_widened_hadamard_add : z = x * y + z element-wise for a 16-bit
+ *                                storage type, in float blocks
+ *
+ * @param  std::size_t n number of elements
+ * @param  S* x input
+ * @param  S* y input
+ * @param  S* z input and output
+ * @return nothing
+ *
+ */
+template <typename S>
+void zt_blas_widened_hadamard_add(std::size_t n, const S* x, const S* y, S* z) {
+
+    const ZTBlasKernels<float>& blas = ZTBlas<float>::kernels();
+    alignas(64) float wx[ZTHalfConvert::chunk_size];
+    alignas(64) float wy[ZTHalfConvert::chunk_size];
+    alignas(64) float wz[ZTHalfConvert::chunk_size];
+    for (std::size_t i = 0; i < n; i += ZTHalfConvert::chunk_size)
+    {
+        const std::size_t len = std::min<std::size_t>(ZTHalfConvert::chunk_size, n - i);
+        ZTHalfConvert::widen(len, x + i, wx);
+        ZTHalfConvert::widen(len, y + i, wy);
+        ZTHalfConvert::widen(len, z + i, wz);
+        blas.hadamard_add(len, wx, wy, wz);
+        ZTHalfConvert::narrow(len, wz, z + i);
+    }
+
+}
+
+/**
+ * zt_blas_select_widened_kernels : fills the kernel table for a 16-bit
+ *                                  storage type
+ *
+ * @param  nothing
+ * @return ZTBlasKernels<S> kernels
+ *
+ */
+template <typename S>
+ZTBlasKernels<S> zt_blas_select_widened_kernels() {
+
+    ZTBlasKernels<S> k = {
+        zt_blas_widened_add_scalar<S>, zt_blas_widened_multiply_scalar<S>,
+        zt_blas_widened_add<S>, zt_blas_widened_minus<S>,
+        zt_blas_widened_axpy<S>, zt_blas_widened_dot<S>,
+        zt_blas_widened_axpy_dot<S>, zt_blas_widened_dot2<S>, zt_blas_widened_xpby<S>,
+        zt_blas_widened_hadamard<S>, zt_blas_widened_hadamard_add<S>, ZTBlas<float>::kernels().instruction_set
+    };
+    return k;
+
+}
+
+/**
+ * select : scalar kernels for any arithmetic type
+ *
+ * @param  nothing
+ * @return ZTBlasKernels<T> kernels
+ *
+ */
+template <typename T>
+ZTBlasKernels<T> ZTBlas<T>::select() {
+
+    ZTBlasKernels<T> k = {
+        zt_blas_scalar_add_scalar<T>, zt_blas_scalar_multiply_scalar<T>,
+        zt_blas_scalar_add<T>, zt_blas_scalar_minus<T>,
+        zt_blas_scalar_axpy<T>, zt_blas_scalar_dot<T>,
+        zt_blas_scalar_axpy_dot<T>, zt_blas_scalar_dot2<T>, zt_blas_scalar_xpby<T>,
+        zt_blas_scalar_hadamard<T>, zt_blas_scalar_hadamard_add<T>, ZT_ISA_SCALAR
+    };
+    return k;
+
+}
+
+template <>
+ZTBlasKernels<double> ZTBlas<double>::select() {
+
+    return zt_blas_select_float_kernels<double>();
+
+}
+
+template <>
+ZTBlasKernels<float> ZTBlas<float>::select() {
+
+    return zt_blas_select_float_kernels<float>();
+
+}
+
+template <>
+ZTBlasKernels<ZTHalf> ZTBlas<ZTHalf>::select() {
+
+    return zt_blas_select_widened_kernels<ZTHalf>();
+
+}
+
+template <>
+ZTBlasKernels<ZTBFloat16> ZTBlas<ZTBFloat16>::select() {
+
+    return zt_blas_select_widened_kernels<ZTBFloat16>();
+
+}
+
+/**
+ * kernels : kernel table in use, selected once on first call
+ *
+ * @param  nothing
+ * @return const ZTBlasKernels<T>& kernels
+ *
+ */
+template <typename T>
+const ZTBlasKernels<T>& ZTBlas<T>::kernels() {
+
+    static const ZTBlasKernels<T> selected = select();
+    return selected;
+
+}
@@ -0,0 +1,78 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ZTBLAS_H
+#define ZTBLAS_H
+
+#include <cstddef>
+
+#include "ZTCpu.h"
+#include "ZTHalf.h"
+
+/*
+ * Table of BLAS-1 kernels over contiguous arrays of n elements. Outputs may
+ * alias inputs exactly (z == x), which is how the cummulative operations run
+ * in place. The fused kernels (axpy_dot, dot2) do in one pass over memory what
+ * would otherwise take two, for the iterative solvers. The element-wise
+ * kernels serve the structure-of-arrays batches, one element of every
+ * matrix in the batch per call. Dot products are returned in the accumulator
+ * type, float for the 16-bit storage types.
+ */
+template <typename T>
+struct ZTBlasKernels {
+    typedef typename ZTAccumulator<T>::type accumulator_type;
+
+    void (*add_scalar)(std::size_t n, const T* x, T alpha, T* z);      // z = x + alpha
+    void (*multiply_scalar)(std::size_t n, const T* x, T alpha, T* z); // z = alpha * x
+    void (*add)(std::size_t n, const T* x, const T* y, T* z);          // z = x + y
+    void (*minus)(std::size_t n, const T* x, const T* y, T* z);        // z = x - y
+    void (*axpy)(std::size_t n, T alpha, const T* x, T* y);            // y = alpha * x + y
+    accumulator_type (*dot)(std::size_t n, const T* x, const T* y);   // x . y
+    accumulator_type (*axpy_dot)(std::size_t n, T alpha, const T* x, T* y); // y = alpha * x + y, returns y . y
+    void (*dot2)(std::size_t n, const T* x, const T* y, const T* z, accumulator_type* result); // result = {x . y, x . z}
+    void (*xpby)(std::size_t n, const T* x, T beta, T* y);             // y = x + beta * y
+    void (*hadamard)(std::size_t n, const T* x, const T* y, T* z);     // z = x * y, element-wise
+    void (*hadamard_add)(std::size_t n, const T* x, const T* y, T* z); // z = x * y + z, element-wise
+    ZTInstructionSet instruction_set;
+};
+
+/*
+ * ZTBlas : hand-vectorized SSE2, AVX2/FMA and AVX-512 kernels for float and
+ *          double, chosen once per process from ZTCpu, with portable scalar
+ *          kernels for every other type and CPU. The 16-bit storage types
+ *          are widened to float a block at a time and run through the float
+ *          kernels, so they compute and accumulate in float.
+ */
+template <typename T>
+class ZTBlas {
+
+private:
+    static ZTBlasKernels<T> select();
+
+public:
+    static const ZTBlasKernels<T>& kernels();
+
+};
+
+#endif /* ZTBLAS_H */
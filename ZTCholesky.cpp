@@ -0,0 +1,1012 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cmath>
+#include <vector>
+#include <cstddef>
+#include <sstream>
+#include <utility>
+#include <stdexcept>
+#include <algorithm>
+
+#include "ZTBlas.h"
+#include "ZTGemm.h"
+#include "ZTError.h"
+#include "ZTCholesky.h"
+#include "ZTThreadPool.h"
+#include "ZTAlignedAllocator.h"
+
+/**
+ * zt_cholesky_panel : solves the rows of an m x nb panel A against the lower
+ *                     triangle of V, a_ij = (a_ij - a_i[0 .. j) . v_j) / v_jj.
+ *                     With V = L this gives L21 = A21 * L11^-T, with
+ *                     V = L11 * D11 it gives the LDL^T panel, and the values
+ *                     before the division (L21 * D11) are kept in W when
+ *                     given. Rows are independent and run on the thread pool
+ *
+ * @param  std::size_t m rows of the panel
+ * @param  std::size_t nb cols of the panel
+ * @param  T* v lower triangle of V, rows ldv elements apart
+ * @param  T* a panel, rows lda elements apart, overwritten
+ * @param  T* w nullptr, or m x nb values before the division, rows ldw apart
+ * @return nothing
+ *
+ */
+template <typename T>
+void zt_cholesky_panel(std::size_t m, std::size_t nb, const T* v, std::size_t ldv,
+                       T* a, std::size_t lda, T* w, std::size_t ldw) {
+
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    const std::size_t chunk_rows = 32;
+    ZTThreadPool::instance().parallel_for((m + chunk_rows - 1) / chunk_rows, [&](std::size_t chunk) {
+        const std::size_t i1 = std::min(m, (chunk + 1) * chunk_rows);
+        for (std::size_t i = chunk * chunk_rows; i < i1; ++i)
+        {
+            T* row = a + i * lda;
+            for (std::size_t j = 0; j < nb; ++j)
+            {
+                const T s = row[j] - blas.dot(j, row, v + j * ldv);
+                if (w != nullptr)
+                {
+                    w[i * ldw + j] = s;
+                }
+                row[j] = s / v[j * ldv + j];
+            }
+        }
+    });
+
+}
+
+/**
+ * zt_cholesky_update : performs the lower half of C -= A * B^T for an m x m
+ *                      C, by row blocks of nb rows that each run the GEMM loop
+ *                      nest on the thread pool. Diagonal blocks are updated
+ *                      whole, so a few elements above the diagonal change
+ *
+ * @param  std::size_t m rows of A, B and C
+ * @param  std::size_t k cols of A and B
+ * @param  std::size_t nb rows per block
+ * @param  T* a A with rows lda elements apart
+ * @param  T* b B with rows ldb elements apart
+ * @param  T* c C with rows ldc elements apart
+ * @return nothing
+ *
+ */
+template <typename T>
+void zt_cholesky_update(std::size_t m, std::size_t k, std::size_t nb,
+                        const T* a, std::size_t lda, const T* b, std::size_t ldb,
+                        T* c, std::size_t ldc) {
+
+    ZTThreadPool::instance().parallel_for((m + nb - 1) / nb, [&](std::size_t block) {
+        const std::size_t i0 = block * nb;
+        const std::size_t i1 = std::min(m, i0 + nb);
+        ZTGemm<T>::blocked(i1 - i0, i1, k, T(-1),
+                           a + i0 * lda, lda, 1,
+                           b, 1, ldb,
+                           c + i0 * ldc, ldc, 1);
+    });
+
+}
+
+/**
+ * zt_cholesky_forward : solves L * y = x in place for one contiguous vector
+ *
+ * @param  std::size_t n order of L
+ * @param  T* a L, rows ld elements apart
+ * @param  bool unit whether the diagonal of L is implied ones
+ * @param  T* x right-hand side, overwritten by y
+ * @return nothing
+ *
+ */
+template <typename T>
+void zt_cholesky_forward(std::size_t n, const T* a, std::size_t ld, bool unit, T* x) {
+
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const T s = x[i] - blas.dot(i, a + i * ld, x);
+        x[i] = unit ? s : s / a[i * ld + i];
+    }
+
+}
+
+/**
+ * zt_cholesky_backward : solves L^T * x = y in place for one contiguous
+ *                        vector. Each solved element is taken out of the ones
+ *                        above it with an axpy along a contiguous row of L
+ *
+ * @param  std::size_t n order of L
+ * @param  T* a L, rows ld elements apart
+ * @param  bool unit whether the diagonal of L is implied ones
+ * @param  T* x right-hand side, overwritten by the solution
+ * @return nothing
+ *
+ */
+template <typename T>
+void zt_cholesky_backward(std::size_t n, const T* a, std::size_t ld, bool unit, T* x) {
+
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    for (std::size_t i = n; i-- > 0;)
+    {
+        if (!unit)
+        {
+            x[i] /= a[i * ld + i];
+        }
+        blas.axpy(i, -x[i], a + i * ld, x);
+    }
+
+}
+
+/**
+ * zt_cholesky_lower_solve : solves L * Y = B in place for cols right-hand
+ *                           sides, by blocks of nb rows that first take the
+ *                           rows already solved with one GEMM
+ *
+ * @param  std::size_t n order of L
+ * @param  T* a L, rows ld elements apart
+ * @param  bool unit whether the diagonal of L is implied ones
+ * @param  std::size_t cols number of right-hand sides
+ * @param  T* b right-hand sides, rows ldb elements apart, overwritten by Y
+ * @param  std::size_t nb rows per block
+ * @return nothing
+ *
+ */
+template <typename T>
+void zt_cholesky_lower_solve(std::size_t n, const T* a, std::size_t ld, bool unit,
+                             std::size_t cols, T* b, std::size_t ldb, std::size_t nb) {
+
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    for (std::size_t i0 = 0; i0 < n; i0 += nb)
+    {
+        const std::size_t i1 = std::min(i0 + nb, n);
+        if (i0 > 0)
+        {
+            ZTGemm<T>::gemm(i1 - i0, cols, i0, T(-1),
+                            a + i0 * ld, ld, 1,
+                            b, ldb, 1,
+                            T(1), b + i0 * ldb, ldb, 1);
+        }
+        for (std::size_t i = i0; i < i1; ++i)
+        {
+            for (std::size_t p = i0; p < i; ++p)
+            {
+                blas.axpy(cols, -a[i * ld + p], b + p * ldb, b + i * ldb);
+            }
+            if (!unit)
+            {
+                blas.multiply_scalar(cols, b + i * ldb, T(1) / a[i * ld + i], b + i * ldb);
+            }
+        }
+    }
+
+}
+
+/**
+ * zt_cholesky_upper_solve : solves L^T * X = Y in place for cols right-hand
+ *                           sides, by blocks of nb rows from the bottom up.
+ *                           L^T is read from L by swapping its strides
+ *
+ * @param  std::size_t n order of L
+ * @param  T* a L, rows ld elements apart
+ * @param  bool unit whether the diagonal of L is implied ones
+ * @param  std::size_t cols number of right-hand sides
+ * @param  T* b right-hand sides, rows ldb elements apart, overwritten by X
+ * @param  std::size_t nb rows per block
+ * @return nothing
+ *
+ */
+template <typename T>
+void zt_cholesky_upper_solve(std::size_t n, const T* a, std::size_t ld, bool unit,
+                             std::size_t cols, T* b, std::size_t ldb, std::size_t nb) {
+
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    const std::size_t blocks = (n + nb - 1) / nb;
+    for (std::size_t block = blocks; block-- > 0;)
+    {
+        const std::size_t i0 = block * nb;
+        const std::size_t i1 = std::min(i0 + nb, n);
+        if (i1 < n)
+        {
+            ZTGemm<T>::gemm(i1 - i0, cols, n - i1, T(-1),
+                            a + i1 * ld + i0, 1, ld,
+                            b + i1 * ldb, ldb, 1,
+                            T(1), b + i0 * ldb, ldb, 1);
+        }
+        for (std::size_t i = i1; i-- > i0;)
+        {
+            if (!unit)
+            {
+                blas.multiply_scalar(cols, b + i * ldb, T(1) / a[i * ld + i], b + i * ldb);
+            }
+            for (std::size_t p = i0; p < i; ++p)
+            {
+                blas.axpy(cols, -a[i * ld + p], b + i * ldb, b + p * ldb);
+            }
+        }
+    }
+
+}
+
+/**
+ * zt_cholesky_solve_dimensions : checks that a right-hand side has one row per
+ *                                row of the factorized matrix
+ *
+ * @param  std::size_t rows rows of the right-hand side
+ * @param  std::size_t order order of the factorized matrix
+ * @return void
+ *
+ */
+inline void zt_cholesky_solve_dimensions(std::size_t rows, std::size_t order) {
+
+    if (rows != order)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Right-hand side of " << rows << " rows does not match the system of order: " << order << "!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * Constructor : Constructs the Cholesky factorization of a symmetric positive
+ *               definite matrix
+ *
+ * @param  ZTMatrix<T> m matrix to factorize, left unchanged
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTCholesky<T>::ZTCholesky(const ZTMatrix<T>& m) : factors(m),
+                                                  order(m.get_matrix_rows()),
+                                                  failure(m.get_matrix_rows()) {
+
+    factorize();
+
+}
+
+/**
+ * Constructor : Constructs the Cholesky factorization of a symmetric positive
+ *               definite matrix, reusing its buffer for the factor
+ *
+ * @param  ZTMatrix<T> m matrix to factorize, left empty
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTCholesky<T>::ZTCholesky(ZTMatrix<T>&& m) : factors(std::move(m)),
+                                             order(factors.get_matrix_rows()),
+                                             failure(factors.get_matrix_rows()) {
+
+    factorize();
+
+}
+
+/**
+ * Constructor : Constructs the Cholesky factorization of a square view
+ *
+ * @param  ZTMatrixView<const T> m block to factorize, left unchanged
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTCholesky<T>::ZTCholesky(const ZTMatrixView<const T>& m) : factors(m),
+                                                            order(m.get_matrix_rows()),
+                                                            failure(m.get_matrix_rows()) {
+
+    factorize();
+
+}
+
+/**
+ * factorize : blocked right-looking factorization over the lower triangle.
+ *             Each step factors a diagonal block row by row, solves the panel
+ *             below it and updates the lower half of the trailing submatrix
+ *
+ * @param  nothing
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTCholesky<T>::factorize() {
+
+    ZT_VALIDATE(factors.valid_sqaure_matrix(factors.get_matrix_rows(), factors.get_matrix_cols()));
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    const std::size_t n = order;
+    const std::size_t ld = factors.stride();
+    T* a = factors.data();
+    for (std::size_t k = 0; k < n; k += block_size)
+    {
+        const std::size_t nb = std::min(block_size, n - k);
+        const std::size_t k1 = k + nb;
+        for (std::size_t i = k; i < k1; ++i)
+        {
+            T* row = a + i * ld + k;
+            for (std::size_t j = 0; j < i - k; ++j)
+            {
+                const T* pivot_row = a + (k + j) * ld + k;
+                row[j] = (row[j] - blas.dot(j, row, pivot_row)) / pivot_row[j];
+            }
+            const T d = row[i - k] - blas.dot(i - k, row, row);
+            if (!(d > T(0)))
+            {
+                failure = i;
+                return;
+            }
+            row[i - k] = std::sqrt(d);
+        }
+        if (k1 == n)
+        {
+            break;
+        }
+
+        // L21 = A21 * L11^-T, then A22 -= L21 * L21^T over the lower half
+        zt_cholesky_panel(n - k1, nb, a + k * ld + k, ld, a + k1 * ld + k, ld, static_cast<T*>(nullptr), 0);
+        zt_cholesky_update(n - k1, nb, block_size,
+                           a + k1 * ld + k, ld, a + k1 * ld + k, ld,
+                           a + k1 * ld + k1, ld);
+    }
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        std::fill(a + i * ld + i + 1, a + i * ld + n, T(0));
+    }
+
+}
+
+/**
+ * size : order of the factorized matrix
+ *
+ * @param  nothing
+ * @return std::size_t order
+ *
+ */
+template <typename T>
+inline std::size_t ZTCholesky<T>::size() const {
+
+    return order;
+
+}
+
+/**
+ * is_positive_definite : whether the factorization ran to the end
+ *
+ * @param  nothing
+ * @return bool
+ *
+ */
+template <typename T>
+inline bool ZTCholesky<T>::is_positive_definite() const {
+
+    return failure == order;
+
+}
+
+/**
+ * get_failure : zero-based column whose pivot was not positive, equal to the
+ *               order when the matrix is positive definite
+ *
+ * @param  nothing
+ * @return std::size_t failure
+ *
+ */
+template <typename T>
+inline std::size_t ZTCholesky<T>::get_failure() const {
+
+    return failure;
+
+}
+
+/**
+ * lower : lower triangular factor L, zero above the diagonal
+ *
+ * @param  nothing
+ * @return ZTMatrix<T> factors
+ *
+ */
+template <typename T>
+inline const ZTMatrix<T>& ZTCholesky<T>::lower() const {
+
+    return factors;
+
+}
+
+/**
+ * solve : solves A * x = b with the stored factor
+ *
+ * @param  ZTVectorView<const T> b right-hand side
+ * @return ZTVector<T> result
+ *
+ */
+template <typename T>
+ZTVector<T> ZTCholesky<T>::solve(const ZTVectorView<const T>& b) const {
+
+    ZTVector<T> result(b);
+    solve(result.view(), result);
+    return result;
+
+}
+
+/**
+ * solve : solves A * X = B with the stored factor, one column of X for each
+ *         column of B
+ *
+ * @param  ZTMatrixView<const T> b right-hand sides
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTCholesky<T>::solve(const ZTMatrixView<const T>& b) const {
+
+    ZTMatrix<T> result(b);
+    solve(result.view(), result);
+    return result;
+
+}
+
+/**
+ * solve : solves A * x = b into a reused buffer, b may be a view of out
+ *
+ * @param  ZTVectorView<const T> b right-hand side
+ * @param  ZTVector<T> out solution
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTCholesky<T>::solve(const ZTVectorView<const T>& b, ZTVector<T>& out) const {
+
+    ZT_VALIDATE(valid_solve_dimensions(b.size()));
+    ZT_VALIDATE(valid_positive_definite());
+    if (b.data() != out.data() || b.stride() != 1 || out.size() != order)
+    {
+        ZTVector<T> copy(b);
+        out = std::move(copy);
+    }
+    zt_cholesky_forward(order, factors.data(), factors.stride(), false, out.data());
+    zt_cholesky_backward(order, factors.data(), factors.stride(), false, out.data());
+
+}
+
+/**
+ * solve : solves A * X = B into a reused buffer, b may be a view of out
+ *
+ * @param  ZTMatrixView<const T> b right-hand sides
+ * @param  ZTMatrix<T> out solutions
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTCholesky<T>::solve(const ZTMatrixView<const T>& b, ZTMatrix<T>& out) const {
+
+    ZT_VALIDATE(valid_solve_dimensions(b.get_matrix_rows()));
+    ZT_VALIDATE(valid_positive_definite());
+    const std::size_t cols = b.get_matrix_cols();
+    if (b.data() != out.data() || b.ld() != out.stride() || b.stride() != 1 ||
+        order != out.get_matrix_rows() || cols != out.get_matrix_cols())
+    {
+        ZTMatrix<T> copy(b);
+        out = std::move(copy);
+    }
+    zt_cholesky_lower_solve(order, factors.data(), factors.stride(), false, cols, out.data(), out.stride(), block_size);
+    zt_cholesky_upper_solve(order, factors.data(), factors.stride(), false, cols, out.data(), out.stride(), block_size);
+
+}
+
+/**
+ * determinant : square of the product of the diagonal of L
+ *
+ * @param  nothing
+ * @return T result
+ *
+ */
+template <typename T>
+T ZTCholesky<T>::determinant() const {
+
+    ZT_VALIDATE(valid_positive_definite());
+    T result = T(1);
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        result *= factors[i][i] * factors[i][i];
+    }
+    return result;
+
+}
+
+/**
+ * log_determinant : twice the sum of the logarithms of the diagonal of L,
+ *                   which stays finite where the determinant overflows
+ *
+ * @param  nothing
+ * @return T result
+ *
+ */
+template <typename T>
+T ZTCholesky<T>::log_determinant() const {
+
+    ZT_VALIDATE(valid_positive_definite());
+    T result = T(0);
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        result += std::log(factors[i][i]);
+    }
+    return T(2) * result;
+
+}
+
+/**
+ * inverse : solves A * X = I with the stored factor
+ *
+ * @param  nothing
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTCholesky<T>::inverse() const {
+
+    ZT_VALIDATE(valid_positive_definite());
+    ZTMatrix<T> result(order, order, T(0));
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        result[i][i] = T(1);
+    }
+    solve(result.view(), result);
+    return result;
+
+}
+
+/**
+ * valid_solve_dimensions : checks that the right-hand side has one row per
+ *                          row of the factorized matrix
+ *
+ * @param  std::size_t rows rows of the right-hand side
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTCholesky<T>::valid_solve_dimensions(std::size_t rows) const {
+
+    zt_cholesky_solve_dimensions(rows, order);
+
+}
+
+/**
+ * valid_positive_definite : checks that the factorization ran to the end
+ *
+ * @param  nothing
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTCholesky<T>::valid_positive_definite() const {
+
+    if (failure != order)
+    {
+        std::ostringstream not_positive_definite;
+        not_positive_definite << "Matrix is not positive definite, pivot " << failure << " is not positive!.";
+        zt_raise<std::domain_error>(not_positive_definite.str());
+    }
+
+}
+
+/**
+ * Constructor : Constructs the LDL^T factorization of a symmetric matrix
+ *
+ * @param  ZTMatrix<T> m matrix to factorize, left unchanged
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTLDLT<T>::ZTLDLT(const ZTMatrix<T>& m) : factors(m),
+                                          order(m.get_matrix_rows()),
+                                          failure(m.get_matrix_rows()) {
+
+    factorize();
+
+}
+
+/**
+ * Constructor : Constructs the LDL^T factorization of a symmetric matrix,
+ *               reusing its buffer for the factors
+ *
+ * @param  ZTMatrix<T> m matrix to factorize, left empty
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTLDLT<T>::ZTLDLT(ZTMatrix<T>&& m) : factors(std::move(m)),
+                                     order(factors.get_matrix_rows()),
+                                     failure(factors.get_matrix_rows()) {
+
+    factorize();
+
+}
+
+/**
+ * Constructor : Constructs the LDL^T factorization of a square view
+ *
+ * @param  ZTMatrixView<const T> m block to factorize, left unchanged
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTLDLT<T>::ZTLDLT(const ZTMatrixView<const T>& m) : factors(m),
+                                                    order(m.get_matrix_rows()),
+                                                    failure(m.get_matrix_rows()) {
+
+    factorize();
+
+}
+
+/**
+ * factorize : blocked right-looking factorization over the lower triangle as
+ *             for ZTCholesky. V = L11 * D11 is kept for the diagonal block so
+ *             every update is a dot product or a GEMM, and the trailing update
+ *             is A22 -= L21 * (L21 * D11)^T
+ *
+ * @param  nothing
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTLDLT<T>::factorize() {
+
+    ZT_VALIDATE(factors.valid_sqaure_matrix(factors.get_matrix_rows(), factors.get_matrix_cols()));
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    const std::size_t n = order;
+    const std::size_t ld = factors.stride();
+    T* a = factors.data();
+    std::vector<T, ZTAlignedAllocator<T> > v(block_size * block_size);
+    std::vector<T, ZTAlignedAllocator<T> > w;
+    for (std::size_t k = 0; k < n; k += block_size)
+    {
+        const std::size_t nb = std::min(block_size, n - k);
+        const std::size_t k1 = k + nb;
+        for (std::size_t i = 0; i < nb; ++i)
+        {
+            T* row = a + (k + i) * ld + k;
+            T* v_row = v.data() + i * nb;
+            for (std::size_t j = 0; j < i; ++j)
+            {
+                const T s = row[j] - blas.dot(j, row, v.data() + j * nb);
+                v_row[j] = s;
+                row[j] = s / v[j * nb + j];
+            }
+            const T d = row[i] - blas.dot(i, row, v_row);
+            if (d == T(0))
+            {
+                failure = k + i;
+                return;
+            }
+            row[i] = d;
+            v_row[i] = d;
+        }
+        if (k1 == n)
+        {
+            break;
+        }
+
+        // L21 = A21 * V^-T keeping W = L21 * D11, then A22 -= L21 * W^T over the lower half
+        w.resize((n - k1) * nb);
+        zt_cholesky_panel(n - k1, nb, v.data(), nb, a + k1 * ld + k, ld, w.data(), nb);
+        zt_cholesky_update(n - k1, nb, block_size,
+                           a + k1 * ld + k, ld, w.data(), nb,
+                           a + k1 * ld + k1, ld);
+    }
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        std::fill(a + i * ld + i + 1, a + i * ld + n, T(0));
+    }
+
+}
+
+/**
+ * size : order of the factorized matrix
+ *
+ * @param  nothing
+ * @return std::size_t order
+ *
+ */
+template <typename T>
+inline std::size_t ZTLDLT<T>::size() const {
+
+    return order;
+
+}
+
+/**
+ * is_singular : whether a zero pivot stopped the factorization
+ *
+ * @param  nothing
+ * @return bool
+ *
+ */
+template <typename T>
+inline bool ZTLDLT<T>::is_singular() const {
+
+    return failure != order;
+
+}
+
+/**
+ * is_positive_definite : whether the factorization ran to the end with every
+ *                        pivot of D positive
+ *
+ * @param  nothing
+ * @return bool
+ *
+ */
+template <typename T>
+bool ZTLDLT<T>::is_positive_definite() const {
+
+    if (failure != order)
+    {
+        return false;
+    }
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        if (!(factors[i][i] > T(0)))
+        {
+            return false;
+        }
+    }
+    return true;
+
+}
+
+/**
+ * get_failure : zero-based column whose pivot was zero, equal to the order
+ *               when the factorization ran to the end
+ *
+ * @param  nothing
+ * @return std::size_t failure
+ *
+ */
+template <typename T>
+inline std::size_t ZTLDLT<T>::get_failure() const {
+
+    return failure;
+
+}
+
+/**
+ * get_factors : L strictly below the diagonal (its unit diagonal is implied)
+ *               and D on it, in one matrix
+ *
+ * @param  nothing
+ * @return ZTMatrix<T> factors
+ *
+ */
+template <typename T>
+inline const ZTMatrix<T>& ZTLDLT<T>::get_factors() const {
+
+    return factors;
+
+}
+
+/**
+ * lower : unit lower triangular factor L
+ *
+ * @param  nothing
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTLDLT<T>::lower() const {
+
+    ZTMatrix<T> result(factors);
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        result[i][i] = T(1);
+    }
+    return result;
+
+}
+
+/**
+ * diagonal : pivots of the diagonal factor D
+ *
+ * @param  nothing
+ * @return ZTVector<T> result
+ *
+ */
+template <typename T>
+ZTVector<T> ZTLDLT<T>::diagonal() const {
+
+    std::vector<T> result(order);
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        result[i] = factors[i][i];
+    }
+    return ZTVector<T>(result);
+
+}
+
+/**
+ * solve : solves A * x = b with the stored factors
+ *
+ * @param  ZTVectorView<const T> b right-hand side
+ * @return ZTVector<T> result
+ *
+ */
+template <typename T>
+ZTVector<T> ZTLDLT<T>::solve(const ZTVectorView<const T>& b) const {
+
+    ZTVector<T> result(b);
+    solve(result.view(), result);
+    return result;
+
+}
+
+/**
+ * solve : solves A * X = B with the stored factors, one column of X for each
+ *         column of B
+ *
+ * @param  ZTMatrixView<const T> b right-hand sides
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTLDLT<T>::solve(const ZTMatrixView<const T>& b) const {
+
+    ZTMatrix<T> result(b);
+    solve(result.view(), result);
+    return result;
+
+}
+
+/**
+ * solve : solves A * x = b into a reused buffer, b may be a view of out
+ *
+ * @param  ZTVectorView<const T> b right-hand side
+ * @param  ZTVector<T> out solution
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTLDLT<T>::solve(const ZTVectorView<const T>& b, ZTVector<T>& out) const {
+
+    ZT_VALIDATE(valid_solve_dimensions(b.size()));
+    ZT_VALIDATE(valid_nonsingular());
+    if (b.data() != out.data() || b.stride() != 1 || out.size() != order)
+    {
+        ZTVector<T> copy(b);
+        out = std::move(copy);
+    }
+    T* x = out.data();
+    zt_cholesky_forward(order, factors.data(), factors.stride(), true, x);
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        x[i] /= factors[i][i];
+    }
+    zt_cholesky_backward(order, factors.data(), factors.stride(), true, x);
+
+}
+
+/**
+ * solve : solves A * X = B into a reused buffer, b may be a view of out
+ *
+ * @param  ZTMatrixView<const T> b right-hand sides
+ * @param  ZTMatrix<T> out solutions
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTLDLT<T>::solve(const ZTMatrixView<const T>& b, ZTMatrix<T>& out) const {
+
+    ZT_VALIDATE(valid_solve_dimensions(b.get_matrix_rows()));
+    ZT_VALIDATE(valid_nonsingular());
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    const std::size_t cols = b.get_matrix_cols();
+    if (b.data() != out.data() || b.ld() != out.stride() || b.stride() != 1 ||
+        order != out.get_matrix_rows() || cols != out.get_matrix_cols())
+    {
+        ZTMatrix<T> copy(b);
+        out = std::move(copy);
+    }
+    zt_cholesky_lower_solve(order, factors.data(), factors.stride(), true, cols, out.data(), out.stride(), block_size);
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        blas.multiply_scalar(cols, out[i], T(1) / factors[i][i], out[i]);
+    }
+    zt_cholesky_upper_solve(order, factors.data(), factors.stride(), true, cols, out.data(), out.stride(), block_size);
+
+}
+
+/**
+ * determinant : product of the pivots of D
+ *
+ * @param  nothing
+ * @return T result
+ *
+ */
+template <typename T>
+T ZTLDLT<T>::determinant() const {
+
+    if (failure != order)
+    {
+        return T(0);
+    }
+    T result = T(1);
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        result *= factors[i][i];
+    }
+    return result;
+
+}
+
+/**
+ * inverse : solves A * X = I with the stored factors
+ *
+ * @param  nothing
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTLDLT<T>::inverse() const {
+
+    ZT_VALIDATE(valid_nonsingular());
+    ZTMatrix<T> result(order, order, T(0));
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        result[i][i] = T(1);
+    }
+    solve(result.view(), result);
+    return result;
+
+}
+
+/**
+ * valid_solve_dimensions : checks that the right-hand side has one row per
+ *                          row of the factorized matrix
+ *
+ * @param  std::size_t rows rows of the right-hand side
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTLDLT<T>::valid_solve_dimensions(std::size_t rows) const {
+
+    zt_cholesky_solve_dimensions(rows, order);
+
+}
+
+/**
+ * valid_nonsingular : checks that the factorization ran to the end
+ *
+ * @param  nothing
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTLDLT<T>::valid_nonsingular() const {
+
+    if (failure != order)
+    {
+        std::ostringstream singular;
+        singular << "Matrix is singular, pivot " << failure << " is zero!.";
+        zt_raise<std::domain_error>(singular.str());
+    }
+
+}
@@ -0,0 +1,137 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ZTCHOLESKY_H
+#define ZTCHOLESKY_H
+
+#include <cstddef>
+
+#include "ZTMatrix.h"
+#include "ZTVector.h"
+#include "ZTMatrixView.h"
+#include "ZTVectorView.h"
+
+/*
+ * ZTCholesky : Cholesky factorization A = L * L^T of a symmetric positive
+ *              definite matrix. Only the lower triangle of A is read, and the
+ *              factor is kept so that solves, the determinant and the inverse
+ *              reuse it.
+ *
+ *              The factorization is blocked and right-looking like ZTLU: the
+ *              diagonal block is factored, the panel below it is solved
+ *              against it, and the lower half of the trailing submatrix takes
+ *              a symmetric rank-nb update. The panel rows and the row blocks
+ *              of the update are spread over the thread pool, each update
+ *              block running the GEMM loop nest.
+ *
+ *              A pivot that is not positive stops the factorization at once:
+ *              is_positive_definite() is then false, get_failure() gives the
+ *              column, and solve and inverse fail.
+ */
+template <typename T>
+class ZTCholesky {
+
+private:
+    static constexpr std::size_t block_size = 64; // columns per panel, the depth of the trailing update
+
+    ZTMatrix<T> factors;  // L on and below the diagonal, zero above
+    std::size_t order;
+    std::size_t failure;  // first column with a pivot that is not positive, order on success
+
+    void factorize();
+
+public:
+    explicit ZTCholesky(const ZTMatrix<T>& m);
+    explicit ZTCholesky(ZTMatrix<T>&& m);            // factorizes in the buffer of m
+    explicit ZTCholesky(const ZTMatrixView<const T>& m);
+
+    std::size_t size() const;
+    bool is_positive_definite() const;
+    std::size_t get_failure() const;
+
+    const ZTMatrix<T>& lower() const;
+
+    ZTVector<T> solve(const ZTVectorView<const T>& b) const;   // x with A * x = b
+    ZTMatrix<T> solve(const ZTMatrixView<const T>& b) const;   // X with A * X = B
+
+    void solve(const ZTVectorView<const T>& b, ZTVector<T>& out) const;
+    void solve(const ZTMatrixView<const T>& b, ZTMatrix<T>& out) const;
+
+    T determinant() const;
+    T log_determinant() const;   // log det A, without overflow
+    ZTMatrix<T> inverse() const;
+
+    void valid_solve_dimensions(std::size_t rows) const;
+    void valid_positive_definite() const;
+
+};
+
+/*
+ * ZTLDLT : square-root free factorization A = L * D * L^T of a symmetric
+ *          matrix, with L unit lower triangular and D diagonal, blocked and
+ *          threaded as ZTCholesky. There is no pivoting, so it suits positive
+ *          definite and quasi-definite matrices; a zero pivot stops the
+ *          factorization and is reported by get_failure().
+ */
+template <typename T>
+class ZTLDLT {
+
+private:
+    static constexpr std::size_t block_size = 64;
+
+    ZTMatrix<T> factors;  // L strictly below the diagonal, D on it, zero above
+    std::size_t order;
+    std::size_t failure;  // first column with a zero pivot, order on success
+
+    void factorize();
+
+public:
+    explicit ZTLDLT(const ZTMatrix<T>& m);
+    explicit ZTLDLT(ZTMatrix<T>&& m);
+    explicit ZTLDLT(const ZTMatrixView<const T>& m);
+
+    std::size_t size() const;
+    bool is_singular() const;
+    bool is_positive_definite() const;   // every pivot of D is positive
+    std::size_t get_failure() const;
+
+    const ZTMatrix<T>& get_factors() const;  // L and D packed together
+    ZTMatrix<T> lower() const;
+    ZTVector<T> diagonal() const;
+
+    ZTVector<T> solve(const ZTVectorView<const T>& b) const;
+    ZTMatrix<T> solve(const ZTMatrixView<const T>& b) const;
+
+    void solve(const ZTVectorView<const T>& b, ZTVector<T>& out) const;
+    void solve(const ZTMatrixView<const T>& b, ZTMatrix<T>& out) const;
+
+    T determinant() const;
+    ZTMatrix<T> inverse() const;
+
+    void valid_solve_dimensions(std::size_t rows) const;
+    void valid_nonsingular() const;
+
+};
+
+#endif /* ZTCHOLESKY_H */
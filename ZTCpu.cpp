@@ -0,0 +1,237 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#define ZT_CPU_X86
+#endif
+
+#include "ZTCpu.h"
+
+/**
+ * detect : queries CPUID for SSE2, AVX2/FMA and AVX-512F and XGETBV for the
+ *          register state the operating system saves on context switches
+ *
+ * @param  nothing
+ * @return ZTInstructionSet widest usable instruction set
+ *
+ */
+ZTInstructionSet ZTCpu::detect() {
+
+#ifdef ZT_CPU_X86
+    unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+    {
+        return ZT_ISA_SCALAR;
+    }
+    const bool sse2 = (edx & (1u << 26)) != 0;
+    const bool fma = (ecx & (1u << 12)) != 0;
+    const bool osxsave = (ecx & (1u << 27)) != 0;
+    const bool avx = (ecx & (1u << 28)) != 0;
+    if (!sse2)
+    {
+        return ZT_ISA_SCALAR;
+    }
+    if (!osxsave || !avx)
+    {
+        return ZT_ISA_SSE2;
+    }
+
+    unsigned xcr0_lo = 0, xcr0_hi = 0;
+    __asm__ volatile("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+    const bool ymm_state = (xcr0_lo & 0x6u) == 0x6u;     // SSE and AVX state
+    const bool zmm_state = (xcr0_lo & 0xe6u) == 0xe6u;   // plus opmask and ZMM state
+
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) || !ymm_state)
+    {
+        return ZT_ISA_SSE2;
+    }
+    const bool avx2 = (ebx & (1u << 5)) != 0;
+    const bool avx512f = (ebx & (1u << 16)) != 0;
+    if (avx512f && avx2 && fma && zmm_state)
+    {
+        return ZT_ISA_AVX512;
+    }
+    if (avx2 && fma)
+    {
+        return ZT_ISA_AVX2;
+    }
+    return ZT_ISA_SSE2;
+#else
+    return ZT_ISA_SCALAR;
+#endif
+
+}
+
+/**
+ * detect_f16c : queries CPUID for the F16C conversions between half and
+ *               single precision, which operate on the AVX register state
+ *
+ * @param  nothing
+ * @return bool
+ *
+ */
+bool ZTCpu::detect_f16c() {
+
+#ifdef ZT_CPU_X86
+    unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+    {
+        return false;
+    }
+    return (ecx & (1u << 29)) != 0;
+#else
+    return false;
+#endif
+
+}
+
+/**
+ * detect_vnni : queries CPUID for AVX-512BW and AVX-512 VNNI, the byte loads
+ *               and the u8 x s8 dot products with int32 accumulation
+ *
+ * @param  nothing
+ * @return bool
+ *
+ */
+bool ZTCpu::detect_vnni() {
+
+#ifdef ZT_CPU_X86
+    unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+    {
+        return false;
+    }
+    return (ebx & (1u << 30)) != 0 && (ecx & (1u << 11)) != 0;
+#else
+    return false;
+#endif
+
+}
+
+/**
+ * cap : lowers the detected instruction set to the one named in ZT_ISA
+ *
+ * @param  ZTInstructionSet detected
+ * @return ZTInstructionSet instruction set to use
+ *
+ */
+ZTInstructionSet ZTCpu::cap(ZTInstructionSet detected) {
+
+    const char* env = std::getenv("ZT_ISA");
+    if (env == nullptr)
+    {
+        return detected;
+    }
+    ZTInstructionSet requested = detected;
+    if (std::strcmp(env, "scalar") == 0)
+    {
+        requested = ZT_ISA_SCALAR;
+    }
+    else if (std::strcmp(env, "sse2") == 0)
+    {
+        requested = ZT_ISA_SSE2;
+    }
+    else if (std::strcmp(env, "avx2") == 0)
+    {
+        requested = ZT_ISA_AVX2;
+    }
+    else if (std::strcmp(env, "avx512") == 0)
+    {
+        requested = ZT_ISA_AVX512;
+    }
+    return requested < detected ? requested : detected;
+
+}
+
+/**
+ * instruction_set : widest usable instruction set, detected on first call
+ *
+ * @param  nothing
+ * @return ZTInstructionSet instruction set
+ *
+ */
+ZTInstructionSet ZTCpu::instruction_set() {
+
+    static const ZTInstructionSet selected = cap(detect());
+    return selected;
+
+}
+
+/**
+ * instruction_set_name : printable name of the instruction set in use
+ *
+ * @param  nothing
+ * @return const char* name
+ *
+ */
+const char* ZTCpu::instruction_set_name() {
+
+    switch (instruction_set())
+    {
+        case ZT_ISA_AVX512:
+            return "avx512";
+        case ZT_ISA_AVX2:
+            return "avx2";
+        case ZT_ISA_SSE2:
+            return "sse2";
+        default:
+            return "scalar";
+    }
+
+}
+
+/**
+ * f16c : whether the F16C conversions can be used, which requires the AVX2
+ *        instruction set to be in use as well, so ZT_ISA caps them too
+ *
+ * @param  nothing
+ * @return bool
+ *
+ */
+bool ZTCpu::f16c() {
+
+    static const bool usable = instruction_set() >= ZT_ISA_AVX2 && detect_f16c();
+    return usable;
+
+}
+
+/**
+ * vnni : whether the AVX-512 VNNI byte dot products can be used, which
+ *        requires the AVX-512 instruction set to be in use as well, so ZT_ISA
+ *        caps them too
+ *
+ * @param  nothing
+ * @return bool
+ *
+ */
+bool ZTCpu::vnni() {
+
+    static const bool usable = instruction_set() >= ZT_ISA_AVX512 && detect_vnni();
+    return usable;
+
+}
@@ -0,0 +1,60 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ZTCPU_H
+#define ZTCPU_H
+
+enum ZTInstructionSet {
+    ZT_ISA_SCALAR = 0,
+    ZT_ISA_SSE2 = 1,
+    ZT_ISA_AVX2 = 2,   // AVX2 + FMA
+    ZT_ISA_AVX512 = 3  // AVX-512F
+};
+
+/*
+ * ZTCpu : CPUID-based detection of the widest instruction set that both the
+ *         processor and the operating system (XSAVE state) support. The result
+ *         is computed once and can be capped with the ZT_ISA environment
+ *         variable (scalar, sse2, avx2 or avx512). The F16C half-precision
+ *         conversions are reported on their own and only alongside AVX2,
+ *         the AVX-512 VNNI byte dot products only alongside AVX-512.
+ */
+class ZTCpu {
+
+private:
+    static ZTInstructionSet detect();
+    static bool detect_f16c();
+    static bool detect_vnni();
+    static ZTInstructionSet cap(ZTInstructionSet detected);
+
+public:
+    static ZTInstructionSet instruction_set();
+    static const char* instruction_set_name();
+    static bool f16c();
+    static bool vnni();
+
+
+};
+
+#endif /* ZTCPU_H */
@@ -0,0 +1,50 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+#include "ZTError.h"
+
+/**
+ * zt_raise : reports a failed check according to the error policy, throwing
+ *            E(message) by default or printing it and aborting when built
+ *            with ZT_ASSERT_CHECKS
+ *
+ * @param  std::string message
+ * @return nothing (does not return)
+ *
+ */
+template <typename E>
+__attribute__((cold, noinline)) void zt_raise(const std::string& message) {
+
+#ifdef ZT_ASSERT_CHECKS
+    std::cerr << "Assertion failed: " << message << std::endl;
+    std::abort();
+#else
+    throw E(message);
+#endif
+
+}
@@ -0,0 +1,55 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ZTERROR_H
+#define ZTERROR_H
+
+#include <string>
+
+/*
+ * Error policy : dimension and subscript checks report failures through
+ *                zt_raise, which is chosen at build time.
+ *
+ *                default          : the check throws std::invalid_argument for
+ *                                   mismatched dimensions and std::out_of_range
+ *                                   for subscripts, and the caller decides
+ *                                   what to do. A check that passes costs a
+ *                                   compare and a branch, there is no
+ *                                   try/catch on the way.
+ *                ZT_ASSERT_CHECKS : checks are debug assertions. A failure
+ *                                   prints the message and aborts, and with
+ *                                   NDEBUG the checks are compiled out.
+ *
+ *                Unchecked accessors (operator[], unsafe_get) never check.
+ */
+#if defined(ZT_ASSERT_CHECKS) && defined(NDEBUG)
+#define ZT_VALIDATE(check) ((void)0)
+#else
+#define ZT_VALIDATE(check) check
+#endif
+
+template <typename E>
+[[noreturn]] void zt_raise(const std::string& message);
+
+#endif /* ZTERROR_H */
@@ -0,0 +1,939 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vector>
+#include <sstream>
+#include <stdexcept>
+
+#include "ZTError.h"
+#include "ZTExpression.h"
+
+/**
+ * zt_valid_expression_dimensions : checks that two operands of an element-wise
+ *                                  operator have the same shape
+ *
+ * @param  std::size_t rows, cols shape of the left operand
+ * @param  std::size_t other_rows, other_cols shape of the right operand
+ * @return void
+ *
+ */
+void zt_valid_expression_dimensions(std::size_t rows, std::size_t cols,
+                                    std::size_t other_rows, std::size_t other_cols) {
+
+    if (rows != other_rows || cols != other_cols)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Operands of dimensions: " << rows << "x" << cols << " and " << other_rows << "x" << other_cols << " are not suitable for element-wise operations!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * Constructor : leaf over contiguous vector elements
+ *
+ * @param  T* v first element
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTExprVectorLeaf<T>::ZTExprVectorLeaf(const T* v) : values(v) {
+
+}
+
+/**
+ * [] operator : element i of the leaf
+ *
+ * @param  std::size_t i zero-based index
+ * @return T element
+ *
+ */
+template <typename T>
+inline T ZTExprVectorLeaf<T>::operator[](std::size_t i) const {
+
+    return values[i];
+
+}
+
+/**
+ * overlaps : whether the leaf may read the destination out of place, which
+ *            a ZTVector or std::vector can only do when the destination is
+ *            a strided view of its elements
+ *
+ * @param  void* p first element of the destination
+ * @param  std::size_t rows, cols, ld, stride shape of the destination
+ * @return bool overlap
+ *
+ */
+template <typename T>
+inline bool ZTExprVectorLeaf<T>::overlaps(const void* p, std::size_t rows, std::size_t cols, std::size_t ld, std::size_t stride) const {
+
+    return ZTExprStridedLeaf<T>(values, 0, 1).overlaps(p, rows, cols, ld, stride);
+
+}
+
+/**
+ * Constructor : leaf over row-major matrix elements
+ *
+ * @param  T* v first element
+ * @param  std::size_t stride leading dimension
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTExprMatrixLeaf<T>::ZTExprMatrixLeaf(const T* v, std::size_t stride) : values(v), ld(stride) {
+
+}
+
+/**
+ * () operator : element (row, col) of the leaf
+ *
+ * @param  std::size_t row zero-based row
+ * @param  std::size_t col zero-based column
+ * @return T element
+ *
+ */
+template <typename T>
+inline T ZTExprMatrixLeaf<T>::operator()(std::size_t row, std::size_t col) const {
+
+    return values[row * ld + col];
+
+}
+
+/**
+ * overlaps : whether the leaf may read the destination out of place, which
+ *            a ZTMatrix can only do when the destination is a view of its
+ *            elements laid out differently, such as its transpose
+ *
+ * @param  void* p first element of the destination
+ * @param  std::size_t rows, cols, ld, stride shape of the destination
+ * @return bool overlap
+ *
+ */
+template <typename T>
+inline bool ZTExprMatrixLeaf<T>::overlaps(const void* p, std::size_t rows, std::size_t cols, std::size_t ld, std::size_t stride) const {
+
+    return ZTExprStridedLeaf<T>(values, this->ld, 1).overlaps(p, rows, cols, ld, stride);
+
+}
+
+/**
+ * Constructor : leaf over strided view elements
+ *
+ * @param  T* v first element
+ * @param  std::size_t row_stride distance between rows
+ * @param  std::size_t inc distance between consecutive elements
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTExprStridedLeaf<T>::ZTExprStridedLeaf(const T* v, std::size_t row_stride, std::size_t inc) :
+                                                                        values(v), ld(row_stride), inc(inc) {
+
+}
+
+/**
+ * [] operator : element i of the leaf
+ *
+ * @param  std::size_t i zero-based index
+ * @return T element
+ *
+ */
+template <typename T>
+inline T ZTExprStridedLeaf<T>::operator[](std::size_t i) const {
+
+    return values[i * inc];
+
+}
+
+/**
+ * () operator : element (row, col) of the leaf
+ *
+ * @param  std::size_t row zero-based row
+ * @param  std::size_t col zero-based column
+ * @return T element
+ *
+ */
+template <typename T>
+inline T ZTExprStridedLeaf<T>::operator()(std::size_t row, std::size_t col) const {
+
+    return values[row * ld + col * inc];
+
+}
+
+/**
+ * overlaps : whether the leaf may read the destination out of place. A
+ *            view laid out exactly like the destination only reads
+ *            element (r, c); any other view is held to the address range
+ *            test of ZTMatrixView::assign
+ *
+ * @param  void* p first element of the destination
+ * @param  std::size_t rows, cols, ld, stride shape of the destination
+ * @return bool overlap
+ *
+ */
+template <typename T>
+bool ZTExprStridedLeaf<T>::overlaps(const void* p, std::size_t rows, std::size_t cols, std::size_t ld, std::size_t stride) const {
+
+    if (values == p && (cols == 1 || inc == stride) && (rows == 1 || this->ld == ld))
+    {
+        return false;
+    }
+    return ZTMatrixView<const T>(values, rows, cols, this->ld, inc).overlaps(p, rows, cols, ld, stride);
+
+}
+
+/**
+ * Constructor : element-wise combination of two nodes
+ *
+ * @param  L l left node
+ * @param  R r right node
+ * @return nothing
+ *
+ */
+template <typename L, typename R, typename Op>
+ZTExprBinary<L, R, Op>::ZTExprBinary(const L& l, const R& r) : lhs(l), rhs(r) {
+
+}
+
+/**
+ * [] operator : element i of a vector-shaped combination
+ *
+ * @param  std::size_t i zero-based index
+ * @return T element
+ *
+ */
+template <typename L, typename R, typename Op>
+inline typename L::value_type ZTExprBinary<L, R, Op>::operator[](std::size_t i) const {
+
+    return Op::apply(value_type(lhs[i]), value_type(rhs[i]));
+
+}
+
+/**
+ * () operator : element (row, col) of a matrix-shaped combination
+ *
+ * @param  std::size_t row zero-based row
+ * @param  std::size_t col zero-based column
+ * @return T element
+ *
+ */
+template <typename L, typename R, typename Op>
+inline typename L::value_type ZTExprBinary<L, R, Op>::operator()(std::size_t row, std::size_t col) const {
+
+    return Op::apply(value_type(lhs(row, col)), value_type(rhs(row, col)));
+
+}
+
+/**
+ * overlaps : whether either operand may read the destination out of place
+ *
+ * @param  void* p first element of the destination
+ * @param  std::size_t rows, cols, ld shape of the destination
+ * @return bool overlap
+ *
+ */
+template <typename L, typename R, typename Op>
+inline bool ZTExprBinary<L, R, Op>::overlaps(const void* p, std::size_t rows, std::size_t cols, std::size_t ld, std::size_t stride) const {
+
+    return lhs.overlaps(p, rows, cols, ld, stride) || rhs.overlaps(p, rows, cols, ld, stride);
+
+}
+
+/**
+ * Constructor : element-wise combination of a node with a scalar
+ *
+ * @param  E e node
+ * @param  T s scalar
+ * @return nothing
+ *
+ */
+template <typename E, typename T, typename Op>
+ZTExprScalar<E, T, Op>::ZTExprScalar(const E& e, const T& s) : expr(e), scalar(s) {
+
+}
+
+/**
+ * [] operator : element i of a vector-shaped combination
+ *
+ * @param  std::size_t i zero-based index
+ * @return T element
+ *
+ */
+template <typename E, typename T, typename Op>
+inline T ZTExprScalar<E, T, Op>::operator[](std::size_t i) const {
+
+    return Op::apply(T(expr[i]), scalar);
+
+}
+
+/**
+ * () operator : element (row, col) of a matrix-shaped combination
+ *
+ * @param  std::size_t row zero-based row
+ * @param  std::size_t col zero-based column
+ * @return T element
+ *
+ */
+template <typename E, typename T, typename Op>
+inline T ZTExprScalar<E, T, Op>::operator()(std::size_t row, std::size_t col) const {
+
+    return Op::apply(T(expr(row, col)), scalar);
+
+}
+
+/**
+ * overlaps : whether the operand may read the destination out of place
+ *
+ * @param  void* p first element of the destination
+ * @param  std::size_t rows, cols, ld shape of the destination
+ * @return bool overlap
+ *
+ */
+template <typename E, typename T, typename Op>
+inline bool ZTExprScalar<E, T, Op>::overlaps(const void* p, std::size_t rows, std::size_t cols, std::size_t ld, std::size_t stride) const {
+
+    return expr.overlaps(p, rows, cols, ld, stride);
+
+}
+
+/**
+ * Constructor : matrix-shaped expression
+ *
+ * @param  E e root node
+ * @param  std::size_t rows, cols shape
+ * @return nothing
+ *
+ */
+template <typename T, typename E>
+ZTMatrixExpression<T, E>::ZTMatrixExpression(const E& e, std::size_t rows, std::size_t cols) :
+                                                expr(e),
+                                                matrix_rows(rows),
+                                                matrix_cols(cols) {
+
+}
+
+/**
+ * node : root node of the expression
+ *
+ * @param  nothing
+ * @return const E& node
+ *
+ */
+template <typename T, typename E>
+inline const E& ZTMatrixExpression<T, E>::node() const {
+
+    return expr;
+
+}
+
+/**
+ * Getter : ZTMatrixExpression::matrix_rows getter method
+ *
+ * @param  nothing
+ * @return std::size_t matrix_rows
+ *
+ */
+template <typename T, typename E>
+inline std::size_t ZTMatrixExpression<T, E>::get_matrix_rows() const {
+
+    return matrix_rows;
+
+}
+
+/**
+ * Getter : ZTMatrixExpression::matrix_cols getter method
+ *
+ * @param  nothing
+ * @return std::size_t matrix_cols
+ *
+ */
+template <typename T, typename E>
+inline std::size_t ZTMatrixExpression<T, E>::get_matrix_cols() const {
+
+    return matrix_cols;
+
+}
+
+/**
+ * () operator : evaluates a single element of the expression
+ *
+ * @param  std::size_t row zero-based row
+ * @param  std::size_t col zero-based column
+ * @return T element
+ *
+ */
+template <typename T, typename E>
+inline T ZTMatrixExpression<T, E>::operator()(std::size_t row, std::size_t col) const {
+
+    return expr(row, col);
+
+}
+
+/**
+ * overlaps : whether writing the expression in place to the matrix at p
+ *            could change elements that are still to be read
+ *
+ * @param  T* p first element of the destination
+ * @param  std::size_t ld leading dimension of the destination
+ * @param  std::size_t stride distance between columns of the destination
+ * @return bool overlap
+ *
+ */
+template <typename T, typename E>
+inline bool ZTMatrixExpression<T, E>::overlaps(const T* p, std::size_t ld, std::size_t stride) const {
+
+    return expr.overlaps(p, matrix_rows, matrix_cols, ld, stride);
+
+}
+
+/**
+ * eval : evaluates the expression into a new matrix in one pass
+ *
+ * @param  nothing
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T, typename E>
+ZTMatrix<T> ZTMatrixExpression<T, E>::eval() const {
+
+    return ZTMatrix<T>(*this);
+
+}
+
+/**
+ * Constructor : vector-shaped expression
+ *
+ * @param  E e root node
+ * @param  std::size_t size size
+ * @return nothing
+ *
+ */
+template <typename T, typename E>
+ZTVectorExpression<T, E>::ZTVectorExpression(const E& e, std::size_t size) : expr(e), vector_size(size) {
+
+}
+
+/**
+ * node : root node of the expression
+ *
+ * @param  nothing
+ * @return const E& node
+ *
+ */
+template <typename T, typename E>
+inline const E& ZTVectorExpression<T, E>::node() const {
+
+    return expr;
+
+}
+
+/**
+ * Getter : ZTVectorExpression::vector_size getter method
+ *
+ * @param  nothing
+ * @return std::size_t vector_size
+ *
+ */
+template <typename T, typename E>
+inline std::size_t ZTVectorExpression<T, E>::get_vector_size() const {
+
+    return vector_size;
+
+}
+
+/**
+ * [] operator : evaluates a single element of the expression
+ *
+ * @param  std::size_t i zero-based index
+ * @return T element
+ *
+ */
+template <typename T, typename E>
+inline T ZTVectorExpression<T, E>::operator[](std::size_t i) const {
+
+    return expr[i];
+
+}
+
+/**
+ * overlaps : whether writing the expression in place to the vector at p
+ *            could change elements that are still to be read
+ *
+ * @param  T* p first element of the destination
+ * @param  std::size_t stride distance between elements of the destination
+ * @return bool overlap
+ *
+ */
+template <typename T, typename E>
+inline bool ZTVectorExpression<T, E>::overlaps(const T* p, std::size_t stride) const {
+
+    return expr.overlaps(p, 1, vector_size, 0, stride);
+
+}
+
+/**
+ * eval : evaluates the expression into a new vector in one pass
+ *
+ * @param  nothing
+ * @return ZTVector<T> result
+ *
+ */
+template <typename T, typename E>
+ZTVector<T> ZTVectorExpression<T, E>::eval() const {
+
+    return ZTVector<T>(*this);
+
+}
+
+/**
+ * node : leaf over the elements of a matrix
+ *
+ */
+template <typename T>
+inline ZTExprMatrixLeaf<T> ZTMatrixOperand<ZTMatrix<T> >::node(const ZTMatrix<T>& m) {
+
+    return ZTExprMatrixLeaf<T>(m.data(), m.stride());
+
+}
+
+/**
+ * value : the matrix itself, as an operand of the matrix product
+ *
+ */
+template <typename T>
+inline const ZTMatrix<T>& ZTMatrixOperand<ZTMatrix<T> >::value(const ZTMatrix<T>& m) {
+
+    return m;
+
+}
+
+/**
+ * node : root node of a sub-expression
+ *
+ */
+template <typename T, typename E>
+inline const E& ZTMatrixOperand<ZTMatrixExpression<T, E> >::node(const ZTMatrixExpression<T, E>& e) {
+
+    return e.node();
+
+}
+
+/**
+ * value : the evaluated sub-expression, as an operand of the matrix product
+ *
+ */
+template <typename T, typename E>
+inline ZTMatrix<T> ZTMatrixOperand<ZTMatrixExpression<T, E> >::value(const ZTMatrixExpression<T, E>& e) {
+
+    return e.eval();
+
+}
+
+/**
+ * node : strided leaf over the elements of a matrix view
+ *
+ */
+template <typename T>
+inline ZTExprStridedLeaf<typename std::remove_const<T>::type> ZTMatrixOperand<ZTMatrixView<T> >::node(const ZTMatrixView<T>& m) {
+
+    return node_type(m.data(), m.ld(), m.stride());
+
+}
+
+/**
+ * value : the view itself, as an operand of the matrix product
+ *
+ */
+template <typename T>
+inline const ZTMatrixView<T>& ZTMatrixOperand<ZTMatrixView<T> >::value(const ZTMatrixView<T>& m) {
+
+    return m;
+
+}
+
+/**
+ * node : leaf over the elements of a vector
+ *
+ */
+template <typename T>
+inline ZTExprVectorLeaf<T> ZTVectorOperand<ZTVector<T> >::node(const ZTVector<T>& v) {
+
+    return ZTExprVectorLeaf<T>(v.data());
+
+}
+
+/**
+ * size : number of elements of a vector
+ *
+ */
+template <typename T>
+inline std::size_t ZTVectorOperand<ZTVector<T> >::size(const ZTVector<T>& v) {
+
+    return v.get_vector_size();
+
+}
+
+/**
+ * value : the vector itself, as an operand of the matrix-vector product
+ *
+ */
+template <typename T>
+inline const ZTVector<T>& ZTVectorOperand<ZTVector<T> >::value(const ZTVector<T>& v) {
+
+    return v;
+
+}
+
+/**
+ * node : root node of a sub-expression
+ *
+ */
+template <typename T, typename E>
+inline const E& ZTVectorOperand<ZTVectorExpression<T, E> >::node(const ZTVectorExpression<T, E>& e) {
+
+    return e.node();
+
+}
+
+/**
+ * size : number of elements of a sub-expression
+ *
+ */
+template <typename T, typename E>
+inline std::size_t ZTVectorOperand<ZTVectorExpression<T, E> >::size(const ZTVectorExpression<T, E>& e) {
+
+    return e.get_vector_size();
+
+}
+
+/**
+ * value : the evaluated sub-expression, as an operand of the matrix-vector product
+ *
+ */
+template <typename T, typename E>
+inline ZTVector<T> ZTVectorOperand<ZTVectorExpression<T, E> >::value(const ZTVectorExpression<T, E>& e) {
+
+    return e.eval();
+
+}
+
+/**
+ * node : strided leaf over the elements of a vector view
+ *
+ */
+template <typename T>
+inline ZTExprStridedLeaf<typename std::remove_const<T>::type> ZTVectorOperand<ZTVectorView<T> >::node(const ZTVectorView<T>& v) {
+
+    return node_type(v.data(), 0, v.stride());
+
+}
+
+/**
+ * size : number of elements of a vector view
+ *
+ */
+template <typename T>
+inline std::size_t ZTVectorOperand<ZTVectorView<T> >::size(const ZTVectorView<T>& v) {
+
+    return v.size();
+
+}
+
+/**
+ * value : the view itself, as an operand of the matrix-vector product
+ *
+ */
+template <typename T>
+inline const ZTVectorView<T>& ZTVectorOperand<ZTVectorView<T> >::value(const ZTVectorView<T>& v) {
+
+    return v;
+
+}
+
+/**
+ * node : leaf over the elements of a std::vector
+ *
+ */
+template <typename T>
+inline ZTExprVectorLeaf<T> ZTVectorRhsOperand<std::vector<T> >::node(const std::vector<T>& v) {
+
+    return ZTExprVectorLeaf<T>(v.data());
+
+}
+
+/**
+ * size : number of elements of a std::vector
+ *
+ */
+template <typename T>
+inline std::size_t ZTVectorRhsOperand<std::vector<T> >::size(const std::vector<T>& v) {
+
+    return v.size();
+
+}
+
+/**
+ * zt_matrix_binary : builds the node combining two matrix operands
+ *
+ * @param  L lhs left operand
+ * @param  R rhs right operand
+ * @return ZTMatrixBinaryExpression<L, R, Op> expression
+ *
+ */
+template <typename Op, typename L, typename R>
+ZTMatrixBinaryExpression<L, R, Op> zt_matrix_binary(const L& lhs, const R& rhs) {
+
+    ZT_VALIDATE(zt_valid_expression_dimensions(lhs.get_matrix_rows(), lhs.get_matrix_cols(),
+                                               rhs.get_matrix_rows(), rhs.get_matrix_cols()));
+    typedef typename ZTMatrixBinaryExpression<L, R, Op>::value_type T;
+    typedef ZTExprBinary<typename ZTMatrixOperand<L>::node_type, typename ZTMatrixOperand<R>::node_type, Op> node_type;
+    return ZTMatrixExpression<T, node_type>(node_type(ZTMatrixOperand<L>::node(lhs), ZTMatrixOperand<R>::node(rhs)),
+                                            lhs.get_matrix_rows(), lhs.get_matrix_cols());
+
+}
+
+/**
+ * zt_matrix_scalar : builds the node combining a matrix operand with a scalar
+ *
+ * @param  L lhs matrix operand
+ * @param  T scalar
+ * @return ZTMatrixScalarExpression<L, Op> expression
+ *
+ */
+template <typename Op, typename L>
+ZTMatrixScalarExpression<L, Op> zt_matrix_scalar(const L& lhs, const typename ZTMatrixOperand<L>::value_type& scalar) {
+
+    typedef typename ZTMatrixOperand<L>::value_type T;
+    typedef ZTExprScalar<typename ZTMatrixOperand<L>::node_type, T, Op> node_type;
+    return ZTMatrixExpression<T, node_type>(node_type(ZTMatrixOperand<L>::node(lhs), scalar),
+                                            lhs.get_matrix_rows(), lhs.get_matrix_cols());
+
+}
+
+/**
+ * zt_vector_binary : builds the node combining two vector operands
+ *
+ * @param  L lhs left operand
+ * @param  R rhs right operand
+ * @return ZTVectorBinaryExpression<L, R, Op> expression
+ *
+ */
+template <typename Op, typename L, typename R>
+ZTVectorBinaryExpression<L, R, Op> zt_vector_binary(const L& lhs, const R& rhs) {
+
+    ZT_VALIDATE(zt_valid_expression_dimensions(ZTVectorOperand<L>::size(lhs), 1, ZTVectorRhsOperand<R>::size(rhs), 1));
+    typedef typename ZTVectorBinaryExpression<L, R, Op>::value_type T;
+    typedef ZTExprBinary<typename ZTVectorOperand<L>::node_type, typename ZTVectorRhsOperand<R>::node_type, Op> node_type;
+    return ZTVectorExpression<T, node_type>(node_type(ZTVectorOperand<L>::node(lhs), ZTVectorRhsOperand<R>::node(rhs)),
+                                            lhs.get_vector_size());
+
+}
+
+/**
+ * zt_vector_scalar : builds the node combining a vector operand with a scalar
+ *
+ * @param  L lhs vector operand
+ * @param  T scalar
+ * @return ZTVectorScalarExpression<L, Op> expression
+ *
+ */
+template <typename Op, typename L>
+ZTVectorScalarExpression<L, Op> zt_vector_scalar(const L& lhs, const typename ZTVectorOperand<L>::value_type& scalar) {
+
+    typedef typename ZTVectorOperand<L>::value_type T;
+    typedef ZTExprScalar<typename ZTVectorOperand<L>::node_type, T, Op> node_type;
+    return ZTVectorExpression<T, node_type>(node_type(ZTVectorOperand<L>::node(lhs), scalar), lhs.get_vector_size());
+
+}
+
+/**
+ * + operator : lazy matrix to matrix addition
+ *
+ * @param  L lhs ZTMatrix or matrix expression
+ * @param  R rhs ZTMatrix or matrix expression
+ *
+ */
+template <typename L, typename R>
+inline ZTMatrixBinaryExpression<L, R, ZTExprAdd> operator+(const L& lhs, const R& rhs) {
+
+    return zt_matrix_binary<ZTExprAdd>(lhs, rhs);
+
+}
+
+/**
+ * - operator : lazy matrix to matrix subtraction
+ *
+ * @param  L lhs ZTMatrix or matrix expression
+ * @param  R rhs ZTMatrix or matrix expression
+ *
+ */
+template <typename L, typename R>
+inline ZTMatrixBinaryExpression<L, R, ZTExprMinus> operator-(const L& lhs, const R& rhs) {
+
+    return zt_matrix_binary<ZTExprMinus>(lhs, rhs);
+
+}
+
+/**
+ * * operator : matrix product, expression operands are evaluated first
+ *
+ * @param  L lhs ZTMatrix or matrix expression
+ * @param  R rhs ZTMatrix or matrix expression
+ *
+ */
+template <typename L, typename R>
+inline ZTMatrixProduct<L, R> operator*(const L& lhs, const R& rhs) {
+
+    typedef typename ZTMatrixOperand<L>::value_type T;
+    return ZTMatrixView<const T>(ZTMatrixOperand<L>::value(lhs)).matmul(ZTMatrixOperand<R>::value(rhs));
+
+}
+
+/**
+ * * operator : matrix-vector product, expression operands are evaluated first
+ *
+ * @param  L lhs ZTMatrix, ZTMatrixView or matrix expression
+ * @param  R rhs ZTVector, ZTVectorView or vector expression
+ *
+ */
+template <typename L, typename R>
+inline ZTMatrixVectorProduct<L, R> operator*(const L& lhs, const R& rhs) {
+
+    typedef typename ZTMatrixOperand<L>::value_type T;
+    return ZTMatrixView<const T>(ZTMatrixOperand<L>::value(lhs)).matvec(ZTVectorOperand<R>::value(rhs));
+
+}
+
+/**
+ * + operator : lazy matrix to scalar addition
+ *
+ * @param  L lhs ZTMatrix or matrix expression
+ * @param  T& scalar
+ *
+ */
+template <typename L>
+inline ZTMatrixScalarExpression<L, ZTExprAdd> operator+(const L& lhs, const typename ZTMatrixOperand<L>::value_type& scalar) {
+
+    return zt_matrix_scalar<ZTExprAdd>(lhs, scalar);
+
+}
+
+/**
+ * - operator : lazy matrix to scalar subtraction
+ *
+ * @param  L lhs ZTMatrix or matrix expression
+ * @param  T& scalar
+ *
+ */
+template <typename L>
+inline ZTMatrixScalarExpression<L, ZTExprMinus> operator-(const L& lhs, const typename ZTMatrixOperand<L>::value_type& scalar) {
+
+    return zt_matrix_scalar<ZTExprMinus>(lhs, scalar);
+
+}
+
+/**
+ * * operator : lazy matrix to scalar multiplication
+ *
+ * @param  L lhs ZTMatrix or matrix expression
+ * @param  T& scalar
+ *
+ */
+template <typename L>
+inline ZTMatrixScalarExpression<L, ZTExprMultiply> operator*(const L& lhs, const typename ZTMatrixOperand<L>::value_type& scalar) {
+
+    return zt_matrix_scalar<ZTExprMultiply>(lhs, scalar);
+
+}
+
+/**
+ * + operator : lazy vector to vector addition
+ *
+ * @param  L lhs ZTVector or vector expression
+ * @param  R rhs ZTVector, vector expression or std::vector
+ *
+ */
+template <typename L, typename R>
+inline ZTVectorBinaryExpression<L, R, ZTExprAdd> operator+(const L& lhs, const R& rhs) {
+
+    return zt_vector_binary<ZTExprAdd>(lhs, rhs);
+
+}
+
+/**
+ * - operator : lazy vector to vector subtraction
+ *
+ * @param  L lhs ZTVector or vector expression
+ * @param  R rhs ZTVector, vector expression or std::vector
+ *
+ */
+template <typename L, typename R>
+inline ZTVectorBinaryExpression<L, R, ZTExprMinus> operator-(const L& lhs, const R& rhs) {
+
+    return zt_vector_binary<ZTExprMinus>(lhs, rhs);
+
+}
+
+/**
+ * + operator : lazy vector to scalar addition
+ *
+ * @param  L lhs ZTVector or vector expression
+ * @param  T& scalar
+ *
+ */
+template <typename L>
+inline ZTVectorScalarExpression<L, ZTExprAdd> operator+(const L& lhs, const typename ZTVectorOperand<L>::value_type& scalar) {
+
+    return zt_vector_scalar<ZTExprAdd>(lhs, scalar);
+
+}
+
+/**
+ * - operator : lazy vector to scalar subtraction
+ *
+ * @param  L lhs ZTVector or vector expression
+ * @param  T& scalar
+ *
+ */
+template <typename L>
+inline ZTVectorScalarExpression<L, ZTExprMinus> operator-(const L& lhs, const typename ZTVectorOperand<L>::value_type& scalar) {
+
+    return zt_vector_scalar<ZTExprMinus>(lhs, scalar);
+
+}
+
+/**
+ * * operator : lazy vector to scalar multiplication
+ *
+ * @param  L lhs ZTVector or vector expression
+ * @param  T& scalar
+ *
+ */
+template <typename L>
+inline ZTVectorScalarExpression<L, ZTExprMultiply> operator*(const L& lhs, const typename ZTVectorOperand<L>::value_type& scalar) {
+
+    return zt_vector_scalar<ZTExprMultiply>(lhs, scalar);
+
+}
@@ -0,0 +1,371 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ZTEXPRESSION_H
+#define ZTEXPRESSION_H
+
+#include <vector>
+#include <type_traits>
+
+#include "ZTMatrix.h"
+#include "ZTVector.h"
+#include "ZTMatrixView.h"
+#include "ZTVectorView.h"
+
+/*
+ * Expression templates : the +, - and scalar * operators of ZTMatrix and
+ * ZTVector build a tree of lightweight nodes instead of a temporary per
+ * operator. The tree is evaluated element by element in a single fused loop
+ * when it is assigned to a ZTMatrix/ZTVector, added to one with += / -=, or
+ * when eval() is called, so a chain of n operators reads every operand once
+ * and writes the result once.
+ *
+ * ZTMatrixView and ZTVectorView operands take part through strided leaves, so
+ * blocks, rows, columns and transposes fuse the same way whole objects do.
+ *
+ * Nodes refer to their operands, which must outlive the expression: assign it
+ * within the full expression that built it rather than keeping it in an auto
+ * variable.
+ *
+ * Assigning in place is safe while every leaf reads element (r, c) of the
+ * destination only. A leaf laid out differently over the same memory can read
+ * other elements of it, as in X = X.view().transpose() + Z or in a block
+ * assigned from a shifted block of the same matrix, so overlaps() checks every
+ * leaf against the destination and its strides, and the assignment evaluates
+ * into a temporary when one may.
+ */
+
+struct ZTExprAdd {
+    template <typename T>
+    static T apply(const T& a, const T& b) { return a + b; }
+};
+
+struct ZTExprMinus {
+    template <typename T>
+    static T apply(const T& a, const T& b) { return a - b; }
+};
+
+struct ZTExprMultiply {
+    template <typename T>
+    static T apply(const T& a, const T& b) { return a * b; }
+};
+
+/*
+ * Leaf over the contiguous elements of a ZTVector or std::vector.
+ */
+template <typename T>
+class ZTExprVectorLeaf {
+
+private:
+    const T* values;
+
+public:
+    typedef T value_type;
+
+    explicit ZTExprVectorLeaf(const T* v);
+
+    T operator [](std::size_t i) const;
+    bool overlaps(const void* p, std::size_t rows, std::size_t cols, std::size_t ld, std::size_t stride) const;
+
+};
+
+/*
+ * Leaf over the row-major elements of a ZTMatrix with leading dimension ld.
+ */
+template <typename T>
+class ZTExprMatrixLeaf {
+
+private:
+    const T* values;
+    std::size_t ld;
+
+public:
+    typedef T value_type;
+
+    ZTExprMatrixLeaf(const T* v, std::size_t stride);
+
+    T operator ()(std::size_t row, std::size_t col) const;
+    bool overlaps(const void* p, std::size_t rows, std::size_t cols, std::size_t ld, std::size_t stride) const;
+
+};
+
+/*
+ * Leaf over the elements of a ZTMatrixView or ZTVectorView : element (row, col)
+ * lives at values[row * ld + col * inc] and element i at values[i * inc].
+ */
+template <typename T>
+class ZTExprStridedLeaf {
+
+private:
+    const T* values;
+    std::size_t ld;
+    std::size_t inc;
+
+public:
+    typedef T value_type;
+
+    ZTExprStridedLeaf(const T* v, std::size_t row_stride, std::size_t inc);
+
+    T operator [](std::size_t i) const;
+    T operator ()(std::size_t row, std::size_t col) const;
+    bool overlaps(const void* p, std::size_t rows, std::size_t cols, std::size_t ld, std::size_t stride) const;
+
+};
+
+/*
+ * Element-wise combination of two nodes.
+ */
+template <typename L, typename R, typename Op>
+class ZTExprBinary {
+
+private:
+    L lhs;
+    R rhs;
+
+public:
+    typedef typename L::value_type value_type;
+
+    ZTExprBinary(const L& l, const R& r);
+
+    value_type operator [](std::size_t i) const;
+    value_type operator ()(std::size_t row, std::size_t col) const;
+    bool overlaps(const void* p, std::size_t rows, std::size_t cols, std::size_t ld, std::size_t stride) const;
+
+};
+
+/*
+ * Element-wise combination of a node with a scalar on its right.
+ */
+template <typename E, typename T, typename Op>
+class ZTExprScalar {
+
+private:
+    E expr;
+    T scalar;
+
+public:
+    typedef T value_type;
+
+    ZTExprScalar(const E& e, const T& s);
+
+    T operator [](std::size_t i) const;
+    T operator ()(std::size_t row, std::size_t col) const;
+    bool overlaps(const void* p, std::size_t rows, std::size_t cols, std::size_t ld, std::size_t stride) const;
+
+};
+
+/*
+ * Matrix-shaped expression of element type T over node E.
+ */
+template <typename T, typename E>
+class ZTMatrixExpression {
+
+private:
+    E expr;
+    std::size_t matrix_rows;
+    std::size_t matrix_cols;
+
+public:
+    typedef T value_type;
+
+    ZTMatrixExpression(const E& e, std::size_t rows, std::size_t cols);
+
+    const E& node() const;
+    std::size_t get_matrix_rows() const;
+    std::size_t get_matrix_cols() const;
+
+    T operator ()(std::size_t row, std::size_t col) const; // zero-based
+    bool overlaps(const T* p, std::size_t ld, std::size_t stride = 1) const; // whether assigning in place to p would read overwritten elements
+
+    ZTMatrix<T> eval() const;
+
+};
+
+/*
+ * Vector-shaped expression of element type T over node E.
+ */
+template <typename T, typename E>
+class ZTVectorExpression {
+
+private:
+    E expr;
+    std::size_t vector_size;
+
+public:
+    typedef T value_type;
+
+    ZTVectorExpression(const E& e, std::size_t size);
+
+    const E& node() const;
+    std::size_t get_vector_size() const;
+
+    T operator [](std::size_t i) const;
+    bool overlaps(const T* p, std::size_t stride = 1) const; // whether assigning in place to p would read overwritten elements
+
+    ZTVector<T> eval() const;
+
+};
+
+/*
+ * ZTMatrixOperand / ZTVectorOperand : what may appear on either side of a
+ * matrix or vector operator, and the node it contributes to the tree. Types
+ * without a specialization drop the operators out of overload resolution.
+ * std::vector is accepted on the right of a ZTVector operator, as before.
+ * Views of const elements are accepted wherever mutable ones are.
+ */
+template <typename X>
+struct ZTMatrixOperand {};
+
+template <typename T>
+struct ZTMatrixOperand<ZTMatrix<T> > {
+    typedef T value_type;
+    typedef ZTExprMatrixLeaf<T> node_type;
+    static node_type node(const ZTMatrix<T>& m);
+    static const ZTMatrix<T>& value(const ZTMatrix<T>& m);
+};
+
+template <typename T, typename E>
+struct ZTMatrixOperand<ZTMatrixExpression<T, E> > {
+    typedef T value_type;
+    typedef E node_type;
+    static const node_type& node(const ZTMatrixExpression<T, E>& e);
+    static ZTMatrix<T> value(const ZTMatrixExpression<T, E>& e);
+};
+
+template <typename T>
+struct ZTMatrixOperand<ZTMatrixView<T> > {
+    typedef typename std::remove_const<T>::type value_type;
+    typedef ZTExprStridedLeaf<value_type> node_type;
+    static node_type node(const ZTMatrixView<T>& m);
+    static const ZTMatrixView<T>& value(const ZTMatrixView<T>& m);
+};
+
+template <typename X>
+struct ZTVectorOperand {};
+
+template <typename T>
+struct ZTVectorOperand<ZTVector<T> > {
+    typedef T value_type;
+    typedef ZTExprVectorLeaf<T> node_type;
+    static node_type node(const ZTVector<T>& v);
+    static std::size_t size(const ZTVector<T>& v);
+    static const ZTVector<T>& value(const ZTVector<T>& v);
+};
+
+template <typename T, typename E>
+struct ZTVectorOperand<ZTVectorExpression<T, E> > {
+    typedef T value_type;
+    typedef E node_type;
+    static const node_type& node(const ZTVectorExpression<T, E>& e);
+    static std::size_t size(const ZTVectorExpression<T, E>& e);
+    static ZTVector<T> value(const ZTVectorExpression<T, E>& e);
+};
+
+template <typename T>
+struct ZTVectorOperand<ZTVectorView<T> > {
+    typedef typename std::remove_const<T>::type value_type;
+    typedef ZTExprStridedLeaf<value_type> node_type;
+    static node_type node(const ZTVectorView<T>& v);
+    static std::size_t size(const ZTVectorView<T>& v);
+    static const ZTVectorView<T>& value(const ZTVectorView<T>& v);
+};
+
+template <typename X>
+struct ZTVectorRhsOperand : ZTVectorOperand<X> {};
+
+template <typename T>
+struct ZTVectorRhsOperand<std::vector<T> > {
+    typedef T value_type;
+    typedef ZTExprVectorLeaf<T> node_type;
+    static node_type node(const std::vector<T>& v);
+    static std::size_t size(const std::vector<T>& v);
+};
+
+void zt_valid_expression_dimensions(std::size_t rows, std::size_t cols,
+                                    std::size_t other_rows, std::size_t other_cols);
+
+template <typename L, typename R, typename Op>
+using ZTMatrixBinaryExpression = ZTMatrixExpression<typename ZTMatrixOperand<L>::value_type,
+    ZTExprBinary<typename ZTMatrixOperand<L>::node_type, typename ZTMatrixOperand<R>::node_type, Op> >;
+
+template <typename L, typename Op>
+using ZTMatrixScalarExpression = ZTMatrixExpression<typename ZTMatrixOperand<L>::value_type,
+    ZTExprScalar<typename ZTMatrixOperand<L>::node_type, typename ZTMatrixOperand<L>::value_type, Op> >;
+
+template <typename L, typename R, typename Op>
+using ZTVectorBinaryExpression = ZTVectorExpression<typename ZTVectorOperand<L>::value_type,
+    ZTExprBinary<typename ZTVectorOperand<L>::node_type, typename ZTVectorRhsOperand<R>::node_type, Op> >;
+
+template <typename L, typename Op>
+using ZTVectorScalarExpression = ZTVectorExpression<typename ZTVectorOperand<L>::value_type,
+    ZTExprScalar<typename ZTVectorOperand<L>::node_type, typename ZTVectorOperand<L>::value_type, Op> >;
+
+template <typename L, typename R>
+using ZTMatrixProduct = typename std::enable_if<
+    std::is_same<typename ZTMatrixOperand<L>::value_type, typename ZTMatrixOperand<R>::value_type>::value,
+    ZTMatrix<typename ZTMatrixOperand<L>::value_type> >::type;
+
+template <typename Op, typename L, typename R>
+ZTMatrixBinaryExpression<L, R, Op> zt_matrix_binary(const L& lhs, const R& rhs);
+template <typename Op, typename L>
+ZTMatrixScalarExpression<L, Op> zt_matrix_scalar(const L& lhs, const typename ZTMatrixOperand<L>::value_type& scalar);
+template <typename Op, typename L, typename R>
+ZTVectorBinaryExpression<L, R, Op> zt_vector_binary(const L& lhs, const R& rhs);
+template <typename Op, typename L>
+ZTVectorScalarExpression<L, Op> zt_vector_scalar(const L& lhs, const typename ZTVectorOperand<L>::value_type& scalar);
+
+template <typename L, typename R>
+using ZTMatrixVectorProduct = typename std::enable_if<
+    std::is_same<typename ZTMatrixOperand<L>::value_type, typename ZTVectorOperand<R>::value_type>::value,
+    ZTVector<typename ZTMatrixOperand<L>::value_type> >::type;
+
+template <typename L, typename R>
+ZTMatrixBinaryExpression<L, R, ZTExprAdd> operator +(const L& lhs, const R& rhs);
+template <typename L, typename R>
+ZTMatrixBinaryExpression<L, R, ZTExprMinus> operator -(const L& lhs, const R& rhs);
+template <typename L, typename R>
+ZTMatrixProduct<L, R> operator *(const L& lhs, const R& rhs); // matrix product, evaluated eagerly
+template <typename L, typename R>
+ZTMatrixVectorProduct<L, R> operator *(const L& lhs, const R& rhs); // matrix-vector product, evaluated eagerly
+
+template <typename L>
+ZTMatrixScalarExpression<L, ZTExprAdd> operator +(const L& lhs, const typename ZTMatrixOperand<L>::value_type& scalar);
+template <typename L>
+ZTMatrixScalarExpression<L, ZTExprMinus> operator -(const L& lhs, const typename ZTMatrixOperand<L>::value_type& scalar);
+template <typename L>
+ZTMatrixScalarExpression<L, ZTExprMultiply> operator *(const L& lhs, const typename ZTMatrixOperand<L>::value_type& scalar);
+
+template <typename L, typename R>
+ZTVectorBinaryExpression<L, R, ZTExprAdd> operator +(const L& lhs, const R& rhs);
+template <typename L, typename R>
+ZTVectorBinaryExpression<L, R, ZTExprMinus> operator -(const L& lhs, const R& rhs);
+
+template <typename L>
+ZTVectorScalarExpression<L, ZTExprAdd> operator +(const L& lhs, const typename ZTVectorOperand<L>::value_type& scalar);
+template <typename L>
+ZTVectorScalarExpression<L, ZTExprMinus> operator -(const L& lhs, const typename ZTVectorOperand<L>::value_type& scalar);
+template <typename L>
+ZTVectorScalarExpression<L, ZTExprMultiply> operator *(const L& lhs, const typename ZTVectorOperand<L>::value_type& scalar);
+
+#endif /* ZTEXPRESSION_H */
@@ -0,0 +1,922 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+
+#include "ZTError.h"
+#include "ZTFixedMatrix.h"
+
+/**
+ * Constructor : Constructs a R x C Matrix with all elements set to elements
+ *
+ * @param  T& elements initial value
+ * @return nothing
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+ZTFixedMatrix<T, R, C>::ZTFixedMatrix(const T& elements) {
+
+    _Pragma("GCC unroll 16") for (std::size_t i = 0; i < R * C; ++i)
+    {
+        matrix_data[i] = elements;
+    }
+
+}
+
+/**
+ * Constructor : Constructs a R x C Matrix from its row-major elements
+ *
+ * @param  std::array<T, R * C> m
+ * @return nothing
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+ZTFixedMatrix<T, R, C>::ZTFixedMatrix(const std::array<T, R * C>& m) {
+
+    _Pragma("GCC unroll 16") for (std::size_t i = 0; i < R * C; ++i)
+    {
+        matrix_data[i] = m[i];
+    }
+
+}
+
+/**
+ * data : pointer to the first element
+ *
+ * @param  nothing
+ * @return T* data
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+inline T* ZTFixedMatrix<T, R, C>::data() {
+
+    return matrix_data;
+
+}
+
+/**
+ * data : pointer to the first element
+ *
+ * @param  nothing
+ * @return const T* data
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+inline const T* ZTFixedMatrix<T, R, C>::data() const {
+
+    return matrix_data;
+
+}
+
+/**
+ * view : view of all the elements of the matrix
+ *
+ * @param  nothing
+ * @return ZTMatrixView<T> view
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+inline ZTMatrixView<T> ZTFixedMatrix<T, R, C>::view() {
+
+    return ZTMatrixView<T>(matrix_data, R, C, C);
+
+}
+
+/**
+ * view : read-only view of all the elements of the matrix
+ *
+ * @param  nothing
+ * @return ZTMatrixView<const T> view
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+inline ZTMatrixView<const T> ZTFixedMatrix<T, R, C>::view() const {
+
+    return ZTMatrixView<const T>(matrix_data, R, C, C);
+
+}
+
+/**
+ * add : performs matrix to scalar addition
+ *
+ * @param  T& scalar
+ * @return ZTFixedMatrix<T, R, C> result
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+inline ZTFixedMatrix<T, R, C> ZTFixedMatrix<T, R, C>::add(const T& scalar) const {
+
+    ZTFixedMatrix<T, R, C> result(*this);
+    result.cummulative_add(scalar);
+    return result;
+
+}
+
+/**
+ * minus : performs matrix to scalar subtraction
+ *
+ * @param  T& scalar
+ * @return ZTFixedMatrix<T, R, C> result
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+inline ZTFixedMatrix<T, R, C> ZTFixedMatrix<T, R, C>::minus(const T& scalar) const {
+
+    ZTFixedMatrix<T, R, C> result(*this);
+    result.cummulative_minus(scalar);
+    return result;
+
+}
+
+/**
+ * multiply : performs matrix to scalar multiplication
+ *
+ * @param  T& scalar
+ * @return ZTFixedMatrix<T, R, C> result
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+inline ZTFixedMatrix<T, R, C> ZTFixedMatrix<T, R, C>::multiply(const T& scalar) const {
+
+    ZTFixedMatrix<T, R, C> result(*this);
+    result.cummulative_multiply(scalar);
+    return result;
+
+}
+
+/**
+ * cummulative_add : performs matrix to scalar cummulative addition
+ *
+ * @param  T& scalar
+ * @return *this (instance of ZTFixedMatrix<T, R, C>)
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+inline ZTFixedMatrix<T, R, C>& ZTFixedMatrix<T, R, C>::cummulative_add(const T& scalar) {
+
+    _Pragma("GCC unroll 16") for (std::size_t i = 0; i < R * C; ++i)
+    {
+        matrix_data[i] += scalar;
+    }
+    return *this;
+
+}
+
+/**
+ * cummulative_minus : performs matrix to scalar cummulative subtraction
+ *
+ * @param  T& scalar
+ * @return *this (instance of ZTFixedMatrix<T, R, C>)
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+inline ZTFixedMatrix<T, R, C>& ZTFixedMatrix<T, R, C>::cummulative_minus(const T& scalar) {
+
+    _Pragma("GCC unroll 16") for (std::size_t i = 0; i < R * C; ++i)
+    {
+        matrix_data[i] -= scalar;
+    }
+    return *this;
+
+}
+
+/**
+ * cummulative_multiply : performs matrix to scalar cummulative multiplication
+ *
+ * @param  T& scalar
+ * @return *this (instance of ZTFixedMatrix<T, R, C>)
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+inline ZTFixedMatrix<T, R, C>& ZTFixedMatrix<T, R, C>::cummulative_multiply(const T& scalar) {
+
+    _Pragma("GCC unroll 16") for (std::size_t i = 0; i < R * C; ++i)
+    {
+        matrix_data[i] *= scalar;
+    }
+    return *this;
+
+}
+
+/**
+ * add : performs matrix to matrix addition
+ *
+ * @param  ZTFixedMatrix<T, R2, C2> m
+ * @return ZTFixedMatrix<T, R, C> result
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+template <std::size_t R2, std::size_t C2>
+inline ZTFixedMatrix<T, R, C> ZTFixedMatrix<T, R, C>::add(const ZTFixedMatrix<T, R2, C2>& m) const {
+
+    ZTFixedMatrix<T, R, C> result(*this);
+    result.cummulative_add(m);
+    return result;
+
+}
+
+/**
+ * minus : performs matrix to matrix subtraction
+ *
+ * @param  ZTFixedMatrix<T, R2, C2> m
+ * @return ZTFixedMatrix<T, R, C> result
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+template <std::size_t R2, std::size_t C2>
+inline ZTFixedMatrix<T, R, C> ZTFixedMatrix<T, R, C>::minus(const ZTFixedMatrix<T, R2, C2>& m) const {
+
+    ZTFixedMatrix<T, R, C> result(*this);
+    result.cummulative_minus(m);
+    return result;
+
+}
+
+/**
+ * multiply : performs matrix to matrix multiplication
+ *
+ * @param  ZTFixedMatrix<T, R2, C2> m
+ * @return ZTFixedMatrix<T, R, C2> result
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+template <std::size_t R2, std::size_t C2>
+inline ZTFixedMatrix<T, R, C2> ZTFixedMatrix<T, R, C>::multiply(const ZTFixedMatrix<T, R2, C2>& m) const {
+
+    return matmul(m);
+
+}
+
+/**
+ * cummulative_add : performs matrix to matrix cummulative addition
+ *
+ * @param  ZTFixedMatrix<T, R2, C2> m
+ * @return *this (instance of ZTFixedMatrix<T, R, C>)
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+template <std::size_t R2, std::size_t C2>
+inline ZTFixedMatrix<T, R, C>& ZTFixedMatrix<T, R, C>::cummulative_add(const ZTFixedMatrix<T, R2, C2>& m) {
+
+    valid_matrix_add_minus<R2, C2>();
+    const T* b = m.data();
+    _Pragma("GCC unroll 16") for (std::size_t i = 0; i < R * C; ++i)
+    {
+        matrix_data[i] += b[i];
+    }
+    return *this;
+
+}
+
+/**
+ * cummulative_minus : performs matrix to matrix cummulative subtraction
+ *
+ * @param  ZTFixedMatrix<T, R2, C2> m
+ * @return *this (instance of ZTFixedMatrix<T, R, C>)
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+template <std::size_t R2, std::size_t C2>
+inline ZTFixedMatrix<T, R, C>& ZTFixedMatrix<T, R, C>::cummulative_minus(const ZTFixedMatrix<T, R2, C2>& m) {
+
+    valid_matrix_add_minus<R2, C2>();
+    const T* b = m.data();
+    _Pragma("GCC unroll 16") for (std::size_t i = 0; i < R * C; ++i)
+    {
+        matrix_data[i] -= b[i];
+    }
+    return *this;
+
+}
+
+/**
+ * cummulative_multiply : performs matrix to matrix cummulative multiplication
+ *
+ * @param  ZTFixedMatrix<T, R2, C2> m
+ * @return *this (instance of ZTFixedMatrix<T, R, C>)
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+template <std::size_t R2, std::size_t C2>
+inline ZTFixedMatrix<T, R, C>& ZTFixedMatrix<T, R, C>::cummulative_multiply(const ZTFixedMatrix<T, R2, C2>& m) {
+
+    static_assert(C2 == C, "Matrix cannot hold the result of the product!.");
+    *this = matmul(m);
+    return *this;
+
+}
+
+/**
+ * matmul : performs the matrix product, unrolled over the constant dimensions.
+ *          Each row of the result accumulates scaled rows of m, so the
+ *          innermost loop runs along contiguous elements
+ *
+ * @param  ZTFixedMatrix<T, R2, C2> m
+ * @return ZTFixedMatrix<T, R, C2> result (R x C2)
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+template <std::size_t R2, std::size_t C2>
+inline ZTFixedMatrix<T, R, C2> ZTFixedMatrix<T, R, C>::matmul(const ZTFixedMatrix<T, R2, C2>& m) const {
+
+    valid_matrix_product<R2, C2>();
+    ZTFixedMatrix<T, R, C2> result;
+    const T* b = m.data();
+    T* z = result.data();
+    _Pragma("GCC unroll 16") for (std::size_t i = 0; i < R; ++i)
+    {
+        _Pragma("GCC unroll 16") for (std::size_t k = 0; k < C; ++k)
+        {
+            const T a = matrix_data[i * C + k];
+            _Pragma("GCC unroll 16") for (std::size_t j = 0; j < C2; ++j)
+            {
+                z[i * C2 + j] += a * b[k * C2 + j];
+            }
+        }
+    }
+    return result;
+
+}
+
+/**
+ * hadamard : performs matrix to matrix element-wise multiplication
+ *
+ * @param  ZTFixedMatrix<T, R2, C2> m
+ * @return ZTFixedMatrix<T, R, C> result
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+template <std::size_t R2, std::size_t C2>
+inline ZTFixedMatrix<T, R, C> ZTFixedMatrix<T, R, C>::hadamard(const ZTFixedMatrix<T, R2, C2>& m) const {
+
+    ZTFixedMatrix<T, R, C> result(*this);
+    result.cummulative_hadamard(m);
+    return result;
+
+}
+
+/**
+ * cummulative_hadamard : performs matrix to matrix cummulative element-wise multiplication
+ *
+ * @param  ZTFixedMatrix<T, R2, C2> m
+ * @return *this (instance of ZTFixedMatrix<T, R, C>)
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+template <std::size_t R2, std::size_t C2>
+inline ZTFixedMatrix<T, R, C>& ZTFixedMatrix<T, R, C>::cummulative_hadamard(const ZTFixedMatrix<T, R2, C2>& m) {
+
+    valid_matrix_add_minus<R2, C2>();
+    const T* b = m.data();
+    _Pragma("GCC unroll 16") for (std::size_t i = 0; i < R * C; ++i)
+    {
+        matrix_data[i] *= b[i];
+    }
+    return *this;
+
+}
+
+/**
+ * matvec : performs the matrix-vector product, unrolled over the constant
+ *          dimensions
+ *
+ * @param  ZTFixedVector<T, N> v
+ * @return ZTFixedVector<T, R> result
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+template <std::size_t N>
+inline ZTFixedVector<T, R> ZTFixedMatrix<T, R, C>::matvec(const ZTFixedVector<T, N>& v) const {
+
+    static_assert(N == C, "Matrix and vector are not suitable for matrix-vector product!.");
+    ZTFixedVector<T, R> result;
+    _Pragma("GCC unroll 16") for (std::size_t i = 0; i < R; ++i)
+    {
+        T sum = T(0);
+        _Pragma("GCC unroll 16") for (std::size_t j = 0; j < C; ++j)
+        {
+            sum += matrix_data[i * C + j] * v[j];
+        }
+        result[i] = sum;
+    }
+    return result;
+
+}
+
+/**
+ * matvec_transposed : performs the product of the transpose with a vector,
+ *                     accumulating scaled rows so the inner loop is contiguous
+ *
+ * @param  ZTFixedVector<T, N> v
+ * @return ZTFixedVector<T, C> result
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+template <std::size_t N>
+inline ZTFixedVector<T, C> ZTFixedMatrix<T, R, C>::matvec_transposed(const ZTFixedVector<T, N>& v) const {
+
+    static_assert(N == R, "Matrix and vector are not suitable for matrix-vector product!.");
+    ZTFixedVector<T, C> result;
+    _Pragma("GCC unroll 16") for (std::size_t i = 0; i < R; ++i)
+    {
+        const T vi = v[i];
+        _Pragma("GCC unroll 16") for (std::size_t j = 0; j < C; ++j)
+        {
+            result[j] += matrix_data[i * C + j] * vi;
+        }
+    }
+    return result;
+
+}
+
+/**
+ * + operator : performs matrix to scalar addition
+ *
+ * @param  T& scalar
+ * @return ZTFixedMatrix<T, R, C> result
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+inline ZTFixedMatrix<T, R, C> ZTFixedMatrix<T, R, C>::operator+(const T& scalar) const {
+
+    return add(scalar);
+
+}
+
+/**
+ * - operator : performs matrix to scalar subtraction
+ *
+ * @param  T& scalar
+ * @return ZTFixedMatrix<T, R, C> result
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+inline ZTFixedMatrix<T, R, C> ZTFixedMatrix<T, R, C>::operator-(const T& scalar) const {
+
+    return minus(scalar);
+
+}
+
+/**
+ * * operator : performs matrix to scalar multiplication
+ *
+ * @param  T& scalar
+ * @return ZTFixedMatrix<T, R, C> result
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+inline ZTFixedMatrix<T, R, C> ZTFixedMatrix<T, R, C>::operator*(const T& scalar) const {
+
+    return multiply(scalar);
+
+}
+
+/**
+ * += operator : performs matrix to scalar cummulative addition
+ *
+ * @param  T& scalar
+ * @return *this (instance of ZTFixedMatrix<T, R, C>)
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+inline ZTFixedMatrix<T, R, C>& ZTFixedMatrix<T, R, C>::operator+=(const T& scalar) {
+
+    return cummulative_add(scalar);
+
+}
+
+/**
+ * -= operator : performs matrix to scalar cummulative subtraction
+ *
+ * @param  T& scalar
+ * @return *this (instance of ZTFixedMatrix<T, R, C>)
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+inline ZTFixedMatrix<T, R, C>& ZTFixedMatrix<T, R, C>::operator-=(const T& scalar) {
+
+    return cummulative_minus(scalar);
+
+}
+
+/**
+ * *= operator : performs matrix to scalar cummulative multiplication
+ *
+ * @param  T& scalar
+ * @return *this (instance of ZTFixedMatrix<T, R, C>)
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+inline ZTFixedMatrix<T, R, C>& ZTFixedMatrix<T, R, C>::operator*=(const T& scalar) {
+
+    return cummulative_multiply(scalar);
+
+}
+
+/**
+ * + operator : performs matrix to matrix addition
+ *
+ * @param  ZTFixedMatrix<T, R2, C2> m
+ * @return ZTFixedMatrix<T, R, C> result
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+template <std::size_t R2, std::size_t C2>
+inline ZTFixedMatrix<T, R, C> ZTFixedMatrix<T, R, C>::operator+(const ZTFixedMatrix<T, R2, C2>& m) const {
+
+    return add(m);
+
+}
+
+/**
+ * - operator : performs matrix to matrix subtraction
+ *
+ * @param  ZTFixedMatrix<T, R2, C2> m
+ * @return ZTFixedMatrix<T, R, C> result
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+template <std::size_t R2, std::size_t C2>
+inline ZTFixedMatrix<T, R, C> ZTFixedMatrix<T, R, C>::operator-(const ZTFixedMatrix<T, R2, C2>& m) const {
+
+    return minus(m);
+
+}
+
+/**
+ * * operator : performs matrix to matrix multiplication
+ *
+ * @param  ZTFixedMatrix<T, R2, C2> m
+ * @return ZTFixedMatrix<T, R, C2> result
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+template <std::size_t R2, std::size_t C2>
+inline ZTFixedMatrix<T, R, C2> ZTFixedMatrix<T, R, C>::operator*(const ZTFixedMatrix<T, R2, C2>& m) const {
+
+    return matmul(m);
+
+}
+
+/**
+ * * operator : performs the matrix-vector product
+ *
+ * @param  ZTFixedVector<T, N> v
+ * @return ZTFixedVector<T, R> result
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+template <std::size_t N>
+inline ZTFixedVector<T, R> ZTFixedMatrix<T, R, C>::operator*(const ZTFixedVector<T, N>& v) const {
+
+    return matvec(v);
+
+}
+
+/**
+ * += operator : performs matrix to matrix cummulative addition
+ *
+ * @param  ZTFixedMatrix<T, R2, C2> m
+ * @return *this (instance of ZTFixedMatrix<T, R, C>)
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+template <std::size_t R2, std::size_t C2>
+inline ZTFixedMatrix<T, R, C>& ZTFixedMatrix<T, R, C>::operator+=(const ZTFixedMatrix<T, R2, C2>& m) {
+
+    return cummulative_add(m);
+
+}
+
+/**
+ * -= operator : performs matrix to matrix cummulative subtraction
+ *
+ * @param  ZTFixedMatrix<T, R2, C2> m
+ * @return *this (instance of ZTFixedMatrix<T, R, C>)
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+template <std::size_t R2, std::size_t C2>
+inline ZTFixedMatrix<T, R, C>& ZTFixedMatrix<T, R, C>::operator-=(const ZTFixedMatrix<T, R2, C2>& m) {
+
+    return cummulative_minus(m);
+
+}
+
+/**
+ * *= operator : performs matrix to matrix cummulative multiplication
+ *
+ * @param  ZTFixedMatrix<T, R2, C2> m
+ * @return *this (instance of ZTFixedMatrix<T, R, C>)
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+template <std::size_t R2, std::size_t C2>
+inline ZTFixedMatrix<T, R, C>& ZTFixedMatrix<T, R, C>::operator*=(const ZTFixedMatrix<T, R2, C2>& m) {
+
+    return cummulative_multiply(m);
+
+}
+
+/**
+ * () operator : get the matrix element given the subscripts (row, col)
+ *
+ * @param  std::size_t row_index one-based row
+ * @param  std::size_t col_index one-based column
+ * @return T result
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+inline T& ZTFixedMatrix<T, R, C>::operator()(std::size_t row_index, std::size_t col_index) {
+
+    ZT_VALIDATE(valid_subscript_dimensions(row_index, col_index));
+    return matrix_data[(row_index - 1) * C + (col_index - 1)];
+
+}
+
+/**
+ * () operator : get the matrix element given the subscripts (row, col)
+ *
+ * @param  std::size_t row_index one-based row
+ * @param  std::size_t col_index one-based column
+ * @return const T result
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+inline const T& ZTFixedMatrix<T, R, C>::operator()(std::size_t row_index, std::size_t col_index) const {
+
+    ZT_VALIDATE(valid_subscript_dimensions(row_index, col_index));
+    return matrix_data[(row_index - 1) * C + (col_index - 1)];
+
+}
+
+/**
+ * at : get the matrix element at zero-based (row, col), the subscripts are
+ *      checked whatever the error policy
+ *
+ * @param  std::size_t row zero-based row
+ * @param  std::size_t col zero-based column
+ * @return T& element
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+inline T& ZTFixedMatrix<T, R, C>::at(std::size_t row, std::size_t col) {
+
+    valid_index_dimensions(row, col);
+    return matrix_data[row * C + col];
+
+}
+
+/**
+ * at : get the matrix element at zero-based (row, col), the subscripts are
+ *      checked whatever the error policy
+ *
+ * @param  std::size_t row zero-based row
+ * @param  std::size_t col zero-based column
+ * @return const T& element
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+inline const T& ZTFixedMatrix<T, R, C>::at(std::size_t row, std::size_t col) const {
+
+    valid_index_dimensions(row, col);
+    return matrix_data[row * C + col];
+
+}
+
+/**
+ * [] operator : pointer to the first element of zero-based row, m[row][col]
+ *              is a single unchecked load
+ *
+ * @param  std::size_t row zero-based row
+ * @return T* row
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+inline T* ZTFixedMatrix<T, R, C>::operator[](std::size_t row) {
+
+    return matrix_data + row * C;
+
+}
+
+/**
+ * [] operator : pointer to the first element of zero-based row, m[row][col]
+ *              is a single unchecked load
+ *
+ * @param  std::size_t row zero-based row
+ * @return const T* row
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+inline const T* ZTFixedMatrix<T, R, C>::operator[](std::size_t row) const {
+
+    return matrix_data + row * C;
+
+}
+
+/**
+ * unsafe_get : get the matrix element at zero-based (row, col) without checks
+ *
+ * @param  std::size_t row zero-based row
+ * @param  std::size_t col zero-based column
+ * @return T& element
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+inline T& ZTFixedMatrix<T, R, C>::unsafe_get(std::size_t row, std::size_t col) {
+
+    return matrix_data[row * C + col];
+
+}
+
+/**
+ * unsafe_get : get the matrix element at zero-based (row, col) without checks
+ *
+ * @param  std::size_t row zero-based row
+ * @param  std::size_t col zero-based column
+ * @return const T& element
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+inline const T& ZTFixedMatrix<T, R, C>::unsafe_get(std::size_t row, std::size_t col) const {
+
+    return matrix_data[row * C + col];
+
+}
+
+/**
+ * trace : performs matrix trace operation
+ *
+ * @param  nothing
+ * @return T result
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+inline T ZTFixedMatrix<T, R, C>::trace() const {
+
+    valid_sqaure_matrix<R, C>();
+    T result = 0;
+    _Pragma("GCC unroll 16") for (std::size_t i = 0; i < R; ++i)
+    {
+        result += matrix_data[i * C + i];
+    }
+    return result;
+
+}
+
+/**
+ * trace : performs matrix to matrix trace operation
+ *
+ * @param  ZTFixedMatrix<T, R2, C2> m
+ * @return T result
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+template <std::size_t R2, std::size_t C2>
+inline T ZTFixedMatrix<T, R, C>::trace(const ZTFixedMatrix<T, R2, C2>& m) const {
+
+    return m.trace();
+
+}
+
+/**
+ * norm : performs matrix norm operation
+ *
+ * @param  nothing
+ * @return T result
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+inline T ZTFixedMatrix<T, R, C>::norm() const {
+
+    T result = 0;
+    _Pragma("GCC unroll 16") for (std::size_t i = 0; i < R * C; ++i)
+    {
+        result += matrix_data[i] * matrix_data[i];
+    }
+    return std::sqrt(result);
+
+}
+
+/**
+ * norm : performs matrix to matrix norm operation
+ *
+ * @param  ZTFixedMatrix<T, R2, C2> m
+ * @return T result
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+template <std::size_t R2, std::size_t C2>
+inline T ZTFixedMatrix<T, R, C>::norm(const ZTFixedMatrix<T, R2, C2>& m) const {
+
+    return m.norm();
+
+}
+
+/**
+ * valid_sqaure_matrix : checks for valid sqaure matrix dimensions at compile time
+ *
+ * @param  nothing
+ * @return void
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+template <std::size_t R2, std::size_t C2>
+inline void ZTFixedMatrix<T, R, C>::valid_sqaure_matrix() {
+
+    static_assert(R2 == C2, "Matrix is not a sqaure matrix!.");
+
+}
+
+/**
+ * valid_matrix_product : checks for valid matrix product dimensions at compile time
+ *
+ * @param  nothing
+ * @return void
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+template <std::size_t R2, std::size_t C2>
+inline void ZTFixedMatrix<T, R, C>::valid_matrix_product() {
+
+    static_assert(C == R2, "Matrices are not suitable for matrix product!.");
+
+}
+
+/**
+ * valid_matrix_add_minus : checks for valid element-wise dimensions at compile time
+ *
+ * @param  nothing
+ * @return void
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+template <std::size_t R2, std::size_t C2>
+inline void ZTFixedMatrix<T, R, C>::valid_matrix_add_minus() {
+
+    static_assert(R == R2 && C == C2, "Matrices are not suitable for matrix add or minus!.");
+
+}
+
+/**
+ * valid_subscript_dimensions : checks for valid subscripts
+ *
+ * @param  std::size_t row_index one-based row
+ * @param  std::size_t col_index one-based column
+ * @return void
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+inline void ZTFixedMatrix<T, R, C>::valid_subscript_dimensions(std::size_t row_index, std::size_t col_index) const {
+
+    if (row_index > R || row_index < 1 || col_index > C || col_index < 1)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Matrix subscripts " << row_index << " and " << col_index << " out of range!.";
+        zt_raise<std::out_of_range>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * valid_index_dimensions : checks for valid zero-based matrix subscripts
+ *
+ * @param  std::size_t row zero-based row
+ * @param  std::size_t col zero-based column
+ * @return void
+ *
+ */
+template <typename T, std::size_t R, std::size_t C>
+inline void ZTFixedMatrix<T, R, C>::valid_index_dimensions(std::size_t row, std::size_t col) const {
+
+    if (row >= R || col >= C)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Matrix index (" << row << ", " << col << ") out of range for a " << R << "x" << C << " matrix!.";
+        zt_raise<std::out_of_range>(invalid_dimensions.str());
+    }
+
+}
@@ -0,0 +1,157 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ZTFIXEDMATRIX_H
+#define ZTFIXEDMATRIX_H
+
+#include <array>
+
+#include "ZTMatrixView.h"
+#include "ZTFixedVector.h"
+
+/*
+ * ZTFixedMatrix : R by C row-major matrix held inline, for the 3x3 and 4x4
+ *                 transforms that dominate small-shape traffic. Both
+ *                 dimensions are part of the type, so a product or sum of
+ *                 mismatched shapes is rejected by static_assert at compile
+ *                 time, there is no heap allocation, and every loop runs a
+ *                 constant trip count the compiler unrolls completely.
+ *                 Subscripts are one-based as for ZTMatrix; view() hands the
+ *                 elements to code written against ZTMatrixView.
+ */
+template <typename T, std::size_t R, std::size_t C>
+class ZTFixedMatrix {
+
+private:
+    static_assert(R > 0 && C > 0, "ZTFixedMatrix must hold at least one element");
+
+    T matrix_data[R * C];
+
+public:
+    typedef T value_type;
+
+    static constexpr std::size_t get_matrix_rows() { return R; }
+    static constexpr std::size_t get_matrix_cols() { return C; }
+    static constexpr std::size_t stride() { return C; }
+
+    explicit ZTFixedMatrix(const T& elements = T());
+    ZTFixedMatrix(const std::array<T, R * C>& m); // row-major elements
+
+    T* data();
+    const T* data() const;
+
+    ZTMatrixView<T> view();
+    ZTMatrixView<const T> view() const;
+
+    ZTFixedMatrix<T, R, C> add(const T& scalar) const;
+    ZTFixedMatrix<T, R, C> minus(const T& scalar) const;
+    ZTFixedMatrix<T, R, C> multiply(const T& scalar) const;
+
+    ZTFixedMatrix<T, R, C>& cummulative_add(const T& scalar);
+    ZTFixedMatrix<T, R, C>& cummulative_minus(const T& scalar);
+    ZTFixedMatrix<T, R, C>& cummulative_multiply(const T& scalar);
+
+    template <std::size_t R2, std::size_t C2>
+    ZTFixedMatrix<T, R, C> add(const ZTFixedMatrix<T, R2, C2>& m) const;
+    template <std::size_t R2, std::size_t C2>
+    ZTFixedMatrix<T, R, C> minus(const ZTFixedMatrix<T, R2, C2>& m) const;
+    template <std::size_t R2, std::size_t C2>
+    ZTFixedMatrix<T, R, C2> multiply(const ZTFixedMatrix<T, R2, C2>& m) const;
+
+    template <std::size_t R2, std::size_t C2>
+    ZTFixedMatrix<T, R, C>& cummulative_add(const ZTFixedMatrix<T, R2, C2>& m);
+    template <std::size_t R2, std::size_t C2>
+    ZTFixedMatrix<T, R, C>& cummulative_minus(const ZTFixedMatrix<T, R2, C2>& m);
+    template <std::size_t R2, std::size_t C2>
+    ZTFixedMatrix<T, R, C>& cummulative_multiply(const ZTFixedMatrix<T, R2, C2>& m);
+
+    template <std::size_t R2, std::size_t C2>
+    ZTFixedMatrix<T, R, C2> matmul(const ZTFixedMatrix<T, R2, C2>& m) const;    // matrix product
+    template <std::size_t R2, std::size_t C2>
+    ZTFixedMatrix<T, R, C> hadamard(const ZTFixedMatrix<T, R2, C2>& m) const;   // element-wise product
+    template <std::size_t R2, std::size_t C2>
+    ZTFixedMatrix<T, R, C>& cummulative_hadamard(const ZTFixedMatrix<T, R2, C2>& m);
+
+    template <std::size_t N>
+    ZTFixedVector<T, R> matvec(const ZTFixedVector<T, N>& v) const;             // matrix-vector product
+    template <std::size_t N>
+    ZTFixedVector<T, C> matvec_transposed(const ZTFixedVector<T, N>& v) const;  // transpose times vector
+
+    ZTFixedMatrix<T, R, C> operator +(const T& scalar) const;
+    ZTFixedMatrix<T, R, C> operator -(const T& scalar) const;
+    ZTFixedMatrix<T, R, C> operator *(const T& scalar) const;
+
+    ZTFixedMatrix<T, R, C>& operator +=(const T& scalar);
+    ZTFixedMatrix<T, R, C>& operator -=(const T& scalar);
+    ZTFixedMatrix<T, R, C>& operator *=(const T& scalar);
+
+    template <std::size_t R2, std::size_t C2>
+    ZTFixedMatrix<T, R, C> operator +(const ZTFixedMatrix<T, R2, C2>& m) const;
+    template <std::size_t R2, std::size_t C2>
+    ZTFixedMatrix<T, R, C> operator -(const ZTFixedMatrix<T, R2, C2>& m) const;
+    template <std::size_t R2, std::size_t C2>
+    ZTFixedMatrix<T, R, C2> operator *(const ZTFixedMatrix<T, R2, C2>& m) const;
+
+    template <std::size_t N>
+    ZTFixedVector<T, R> operator *(const ZTFixedVector<T, N>& v) const;
+
+    template <std::size_t R2, std::size_t C2>
+    ZTFixedMatrix<T, R, C>& operator +=(const ZTFixedMatrix<T, R2, C2>& m);
+    template <std::size_t R2, std::size_t C2>
+    ZTFixedMatrix<T, R, C>& operator -=(const ZTFixedMatrix<T, R2, C2>& m);
+    template <std::size_t R2, std::size_t C2>
+    ZTFixedMatrix<T, R, C>& operator *=(const ZTFixedMatrix<T, R2, C2>& m);
+
+    T& operator()(std::size_t row, std::size_t col);             // one-based, checked
+    const T& operator()(std::size_t row, std::size_t col) const;
+
+    T& at(std::size_t row, std::size_t col);                     // zero-based, always checked
+    const T& at(std::size_t row, std::size_t col) const;
+
+    T* operator [](std::size_t row);                             // zero-based row, unchecked: m[row][col]
+    const T* operator [](std::size_t row) const;
+
+    T& unsafe_get(std::size_t row, std::size_t col);             // zero-based, unchecked
+    const T& unsafe_get(std::size_t row, std::size_t col) const;
+
+    T trace() const;
+    template <std::size_t R2, std::size_t C2>
+    T trace(const ZTFixedMatrix<T, R2, C2>& m) const;
+
+    T norm() const;
+    template <std::size_t R2, std::size_t C2>
+    T norm(const ZTFixedMatrix<T, R2, C2>& m) const;
+
+    template <std::size_t R2, std::size_t C2>
+    static void valid_sqaure_matrix();
+    template <std::size_t R2, std::size_t C2>
+    static void valid_matrix_product();
+    template <std::size_t R2, std::size_t C2>
+    static void valid_matrix_add_minus();
+    void valid_subscript_dimensions(std::size_t rows, std::size_t cols) const;
+    void valid_index_dimensions(std::size_t row, std::size_t col) const;
+
+};
+
+#endif /* ZTFIXEDMATRIX_H */
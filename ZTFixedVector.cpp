@@ -0,0 +1,673 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+
+#include "ZTError.h"
+#include "ZTFixedVector.h"
+
+/**
+ * Constructor : Constructs a Vector with all N elements set to elements
+ *
+ * @param  T& elements initial value
+ * @return nothing
+ *
+ */
+template <typename T, std::size_t N>
+ZTFixedVector<T, N>::ZTFixedVector(const T& elements) {
+
+    _Pragma("GCC unroll 16") for (std::size_t i = 0; i < N; ++i)
+    {
+        vector_data[i] = elements;
+    }
+
+}
+
+/**
+ * Constructor : Constructs a Vector from an array of N elements
+ *
+ * @param  std::array<T, N> v
+ * @return nothing
+ *
+ */
+template <typename T, std::size_t N>
+ZTFixedVector<T, N>::ZTFixedVector(const std::array<T, N>& v) {
+
+    set_vector_data(v);
+
+}
+
+/**
+ * data : pointer to the first element
+ *
+ * @param  nothing
+ * @return T* data
+ *
+ */
+template <typename T, std::size_t N>
+inline T* ZTFixedVector<T, N>::data() {
+
+    return vector_data;
+
+}
+
+/**
+ * data : pointer to the first element
+ *
+ * @param  nothing
+ * @return const T* data
+ *
+ */
+template <typename T, std::size_t N>
+inline const T* ZTFixedVector<T, N>::data() const {
+
+    return vector_data;
+
+}
+
+/**
+ * view : view of all the elements of the vector
+ *
+ * @param  nothing
+ * @return ZTVectorView<T> view
+ *
+ */
+template <typename T, std::size_t N>
+inline ZTVectorView<T> ZTFixedVector<T, N>::view() {
+
+    return ZTVectorView<T>(vector_data, N);
+
+}
+
+/**
+ * view : read-only view of all the elements of the vector
+ *
+ * @param  nothing
+ * @return ZTVectorView<const T> view
+ *
+ */
+template <typename T, std::size_t N>
+inline ZTVectorView<const T> ZTFixedVector<T, N>::view() const {
+
+    return ZTVectorView<const T>(vector_data, N);
+
+}
+
+/**
+ * Getter : ZTFixedVector::vector_data getter method
+ *
+ * @param  nothing
+ * @return std::array<T, N> vector_data
+ *
+ */
+template <typename T, std::size_t N>
+inline std::array<T, N> ZTFixedVector<T, N>::get_vector_data() const {
+
+    std::array<T, N> result;
+    _Pragma("GCC unroll 16") for (std::size_t i = 0; i < N; ++i)
+    {
+        result[i] = vector_data[i];
+    }
+    return result;
+
+}
+
+/**
+ * Setter : ZTFixedVector::vector_data setter method
+ *
+ * @param  std::array<T, N> v
+ * @return void
+ *
+ */
+template <typename T, std::size_t N>
+inline void ZTFixedVector<T, N>::set_vector_data(const std::array<T, N>& v) {
+
+    _Pragma("GCC unroll 16") for (std::size_t i = 0; i < N; ++i)
+    {
+        vector_data[i] = v[i];
+    }
+
+}
+
+/**
+ * [] operator : element i of the vector
+ *
+ * @param  std::size_t i zero-based index
+ * @return T& element
+ *
+ */
+template <typename T, std::size_t N>
+inline T& ZTFixedVector<T, N>::operator[](std::size_t i) {
+
+    return vector_data[i];
+
+}
+
+/**
+ * [] operator : element i of the vector
+ *
+ * @param  std::size_t i zero-based index
+ * @return const T& element
+ *
+ */
+template <typename T, std::size_t N>
+inline const T& ZTFixedVector<T, N>::operator[](std::size_t i) const {
+
+    return vector_data[i];
+
+}
+
+/**
+ * at : element i of the vector, the index is checked whatever the error policy
+ *
+ * @param  std::size_t i zero-based index
+ * @return T& element
+ *
+ */
+template <typename T, std::size_t N>
+inline T& ZTFixedVector<T, N>::at(std::size_t i) {
+
+    valid_vector_index(i);
+    return vector_data[i];
+
+}
+
+/**
+ * at : element i of the vector, the index is checked whatever the error policy
+ *
+ * @param  std::size_t i zero-based index
+ * @return const T& element
+ *
+ */
+template <typename T, std::size_t N>
+inline const T& ZTFixedVector<T, N>::at(std::size_t i) const {
+
+    valid_vector_index(i);
+    return vector_data[i];
+
+}
+
+/**
+ * unsafe_get : element i of the vector without checks
+ *
+ * @param  std::size_t i zero-based index
+ * @return T& element
+ *
+ */
+template <typename T, std::size_t N>
+inline T& ZTFixedVector<T, N>::unsafe_get(std::size_t i) {
+
+    return vector_data[i];
+
+}
+
+/**
+ * unsafe_get : element i of the vector without checks
+ *
+ * @param  std::size_t i zero-based index
+ * @return const T& element
+ *
+ */
+template <typename T, std::size_t N>
+inline const T& ZTFixedVector<T, N>::unsafe_get(std::size_t i) const {
+
+    return vector_data[i];
+
+}
+
+/**
+ * add : performs vector to scalar addition
+ *
+ * @param  T& scalar
+ * @return ZTFixedVector<T, N> result
+ *
+ */
+template <typename T, std::size_t N>
+inline ZTFixedVector<T, N> ZTFixedVector<T, N>::add(const T& scalar) const {
+
+    ZTFixedVector<T, N> result(*this);
+    result.cummulative_add(scalar);
+    return result;
+
+}
+
+/**
+ * minus : performs vector to scalar subtraction
+ *
+ * @param  T& scalar
+ * @return ZTFixedVector<T, N> result
+ *
+ */
+template <typename T, std::size_t N>
+inline ZTFixedVector<T, N> ZTFixedVector<T, N>::minus(const T& scalar) const {
+
+    ZTFixedVector<T, N> result(*this);
+    result.cummulative_minus(scalar);
+    return result;
+
+}
+
+/**
+ * multiply : performs vector to scalar multiplication
+ *
+ * @param  T& scalar
+ * @return ZTFixedVector<T, N> result
+ *
+ */
+template <typename T, std::size_t N>
+inline ZTFixedVector<T, N> ZTFixedVector<T, N>::multiply(const T& scalar) const {
+
+    ZTFixedVector<T, N> result(*this);
+    result.cummulative_multiply(scalar);
+    return result;
+
+}
+
+/**
+ * cummulative_add : performs vector to scalar cummulative addition
+ *
+ * @param  T& scalar
+ * @return *this (instance of ZTFixedVector<T, N>)
+ *
+ */
+template <typename T, std::size_t N>
+inline ZTFixedVector<T, N>& ZTFixedVector<T, N>::cummulative_add(const T& scalar) {
+
+    _Pragma("GCC unroll 16") for (std::size_t i = 0; i < N; ++i)
+    {
+        vector_data[i] += scalar;
+    }
+    return *this;
+
+}
+
+/**
+ * cummulative_minus : performs vector to scalar cummulative subtraction
+ *
+ * @param  T& scalar
+ * @return *this (instance of ZTFixedVector<T, N>)
+ *
+ */
+template <typename T, std::size_t N>
+inline ZTFixedVector<T, N>& ZTFixedVector<T, N>::cummulative_minus(const T& scalar) {
+
+    _Pragma("GCC unroll 16") for (std::size_t i = 0; i < N; ++i)
+    {
+        vector_data[i] -= scalar;
+    }
+    return *this;
+
+}
+
+/**
+ * cummulative_multiply : performs vector to scalar cummulative multiplication
+ *
+ * @param  T& scalar
+ * @return *this (instance of ZTFixedVector<T, N>)
+ *
+ */
+template <typename T, std::size_t N>
+inline ZTFixedVector<T, N>& ZTFixedVector<T, N>::cummulative_multiply(const T& scalar) {
+
+    _Pragma("GCC unroll 16") for (std::size_t i = 0; i < N; ++i)
+    {
+        vector_data[i] *= scalar;
+    }
+    return *this;
+
+}
+
+/**
+ * add : performs vector to vector addition
+ *
+ * @param  ZTFixedVector<T, M> v
+ * @return ZTFixedVector<T, N> result
+ *
+ */
+template <typename T, std::size_t N>
+template <std::size_t M>
+inline ZTFixedVector<T, N> ZTFixedVector<T, N>::add(const ZTFixedVector<T, M>& v) const {
+
+    ZTFixedVector<T, N> result(*this);
+    result.cummulative_add(v);
+    return result;
+
+}
+
+/**
+ * minus : performs vector to vector subtraction
+ *
+ * @param  ZTFixedVector<T, M> v
+ * @return ZTFixedVector<T, N> result
+ *
+ */
+template <typename T, std::size_t N>
+template <std::size_t M>
+inline ZTFixedVector<T, N> ZTFixedVector<T, N>::minus(const ZTFixedVector<T, M>& v) const {
+
+    ZTFixedVector<T, N> result(*this);
+    result.cummulative_minus(v);
+    return result;
+
+}
+
+/**
+ * multiply : performs vector to vector multiplication
+ *
+ * @param  ZTFixedVector<T, M> v
+ * @return T result
+ *
+ */
+template <typename T, std::size_t N>
+template <std::size_t M>
+inline T ZTFixedVector<T, N>::multiply(const ZTFixedVector<T, M>& v) const {
+
+    return dot(v);
+
+}
+
+/**
+ * cummulative_add : performs vector to vector cummulative addition
+ *
+ * @param  ZTFixedVector<T, M> v
+ * @return *this (instance of ZTFixedVector<T, N>)
+ *
+ */
+template <typename T, std::size_t N>
+template <std::size_t M>
+inline ZTFixedVector<T, N>& ZTFixedVector<T, N>::cummulative_add(const ZTFixedVector<T, M>& v) {
+
+    valid_vector_dimensions<M>();
+    _Pragma("GCC unroll 16") for (std::size_t i = 0; i < N; ++i)
+    {
+        vector_data[i] += v[i];
+    }
+    return *this;
+
+}
+
+/**
+ * cummulative_minus : performs vector to vector cummulative subtraction
+ *
+ * @param  ZTFixedVector<T, M> v
+ * @return *this (instance of ZTFixedVector<T, N>)
+ *
+ */
+template <typename T, std::size_t N>
+template <std::size_t M>
+inline ZTFixedVector<T, N>& ZTFixedVector<T, N>::cummulative_minus(const ZTFixedVector<T, M>& v) {
+
+    valid_vector_dimensions<M>();
+    _Pragma("GCC unroll 16") for (std::size_t i = 0; i < N; ++i)
+    {
+        vector_data[i] -= v[i];
+    }
+    return *this;
+
+}
+
+/**
+ * + operator : performs vector to scalar addition
+ *
+ * @param  T& scalar
+ * @return ZTFixedVector<T, N> result
+ *
+ */
+template <typename T, std::size_t N>
+inline ZTFixedVector<T, N> ZTFixedVector<T, N>::operator+(const T& scalar) const {
+
+    return add(scalar);
+
+}
+
+/**
+ * - operator : performs vector to scalar subtraction
+ *
+ * @param  T& scalar
+ * @return ZTFixedVector<T, N> result
+ *
+ */
+template <typename T, std::size_t N>
+inline ZTFixedVector<T, N> ZTFixedVector<T, N>::operator-(const T& scalar) const {
+
+    return minus(scalar);
+
+}
+
+/**
+ * * operator : performs vector to scalar multiplication
+ *
+ * @param  T& scalar
+ * @return ZTFixedVector<T, N> result
+ *
+ */
+template <typename T, std::size_t N>
+inline ZTFixedVector<T, N> ZTFixedVector<T, N>::operator*(const T& scalar) const {
+
+    return multiply(scalar);
+
+}
+
+/**
+ * += operator : performs vector to scalar cummulative addition
+ *
+ * @param  T& scalar
+ * @return *this (instance of ZTFixedVector<T, N>)
+ *
+ */
+template <typename T, std::size_t N>
+inline ZTFixedVector<T, N>& ZTFixedVector<T, N>::operator+=(const T& scalar) {
+
+    return cummulative_add(scalar);
+
+}
+
+/**
+ * -= operator : performs vector to scalar cummulative subtraction
+ *
+ * @param  T& scalar
+ * @return *this (instance of ZTFixedVector<T, N>)
+ *
+ */
+template <typename T, std::size_t N>
+inline ZTFixedVector<T, N>& ZTFixedVector<T, N>::operator-=(const T& scalar) {
+
+    return cummulative_minus(scalar);
+
+}
+
+/**
+ * *= operator : performs vector to scalar cummulative multiplication
+ *
+ * @param  T& scalar
+ * @return *this (instance of ZTFixedVector<T, N>)
+ *
+ */
+template <typename T, std::size_t N>
+inline ZTFixedVector<T, N>& ZTFixedVector<T, N>::operator*=(const T& scalar) {
+
+    return cummulative_multiply(scalar);
+
+}
+
+/**
+ * + operator : performs vector to vector addition
+ *
+ * @param  ZTFixedVector<T, M> v
+ * @return ZTFixedVector<T, N> result
+ *
+ */
+template <typename T, std::size_t N>
+template <std::size_t M>
+inline ZTFixedVector<T, N> ZTFixedVector<T, N>::operator+(const ZTFixedVector<T, M>& v) const {
+
+    return add(v);
+
+}
+
+/**
+ * - operator : performs vector to vector subtraction
+ *
+ * @param  ZTFixedVector<T, M> v
+ * @return ZTFixedVector<T, N> result
+ *
+ */
+template <typename T, std::size_t N>
+template <std::size_t M>
+inline ZTFixedVector<T, N> ZTFixedVector<T, N>::operator-(const ZTFixedVector<T, M>& v) const {
+
+    return minus(v);
+
+}
+
+/**
+ * * operator : performs vector to vector multiplication
+ *
+ * @param  ZTFixedVector<T, M> v
+ * @return T result
+ *
+ */
+template <typename T, std::size_t N>
+template <std::size_t M>
+inline T ZTFixedVector<T, N>::operator*(const ZTFixedVector<T, M>& v) const {
+
+    return dot(v);
+
+}
+
+/**
+ * += operator : performs vector to vector cummulative addition
+ *
+ * @param  ZTFixedVector<T, M> v
+ * @return *this (instance of ZTFixedVector<T, N>)
+ *
+ */
+template <typename T, std::size_t N>
+template <std::size_t M>
+inline ZTFixedVector<T, N>& ZTFixedVector<T, N>::operator+=(const ZTFixedVector<T, M>& v) {
+
+    return cummulative_add(v);
+
+}
+
+/**
+ * -= operator : performs vector to vector cummulative subtraction
+ *
+ * @param  ZTFixedVector<T, M> v
+ * @return *this (instance of ZTFixedVector<T, N>)
+ *
+ */
+template <typename T, std::size_t N>
+template <std::size_t M>
+inline ZTFixedVector<T, N>& ZTFixedVector<T, N>::operator-=(const ZTFixedVector<T, M>& v) {
+
+    return cummulative_minus(v);
+
+}
+
+/**
+ * dot : performs vector to vector dot operation
+ *
+ * @param  ZTFixedVector<T, M> v
+ * @return T result
+ *
+ */
+template <typename T, std::size_t N>
+template <std::size_t M>
+inline T ZTFixedVector<T, N>::dot(const ZTFixedVector<T, M>& v) const {
+
+    valid_vector_dimensions<M>();
+    T result = 0;
+    _Pragma("GCC unroll 16") for (std::size_t i = 0; i < N; ++i)
+    {
+        result += vector_data[i] * v[i];
+    }
+    return result;
+
+}
+
+/**
+ * norm : performs vector norm operation
+ *
+ * @param  nothing
+ * @return T result
+ *
+ */
+template <typename T, std::size_t N>
+inline T ZTFixedVector<T, N>::norm() const {
+
+    return std::sqrt(dot(*this));
+
+}
+
+/**
+ * norm : performs vector to vector norm operation
+ *
+ * @param  ZTFixedVector<T, M> v
+ * @return T result
+ *
+ */
+template <typename T, std::size_t N>
+template <std::size_t M>
+inline T ZTFixedVector<T, N>::norm(const ZTFixedVector<T, M>& v) const {
+
+    return std::sqrt(dot(v));
+
+}
+
+/**
+ * valid_vector_dimensions : checks for valid vector dimensions at compile time
+ *
+ * @param  nothing
+ * @return void
+ *
+ */
+template <typename T, std::size_t N>
+template <std::size_t M>
+inline void ZTFixedVector<T, N>::valid_vector_dimensions() {
+
+    static_assert(M == N, "vector sizes do not match!.");
+
+}
+
+/**
+ * valid_vector_index : checks for a valid zero-based vector index
+ *
+ * @param  std::size_t i zero-based index
+ * @return void
+ *
+ */
+template <typename T, std::size_t N>
+inline void ZTFixedVector<T, N>::valid_vector_index(std::size_t i) const {
+
+    if (i >= N)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "vector index " << i << " out of range for size " << N << "!.";
+        zt_raise<std::out_of_range>(invalid_dimensions.str());
+    }
+
+}
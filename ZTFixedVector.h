@@ -0,0 +1,129 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ZTFIXEDVECTOR_H
+#define ZTFIXEDVECTOR_H
+
+#include <array>
+
+#include "ZTVectorView.h"
+
+/*
+ * ZTFixedVector : vector of N elements held inline, for the 2 to 16 element
+ *                 vectors of geometry and small transforms. The size is part
+ *                 of the type, so operands of different sizes are rejected by
+ *                 static_assert at compile time, there is no heap allocation,
+ *                 and every loop runs a constant trip count the compiler
+ *                 unrolls completely. view() hands the elements to code written
+ *                 against ZTVectorView.
+ */
+template <typename T, std::size_t N>
+class ZTFixedVector {
+
+private:
+    static_assert(N > 0, "ZTFixedVector must hold at least one element");
+
+    T vector_data[N];
+
+public:
+    typedef T value_type;
+
+    static constexpr std::size_t size() { return N; }
+    static constexpr std::size_t get_vector_size() { return N; }
+
+    explicit ZTFixedVector(const T& elements = T());
+    ZTFixedVector(const std::array<T, N>& v);
+
+    T* data();
+    const T* data() const;
+
+    ZTVectorView<T> view();
+    ZTVectorView<const T> view() const;
+
+    std::array<T, N> get_vector_data() const;
+    void set_vector_data(const std::array<T, N>& v);
+
+    T& operator [](std::size_t i);            // zero-based, unchecked
+    const T& operator [](std::size_t i) const;
+
+    T& at(std::size_t i);                     // zero-based, always checked
+    const T& at(std::size_t i) const;
+
+    T& unsafe_get(std::size_t i);
+    const T& unsafe_get(std::size_t i) const;
+
+    ZTFixedVector<T, N> add(const T& scalar) const;
+    ZTFixedVector<T, N> minus(const T& scalar) const;
+    ZTFixedVector<T, N> multiply(const T& scalar) const;
+
+    ZTFixedVector<T, N>& cummulative_add(const T& scalar);
+    ZTFixedVector<T, N>& cummulative_minus(const T& scalar);
+    ZTFixedVector<T, N>& cummulative_multiply(const T& scalar);
+
+    template <std::size_t M>
+    ZTFixedVector<T, N> add(const ZTFixedVector<T, M>& v) const;
+    template <std::size_t M>
+    ZTFixedVector<T, N> minus(const ZTFixedVector<T, M>& v) const;
+    template <std::size_t M>
+    T multiply(const ZTFixedVector<T, M>& v) const;
+
+    template <std::size_t M>
+    ZTFixedVector<T, N>& cummulative_add(const ZTFixedVector<T, M>& v);
+    template <std::size_t M>
+    ZTFixedVector<T, N>& cummulative_minus(const ZTFixedVector<T, M>& v);
+
+    ZTFixedVector<T, N> operator +(const T& scalar) const;
+    ZTFixedVector<T, N> operator -(const T& scalar) const;
+    ZTFixedVector<T, N> operator *(const T& scalar) const;
+
+    ZTFixedVector<T, N>& operator +=(const T& scalar);
+    ZTFixedVector<T, N>& operator -=(const T& scalar);
+    ZTFixedVector<T, N>& operator *=(const T& scalar);
+
+    template <std::size_t M>
+    ZTFixedVector<T, N> operator +(const ZTFixedVector<T, M>& v) const;
+    template <std::size_t M>
+    ZTFixedVector<T, N> operator -(const ZTFixedVector<T, M>& v) const;
+    template <std::size_t M>
+    T operator *(const ZTFixedVector<T, M>& v) const;
+
+    template <std::size_t M>
+    ZTFixedVector<T, N>& operator +=(const ZTFixedVector<T, M>& v);
+    template <std::size_t M>
+    ZTFixedVector<T, N>& operator -=(const ZTFixedVector<T, M>& v);
+
+    template <std::size_t M>
+    T dot(const ZTFixedVector<T, M>& v) const; // dot product
+
+    T norm() const;
+    template <std::size_t M>
+    T norm(const ZTFixedVector<T, M>& v) const;
+
+    template <std::size_t M>
+    static void valid_vector_dimensions();
+    void valid_vector_index(std::size_t i) const;
+
+};
+
+#endif /* ZTFIXEDVECTOR_H */
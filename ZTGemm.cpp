@@ -0,0 +1,698 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+
+#include "ZTCpu.h"
+#include "ZTGemm.h"
+#include "ZTHalf.h"
+#include "ZTSimd.h"
+#include "ZTWorkspace.h"
+#include "ZTThreadPool.h"
+
+/**
+ * zt_gemm_micro_kernel : portable register-tiled micro-kernel, the MR x NR
+ *                        accumulator block is fully unrolled so that it stays
+ *                        in registers across the kc loop
+ *
+ * @param  std::size_t kc depth of the packed panels
+ * @param  T* a packed MR-row panel of A
+ * @param  T* b packed NR-col panel of B
+ * @param  T& alpha scaling of the product
+ * @param  T* c top left element of the C tile (row-major, leading dimension ldc)
+ * @return nothing
+ *
+ */
+template <typename T, int MR, int NR>
+void zt_gemm_micro_kernel(std::size_t kc, const T* a, const T* b, const T& alpha, T* c, std::size_t ldc) {
+
+    T acc[MR][NR];
+    _Pragma("GCC unroll 16") for (int i = 0; i < MR; ++i)
+    {
+        _Pragma("GCC unroll 16") for (int j = 0; j < NR; ++j)
+        {
+            acc[i][j] = T(0);
+        }
+    }
+    for (std::size_t p = 0; p < kc; ++p)
+    {
+        _Pragma("GCC unroll 16") for (int i = 0; i < MR; ++i)
+        {
+            const T ai = a[i];
+            _Pragma("GCC unroll 16") for (int j = 0; j < NR; ++j)
+            {
+                acc[i][j] += ai * b[j];
+            }
+        }
+        a += MR;
+        b += NR;
+    }
+    _Pragma("GCC unroll 16") for (int i = 0; i < MR; ++i)
+    {
+        _Pragma("GCC unroll 16") for (int j = 0; j < NR; ++j)
+        {
+            c[i * ldc + j] += alpha * acc[i][j];
+        }
+    }
+
+}
+
+#ifdef ZT_SIMD_X86
+
+/**
+ * zt_gemm_avx2_kernel : AVX2/FMA micro-kernel, MR rows by NV registers of columns
+ *
+ * @param  std::size_t kc depth of the packed panels
+ * @param  T* a packed MR-row panel of A
+ * @param  T* b packed panel of B, NV * (32 / sizeof(T)) columns wide
+ * @param  T& alpha scaling of the product
+ * @param  T* c top left element of the C tile (row-major, leading dimension ldc)
+ * @return nothing
+ *
+ */
+template <typename T, int MR, int NV>
+ZT_AVX2_TARGET void zt_gemm_avx2_kernel(std::size_t kc, const T* a, const T* b, const T& alpha, T* c, std::size_t ldc) {
+
+    const int width = 32 / sizeof(T);
+    decltype(zt_avx2_set1(T())) acc[MR][NV];
+    _Pragma("GCC unroll 16") for (int i = 0; i < MR; ++i)
+    {
+        _Pragma("GCC unroll 16") for (int j = 0; j < NV; ++j)
+        {
+            acc[i][j] = zt_avx2_set1(T(0));
+        }
+    }
+    for (std::size_t p = 0; p < kc; ++p)
+    {
+        decltype(zt_avx2_set1(T())) bv[NV];
+        _Pragma("GCC unroll 16") for (int j = 0; j < NV; ++j)
+        {
+            bv[j] = zt_avx2_load(b + j * width);
+        }
+        _Pragma("GCC unroll 16") for (int i = 0; i < MR; ++i)
+        {
+            const auto ai = zt_avx2_set1(a[i]);
+            _Pragma("GCC unroll 16") for (int j = 0; j < NV; ++j)
+            {
+                acc[i][j] = zt_avx2_fmadd(ai, bv[j], acc[i][j]);
+            }
+        }
+        a += MR;
+        b += NV * width;
+    }
+    const auto scale = zt_avx2_set1(alpha);
+    _Pragma("GCC unroll 16") for (int i = 0; i < MR; ++i)
+    {
+        _Pragma("GCC unroll 16") for (int j = 0; j < NV; ++j)
+        {
+            T* cij = c + i * ldc + j * width;
+            zt_avx2_store(cij, zt_avx2_fmadd(scale, acc[i][j], zt_avx2_load(cij)));
+        }
+    }
+
+}
+
+/**
+ * zt_gemm_avx512_kernel : AVX-512 micro-kernel, MR rows by NV registers of columns
+ *
+ * @param  std::size_t kc depth of the packed panels
+ * @param  T* a packed MR-row panel of A
+ * @param  T* b packed panel of B, NV * (64 / sizeof(T)) columns wide
+ * @param  T& alpha scaling of the product
+ * @param  T* c top left element of the C tile (row-major, leading dimension ldc)
+ * @return nothing
+ *
+ */
+template <typename T, int MR, int NV>
+ZT_AVX512_TARGET void zt_gemm_avx512_kernel(std::size_t kc, const T* a, const T* b, const T& alpha, T* c, std::size_t ldc) {
+
+    const int width = 64 / sizeof(T);
+    decltype(zt_avx512_set1(T())) acc[MR][NV];
+    _Pragma("GCC unroll 16") for (int i = 0; i < MR; ++i)
+    {
+        _Pragma("GCC unroll 16") for (int j = 0; j < NV; ++j)
+        {
+            acc[i][j] = zt_avx512_set1(T(0));
+        }
+    }
+    for (std::size_t p = 0; p < kc; ++p)
+    {
+        decltype(zt_avx512_set1(T())) bv[NV];
+        _Pragma("GCC unroll 16") for (int j = 0; j < NV; ++j)
+        {
+            bv[j] = zt_avx512_load(b + j * width);
+        }
+        _Pragma("GCC unroll 16") for (int i = 0; i < MR; ++i)
+        {
+            const auto ai = zt_avx512_set1(a[i]);
+            _Pragma("GCC unroll 16") for (int j = 0; j < NV; ++j)
+            {
+                acc[i][j] = zt_avx512_fmadd(ai, bv[j], acc[i][j]);
+            }
+        }
+        a += MR;
+        b += NV * width;
+    }
+    const auto scale = zt_avx512_set1(alpha);
+    _Pragma("GCC unroll 16") for (int i = 0; i < MR; ++i)
+    {
+        _Pragma("GCC unroll 16") for (int j = 0; j < NV; ++j)
+        {
+            T* cij = c + i * ldc + j * width;
+            zt_avx512_store(cij, zt_avx512_fmadd(scale, acc[i][j], zt_avx512_load(cij)));
+        }
+    }
+
+}
+
+#endif /* ZT_SIMD_X86 */
+
+/**
+ * zt_gemm_select_float_kernel : picks the widest micro-kernel the running CPU supports
+ *                         for a floating point type, with the L1/L2/L3 blocking
+ *                         sized for it
+ *
+ * @param  nothing
+ * @return ZTGemmKernel<T> kernel
+ *
+ */
+template <typename T>
+ZTGemmKernel<T> zt_gemm_select_float_kernel() {
+
+#ifdef ZT_SIMD_X86
+    const std::size_t width = 64 / sizeof(T);
+    if (ZTCpu::instruction_set() >= ZT_ISA_AVX512)
+    {
+        ZTGemmKernel<T> k = { zt_gemm_avx512_kernel<T, 12, 2>, 12, 2 * width, 192, 192, 4096 };
+        return k;
+    }
+    if (ZTCpu::instruction_set() >= ZT_ISA_AVX2)
+    {
+        ZTGemmKernel<T> k = { zt_gemm_avx2_kernel<T, 6, 2>, 6, width, 72, 256, 4096 };
+        return k;
+    }
+#endif
+    ZTGemmKernel<T> k = { zt_gemm_micro_kernel<T, 4, 4>, 4, 4, 64, 256, 4096 };
+    return k;
+
+}
+
+/**
+ * select_kernel : portable micro-kernel for any arithmetic type
+ *
+ * @param  nothing
+ * @return ZTGemmKernel<T> kernel
+ *
+ */
+template <typename T>
+ZTGemmKernel<T> ZTGemm<T>::select_kernel() {
+
+    ZTGemmKernel<T> k = { zt_gemm_micro_kernel<T, 4, 4>, 4, 4, 64, 256, 4096 };
+    return k;
+
+}
+
+template <>
+ZTGemmKernel<double> ZTGemm<double>::select_kernel() {
+
+    return zt_gemm_select_float_kernel<double>();
+
+}
+
+template <>
+ZTGemmKernel<float> ZTGemm<float>::select_kernel() {
+
+    return zt_gemm_select_float_kernel<float>();
+
+}
+
+/**
+ * kernel : micro-kernel and blocking in use, selected once on first call
+ *
+ * @param  nothing
+ * @return const ZTGemmKernel<T>& kernel
+ *
+ */
+template <typename T>
+const ZTGemmKernel<T>& ZTGemm<T>::kernel() {
+
+    static const ZTGemmKernel<T> selected = select_kernel();
+    return selected;
+
+}
+
+/**
+ * pack_a : copies an mc x kc block of A into consecutive mr-row panels, each
+ *          stored column by column, zero-padding the last panel
+ *
+ * @param  std::size_t mc rows of the block
+ * @param  std::size_t kc cols of the block
+ * @param  std::size_t mr panel height
+ * @param  T* a top left element of the block, with strides rsa and csa
+ * @param  T* packed destination buffer of ceil(mc / mr) * mr * kc elements
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTGemm<T>::pack_a(std::size_t mc, std::size_t kc, std::size_t mr,
+                       const T* a, std::size_t rsa, std::size_t csa, T* packed) {
+
+    for (std::size_t ir = 0; ir < mc; ir += mr)
+    {
+        const std::size_t rows = std::min(mr, mc - ir);
+        const T* panel = a + ir * rsa;
+        for (std::size_t p = 0; p < kc; ++p)
+        {
+            std::size_t i = 0;
+            for (; i < rows; ++i)
+            {
+                packed[i] = panel[i * rsa + p * csa];
+            }
+            for (; i < mr; ++i)
+            {
+                packed[i] = T(0);
+            }
+            packed += mr;
+        }
+    }
+
+}
+
+/**
+ * pack_b : copies a kc x nc block of B into consecutive nr-col panels, each
+ *          stored row by row, zero-padding the last panel
+ *
+ * @param  std::size_t kc rows of the block
+ * @param  std::size_t nc cols of the block
+ * @param  std::size_t nr panel width
+ * @param  T* b top left element of the block, with strides rsb and csb
+ * @param  T* packed destination buffer of ceil(nc / nr) * nr * kc elements
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTGemm<T>::pack_b(std::size_t kc, std::size_t nc, std::size_t nr,
+                       const T* b, std::size_t rsb, std::size_t csb, T* packed) {
+
+    for (std::size_t jr = 0; jr < nc; jr += nr)
+    {
+        const std::size_t cols = std::min(nr, nc - jr);
+        const T* panel = b + jr * csb;
+        for (std::size_t p = 0; p < kc; ++p)
+        {
+            const T* row = panel + p * rsb;
+            std::size_t j = 0;
+            if (csb == 1)
+            {
+                for (; j < cols; ++j)
+                {
+                    packed[j] = row[j];
+                }
+            }
+            else
+            {
+                for (; j < cols; ++j)
+                {
+                    packed[j] = row[j * csb];
+                }
+            }
+            for (; j < nr; ++j)
+            {
+                packed[j] = T(0);
+            }
+            packed += nr;
+        }
+    }
+
+}
+
+/**
+ * macro_kernel : sweeps the micro-kernel over an mc x nc block of C, full tiles
+ *                of a row-major C are updated in place, edge tiles and other
+ *                layouts go through a small local tile
+ *
+ * @param  ZTGemmKernel<T> kernel micro-kernel and its tile shape
+ * @param  std::size_t mc rows of the block
+ * @param  std::size_t nc cols of the block
+ * @param  std::size_t kc depth of the packed panels
+ * @param  T& alpha scaling of the product
+ * @param  T* packed_a packed block of A
+ * @param  T* packed_b packed block of B
+ * @param  T* c top left element of the block of C, with strides rsc and csc
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTGemm<T>::macro_kernel(const ZTGemmKernel<T>& kernel, std::size_t mc, std::size_t nc, std::size_t kc,
+                             const T& alpha, const T* packed_a, const T* packed_b,
+                             T* c, std::size_t rsc, std::size_t csc) {
+
+    const std::size_t mr = kernel.mr;
+    const std::size_t nr = kernel.nr;
+    T tile[32 * 64]; // large enough for every kernel tile
+
+    for (std::size_t jr = 0; jr < nc; jr += nr)
+    {
+        const std::size_t cols = std::min(nr, nc - jr);
+        const T* b = packed_b + jr * kc;
+        for (std::size_t ir = 0; ir < mc; ir += mr)
+        {
+            const std::size_t rows = std::min(mr, mc - ir);
+            const T* a = packed_a + ir * kc;
+            T* cij = c + ir * rsc + jr * csc;
+            if (rows == mr && cols == nr && csc == 1)
+            {
+                kernel.micro_kernel(kc, a, b, alpha, cij, rsc);
+                continue;
+            }
+            std::fill(tile, tile + mr * nr, T(0));
+            kernel.micro_kernel(kc, a, b, alpha, tile, nr);
+            for (std::size_t i = 0; i < rows; ++i)
+            {
+                for (std::size_t j = 0; j < cols; ++j)
+                {
+                    cij[i * rsc + j * csc] += tile[i * nr + j];
+                }
+            }
+        }
+    }
+
+}
+
+/**
+ * scale : performs C = beta * C, where beta == 0 overwrites C so that
+ *         uninitialized or non-finite values do not leak into the product
+ *
+ * @param  std::size_t m rows of C
+ * @param  std::size_t n cols of C
+ * @param  T& beta scaling of C
+ * @param  T* c C with strides rsc and csc
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTGemm<T>::scale(std::size_t m, std::size_t n, const T& beta, T* c, std::size_t rsc, std::size_t csc) {
+
+    if (beta == T(1))
+    {
+        return;
+    }
+    for (std::size_t i = 0; i < m; ++i)
+    {
+        T* row = c + i * rsc;
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            row[j * csc] = (beta == T(0)) ? T(0) : beta * row[j * csc];
+        }
+    }
+
+}
+
+/**
+ * naive : performs C += alpha * A * B without packing, for products too small
+ *         to amortize it
+ *
+ * @param  std::size_t m rows of A and C
+ * @param  std::size_t n cols of B and C
+ * @param  std::size_t k cols of A and rows of B
+ * @param  T& alpha scaling of the product
+ * @param  T* a A with strides rsa and csa
+ * @param  T* b B with strides rsb and csb
+ * @param  T* c C with strides rsc and csc
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTGemm<T>::naive(std::size_t m, std::size_t n, std::size_t k, const T& alpha,
+                      const T* a, std::size_t rsa, std::size_t csa,
+                      const T* b, std::size_t rsb, std::size_t csb,
+                      T* c, std::size_t rsc, std::size_t csc) {
+
+    for (std::size_t i = 0; i < m; ++i)
+    {
+        T* ci = c + i * rsc;
+        for (std::size_t p = 0; p < k; ++p)
+        {
+            const T aip = alpha * a[i * rsa + p * csa];
+            const T* bp = b + p * rsb;
+            for (std::size_t j = 0; j < n; ++j)
+            {
+                ci[j * csc] += aip * bp[j * csb];
+            }
+        }
+    }
+
+}
+
+/**
+ * blocked : performs C += alpha * A * B with the L3/L2/L1 blocked loop nest
+ *           (nc columns of B, kc deep panels, mc rows of A) around the
+ *           micro-kernel, packing buffers are kept per thread and reused
+ *
+ * @param  std::size_t m rows of A and C
+ * @param  std::size_t n cols of B and C
+ * @param  std::size_t k cols of A and rows of B
+ * @param  T& alpha scaling of the product
+ * @param  T* a A with strides rsa and csa
+ * @param  T* b B with strides rsb and csb
+ * @param  T* c C with strides rsc and csc
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTGemm<T>::blocked(std::size_t m, std::size_t n, std::size_t k, const T& alpha,
+                        const T* a, std::size_t rsa, std::size_t csa,
+                        const T* b, std::size_t rsb, std::size_t csb,
+                        T* c, std::size_t rsc, std::size_t csc) {
+
+    const ZTGemmKernel<T>& kern = kernel();
+    const std::size_t mc_max = std::min(kern.mc, (m + kern.mr - 1) / kern.mr * kern.mr);
+    const std::size_t nc_max = std::min(kern.nc, (n + kern.nr - 1) / kern.nr * kern.nr);
+    const std::size_t kc_max = std::min(kern.kc, k);
+
+    static thread_local buffer_type packed_a;
+    static thread_local buffer_type packed_b;
+    if (packed_a.size() < mc_max * kc_max || packed_b.size() < nc_max * kc_max)
+    {
+        ZTHeapScope heap; // the buffers live as long as the thread, not a workspace
+        if (packed_a.size() < mc_max * kc_max)
+        {
+            packed_a.resize(mc_max * kc_max);
+        }
+        if (packed_b.size() < nc_max * kc_max)
+        {
+            packed_b.resize(nc_max * kc_max);
+        }
+    }
+
+    for (std::size_t jc = 0; jc < n; jc += kern.nc)
+    {
+        const std::size_t nc = std::min(kern.nc, n - jc);
+        for (std::size_t pc = 0; pc < k; pc += kern.kc)
+        {
+            const std::size_t kc = std::min(kern.kc, k - pc);
+            pack_b(kc, nc, kern.nr, b + pc * rsb + jc * csb, rsb, csb, packed_b.data());
+            for (std::size_t ic = 0; ic < m; ic += kern.mc)
+            {
+                const std::size_t mc = std::min(kern.mc, m - ic);
+                pack_a(mc, kc, kern.mr, a + ic * rsa + pc * csa, rsa, csa, packed_a.data());
+                macro_kernel(kern, mc, nc, kc, alpha, packed_a.data(), packed_b.data(),
+                             c + ic * rsc + jc * csc, rsc, csc);
+            }
+        }
+    }
+
+}
+
+/**
+ * parallel : performs C += alpha * A * B on the thread pool, C is cut into a
+ *            grid of macro-tiles (whole mc row blocks by nr-aligned column
+ *            blocks) with a few tiles per thread so that stealing can even out
+ *            the load, and every tile runs the blocked loop nest on its own
+ *
+ * @param  std::size_t m rows of A and C
+ * @param  std::size_t n cols of B and C
+ * @param  std::size_t k cols of A and rows of B
+ * @param  T& alpha scaling of the product
+ * @param  T* a A with strides rsa and csa
+ * @param  T* b B with strides rsb and csb
+ * @param  T* c C with strides rsc and csc
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTGemm<T>::parallel(std::size_t m, std::size_t n, std::size_t k, const T& alpha,
+                         const T* a, std::size_t rsa, std::size_t csa,
+                         const T* b, std::size_t rsb, std::size_t csb,
+                         T* c, std::size_t rsc, std::size_t csc) {
+
+    ZTThreadPool& pool = ZTThreadPool::instance();
+    const ZTGemmKernel<T>& kern = kernel();
+    const std::size_t target_tiles = 4 * pool.get_num_threads();
+
+    const std::size_t tile_rows = std::min(kern.mc, (m + kern.mr - 1) / kern.mr * kern.mr);
+    const std::size_t row_blocks = (m + tile_rows - 1) / tile_rows;
+    const std::size_t col_panels = (n + kern.nr - 1) / kern.nr;
+    const std::size_t wanted_cols = std::max<std::size_t>(1, (target_tiles + row_blocks - 1) / row_blocks);
+    const std::size_t tile_cols = (col_panels + std::min(wanted_cols, col_panels) - 1) / std::min(wanted_cols, col_panels) * kern.nr;
+    const std::size_t col_blocks = (n + tile_cols - 1) / tile_cols;
+
+    pool.parallel_for(row_blocks * col_blocks, [&](std::size_t tile) {
+        const std::size_t i0 = (tile / col_blocks) * tile_rows;
+        const std::size_t j0 = (tile % col_blocks) * tile_cols;
+        blocked(std::min(tile_rows, m - i0), std::min(tile_cols, n - j0), k, alpha,
+                a + i0 * rsa, rsa, csa,
+                b + j0 * csb, rsb, csb,
+                c + i0 * rsc + j0 * csc, rsc, csc);
+    });
+
+}
+
+/**
+ * gemm : performs C = alpha * A * B + beta * C for an m x k matrix A and a
+ *        k x n matrix B
+ *
+ * @param  std::size_t m rows of A and C
+ * @param  std::size_t n cols of B and C
+ * @param  std::size_t k cols of A and rows of B
+ * @param  T& alpha scaling of the product
+ * @param  T* a A with strides rsa and csa
+ * @param  T* b B with strides rsb and csb
+ * @param  T& beta scaling of C
+ * @param  T* c C with strides rsc and csc
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTGemm<T>::gemm(std::size_t m, std::size_t n, std::size_t k, const T& alpha,
+                     const T* a, std::size_t rsa, std::size_t csa,
+                     const T* b, std::size_t rsb, std::size_t csb,
+                     const T& beta, T* c, std::size_t rsc, std::size_t csc) {
+
+    if (m == 0 || n == 0)
+    {
+        return;
+    }
+    scale(m, n, beta, c, rsc, csc);
+    if (k == 0 || alpha == T(0))
+    {
+        return;
+    }
+    if (m * n * k <= small_product)
+    {
+        naive(m, n, k, alpha, a, rsa, csa, b, rsb, csb, c, rsc, csc);
+        return;
+    }
+    if (m * n * k >= parallel_product && ZTThreadPool::instance().get_num_threads() > 1)
+    {
+        parallel(m, n, k, alpha, a, rsa, csa, b, rsb, csb, c, rsc, csc);
+        return;
+    }
+    blocked(m, n, k, alpha, a, rsa, csa, b, rsb, csb, c, rsc, csc);
+
+}
+
+/**
+ * zt_gemm_widened : gemm for a 16-bit storage type, the panels of A and B
+ *                   widened to float a block of k at a time and C kept in
+ *                   float until the end, so the products and the sums all
+ *                   happen in single precision
+ *
+ * @param  std::size_t m rows of A and C
+ * @param  std::size_t n cols of B and C
+ * @param  std::size_t k cols of A and rows of B
+ * @param  S& alpha scaling of the product
+ * @param  S* a A with strides rsa and csa
+ * @param  S* b B with strides rsb and csb
+ * @param  S& beta scaling of C
+ * @param  S* c C with strides rsc and csc
+ * @return nothing
+ *
+ */
+template <typename S>
+void zt_gemm_widened(std::size_t m, std::size_t n, std::size_t k, const S& alpha,
+                     const S* a, std::size_t rsa, std::size_t csa,
+                     const S* b, std::size_t rsb, std::size_t csb,
+                     const S& beta, S* c, std::size_t rsc, std::size_t csc) {
+
+    typedef std::vector<float, ZTAlignedAllocator<float> > buffer_type;
+    const std::size_t block = 256; // depth of the widened panels
+
+    if (m == 0 || n == 0)
+    {
+        return;
+    }
+    buffer_type wc(m * n);
+    if (float(beta) == 0.0f)
+    {
+        std::fill(wc.begin(), wc.end(), 0.0f);
+    }
+    else
+    {
+        ZTHalfConvert::widen(m, n, c, rsc, csc, wc.data(), n);
+        const float scale = beta;
+        _Pragma("GCC ivdep")
+        for (std::size_t i = 0; i < m * n; ++i)
+        {
+            wc[i] *= scale;
+        }
+    }
+    if (k != 0 && float(alpha) != 0.0f)
+    {
+        const std::size_t kb = std::min(k, block);
+        buffer_type wa(m * kb);
+        buffer_type wb(kb * n);
+        for (std::size_t p = 0; p < k; p += kb)
+        {
+            const std::size_t len = std::min(kb, k - p);
+            ZTHalfConvert::widen(m, len, a + p * csa, rsa, csa, wa.data(), len);
+            ZTHalfConvert::widen(len, n, b + p * rsb, rsb, csb, wb.data(), n);
+            ZTGemm<float>::gemm(m, n, len, float(alpha), wa.data(), len, 1, wb.data(), n, 1, 1.0f, wc.data(), n, 1);
+        }
+    }
+    ZTHalfConvert::narrow(m, n, wc.data(), n, c, rsc, csc);
+
+}
+
+template <>
+void ZTGemm<ZTHalf>::gemm(std::size_t m, std::size_t n, std::size_t k, const ZTHalf& alpha,
+                          const ZTHalf* a, std::size_t rsa, std::size_t csa,
+                          const ZTHalf* b, std::size_t rsb, std::size_t csb,
+                          const ZTHalf& beta, ZTHalf* c, std::size_t rsc, std::size_t csc) {
+
+    zt_gemm_widened(m, n, k, alpha, a, rsa, csa, b, rsb, csb, beta, c, rsc, csc);
+
+}
+
+template <>
+void ZTGemm<ZTBFloat16>::gemm(std::size_t m, std::size_t n, std::size_t k, const ZTBFloat16& alpha,
+                              const ZTBFloat16* a, std::size_t rsa, std::size_t csa,
+                              const ZTBFloat16* b, std::size_t rsb, std::size_t csb,
+                              const ZTBFloat16& beta, ZTBFloat16* c, std::size_t rsc, std::size_t csc) {
+
+    zt_gemm_widened(m, n, k, alpha, a, rsa, csa, b, rsb, csb, beta, c, rsc, csc);
+
+}
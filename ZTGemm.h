@@ -0,0 +1,103 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ZTGEMM_H
+#define ZTGEMM_H
+
+#include <vector>
+
+#include "ZTAlignedAllocator.h"
+
+/*
+ * Micro-kernel descriptor : computes an mr x nr tile of C += alpha * A * B from
+ * packed panels of A (mr rows, column-major within the panel) and B (nr columns,
+ * row-major within the panel), and holds the cache blocking that suits it.
+ */
+template <typename T>
+struct ZTGemmKernel {
+    void (*micro_kernel)(std::size_t kc, const T* a, const T* b, const T& alpha, T* c, std::size_t ldc);
+    std::size_t mr; // register tile rows
+    std::size_t nr; // register tile cols
+    std::size_t mc; // rows of A kept in L2
+    std::size_t kc; // depth of the panels kept in L1
+    std::size_t nc; // cols of B kept in L3
+};
+
+/*
+ * ZTGemm : general matrix product C = alpha * A * B + beta * C on strided
+ *          storage, following the Goto/BLIS layering: L3-sized panels of B and
+ *          L2-sized blocks of A are packed into contiguous buffers and swept by
+ *          a register-tiled micro-kernel chosen for the running CPU.
+ *
+ * Every operand is described by a pointer plus a row stride and a column
+ * stride, so transposed operands are expressed by swapping the two strides.
+ */
+template <typename T>
+class ZTGemm {
+
+private:
+    typedef std::vector<T, ZTAlignedAllocator<T> > buffer_type;
+
+    static constexpr std::size_t small_product = 32 * 32 * 32;       // below this packing does not pay off
+    static constexpr std::size_t parallel_product = 128 * 128 * 128; // below this threads do not pay off
+
+    static void pack_a(std::size_t mc, std::size_t kc, std::size_t mr,
+                       const T* a, std::size_t rsa, std::size_t csa, T* packed);
+    static void pack_b(std::size_t kc, std::size_t nc, std::size_t nr,
+                       const T* b, std::size_t rsb, std::size_t csb, T* packed);
+
+    static void macro_kernel(const ZTGemmKernel<T>& kernel, std::size_t mc, std::size_t nc, std::size_t kc,
+                             const T& alpha, const T* packed_a, const T* packed_b,
+                             T* c, std::size_t rsc, std::size_t csc);
+
+    static void scale(std::size_t m, std::size_t n, const T& beta, T* c, std::size_t rsc, std::size_t csc);
+
+    static void naive(std::size_t m, std::size_t n, std::size_t k, const T& alpha,
+                      const T* a, std::size_t rsa, std::size_t csa,
+                      const T* b, std::size_t rsb, std::size_t csb,
+                      T* c, std::size_t rsc, std::size_t csc);
+
+    static void parallel(std::size_t m, std::size_t n, std::size_t k, const T& alpha,
+                         const T* a, std::size_t rsa, std::size_t csa,
+                         const T* b, std::size_t rsb, std::size_t csb,
+                         T* c, std::size_t rsc, std::size_t csc);
+
+    static ZTGemmKernel<T> select_kernel();
+
+public:
+    static const ZTGemmKernel<T>& kernel();
+
+    static void gemm(std::size_t m, std::size_t n, std::size_t k, const T& alpha,
+                     const T* a, std::size_t rsa, std::size_t csa,
+                     const T* b, std::size_t rsb, std::size_t csb,
+                     const T& beta, T* c, std::size_t rsc, std::size_t csc);
+
+    static void blocked(std::size_t m, std::size_t n, std::size_t k, const T& alpha,
+                        const T* a, std::size_t rsa, std::size_t csa,
+                        const T* b, std::size_t rsb, std::size_t csb,
+                        T* c, std::size_t rsc, std::size_t csc);
+
+};
+
+#endif /* ZTGEMM_H */
@@ -0,0 +1,620 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+
+#include "ZTCpu.h"
+#include "ZTBlas.h"
+#include "ZTGemm.h"
+#include "ZTGemv.h"
+#include "ZTHalf.h"
+#include "ZTSimd.h"
+#include "ZTThreadPool.h"
+#include "ZTAlignedAllocator.h"
+
+/**
+ * zt_gemv_dot_rows : portable row kernel, r[i] = a[i * lda + 0 .. n) . x for
+ *                    the four rows i = 0 .. 3
+ *
+ * @param  std::size_t n number of columns
+ * @param  T* a first element of the first row
+ * @param  std::size_t lda distance between rows
+ * @param  T* x contiguous vector of n elements
+ * @param  T* r four results
+ * @return nothing
+ *
+ */
+template <typename T>
+void zt_gemv_dot_rows(std::size_t n, const T* a, std::size_t lda, const T* x, T* r) {
+
+    const T* a1 = a + lda;
+    const T* a2 = a + 2 * lda;
+    const T* a3 = a + 3 * lda;
+    T s0 = T(0), s1 = T(0), s2 = T(0), s3 = T(0);
+    for (std::size_t j = 0; j < n; ++j)
+    {
+        const T xj = x[j];
+        s0 += a[j] * xj;
+        s1 += a1[j] * xj;
+        s2 += a2[j] * xj;
+        s3 += a3[j] * xj;
+    }
+    r[0] = s0;
+    r[1] = s1;
+    r[2] = s2;
+    r[3] = s3;
+
+}
+
+#ifdef ZT_SIMD_X86
+
+/**
+ * zt_gemv_avx2_dot_rows : AVX2/FMA row kernel, two accumulators per row hide
+ *                         the FMA latency
+ *
+ * @param  std::size_t n number of columns
+ * @param  T* a first element of the first row
+ * @param  std::size_t lda distance between rows
+ * @param  T* x contiguous vector of n elements
+ * @param  T* r four results
+ * @return nothing
+ *
+ */
+template <typename T>
+ZT_AVX2_TARGET void zt_gemv_avx2_dot_rows(std::size_t n, const T* a, std::size_t lda, const T* x, T* r) {
+
+    const std::size_t width = 32 / sizeof(T);
+    const T* a1 = a + lda;
+    const T* a2 = a + 2 * lda;
+    const T* a3 = a + 3 * lda;
+    auto s0 = zt_avx2_set1(T(0));
+    auto s1 = s0, s2 = s0, s3 = s0, t0 = s0, t1 = s0, t2 = s0, t3 = s0;
+    std::size_t j = 0;
+    for (; j + 2 * width <= n; j += 2 * width)
+    {
+        const auto x0 = zt_avx2_load(x + j);
+        const auto x1 = zt_avx2_load(x + j + width);
+        s0 = zt_avx2_fmadd(zt_avx2_load(a + j), x0, s0);
+        t0 = zt_avx2_fmadd(zt_avx2_load(a + j + width), x1, t0);
+        s1 = zt_avx2_fmadd(zt_avx2_load(a1 + j), x0, s1);
+        t1 = zt_avx2_fmadd(zt_avx2_load(a1 + j + width), x1, t1);
+        s2 = zt_avx2_fmadd(zt_avx2_load(a2 + j), x0, s2);
+        t2 = zt_avx2_fmadd(zt_avx2_load(a2 + j + width), x1, t2);
+        s3 = zt_avx2_fmadd(zt_avx2_load(a3 + j), x0, s3);
+        t3 = zt_avx2_fmadd(zt_avx2_load(a3 + j + width), x1, t3);
+    }
+    for (; j + width <= n; j += width)
+    {
+        const auto x0 = zt_avx2_load(x + j);
+        s0 = zt_avx2_fmadd(zt_avx2_load(a + j), x0, s0);
+        s1 = zt_avx2_fmadd(zt_avx2_load(a1 + j), x0, s1);
+        s2 = zt_avx2_fmadd(zt_avx2_load(a2 + j), x0, s2);
+        s3 = zt_avx2_fmadd(zt_avx2_load(a3 + j), x0, s3);
+    }
+    T r0 = zt_avx2_sum(zt_avx2_add(s0, t0));
+    T r1 = zt_avx2_sum(zt_avx2_add(s1, t1));
+    T r2 = zt_avx2_sum(zt_avx2_add(s2, t2));
+    T r3 = zt_avx2_sum(zt_avx2_add(s3, t3));
+    for (; j < n; ++j)
+    {
+        r0 += a[j] * x[j];
+        r1 += a1[j] * x[j];
+        r2 += a2[j] * x[j];
+        r3 += a3[j] * x[j];
+    }
+    r[0] = r0;
+    r[1] = r1;
+    r[2] = r2;
+    r[3] = r3;
+
+}
+
+/**
+ * zt_gemv_avx512_dot_rows : AVX-512 row kernel, two accumulators per row hide
+ *                           the FMA latency
+ *
+ * @param  std::size_t n number of columns
+ * @param  T* a first element of the first row
+ * @param  std::size_t lda distance between rows
+ * @param  T* x contiguous vector of n elements
+ * @param  T* r four results
+ * @return nothing
+ *
+ */
+template <typename T>
+ZT_AVX512_TARGET void zt_gemv_avx512_dot_rows(std::size_t n, const T* a, std::size_t lda, const T* x, T* r) {
+
+    const std::size_t width = 64 / sizeof(T);
+    const T* a1 = a + lda;
+    const T* a2 = a + 2 * lda;
+    const T* a3 = a + 3 * lda;
+    auto s0 = zt_avx512_set1(T(0));
+    auto s1 = s0, s2 = s0, s3 = s0, t0 = s0, t1 = s0, t2 = s0, t3 = s0;
+    std::size_t j = 0;
+    for (; j + 2 * width <= n; j += 2 * width)
+    {
+        const auto x0 = zt_avx512_load(x + j);
+        const auto x1 = zt_avx512_load(x + j + width);
+        s0 = zt_avx512_fmadd(zt_avx512_load(a + j), x0, s0);
+        t0 = zt_avx512_fmadd(zt_avx512_load(a + j + width), x1, t0);
+        s1 = zt_avx512_fmadd(zt_avx512_load(a1 + j), x0, s1);
+        t1 = zt_avx512_fmadd(zt_avx512_load(a1 + j + width), x1, t1);
+        s2 = zt_avx512_fmadd(zt_avx512_load(a2 + j), x0, s2);
+        t2 = zt_avx512_fmadd(zt_avx512_load(a2 + j + width), x1, t2);
+        s3 = zt_avx512_fmadd(zt_avx512_load(a3 + j), x0, s3);
+        t3 = zt_avx512_fmadd(zt_avx512_load(a3 + j + width), x1, t3);
+    }
+    for (; j + width <= n; j += width)
+    {
+        const auto x0 = zt_avx512_load(x + j);
+        s0 = zt_avx512_fmadd(zt_avx512_load(a + j), x0, s0);
+        s1 = zt_avx512_fmadd(zt_avx512_load(a1 + j), x0, s1);
+        s2 = zt_avx512_fmadd(zt_avx512_load(a2 + j), x0, s2);
+        s3 = zt_avx512_fmadd(zt_avx512_load(a3 + j), x0, s3);
+    }
+    T r0 = zt_avx512_sum(zt_avx512_add(s0, t0));
+    T r1 = zt_avx512_sum(zt_avx512_add(s1, t1));
+    T r2 = zt_avx512_sum(zt_avx512_add(s2, t2));
+    T r3 = zt_avx512_sum(zt_avx512_add(s3, t3));
+    for (; j < n; ++j)
+    {
+        r0 += a[j] * x[j];
+        r1 += a1[j] * x[j];
+        r2 += a2[j] * x[j];
+        r3 += a3[j] * x[j];
+    }
+    r[0] = r0;
+    r[1] = r1;
+    r[2] = r2;
+    r[3] = r3;
+
+}
+
+#endif /* ZT_SIMD_X86 */
+
+/**
+ * zt_gemv_select_float_kernel : widest row kernel for float or double
+ *
+ * @param  nothing
+ * @return ZTGemvKernel<T> kernel
+ *
+ */
+template <typename T>
+ZTGemvKernel<T> zt_gemv_select_float_kernel() {
+
+#ifdef ZT_SIMD_X86
+    if (ZTCpu::instruction_set() >= ZT_ISA_AVX512)
+    {
+        ZTGemvKernel<T> k = { zt_gemv_avx512_dot_rows<T> };
+        return k;
+    }
+    if (ZTCpu::instruction_set() >= ZT_ISA_AVX2)
+    {
+        ZTGemvKernel<T> k = { zt_gemv_avx2_dot_rows<T> };
+        return k;
+    }
+#endif
+    ZTGemvKernel<T> k = { zt_gemv_dot_rows<T> };
+    return k;
+
+}
+
+/**
+ * select_kernel : portable row kernel for any arithmetic type
+ *
+ * @param  nothing
+ * @return ZTGemvKernel<T> kernel
+ *
+ */
+template <typename T>
+ZTGemvKernel<T> ZTGemv<T>::select_kernel() {
+
+    ZTGemvKernel<T> k = { zt_gemv_dot_rows<T> };
+    return k;
+
+}
+
+template <>
+ZTGemvKernel<double> ZTGemv<double>::select_kernel() {
+
+    return zt_gemv_select_float_kernel<double>();
+
+}
+
+template <>
+ZTGemvKernel<float> ZTGemv<float>::select_kernel() {
+
+    return zt_gemv_select_float_kernel<float>();
+
+}
+
+/**
+ * kernel : row kernel in use, selected once on first call
+ *
+ * @param  nothing
+ * @return const ZTGemvKernel<T>& kernel
+ *
+ */
+template <typename T>
+const ZTGemvKernel<T>& ZTGemv<T>::kernel() {
+
+    static const ZTGemvKernel<T> selected = select_kernel();
+    return selected;
+
+}
+
+/**
+ * scale : performs y = beta * y, where beta == 0 overwrites y so that
+ *         uninitialized or non-finite values do not leak into the product
+ *
+ * @param  std::size_t m number of elements
+ * @param  T& beta scaling of y
+ * @param  T* y y with stride incy
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTGemv<T>::scale(std::size_t m, const T& beta, T* y, std::size_t incy) {
+
+    if (beta == T(1))
+    {
+        return;
+    }
+    for (std::size_t i = 0; i < m; ++i)
+    {
+        y[i * incy] = (beta == T(0)) ? T(0) : beta * y[i * incy];
+    }
+
+}
+
+/**
+ * rows : performs y += alpha * A * x for an A with contiguous rows and a
+ *        contiguous x. Columns are taken in blocks that keep their part of x
+ *        in L1 while the row kernel sweeps four rows at a time
+ *
+ * @param  std::size_t m rows of A
+ * @param  std::size_t n cols of A
+ * @param  T& alpha scaling of the product
+ * @param  T* a A with rows lda elements apart
+ * @param  T* x contiguous x
+ * @param  T* y y with stride incy
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTGemv<T>::rows(std::size_t m, std::size_t n, const T& alpha,
+                     const T* a, std::size_t lda, const T* x, T* y, std::size_t incy) {
+
+    const ZTGemvKernel<T>& kern = kernel();
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    const std::size_t nb = std::max<std::size_t>(1, block_bytes / sizeof(T));
+    T r[4];
+    for (std::size_t j0 = 0; j0 < n; j0 += nb)
+    {
+        const std::size_t nc = std::min(nb, n - j0);
+        std::size_t i = 0;
+        for (; i + 4 <= m; i += 4)
+        {
+            kern.dot_rows(nc, a + i * lda + j0, lda, x + j0, r);
+            y[i * incy] += alpha * r[0];
+            y[(i + 1) * incy] += alpha * r[1];
+            y[(i + 2) * incy] += alpha * r[2];
+            y[(i + 3) * incy] += alpha * r[3];
+        }
+        for (; i < m; ++i)
+        {
+            y[i * incy] += alpha * blas.dot(nc, a + i * lda + j0, x + j0);
+        }
+    }
+
+}
+
+/**
+ * cols : performs y += alpha * A * x for an A with contiguous columns and a
+ *        contiguous y, as one axpy per column. Rows are taken in blocks that
+ *        keep their part of y in L1 while all the columns are accumulated
+ *
+ * @param  std::size_t m rows of A
+ * @param  std::size_t n cols of A
+ * @param  T& alpha scaling of the product
+ * @param  T* a A with columns lda elements apart
+ * @param  T* x x with stride incx
+ * @param  T* y contiguous y
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTGemv<T>::cols(std::size_t m, std::size_t n, const T& alpha,
+                     const T* a, std::size_t lda, const T* x, std::size_t incx, T* y) {
+
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    const std::size_t mb = std::max<std::size_t>(1, block_bytes / sizeof(T));
+    for (std::size_t i0 = 0; i0 < m; i0 += mb)
+    {
+        const std::size_t mc = std::min(mb, m - i0);
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            blas.axpy(mc, alpha * x[j * incx], a + j * lda + i0, y + i0);
+        }
+    }
+
+}
+
+/**
+ * strided : performs y += alpha * A * x for any strides
+ *
+ * @param  std::size_t m rows of A
+ * @param  std::size_t n cols of A
+ * @param  T& alpha scaling of the product
+ * @param  T* a A with strides rsa and csa
+ * @param  T* x x with stride incx
+ * @param  T* y y with stride incy
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTGemv<T>::strided(std::size_t m, std::size_t n, const T& alpha,
+                        const T* a, std::size_t rsa, std::size_t csa,
+                        const T* x, std::size_t incx, T* y, std::size_t incy) {
+
+    for (std::size_t i = 0; i < m; ++i)
+    {
+        const T* row = a + i * rsa;
+        T sum = T(0);
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            sum += row[j * csa] * x[j * incx];
+        }
+        y[i * incy] += alpha * sum;
+    }
+
+}
+
+/**
+ * serial : performs y += alpha * A * x on the calling thread, through the
+ *          kernel that matches the layout of A
+ *
+ * @param  std::size_t m rows of A
+ * @param  std::size_t n cols of A
+ * @param  T& alpha scaling of the product
+ * @param  T* a A with strides rsa and csa
+ * @param  T* x x with stride incx
+ * @param  T* y y with stride incy
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTGemv<T>::serial(std::size_t m, std::size_t n, const T& alpha,
+                       const T* a, std::size_t rsa, std::size_t csa,
+                       const T* x, std::size_t incx, T* y, std::size_t incy) {
+
+    if (csa == 1 && incx == 1)
+    {
+        rows(m, n, alpha, a, rsa, x, y, incy);
+    }
+    else if (rsa == 1 && incy == 1)
+    {
+        cols(m, n, alpha, a, csa, x, incx, y);
+    }
+    else
+    {
+        strided(m, n, alpha, a, rsa, csa, x, incx, y, incy);
+    }
+
+}
+
+/**
+ * gemv : performs y = alpha * A * x + beta * y for an m x n matrix A. y must
+ *        not overlap A or x. A strided x against contiguous rows is packed
+ *        first, and large products split the rows of y over the thread pool
+ *
+ * @param  std::size_t m rows of A, size of y
+ * @param  std::size_t n cols of A, size of x
+ * @param  T& alpha scaling of the product
+ * @param  T* a A with strides rsa and csa
+ * @param  T* x x with stride incx
+ * @param  T& beta scaling of y
+ * @param  T* y y with stride incy
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTGemv<T>::gemv(std::size_t m, std::size_t n, const T& alpha,
+                     const T* a, std::size_t rsa, std::size_t csa,
+                     const T* x, std::size_t incx,
+                     const T& beta, T* y, std::size_t incy) {
+
+    if (m == 0)
+    {
+        return;
+    }
+    scale(m, beta, y, incy);
+    if (n == 0 || alpha == T(0))
+    {
+        return;
+    }
+    std::vector<T, ZTAlignedAllocator<T> > packed;
+    if (csa == 1 && incx != 1)
+    {
+        packed.resize(n);
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            packed[j] = x[j * incx];
+        }
+        x = packed.data();
+        incx = 1;
+    }
+    ZTThreadPool& pool = ZTThreadPool::instance();
+    if (m * n >= parallel_size && m >= 8 && pool.get_num_threads() > 1)
+    {
+        const std::size_t chunks = std::min(4 * pool.get_num_threads(), m / 4);
+        const std::size_t chunk_rows = ((m + chunks - 1) / chunks + 3) / 4 * 4;
+        pool.parallel_for((m + chunk_rows - 1) / chunk_rows, [&](std::size_t chunk) {
+            const std::size_t i0 = chunk * chunk_rows;
+            serial(std::min(chunk_rows, m - i0), n, alpha, a + i0 * rsa, rsa, csa, x, incx, y + i0 * incy, incy);
+        });
+        return;
+    }
+    serial(m, n, alpha, a, rsa, csa, x, incx, y, incy);
+
+}
+
+/**
+ * batch : performs y_b = alpha * A * x_b + beta * y_b for count vectors x_b,
+ *         stored ldx elements apart, and results y_b, stored ldy elements
+ *         apart. From batch_size vectors the batch is the single product
+ *         Y^T = alpha * X^T * A^T + beta * Y^T handed to ZTGemm, which streams
+ *         A once for all the vectors
+ *
+ * @param  std::size_t m rows of A, size of every y_b
+ * @param  std::size_t n cols of A, size of every x_b
+ * @param  std::size_t count number of vectors
+ * @param  T& alpha scaling of the products
+ * @param  T* a A with strides rsa and csa
+ * @param  T* x first contiguous x_b, the next ones ldx elements apart
+ * @param  T& beta scaling of y
+ * @param  T* y first contiguous y_b, the next ones ldy elements apart
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTGemv<T>::batch(std::size_t m, std::size_t n, std::size_t count, const T& alpha,
+                      const T* a, std::size_t rsa, std::size_t csa,
+                      const T* x, std::size_t ldx,
+                      const T& beta, T* y, std::size_t ldy) {
+
+    if (count < batch_size)
+    {
+        for (std::size_t b = 0; b < count; ++b)
+        {
+            gemv(m, n, alpha, a, rsa, csa, x + b * ldx, 1, beta, y + b * ldy, 1);
+        }
+        return;
+    }
+    ZTGemm<T>::gemm(count, m, n, alpha, x, ldx, 1, a, csa, rsa, beta, y, ldy, 1);
+
+}
+
+/**
+ * zt_gemv_widened : gemv for a 16-bit storage type. x and y are widened to
+ *                   float once, A a tile at a time, and every tile runs
+ *                   through the float kernels so the sums stay in single
+ *                   precision. Large products split the row tiles over the
+ *                   thread pool, each task with its own tile buffer
+ *
+ * @param  std::size_t m rows of A, size of y
+ * @param  std::size_t n cols of A, size of x
+ * @param  S& alpha scaling of the product
+ * @param  S* a A with strides rsa and csa
+ * @param  S* x x with stride incx
+ * @param  S& beta scaling of y
+ * @param  S* y y with stride incy
+ * @return nothing
+ *
+ */
+template <typename S>
+void zt_gemv_widened(std::size_t m, std::size_t n, const S& alpha,
+                     const S* a, std::size_t rsa, std::size_t csa,
+                     const S* x, std::size_t incx,
+                     const S& beta, S* y, std::size_t incy) {
+
+    typedef std::vector<float, ZTAlignedAllocator<float> > buffer_type;
+    const std::size_t tile_size = 16 * 1024;      // floats of A widened at a time
+    const std::size_t parallel_size = 256 * 256;  // below this threads do not pay off
+
+    if (m == 0)
+    {
+        return;
+    }
+    buffer_type wy(m);
+    if (float(beta) == 0.0f)
+    {
+        std::fill(wy.begin(), wy.end(), 0.0f);
+    }
+    else
+    {
+        const float scale = beta;
+        ZTHalfConvert::widen(1, m, y, 0, incy, wy.data(), m);
+        _Pragma("GCC ivdep")
+        for (std::size_t i = 0; i < m; ++i)
+        {
+            wy[i] *= scale;
+        }
+    }
+    if (n != 0 && float(alpha) != 0.0f)
+    {
+        buffer_type wx(n);
+        ZTHalfConvert::widen(1, n, x, 0, incx, wx.data(), n);
+        const std::size_t cb = std::min(n, tile_size / 4);
+        const std::size_t rb = std::max<std::size_t>(4, tile_size / cb);
+        auto rows = [&](std::size_t i0, std::size_t mb) {
+            buffer_type tile(mb * cb);
+            for (std::size_t j0 = 0; j0 < n; j0 += cb)
+            {
+                const std::size_t nb = std::min(cb, n - j0);
+                ZTHalfConvert::widen(mb, nb, a + i0 * rsa + j0 * csa, rsa, csa, tile.data(), nb);
+                ZTGemv<float>::gemv(mb, nb, float(alpha), tile.data(), nb, 1, wx.data() + j0, 1, 1.0f, wy.data() + i0, 1);
+            }
+        };
+        ZTThreadPool& pool = ZTThreadPool::instance();
+        if (m * n >= parallel_size && m > rb && pool.get_num_threads() > 1)
+        {
+            pool.parallel_for((m + rb - 1) / rb, [&](std::size_t block) {
+                const std::size_t i0 = block * rb;
+                rows(i0, std::min(rb, m - i0));
+            });
+        }
+        else
+        {
+            for (std::size_t i0 = 0; i0 < m; i0 += rb)
+            {
+                rows(i0, std::min(rb, m - i0));
+            }
+        }
+    }
+    ZTHalfConvert::narrow(1, m, wy.data(), m, y, 0, incy);
+
+}
+
+template <>
+void ZTGemv<ZTHalf>::gemv(std::size_t m, std::size_t n, const ZTHalf& alpha,
+                          const ZTHalf* a, std::size_t rsa, std::size_t csa,
+                          const ZTHalf* x, std::size_t incx,
+                          const ZTHalf& beta, ZTHalf* y, std::size_t incy) {
+
+    zt_gemv_widened(m, n, alpha, a, rsa, csa, x, incx, beta, y, incy);
+
+}
+
+template <>
+void ZTGemv<ZTBFloat16>::gemv(std::size_t m, std::size_t n, const ZTBFloat16& alpha,
+                              const ZTBFloat16* a, std::size_t rsa, std::size_t csa,
+                              const ZTBFloat16* x, std::size_t incx,
+                              const ZTBFloat16& beta, ZTBFloat16* y, std::size_t incy) {
+
+    zt_gemv_widened(m, n, alpha, a, rsa, csa, x, incx, beta, y, incy);
+
+}
@@ -0,0 +1,93 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ZTGEMV_H
+#define ZTGEMV_H
+
+#include <cstddef>
+
+/*
+ * Row kernel : computes the dot products of four consecutive rows of A (lda
+ * elements apart) with x over n contiguous columns, so that every element of
+ * x is loaded once for four rows.
+ */
+template <typename T>
+struct ZTGemvKernel {
+    void (*dot_rows)(std::size_t n, const T* a, std::size_t lda, const T* x, T* r);
+};
+
+/*
+ * ZTGemv : matrix-vector product y = alpha * A * x + beta * y on strided
+ *          storage. Like ZTGemm every operand is a pointer plus strides, so
+ *          the transposed product is the same call with the two strides of A
+ *          swapped.
+ *
+ *          Contiguous rows are swept four at a time by a SIMD row kernel over
+ *          column blocks of x that stay in L1; contiguous columns are
+ *          accumulated into row blocks of y that stay in L1 with the BLAS-1
+ *          axpy. Large products split the rows of y over the thread pool, so
+ *          the threads never write the same element. A batch of vectors
+ *          against one matrix runs as a single GEMM, which reads A once for
+ *          the whole batch.
+ */
+template <typename T>
+class ZTGemv {
+
+private:
+    static constexpr std::size_t block_bytes = 16 * 1024;       // block of x or y kept in L1
+    static constexpr std::size_t parallel_size = 256 * 256;     // below this threads do not pay off
+    static constexpr std::size_t batch_size = 4;                // from this many vectors a batch runs as a GEMM
+
+    static void scale(std::size_t m, const T& beta, T* y, std::size_t incy);
+
+    static void rows(std::size_t m, std::size_t n, const T& alpha,
+                     const T* a, std::size_t lda, const T* x, T* y, std::size_t incy);
+    static void cols(std::size_t m, std::size_t n, const T& alpha,
+                     const T* a, std::size_t lda, const T* x, std::size_t incx, T* y);
+    static void strided(std::size_t m, std::size_t n, const T& alpha,
+                        const T* a, std::size_t rsa, std::size_t csa,
+                        const T* x, std::size_t incx, T* y, std::size_t incy);
+
+    static void serial(std::size_t m, std::size_t n, const T& alpha,
+                       const T* a, std::size_t rsa, std::size_t csa,
+                       const T* x, std::size_t incx, T* y, std::size_t incy);
+
+    static ZTGemvKernel<T> select_kernel();
+
+public:
+    static const ZTGemvKernel<T>& kernel();
+
+    static void gemv(std::size_t m, std::size_t n, const T& alpha,
+                     const T* a, std::size_t rsa, std::size_t csa,
+                     const T* x, std::size_t incx,
+                     const T& beta, T* y, std::size_t incy);
+
+    static void batch(std::size_t m, std::size_t n, std::size_t count, const T& alpha,
+                      const T* a, std::size_t rsa, std::size_t csa,
+                      const T* x, std::size_t ldx,
+                      const T& beta, T* y, std::size_t ldy);
+
+};
+
+#endif /* ZTGEMV_H */
@@ -0,0 +1,773 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+#include "ZTCpu.h"
+#include "ZTHalf.h"
+#include "ZTSimd.h"
+
+/**
+ * zt_half_from_float : rounds a float to the nearest binary16, ties to even
+ *
+ * @param  float value
+ * @return std::uint16_t bits
+ *
+ */
+inline std::uint16_t zt_half_from_float(float value) {
+
+    std::uint32_t x;
+    std::memcpy(&x, &value, sizeof(x));
+    const std::uint32_t sign = (x >> 16) & 0x8000u;
+    const std::uint32_t magnitude = x & 0x7fffffffu;
+    if (magnitude >= 0x7f800000u)
+    {
+        return static_cast<std::uint16_t>(sign | (magnitude > 0x7f800000u ? 0x7e00u : 0x7c00u));
+    }
+    if (magnitude >= 0x477ff000u) // 65520 and above round past the largest half
+    {
+        return static_cast<std::uint16_t>(sign | 0x7c00u);
+    }
+    if (magnitude < 0x38800000u) // below 2^-14 the result is subnormal
+    {
+        if (magnitude < 0x33000000u)
+        {
+            return static_cast<std::uint16_t>(sign);
+        }
+        const std::uint32_t mantissa = (magnitude & 0x7fffffu) | 0x800000u;
+        const std::uint32_t shift = 126u - (magnitude >> 23);
+        std::uint32_t h = mantissa >> shift;
+        const std::uint32_t remainder = mantissa & ((1u << shift) - 1u);
+        const std::uint32_t halfway = 1u << (shift - 1u);
+        if (remainder > halfway || (remainder == halfway && (h & 1u)))
+        {
+            ++h;
+        }
+        return static_cast<std::uint16_t>(sign | h);
+    }
+    std::uint32_t h = (magnitude - 0x38000000u) >> 13;
+    const std::uint32_t remainder = magnitude & 0x1fffu;
+    if (remainder > 0x1000u || (remainder == 0x1000u && (h & 1u)))
+    {
+        ++h;
+    }
+    return static_cast<std::uint16_t>(sign | h);
+
+}
+
+/**
+ * zt_half_to_float : exact value of a binary16 as a float
+ *
+ * @param  std::uint16_t bits
+ * @return float value
+ *
+ */
+inline float zt_half_to_float(std::uint16_t bits) {
+
+    const std::uint32_t sign = static_cast<std::uint32_t>(bits & 0x8000u) << 16;
+    std::uint32_t exponent = (bits >> 10) & 0x1fu;
+    std::uint32_t mantissa = bits & 0x3ffu;
+    std::uint32_t x;
+    if (exponent == 0x1fu)
+    {
+        x = sign | 0x7f800000u | (mantissa << 13);
+    }
+    else if (exponent != 0)
+    {
+        x = sign | ((exponent + 112u) << 23) | (mantissa << 13);
+    }
+    else if (mantissa == 0)
+    {
+        x = sign;
+    }
+    else
+    {
+        exponent = 113u;
+        while ((mantissa & 0x400u) == 0)
+        {
+            mantissa <<= 1;
+            --exponent;
+        }
+        x = sign | (exponent << 23) | ((mantissa & 0x3ffu) << 13);
+    }
+    float value;
+    std::memcpy(&value, &x, sizeof(value));
+    return value;
+
+}
+
+/**
+ * zt_bfloat16_from_float : rounds a float to the nearest bfloat16, ties to
+ *                          even, NaNs kept quiet
+ *
+ * @param  float value
+ * @return std::uint16_t bits
+ *
+ */
+inline std::uint16_t zt_bfloat16_from_float(float value) {
+
+    std::uint32_t x;
+    std::memcpy(&x, &value, sizeof(x));
+    if ((x & 0x7fffffffu) > 0x7f800000u)
+    {
+        return static_cast<std::uint16_t>((x >> 16) | 0x40u);
+    }
+    return static_cast<std::uint16_t>((x + 0x7fffu + ((x >> 16) & 1u)) >> 16);
+
+}
+
+/**
+ * zt_bfloat16_to_float : exact value of a bfloat16 as a float
+ *
+ * @param  std::uint16_t bits
+ * @return float value
+ *
+ */
+inline float zt_bfloat16_to_float(std::uint16_t bits) {
+
+    const std::uint32_t x = static_cast<std::uint32_t>(bits) << 16;
+    float value;
+    std::memcpy(&value, &x, sizeof(value));
+    return value;
+
+}
+
+/**
+ * Constructor : rounds a float to the nearest half
+ *
+ * @param  float value
+ * @return nothing
+ *
+ */
+inline ZTHalf::ZTHalf(float value) : bits(zt_half_from_float(value)) {
+
+}
+
+/**
+ * float : value of the half as a float
+ *
+ * @param  nothing
+ * @return float
+ *
+ */
+inline ZTHalf::operator float() const {
+
+    return zt_half_to_float(bits);
+
+}
+
+/**
+ * operator += : adds in float and rounds the sum
+ *
+ * @param  float value
+ * @return ZTHalf& *this
+ *
+ */
+inline ZTHalf& ZTHalf::operator +=(float value) {
+
+    return *this = ZTHalf(float(*this) + value);
+
+}
+
+/**
+ * operator -= : subtracts in float and rounds the difference
+ *
+ * @param  float value
+ * @return ZTHalf& *this
+ *
+ */
+inline ZTHalf& ZTHalf::operator -=(float value) {
+
+    return *this = ZTHalf(float(*this) - value);
+
+}
+
+/**
+ * operator *= : multiplies in float and rounds the product
+ *
+ * @param  float value
+ * @return ZTHalf& *this
+ *
+ */
+inline ZTHalf& ZTHalf::operator *=(float value) {
+
+    return *this = ZTHalf(float(*this) * value);
+
+}
+
+/**
+ * operator /= : divides in float and rounds the quotient
+ *
+ * @param  float value
+ * @return ZTHalf& *this
+ *
+ */
+inline ZTHalf& ZTHalf::operator /=(float value) {
+
+    return *this = ZTHalf(float(*this) / value);
+
+}
+
+/**
+ * from_bits : half with the given binary16 encoding
+ *
+ * @param  std::uint16_t bits
+ * @return ZTHalf
+ *
+ */
+inline ZTHalf ZTHalf::from_bits(std::uint16_t bits) {
+
+    ZTHalf h;
+    h.bits = bits;
+    return h;
+
+}
+
+/**
+ * Constructor : rounds a float to the nearest bfloat16
+ *
+ * @param  float value
+ * @return nothing
+ *
+ */
+inline ZTBFloat16::ZTBFloat16(float value) : bits(zt_bfloat16_from_float(value)) {
+
+}
+
+/**
+ * float : value of the bfloat16 as a float
+ *
+ * @param  nothing
+ * @return float
+ *
+ */
+inline ZTBFloat16::operator float() const {
+
+    return zt_bfloat16_to_float(bits);
+
+}
+
+/**
+ * operator += : adds in float and rounds the sum
+ *
+ * @param  float value
+ * @return ZTBFloat16& *this
+ *
+ */
+inline ZTBFloat16& ZTBFloat16::operator +=(float value) {
+
+    return *this = ZTBFloat16(float(*this) + value);
+
+}
+
+/**
+ * operator -= : subtracts in float and rounds the difference
+ *
+ * @param  float value
+ * @return ZTBFloat16& *this
+ *
+ */
+inline ZTBFloat16& ZTBFloat16::operator -=(float value) {
+
+    return *this = ZTBFloat16(float(*this) - value);
+
+}
+
+/**
+ * operator *= : multiplies in float and rounds the product
+ *
+ * @param  float value
+ * @return ZTBFloat16& *this
+ *
+ */
+inline ZTBFloat16& ZTBFloat16::operator *=(float value) {
+
+    return *this = ZTBFloat16(float(*this) * value);
+
+}
+
+/**
+ * operator /= : divides in float and rounds the quotient
+ *
+ * @param  float value
+ * @return ZTBFloat16& *this
+ *
+ */
+inline ZTBFloat16& ZTBFloat16::operator /=(float value) {
+
+    return *this = ZTBFloat16(float(*this) / value);
+
+}
+
+/**
+ * from_bits : bfloat16 with the given encoding
+ *
+ * @param  std::uint16_t bits
+ * @return ZTBFloat16
+ *
+ */
+inline ZTBFloat16 ZTBFloat16::from_bits(std::uint16_t bits) {
+
+    ZTBFloat16 b;
+    b.bits = bits;
+    return b;
+
+}
+
+/**
+ * zt_half_scalar_widen : half to float, one element at a time
+ *
+ * @param  std::size_t n number of elements
+ * @param  ZTHalf* x input
+ * @param  float* y output
+ * @return nothing
+ *
+ */
+void zt_half_scalar_widen(std::size_t n, const ZTHalf* x, float* y) {
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        y[i] = zt_half_to_float(x[i].bits);
+    }
+
+}
+
+/**
+ * zt_half_scalar_narrow : float to half, one element at a time
+ *
+ * @param  std::size_t n number of elements
+ * @param  float* x input
+ * @param  ZTHalf* y output
+ * @return nothing
+ *
+ */
+void zt_half_scalar_narrow(std::size_t n, const float* x, ZTHalf* y) {
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        y[i].bits = zt_half_from_float(x[i]);
+    }
+
+}
+
+/**
+ * zt_bfloat16_scalar_widen : bfloat16 to float, one element at a time
+ *
+ * @param  std::size_t n number of elements
+ * @param  ZTBFloat16* x input
+ * @param  float* y output
+ * @return nothing
+ *
+ */
+void zt_bfloat16_scalar_widen(std::size_t n, const ZTBFloat16* x, float* y) {
+
+    _Pragma("GCC ivdep")
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        y[i] = zt_bfloat16_to_float(x[i].bits);
+    }
+
+}
+
+/**
+ * zt_bfloat16_scalar_narrow : float to bfloat16, one element at a time
+ *
+ * @param  std::size_t n number of elements
+ * @param  float* x input
+ * @param  ZTBFloat16* y output
+ * @return nothing
+ *
+ */
+void zt_bfloat16_scalar_narrow(std::size_t n, const float* x, ZTBFloat16* y) {
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        y[i].bits = zt_bfloat16_from_float(x[i]);
+    }
+
+}
+
+#ifdef ZT_SIMD_X86
+
+/**
+ * zt_half_f16c_widen : F16C kernel for half to float
+ *
+ * @param  std::size_t n number of elements
+ * @param  ZTHalf* x input
+ * @param  float* y output
+ * @return nothing
+ *
+ */
+ZT_F16C_TARGET void zt_half_f16c_widen(std::size_t n, const ZTHalf* x, float* y) {
+
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        _mm256_storeu_ps(y + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(x + i))));
+    }
+    zt_half_scalar_widen(n - i, x + i, y + i);
+
+}
+
+/**
+ * zt_half_f16c_narrow : F16C kernel for float to half
+ *
+ * @param  std::size_t n number of elements
+ * @param  float* x input
+ * @param  ZTHalf* y output
+ * @return nothing
+ *
+ */
+ZT_F16C_TARGET void zt_half_f16c_narrow(std::size_t n, const float* x, ZTHalf* y) {
+
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(y + i), _mm256_cvtps_ph(_mm256_loadu_ps(x + i), _MM_FROUND_TO_NEAREST_INT));
+    }
+    zt_half_scalar_narrow(n - i, x + i, y + i);
+
+}
+
+/**
+ * zt_bfloat16_avx2_widen : AVX2 kernel for bfloat16 to float, a zero
+ *                          extension and a shift into the upper half
+ *
+ * @param  std::size_t n number of elements
+ * @param  ZTBFloat16* x input
+ * @param  float* y output
+ * @return nothing
+ *
+ */
+ZT_AVX2_TARGET void zt_bfloat16_avx2_widen(std::size_t n, const ZTBFloat16* x, float* y) {
+
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        const __m256i wide = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(x + i)));
+        _mm256_storeu_ps(y + i, _mm256_castsi256_ps(_mm256_slli_epi32(wide, 16)));
+    }
+    zt_bfloat16_scalar_widen(n - i, x + i, y + i);
+
+}
+
+/**
+ * zt_bfloat16_avx2_narrow : AVX2 kernel for float to bfloat16, rounding to
+ *                           nearest even in integer arithmetic
+ *
+ * @param  std::size_t n number of elements
+ * @param  float* x input
+ * @param  ZTBFloat16* y output
+ * @return nothing
+ *
+ */
+ZT_AVX2_TARGET void zt_bfloat16_avx2_narrow(std::size_t n, const float* x, ZTBFloat16* y) {
+
+    const __m256i bias = _mm256_set1_epi32(0x7fff);
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i quiet = _mm256_set1_epi32(0x400000);
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        const __m256 v = _mm256_loadu_ps(x + i);
+        const __m256i bits = _mm256_castps_si256(v);
+        const __m256i odd = _mm256_and_si256(_mm256_srli_epi32(bits, 16), one);
+        __m256i rounded = _mm256_add_epi32(bits, _mm256_add_epi32(bias, odd));
+        const __m256i nan = _mm256_castps_si256(_mm256_cmp_ps(v, v, _CMP_UNORD_Q));
+        rounded = _mm256_blendv_epi8(rounded, _mm256_or_si256(bits, quiet), nan);
+        const __m256i packed = _mm256_packus_epi32(_mm256_srli_epi32(rounded, 16), _mm256_setzero_si256());
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(y + i), _mm256_castsi256_si128(_mm256_permute4x64_epi64(packed, 0x08)));
+    }
+    zt_bfloat16_scalar_narrow(n - i, x + i, y + i);
+
+}
+
+/**
+ * zt_half_avx512_widen : AVX-512 kernel for half to float
+ *
+ * @param  std::size_t n number of elements
+ * @param  ZTHalf* x input
+ * @param  float* y output
+ * @return nothing
+ *
+ */
+ZT_AVX512_TARGET void zt_half_avx512_widen(std::size_t n, const ZTHalf* x, float* y) {
+
+    const __mmask16 all = 0xFFFF; // zero-masked forms, the unmasked ones trip -Wmaybe-uninitialized on GCC 12
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        _mm512_storeu_ps(y + i, _mm512_maskz_cvtph_ps(all, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i))));
+    }
+    zt_half_scalar_widen(n - i, x + i, y + i);
+
+}
+
+/**
+ * zt_half_avx512_narrow : AVX-512 kernel for float to half
+ *
+ * @param  std::size_t n number of elements
+ * @param  float* x input
+ * @param  ZTHalf* y output
+ * @return nothing
+ *
+ */
+ZT_AVX512_TARGET void zt_half_avx512_narrow(std::size_t n, const float* x, ZTHalf* y) {
+
+    const __mmask16 all = 0xFFFF;
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(y + i), _mm512_maskz_cvtps_ph(all, _mm512_loadu_ps(x + i), _MM_FROUND_TO_NEAREST_INT));
+    }
+    zt_half_scalar_narrow(n - i, x + i, y + i);
+
+}
+
+/**
+ * zt_bfloat16_avx512_widen : AVX-512 kernel for bfloat16 to float
+ *
+ * @param  std::size_t n number of elements
+ * @param  ZTBFloat16* x input
+ * @param  float* y output
+ * @return nothing
+ *
+ */
+ZT_AVX512_TARGET void zt_bfloat16_avx512_widen(std::size_t n, const ZTBFloat16* x, float* y) {
+
+    const __mmask16 all = 0xFFFF;
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        const __m512i wide = _mm512_maskz_cvtepu16_epi32(all, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i)));
+        _mm512_storeu_ps(y + i, _mm512_castsi512_ps(_mm512_maskz_slli_epi32(all, wide, 16)));
+    }
+    zt_bfloat16_scalar_widen(n - i, x + i, y + i);
+
+}
+
+/**
+ * zt_bfloat16_avx512_narrow : AVX-512 kernel for float to bfloat16
+ *
+ * @param  std::size_t n number of elements
+ * @param  float* x input
+ * @param  ZTBFloat16* y output
+ * @return nothing
+ *
+ */
+ZT_AVX512_TARGET void zt_bfloat16_avx512_narrow(std::size_t n, const float* x, ZTBFloat16* y) {
+
+    const __m512i bias = _mm512_set1_epi32(0x7fff);
+    const __m512i one = _mm512_set1_epi32(1);
+    const __m512i quiet = _mm512_set1_epi32(0x400000);
+    const __mmask16 all = 0xFFFF;
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        const __m512 v = _mm512_loadu_ps(x + i);
+        const __m512i bits = _mm512_castps_si512(v);
+        const __m512i odd = _mm512_and_si512(_mm512_maskz_srli_epi32(all, bits, 16), one);
+        const __m512i rounded = _mm512_add_epi32(bits, _mm512_add_epi32(bias, odd));
+        const __mmask16 nan = _mm512_cmp_ps_mask(v, v, _CMP_UNORD_Q);
+        const __m512i result = _mm512_mask_blend_epi32(nan, rounded, _mm512_or_si512(bits, quiet));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(y + i), _mm512_maskz_cvtepi32_epi16(all, _mm512_maskz_srli_epi32(all, result, 16)));
+    }
+    zt_bfloat16_scalar_narrow(n - i, x + i, y + i);
+
+}
+
+#endif /* ZT_SIMD_X86 */
+
+/**
+ * select : conversion kernels for the widest instruction set available
+ *
+ * @param  nothing
+ * @return ZTHalfKernels kernels
+ *
+ */
+ZTHalfKernels ZTHalfConvert::select() {
+
+    ZTHalfKernels k = {
+        zt_half_scalar_widen, zt_half_scalar_narrow,
+        zt_bfloat16_scalar_widen, zt_bfloat16_scalar_narrow
+    };
+#ifdef ZT_SIMD_X86
+    if (ZTCpu::instruction_set() == ZT_ISA_AVX512)
+    {
+        ZTHalfKernels avx512 = {
+            zt_half_avx512_widen, zt_half_avx512_narrow,
+            zt_bfloat16_avx512_widen, zt_bfloat16_avx512_narrow
+        };
+        return avx512;
+    }
+    if (ZTCpu::instruction_set() == ZT_ISA_AVX2)
+    {
+        k.widen_bfloat16 = zt_bfloat16_avx2_widen;
+        k.narrow_bfloat16 = zt_bfloat16_avx2_narrow;
+    }
+    if (ZTCpu::f16c())
+    {
+        k.widen_half = zt_half_f16c_widen;
+        k.narrow_half = zt_half_f16c_narrow;
+    }
+#endif
+    return k;
+
+}
+
+/**
+ * kernels : conversion kernels in use, selected once on first call
+ *
+ * @param  nothing
+ * @return const ZTHalfKernels& kernels
+ *
+ */
+const ZTHalfKernels& ZTHalfConvert::kernels() {
+
+    static const ZTHalfKernels selected = select();
+    return selected;
+
+}
+
+/**
+ * widen : converts n halves to float
+ *
+ * @param  std::size_t n number of elements
+ * @param  ZTHalf* x input
+ * @param  float* y output
+ * @return nothing
+ *
+ */
+inline void ZTHalfConvert::widen(std::size_t n, const ZTHalf* x, float* y) {
+
+    kernels().widen_half(n, x, y);
+
+}
+
+/**
+ * widen : converts n bfloat16 values to float
+ *
+ * @param  std::size_t n number of elements
+ * @param  ZTBFloat16* x input
+ * @param  float* y output
+ * @return nothing
+ *
+ */
+inline void ZTHalfConvert::widen(std::size_t n, const ZTBFloat16* x, float* y) {
+
+    kernels().widen_bfloat16(n, x, y);
+
+}
+
+/**
+ * narrow : rounds n floats to half
+ *
+ * @param  std::size_t n number of elements
+ * @param  float* x input
+ * @param  ZTHalf* y output
+ * @return nothing
+ *
+ */
+inline void ZTHalfConvert::narrow(std::size_t n, const float* x, ZTHalf* y) {
+
+    kernels().narrow_half(n, x, y);
+
+}
+
+/**
+ * narrow : rounds n floats to bfloat16
+ *
+ * @param  std::size_t n number of elements
+ * @param  float* x input
+ * @param  ZTBFloat16* y output
+ * @return nothing
+ *
+ */
+inline void ZTHalfConvert::narrow(std::size_t n, const float* x, ZTBFloat16* y) {
+
+    kernels().narrow_bfloat16(n, x, y);
+
+}
+
+/**
+ * widen : converts a rows x cols block with strides rsa and csa into a
+ *         contiguous float block, rows ldb elements apart
+ *
+ * @param  std::size_t rows
+ * @param  std::size_t cols
+ * @param  S* a input block
+ * @param  float* b output block
+ * @return nothing
+ *
+ */
+template <typename S>
+void ZTHalfConvert::widen(std::size_t rows, std::size_t cols, const S* a, std::size_t rsa, std::size_t csa,
+                          float* b, std::size_t ldb) {
+
+    for (std::size_t i = 0; i < rows; ++i)
+    {
+        if (csa == 1)
+        {
+            widen(cols, a + i * rsa, b + i * ldb);
+            continue;
+        }
+        for (std::size_t j = 0; j < cols; ++j)
+        {
+            b[i * ldb + j] = float(a[i * rsa + j * csa]);
+        }
+    }
+
+}
+
+/**
+ * narrow : rounds a contiguous float block, rows lda elements apart, into a
+ *          rows x cols block with strides rsb and csb
+ *
+ * @param  std::size_t rows
+ * @param  std::size_t cols
+ * @param  float* a input block
+ * @param  S* b output block
+ * @return nothing
+ *
+ */
+template <typename S>
+void ZTHalfConvert::narrow(std::size_t rows, std::size_t cols, const float* a, std::size_t lda,
+                           S* b, std::size_t rsb, std::size_t csb) {
+
+    for (std::size_t i = 0; i < rows; ++i)
+    {
+        if (csb == 1)
+        {
+            narrow(cols, a + i * lda, b + i * rsb);
+            continue;
+        }
+        for (std::size_t j = 0; j < cols; ++j)
+        {
+            b[i * rsb + j * csb] = S(a[i * lda + j]);
+        }
+    }
+
+}
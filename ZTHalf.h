@@ -0,0 +1,142 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ZTHALF_H
+#define ZTHALF_H
+
+#include <cstdint>
+#include <cstddef>
+
+/*
+ * ZTHalf : IEEE 754 binary16 storage type, 1 sign, 5 exponent and 10
+ *          fraction bits. It converts to and from float implicitly, so the
+ *          library templates instantiate over it unchanged: arithmetic on
+ *          two elements is carried out in float and rounded to nearest
+ *          even when stored back.
+ */
+struct ZTHalf {
+
+    std::uint16_t bits;
+
+    ZTHalf() = default;
+    ZTHalf(float value);
+
+    operator float() const;
+
+    ZTHalf& operator +=(float value);
+    ZTHalf& operator -=(float value);
+    ZTHalf& operator *=(float value);
+    ZTHalf& operator /=(float value);
+
+    static ZTHalf from_bits(std::uint16_t bits);
+
+};
+
+/*
+ * ZTBFloat16 : brain floating point storage type, the upper half of a
+ *              float with the same 8 exponent bits and 7 fraction bits,
+ *              so it keeps the range of float at a quarter of the
+ *              precision of half. Conversions behave as for ZTHalf.
+ */
+struct ZTBFloat16 {
+
+    std::uint16_t bits;
+
+    ZTBFloat16() = default;
+    ZTBFloat16(float value);
+
+    operator float() const;
+
+    ZTBFloat16& operator +=(float value);
+    ZTBFloat16& operator -=(float value);
+    ZTBFloat16& operator *=(float value);
+    ZTBFloat16& operator /=(float value);
+
+    static ZTBFloat16 from_bits(std::uint16_t bits);
+
+};
+
+/*
+ * ZTAccumulator : type that sums, dot products and norms of elements of T
+ *                 accumulate in, float for the 16-bit storage types and T
+ *                 itself for every other type.
+ */
+template <typename T>
+struct ZTAccumulator {
+    typedef T type;
+};
+
+template <>
+struct ZTAccumulator<ZTHalf> {
+    typedef float type;
+};
+
+template <>
+struct ZTAccumulator<ZTBFloat16> {
+    typedef float type;
+};
+
+/*
+ * Conversion kernels : n elements between a 16-bit storage type and float.
+ */
+struct ZTHalfKernels {
+    void (*widen_half)(std::size_t n, const ZTHalf* x, float* y);
+    void (*narrow_half)(std::size_t n, const float* x, ZTHalf* y);
+    void (*widen_bfloat16)(std::size_t n, const ZTBFloat16* x, float* y);
+    void (*narrow_bfloat16)(std::size_t n, const float* x, ZTBFloat16* y);
+};
+
+/*
+ * ZTHalfConvert : bulk conversions between the 16-bit storage types and
+ *                 float, on F16C or AVX-512 where ZTCpu finds them and in
+ *                 portable bit arithmetic otherwise. Narrowing rounds to
+ *                 nearest even and keeps infinities and NaNs. The strided
+ *                 forms convert a rows x cols block into or out of a
+ *                 contiguous float block for the widening GEMM and GEMV.
+ */
+class ZTHalfConvert {
+
+private:
+    static ZTHalfKernels select();
+
+public:
+    static constexpr std::size_t chunk_size = 512; // elements widened at a time, a float block that stays in L1
+
+    static const ZTHalfKernels& kernels();
+
+    static void widen(std::size_t n, const ZTHalf* x, float* y);
+    static void widen(std::size_t n, const ZTBFloat16* x, float* y);
+    static void narrow(std::size_t n, const float* x, ZTHalf* y);
+    static void narrow(std::size_t n, const float* x, ZTBFloat16* y);
+
+    template <typename S>
+    static void widen(std::size_t rows, std::size_t cols, const S* a, std::size_t rsa, std::size_t csa,
+                      float* b, std::size_t ldb);
+    template <typename S>
+    static void narrow(std::size_t rows, std::size_t cols, const float* a, std::size_t lda,
+                       S* b, std::size_t rsb, std::size_t csb);
+
+};
+
+#endif /* ZTHALF_H */
@@ -0,0 +1,343 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cmath>
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+
+#include "ZTBlas.h"
+#include "ZTKrylov.h"
+
+/**
+ * initial_residual : r = b - A * x, with x reset to zero, and r to b, when
+ *                    its size does not match b
+ *
+ * @param  Operator a operator with apply(x, y)
+ * @param  ZTVector<T> b right-hand side
+ * @param  ZTVector<T>& x initial guess
+ * @param  ZTVector<T>& r result
+ * @return T || r ||
+ *
+ */
+template <typename T>
+template <typename Operator>
+T ZTKrylov<T>::initial_residual(const Operator& a, const ZTVector<T>& b, ZTVector<T>& x, ZTVector<T>& r) {
+
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    const std::size_t n = b.size();
+    if (x.size() != n)
+    {
+        x.set_vector_size(n);
+        std::fill(x.data(), x.data() + n, T(0));
+        r = b;
+    }
+    else
+    {
+        a.apply(x, r);
+        blas.minus(n, b.data(), r.data(), r.data());
+    }
+    return std::sqrt(blas.dot(n, r.data(), r.data()));
+
+}
+
+/**
+ * cg : preconditioned conjugate gradients. Per iteration one product with
+ *      A, one preconditioner application, two dot products and three
+ *      vector updates, the residual update fused with its norm
+ *
+ * @param  Operator a symmetric positive definite operator with apply(x, y)
+ * @param  ZTVector<T> b right-hand side
+ * @param  ZTVector<T>& x initial guess, overwritten by the solution
+ * @param  Preconditioner m symmetric positive definite preconditioner with apply(r, z)
+ * @param  ZTKrylovOptions<T> options stopping criteria
+ * @return ZTKrylovResult<T> result
+ *
+ */
+template <typename T>
+template <typename Operator, typename Preconditioner>
+ZTKrylovResult<T> ZTKrylov<T>::cg(const Operator& a, const ZTVector<T>& b, ZTVector<T>& x,
+                                  const Preconditioner& m, const ZTKrylovOptions<T>& options) {
+
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    const std::size_t n = b.size();
+    ZTKrylovResult<T> result = {0, T(0), false};
+    ZTVector<T> r((std::vector<T>(n))), z((std::vector<T>(n))), p((std::vector<T>(n))), q((std::vector<T>(n)));
+    const T bnorm = std::sqrt(blas.dot(n, b.data(), b.data()));
+    const T rnorm = initial_residual(a, b, x, r);
+    if (bnorm == T(0))
+    {
+        std::fill(x.data(), x.data() + n, T(0));
+        result.converged = true;
+        return result;
+    }
+    result.residual = rnorm / bnorm;
+    if (result.residual <= options.tolerance)
+    {
+        result.converged = true;
+        return result;
+    }
+
+    m.apply(r, z);
+    p = z;
+    T rz = blas.dot(n, r.data(), z.data());
+    while (result.iterations < options.max_iterations)
+    {
+        a.apply(p, q);
+        ++result.iterations;
+        const T pq = blas.dot(n, p.data(), q.data());
+        if (!(pq != T(0)) || !std::isfinite(pq))
+        {
+            break;
+        }
+        const T alpha = rz / pq;
+        blas.axpy(n, alpha, p.data(), x.data());
+        result.residual = std::sqrt(blas.axpy_dot(n, -alpha, q.data(), r.data())) / bnorm;
+        if (result.residual <= options.tolerance)
+        {
+            result.converged = true;
+            break;
+        }
+        m.apply(r, z);
+        const T rz_next = blas.dot(n, r.data(), z.data());
+        blas.xpby(n, z.data(), rz_next / rz, p.data());
+        rz = rz_next;
+    }
+    return result;
+
+}
+
+/**
+ * bicgstab : right-preconditioned BiCGSTAB. Per iteration two products with
+ *            A and two preconditioner applications; both residual updates
+ *            return their norms and the stabilizing step takes t . s and
+ *            t . t in one pass
+ *
+ * @param  Operator a operator with apply(x, y)
+ * @param  ZTVector<T> b right-hand side
+ * @param  ZTVector<T>& x initial guess, overwritten by the solution
+ * @param  Preconditioner m preconditioner with apply(r, z)
+ * @param  ZTKrylovOptions<T> options stopping criteria
+ * @return ZTKrylovResult<T> result
+ *
+ */
+template <typename T>
+template <typename Operator, typename Preconditioner>
+ZTKrylovResult<T> ZTKrylov<T>::bicgstab(const Operator& a, const ZTVector<T>& b, ZTVector<T>& x,
+                                        const Preconditioner& m, const ZTKrylovOptions<T>& options) {
+
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    const std::size_t n = b.size();
+    ZTKrylovResult<T> result = {0, T(0), false};
+    ZTVector<T> r((std::vector<T>(n))), shadow((std::vector<T>(n)));
+    ZTVector<T> p((std::vector<T>(n))), v((std::vector<T>(n))), t((std::vector<T>(n))), z((std::vector<T>(n)));
+    const T bnorm = std::sqrt(blas.dot(n, b.data(), b.data()));
+    const T rnorm = initial_residual(a, b, x, r);
+    if (bnorm == T(0))
+    {
+        std::fill(x.data(), x.data() + n, T(0));
+        result.converged = true;
+        return result;
+    }
+    result.residual = rnorm / bnorm;
+    if (result.residual <= options.tolerance)
+    {
+        result.converged = true;
+        return result;
+    }
+
+    shadow = r;
+    T rho = T(1), alpha = T(1), omega = T(1);
+    while (result.iterations < options.max_iterations)
+    {
+        ++result.iterations;
+        const T rho_next = blas.dot(n, shadow.data(), r.data());
+        if (!(rho_next != T(0)))
+        {
+            break;
+        }
+        // p = r + beta * (p - omega * v)
+        blas.axpy(n, -omega, v.data(), p.data());
+        blas.xpby(n, r.data(), (rho_next / rho) * (alpha / omega), p.data());
+        rho = rho_next;
+
+        m.apply(p, z);
+        a.apply(z, v);
+        const T sv = blas.dot(n, shadow.data(), v.data());
+        if (!(sv != T(0)) || !std::isfinite(sv))
+        {
+            break;
+        }
+        alpha = rho / sv;
+        blas.axpy(n, alpha, z.data(), x.data());
+        result.residual = std::sqrt(blas.axpy_dot(n, -alpha, v.data(), r.data())) / bnorm;
+        if (result.residual <= options.tolerance)
+        {
+            result.converged = true;
+            break;
+        }
+
+        m.apply(r, z);
+        a.apply(z, t);
+        T products[2];
+        blas.dot2(n, t.data(), r.data(), t.data(), products);
+        if (!(products[1] != T(0)))
+        {
+            break;
+        }
+        omega = products[0] / products[1];
+        blas.axpy(n, omega, z.data(), x.data());
+        result.residual = std::sqrt(blas.axpy_dot(n, -omega, t.data(), r.data())) / bnorm;
+        if (result.residual <= options.tolerance)
+        {
+            result.converged = true;
+            break;
+        }
+        if (!(omega != T(0)))
+        {
+            break;
+        }
+    }
+    return result;
+
+}
+
+/**
+ * gmres : right-preconditioned restarted GMRES. Each cycle builds an
+ *         orthonormal Krylov basis of up to restart vectors by modified
+ *         Gram-Schmidt, the last projection fused with the norm of the new
+ *         vector, reduces the Hessenberg matrix by Givens rotations so the
+ *         residual norm is known at every step, and updates
+ *         x += M^-1 * V * y once per cycle
+ *
+ * @param  Operator a operator with apply(x, y)
+ * @param  ZTVector<T> b right-hand side
+ * @param  ZTVector<T>& x initial guess, overwritten by the solution
+ * @param  Preconditioner m preconditioner with apply(r, z)
+ * @param  ZTKrylovOptions<T> options stopping criteria
+ * @return ZTKrylovResult<T> result
+ *
+ */
+template <typename T>
+template <typename Operator, typename Preconditioner>
+ZTKrylovResult<T> ZTKrylov<T>::gmres(const Operator& a, const ZTVector<T>& b, ZTVector<T>& x,
+                                     const Preconditioner& m, const ZTKrylovOptions<T>& options) {
+
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    const std::size_t n = b.size();
+    const std::size_t size = std::max<std::size_t>(options.restart, 1);
+    ZTKrylovResult<T> result = {0, T(0), false};
+    std::vector<ZTVector<T> > basis(size + 1, ZTVector<T>(std::vector<T>(n)));
+    ZTVector<T> z((std::vector<T>(n))), u((std::vector<T>(n)));
+    std::vector<T> h((size + 1) * size), cs(size), sn(size), g(size + 1), y(size);
+
+    const T bnorm = std::sqrt(blas.dot(n, b.data(), b.data()));
+    T beta = initial_residual(a, b, x, basis[0]);
+    if (bnorm == T(0))
+    {
+        std::fill(x.data(), x.data() + n, T(0));
+        result.converged = true;
+        return result;
+    }
+    for (;;)
+    {
+        result.residual = beta / bnorm;
+        if (result.residual <= options.tolerance)
+        {
+            result.converged = true;
+            break;
+        }
+        if (result.iterations >= options.max_iterations)
+        {
+            break;
+        }
+
+        blas.multiply_scalar(n, basis[0].data(), T(1) / beta, basis[0].data());
+        std::fill(g.begin(), g.end(), T(0));
+        g[0] = beta;
+        std::size_t k = 0;
+        while (k < size && result.iterations < options.max_iterations)
+        {
+            T* w = basis[k + 1].data();
+            m.apply(basis[k], z);
+            a.apply(z, basis[k + 1]);
+            ++result.iterations;
+            for (std::size_t i = 0; i < k; ++i)
+            {
+                const T hik = blas.dot(n, w, basis[i].data());
+                blas.axpy(n, -hik, basis[i].data(), w);
+                h[i * size + k] = hik;
+            }
+            const T hkk = blas.dot(n, w, basis[k].data());
+            const T next = std::sqrt(blas.axpy_dot(n, -hkk, basis[k].data(), w));
+            h[k * size + k] = hkk;
+            h[(k + 1) * size + k] = next;
+
+            for (std::size_t i = 0; i < k; ++i)
+            {
+                const T upper = h[i * size + k];
+                const T lower = h[(i + 1) * size + k];
+                h[i * size + k] = cs[i] * upper + sn[i] * lower;
+                h[(i + 1) * size + k] = cs[i] * lower - sn[i] * upper;
+            }
+            const T diagonal = h[k * size + k];
+            const T denominator = std::hypot(diagonal, next);
+            cs[k] = denominator == T(0) ? T(1) : diagonal / denominator;
+            sn[k] = denominator == T(0) ? T(0) : next / denominator;
+            h[k * size + k] = denominator;
+            h[(k + 1) * size + k] = T(0);
+            g[k + 1] = -sn[k] * g[k];
+            g[k] = cs[k] * g[k];
+            ++k;
+
+            result.residual = std::abs(g[k]) / bnorm;
+            if (result.residual <= options.tolerance || !(next != T(0)))
+            {
+                break;
+            }
+            blas.multiply_scalar(n, w, T(1) / next, w);
+        }
+
+        // y = H^-1 * g, x += M^-1 * V * y
+        for (std::size_t i = k; i-- > 0;)
+        {
+            T sum = g[i];
+            for (std::size_t j = i + 1; j < k; ++j)
+            {
+                sum -= h[i * size + j] * y[j];
+            }
+            y[i] = h[i * size + i] == T(0) ? T(0) : sum / h[i * size + i];
+        }
+        std::fill(u.data(), u.data() + n, T(0));
+        for (std::size_t i = 0; i < k; ++i)
+        {
+            blas.axpy(n, y[i], basis[i].data(), u.data());
+        }
+        m.apply(u, z);
+        blas.axpy(n, T(1), z.data(), x.data());
+        beta = initial_residual(a, b, x, basis[0]);
+    }
+    return result;
+
+}
@@ -0,0 +1,103 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ZTKRYLOV_H
+#define ZTKRYLOV_H
+
+#include <cstddef>
+
+#include "ZTVector.h"
+#include "ZTPreconditioner.h"
+
+/*
+ * ZTKrylovOptions : stopping criteria of the iterative solvers.
+ */
+template <typename T>
+struct ZTKrylovOptions {
+    T tolerance;                 // on the relative residual || b - A * x || / || b ||
+    std::size_t max_iterations;  // iterations, at most (a GMRES iteration is one basis vector)
+    std::size_t restart;         // GMRES basis size between restarts
+
+    ZTKrylovOptions() : tolerance(T(1e-8)), max_iterations(1000), restart(30) {}
+};
+
+/*
+ * ZTKrylovResult : outcome of an iterative solve.
+ */
+template <typename T>
+struct ZTKrylovResult {
+    std::size_t iterations;
+    T residual;      // relative residual at exit
+    bool converged;
+};
+
+/*
+ * ZTKrylov : Krylov subspace solvers for A * x = b that touch A only through
+ *            a.apply(x, y), y = A * x, so ZTMatrix, ZTSparseMatrix and any
+ *            matrix-free operator with that member work alike. The
+ *            preconditioner is anything with m.apply(r, z), z = M^-1 * r.
+ *
+ *            cg       : conjugate gradients, A symmetric positive definite,
+ *                       M symmetric positive definite (Jacobi, IC(0))
+ *            bicgstab : BiCGSTAB for general A, right preconditioned
+ *            gmres    : restarted GMRES(restart) for general A, right
+ *                       preconditioned, modified Gram-Schmidt Arnoldi with
+ *                       Givens rotations
+ *
+ *            Every iteration is one or two products with A and the
+ *            preconditioner plus BLAS-1 work, so the vector updates use the
+ *            fused kernels of ZTBlas: the residual update returns its own
+ *            norm (axpy_dot) and paired dot products share a pass (dot2).
+ *
+ *            x holds the initial guess on entry, and is reset to zero when
+ *            its size does not match b. The solvers stop without raising
+ *            when the iteration limit is reached or the method breaks down,
+ *            which the result reports through converged.
+ */
+template <typename T>
+class ZTKrylov {
+
+private:
+    template <typename Operator>
+    static T initial_residual(const Operator& a, const ZTVector<T>& b, ZTVector<T>& x, ZTVector<T>& r);
+
+public:
+    template <typename Operator, typename Preconditioner = ZTIdentityPreconditioner<T> >
+    static ZTKrylovResult<T> cg(const Operator& a, const ZTVector<T>& b, ZTVector<T>& x,
+                                const Preconditioner& m = Preconditioner(),
+                                const ZTKrylovOptions<T>& options = ZTKrylovOptions<T>());
+
+    template <typename Operator, typename Preconditioner = ZTIdentityPreconditioner<T> >
+    static ZTKrylovResult<T> bicgstab(const Operator& a, const ZTVector<T>& b, ZTVector<T>& x,
+                                      const Preconditioner& m = Preconditioner(),
+                                      const ZTKrylovOptions<T>& options = ZTKrylovOptions<T>());
+
+    template <typename Operator, typename Preconditioner = ZTIdentityPreconditioner<T> >
+    static ZTKrylovResult<T> gmres(const Operator& a, const ZTVector<T>& b, ZTVector<T>& x,
+                                   const Preconditioner& m = Preconditioner(),
+                                   const ZTKrylovOptions<T>& options = ZTKrylovOptions<T>());
+
+};
+
+#endif /* ZTKRYLOV_H */
@@ -0,0 +1,603 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cmath>
+#include <vector>
+#include <cstddef>
+#include <sstream>
+#include <utility>
+#include <stdexcept>
+#include <algorithm>
+
+#include "ZTLU.h"
+#include "ZTBlas.h"
+#include "ZTGemm.h"
+#include "ZTError.h"
+
+/**
+ * Constructor : Constructs the LU factorization of a square matrix
+ *
+ * @param  ZTMatrix<T> m matrix to factorize, left unchanged
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTLU<T>::ZTLU(const ZTMatrix<T>& m) : factors(m),
+                                      order(m.get_matrix_rows()),
+                                      parity(T(1)),
+                                      singular(false) {
+
+    factorize();
+
+}
+
+/**
+ * Constructor : Constructs the LU factorization of a square matrix, reusing
+ *               its buffer for the factors
+ *
+ * @param  ZTMatrix<T> m matrix to factorize, left empty
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTLU<T>::ZTLU(ZTMatrix<T>&& m) : factors(std::move(m)),
+                                 order(factors.get_matrix_rows()),
+                                 parity(T(1)),
+                                 singular(false) {
+
+    factorize();
+
+}
+
+/**
+ * Constructor : Constructs the LU factorization of a square view
+ *
+ * @param  ZTMatrixView<const T> m block to factorize, left unchanged
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTLU<T>::ZTLU(const ZTMatrixView<const T>& m) : factors(m),
+                                                order(m.get_matrix_rows()),
+                                                parity(T(1)),
+                                                singular(false) {
+
+    factorize();
+
+}
+
+/**
+ * factorize : blocked right-looking factorization. Each step factors a panel
+ *             of block_size columns, solves for the block row of U to its
+ *             right and updates the trailing submatrix with one GEMM
+ *
+ * @param  nothing
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTLU<T>::factorize() {
+
+    ZT_VALIDATE(factors.valid_sqaure_matrix(factors.get_matrix_rows(), factors.get_matrix_cols()));
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    const std::size_t n = order;
+    const std::size_t ld = factors.stride();
+    T* a = factors.data();
+    pivots.resize(n);
+    for (std::size_t k = 0; k < n; k += block_size)
+    {
+        const std::size_t nb = std::min(block_size, n - k);
+        const std::size_t k1 = k + nb;
+        panel(k, nb);
+        if (k1 == n)
+        {
+            break;
+        }
+
+        // U12 = L11^-1 * A12, row by row since L11 has a unit diagonal
+        for (std::size_t i = k + 1; i < k1; ++i)
+        {
+            for (std::size_t p = k; p < i; ++p)
+            {
+                blas.axpy(n - k1, -a[i * ld + p], a + p * ld + k1, a + i * ld + k1);
+            }
+        }
+
+        // A22 -= L21 * U12
+        ZTGemm<T>::gemm(n - k1, n - k1, nb, T(-1),
+                        a + k1 * ld + k, ld, 1,
+                        a + k * ld + k1, ld, 1,
+                        T(1), a + k1 * ld + k1, ld, 1);
+    }
+
+}
+
+/**
+ * panel : unblocked factorization of the nb columns from column k, over rows
+ *         k to the end. Pivoting swaps whole rows, which are contiguous, so
+ *         the columns left and right of the panel are permuted at once
+ *
+ * @param  std::size_t k first column of the panel
+ * @param  std::size_t nb number of columns in the panel
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTLU<T>::panel(std::size_t k, std::size_t nb) {
+
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    const std::size_t n = order;
+    const std::size_t ld = factors.stride();
+    const std::size_t k1 = k + nb;
+    T* a = factors.data();
+    for (std::size_t j = k; j < k1; ++j)
+    {
+        std::size_t p = j;
+        T largest = std::abs(a[j * ld + j]);
+        for (std::size_t i = j + 1; i < n; ++i)
+        {
+            const T candidate = std::abs(a[i * ld + j]);
+            if (candidate > largest)
+            {
+                largest = candidate;
+                p = i;
+            }
+        }
+
+        pivots[j] = p;
+        if (p != j)
+        {
+            std::swap_ranges(a + j * ld, a + j * ld + n, a + p * ld);
+            parity = -parity;
+        }
+
+        const T pivot = a[j * ld + j];
+        if (pivot == T(0))
+        {
+            singular = true;
+            continue;
+        }
+
+        const T inverse_pivot = T(1) / pivot;
+        for (std::size_t i = j + 1; i < n; ++i)
+        {
+            T* row = a + i * ld;
+            row[j] *= inverse_pivot;
+            blas.axpy(k1 - j - 1, -row[j], a + j * ld + j + 1, row + j + 1);
+        }
+    }
+
+}
+
+/**
+ * permute : applies the row interchanges of the factorization to the rows of b
+ *
+ * @param  T* b order rows of cols elements, rows ldb elements apart
+ * @param  std::size_t cols number of columns of b
+ * @param  std::size_t ldb distance between rows of b
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTLU<T>::permute(T* b, std::size_t cols, std::size_t ldb) const {
+
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        if (pivots[i] != i)
+        {
+            std::swap_ranges(b + i * ldb, b + i * ldb + cols, b + pivots[i] * ldb);
+        }
+    }
+
+}
+
+/**
+ * forward : solves L * y = x in place for one contiguous vector, each element
+ *           is a dot product with a contiguous row of L
+ *
+ * @param  T* x right-hand side, overwritten by y
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTLU<T>::forward(T* x) const {
+
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    const std::size_t ld = factors.stride();
+    const T* a = factors.data();
+    for (std::size_t i = 1; i < order; ++i)
+    {
+        x[i] -= blas.dot(i, a + i * ld, x);
+    }
+
+}
+
+/**
+ * backward : solves U * x = y in place for one contiguous vector, each element
+ *            is a dot product with a contiguous row of U
+ *
+ * @param  T* x right-hand side, overwritten by the solution
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTLU<T>::backward(T* x) const {
+
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    const std::size_t ld = factors.stride();
+    const T* a = factors.data();
+    for (std::size_t i = order; i-- > 0;)
+    {
+        const T* row = a + i * ld;
+        x[i] = (x[i] - blas.dot(order - i - 1, row + i + 1, x + i + 1)) / row[i];
+    }
+
+}
+
+/**
+ * lower_solve : solves L * Y = B in place for cols right-hand sides. Blocks of
+ *               block_size rows first take the contribution of the rows
+ *               already solved with one GEMM, then are solved row by row
+ *
+ * @param  std::size_t cols number of right-hand sides
+ * @param  T* b right-hand sides, overwritten by Y
+ * @param  std::size_t ldb distance between rows of b
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTLU<T>::lower_solve(std::size_t cols, T* b, std::size_t ldb) const {
+
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    const std::size_t ld = factors.stride();
+    const T* a = factors.data();
+    for (std::size_t i0 = 0; i0 < order; i0 += block_size)
+    {
+        const std::size_t i1 = std::min(i0 + block_size, order);
+        if (i0 > 0)
+        {
+            ZTGemm<T>::gemm(i1 - i0, cols, i0, T(-1),
+                            a + i0 * ld, ld, 1,
+                            b, ldb, 1,
+                            T(1), b + i0 * ldb, ldb, 1);
+        }
+        for (std::size_t i = i0 + 1; i < i1; ++i)
+        {
+            for (std::size_t p = i0; p < i; ++p)
+            {
+                blas.axpy(cols, -a[i * ld + p], b + p * ldb, b + i * ldb);
+            }
+        }
+    }
+
+}
+
+/**
+ * upper_solve : solves U * X = Y in place for cols right-hand sides, by
+ *               blocks of block_size rows from the bottom up
+ *
+ * @param  std::size_t cols number of right-hand sides
+ * @param  T* b right-hand sides, overwritten by X
+ * @param  std::size_t ldb distance between rows of b
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTLU<T>::upper_solve(std::size_t cols, T* b, std::size_t ldb) const {
+
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    const std::size_t ld = factors.stride();
+    const T* a = factors.data();
+    const std::size_t blocks = (order + block_size - 1) / block_size;
+    for (std::size_t block = blocks; block-- > 0;)
+    {
+        const std::size_t i0 = block * block_size;
+        const std::size_t i1 = std::min(i0 + block_size, order);
+        if (i1 < order)
+        {
+            ZTGemm<T>::gemm(i1 - i0, cols, order - i1, T(-1),
+                            a + i0 * ld + i1, ld, 1,
+                            b + i1 * ldb, ldb, 1,
+                            T(1), b + i0 * ldb, ldb, 1);
+        }
+        for (std::size_t i = i1; i-- > i0;)
+        {
+            for (std::size_t p = i + 1; p < i1; ++p)
+            {
+                blas.axpy(cols, -a[i * ld + p], b + p * ldb, b + i * ldb);
+            }
+            blas.multiply_scalar(cols, b + i * ldb, T(1) / a[i * ld + i], b + i * ldb);
+        }
+    }
+
+}
+
+/**
+ * size : order of the factorized matrix
+ *
+ * @param  nothing
+ * @return std::size_t order
+ *
+ */
+template <typename T>
+inline std::size_t ZTLU<T>::size() const {
+
+    return order;
+
+}
+
+/**
+ * is_singular : whether a zero pivot was met during the factorization
+ *
+ * @param  nothing
+ * @return bool singular
+ *
+ */
+template <typename T>
+inline bool ZTLU<T>::is_singular() const {
+
+    return singular;
+
+}
+
+/**
+ * get_factors : L strictly below the diagonal (its unit diagonal is implied)
+ *               and U on and above it, in one matrix
+ *
+ * @param  nothing
+ * @return ZTMatrix<T> factors
+ *
+ */
+template <typename T>
+inline const ZTMatrix<T>& ZTLU<T>::get_factors() const {
+
+    return factors;
+
+}
+
+/**
+ * get_pivots : row interchanges, row i was swapped with row pivots[i] in
+ *              increasing order of i
+ *
+ * @param  nothing
+ * @return std::vector<std::size_t> pivots
+ *
+ */
+template <typename T>
+inline const std::vector<std::size_t>& ZTLU<T>::get_pivots() const {
+
+    return pivots;
+
+}
+
+/**
+ * lower : unit lower triangular factor L
+ *
+ * @param  nothing
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTLU<T>::lower() const {
+
+    ZTMatrix<T> result(order, order, T(0));
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        std::copy(factors[i], factors[i] + i, result[i]);
+        result[i][i] = T(1);
+    }
+    return result;
+
+}
+
+/**
+ * upper : upper triangular factor U
+ *
+ * @param  nothing
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTLU<T>::upper() const {
+
+    ZTMatrix<T> result(order, order, T(0));
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        std::copy(factors[i] + i, factors[i] + order, result[i] + i);
+    }
+    return result;
+
+}
+
+/**
+ * solve : solves A * x = b with the stored factors
+ *
+ * @param  ZTVectorView<const T> b right-hand side
+ * @return ZTVector<T> result
+ *
+ */
+template <typename T>
+ZTVector<T> ZTLU<T>::solve(const ZTVectorView<const T>& b) const {
+
+    ZTVector<T> result(b);
+    solve(result.view(), result);
+    return result;
+
+}
+
+/**
+ * solve : solves A * X = B with the stored factors, one column of X for each
+ *         column of B
+ *
+ * @param  ZTMatrixView<const T> b right-hand sides
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTLU<T>::solve(const ZTMatrixView<const T>& b) const {
+
+    ZTMatrix<T> result(b);
+    solve(result.view(), result);
+    return result;
+
+}
+
+/**
+ * solve : solves A * x = b into a reused buffer, b may be a view of out
+ *
+ * @param  ZTVectorView<const T> b right-hand side
+ * @param  ZTVector<T> out solution
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTLU<T>::solve(const ZTVectorView<const T>& b, ZTVector<T>& out) const {
+
+    ZT_VALIDATE(valid_solve_dimensions(b.size()));
+    ZT_VALIDATE(valid_nonsingular());
+    if (b.data() != out.data() || b.stride() != 1 || out.size() != order)
+    {
+        ZTVector<T> copy(b);
+        out = std::move(copy);
+    }
+    T* x = out.data();
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        if (pivots[i] != i)
+        {
+            std::swap(x[i], x[pivots[i]]);
+        }
+    }
+    forward(x);
+    backward(x);
+
+}
+
+/**
+ * solve : solves A * X = B into a reused buffer, b may be a view of out
+ *
+ * @param  ZTMatrixView<const T> b right-hand sides
+ * @param  ZTMatrix<T> out solutions
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTLU<T>::solve(const ZTMatrixView<const T>& b, ZTMatrix<T>& out) const {
+
+    ZT_VALIDATE(valid_solve_dimensions(b.get_matrix_rows()));
+    ZT_VALIDATE(valid_nonsingular());
+    const std::size_t cols = b.get_matrix_cols();
+    if (b.data() != out.data() || b.ld() != out.stride() || b.stride() != 1 ||
+        order != out.get_matrix_rows() || cols != out.get_matrix_cols())
+    {
+        ZTMatrix<T> copy(b);
+        out = std::move(copy);
+    }
+    permute(out.data(), cols, out.stride());
+    lower_solve(cols, out.data(), out.stride());
+    upper_solve(cols, out.data(), out.stride());
+
+}
+
+/**
+ * determinant : product of the pivots, signed by the parity of the row
+ *               interchanges
+ *
+ * @param  nothing
+ * @return T result
+ *
+ */
+template <typename T>
+T ZTLU<T>::determinant() const {
+
+    if (singular)
+    {
+        return T(0);
+    }
+    T result = parity;
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        result *= factors[i][i];
+    }
+    return result;
+
+}
+
+/**
+ * inverse : solves A * X = I with the stored factors
+ *
+ * @param  nothing
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTLU<T>::inverse() const {
+
+    ZT_VALIDATE(valid_nonsingular());
+    ZTMatrix<T> result(order, order, T(0));
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        result[i][i] = T(1);
+    }
+    solve(result.view(), result);
+    return result;
+
+}
+
+/**
+ * valid_solve_dimensions : checks that the right-hand side has one row per
+ *                          row of the factorized matrix
+ *
+ * @param  std::size_t rows rows of the right-hand side
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTLU<T>::valid_solve_dimensions(std::size_t rows) const {
+
+    if (rows != order)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Right-hand side of " << rows << " rows does not match the system of order: " << order << "!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * valid_nonsingular : checks that the factorized matrix is not singular
+ *
+ * @param  nothing
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTLU<T>::valid_nonsingular() const {
+
+    if (singular)
+    {
+        zt_raise<std::domain_error>("Matrix is singular, the system has no unique solution!.");
+    }
+
+}
@@ -0,0 +1,99 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ZTLU_H
+#define ZTLU_H
+
+#include <vector>
+#include <cstddef>
+
+#include "ZTMatrix.h"
+#include "ZTVector.h"
+#include "ZTMatrixView.h"
+#include "ZTVectorView.h"
+
+/*
+ * ZTLU : LU factorization with partial pivoting, P * A = L * U, of a square
+ *        matrix. The factors are computed once and kept, so any number of
+ *        right-hand sides, the determinant and the inverse come from the same
+ *        factorization.
+ *
+ *        The factorization is blocked and right-looking: a panel of columns
+ *        is factored with row pivoting, the matching block row of U is found
+ *        by a triangular solve, and the trailing submatrix is updated with a
+ *        single GEMM, where nearly all of the flops are spent.
+ *
+ *        A zero pivot does not stop the factorization. The matrix is then
+ *        reported singular, its determinant is zero, and solve and inverse
+ *        fail.
+ */
+template <typename T>
+class ZTLU {
+
+private:
+    static constexpr std::size_t block_size = 64; // columns per panel, the depth of the trailing GEMM
+
+    ZTMatrix<T> factors;              // unit lower L below the diagonal, U on and above
+    std::vector<std::size_t> pivots;  // row i was swapped with row pivots[i], in order
+    std::size_t order;
+    T parity;                         // determinant of P, +1 or -1
+    bool singular;
+
+    void factorize();
+    void panel(std::size_t k, std::size_t nb);
+
+    void permute(T* b, std::size_t cols, std::size_t ldb) const;
+    void forward(T* x) const;
+    void backward(T* x) const;
+    void lower_solve(std::size_t cols, T* b, std::size_t ldb) const;
+    void upper_solve(std::size_t cols, T* b, std::size_t ldb) const;
+
+public:
+    explicit ZTLU(const ZTMatrix<T>& m);
+    explicit ZTLU(ZTMatrix<T>&& m);                  // factorizes in the buffer of m
+    explicit ZTLU(const ZTMatrixView<const T>& m);
+
+    std::size_t size() const;
+    bool is_singular() const;
+
+    const ZTMatrix<T>& get_factors() const;                 // L and U packed together
+    const std::vector<std::size_t>& get_pivots() const;
+    ZTMatrix<T> lower() const;
+    ZTMatrix<T> upper() const;
+
+    ZTVector<T> solve(const ZTVectorView<const T>& b) const;   // x with A * x = b
+    ZTMatrix<T> solve(const ZTMatrixView<const T>& b) const;   // X with A * X = B
+
+    void solve(const ZTVectorView<const T>& b, ZTVector<T>& out) const;
+    void solve(const ZTMatrixView<const T>& b, ZTMatrix<T>& out) const;
+
+    T determinant() const;
+    ZTMatrix<T> inverse() const;
+
+    void valid_solve_dimensions(std::size_t rows) const;
+    void valid_nonsingular() const;
+
+};
+
+#endif /* ZTLU_H */
@@ -29,11 +29,24 @@
 #include <cstdlib>
 #include <sstream>
 #include <numeric>
+#include <utility>
 #include <iostream>
 #include <stdexcept>
+#include <algorithm>
 #include <functional>
 
+#include "ZTBlas.h"
+#include "ZTError.h"
+#include "ZTGemm.h"
+#include "ZTGemv.h"
+#include "ZTLU.h"
+#include "ZTCholesky.h"
+#include "ZTQR.h"
+#include "ZTSVD.h"
+#include "ZTSymmetricEigen.h"
 #include "ZTMatrix.h"
+#include "ZTMatrixView.h"
+#include "ZTExpression.h"
 
 /**
  * Constructor : Constructs a Matrix of dimensions rows by cols whose elements are
@@ -46,12 +59,55 @@
  *
  */
 template <typename T>
-ZTMatrix<T>::ZTMatrix(std::size_t rows, std::size_t cols, const T& elements) : matrix_rows(rows), matrix_cols(cols) {
+ZTMatrix<T>::ZTMatrix(std::size_t rows, std::size_t cols, const T& elements) :
+                                                matrix_data(rows * cols, elements),
+                                                matrix_rows(rows),
+                                                matrix_cols(cols),
+                                                matrix_stride(cols) {
 
-    for (std::size_t i = 0; i < rows; i++)
+}
+
+/**
+ * Constructor : Constructs a Matrix of dimensions rows by cols whose elements are
+ *              left uninitialized, for results that are about to be overwritten
+ *
+ * @param  std::size_t rows size for initialization
+ * @param  std::size_t cols size for initialization
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTMatrix<T>::ZTMatrix(std::size_t rows, std::size_t cols) :
+                                                matrix_data(rows * cols),
+                                                matrix_rows(rows),
+                                                matrix_cols(cols),
+                                                matrix_stride(cols) {
+
+}
+
+/**
+ * Constructor : Constructs a Matrix by evaluating an expression in a single pass
+ *
+ * @param  ZTMatrixExpression<T, E> e expression for initialization
+ * @return nothing
+ *
+ */
+template <typename T>
+template <typename E>
+ZTMatrix<T>::ZTMatrix(const ZTMatrixExpression<T, E>& e) :
+                                                matrix_data(e.get_matrix_rows() * e.get_matrix_cols()),
+                                                matrix_rows(e.get_matrix_rows()),
+                                                matrix_cols(e.get_matrix_cols()),
+                                                matrix_stride(e.get_matrix_cols()) {
+
+    for (std::size_t r = 0; r < matrix_rows; ++r)
     {
-        std::vector<double> matrix_rows(cols, elements);
-        matrix_data.push_back(matrix_rows);
+        T* z = matrix_data.data() + r * matrix_stride;
+        _Pragma("GCC ivdep")
+        for (std::size_t c = 0; c < matrix_cols; ++c)
+        {
+            z[c] = e(r, c);
+        }
     }
 
 }
@@ -65,9 +121,49 @@ ZTMatrix<T>::ZTMatrix(std::size_t rows, std::size_t cols, const T& elements) : m
  */
 template<typename T>
 ZTMatrix<T>::ZTMatrix(const ZTMatrix<T>& cp) :
+                                                matrix_data(cp.matrix_data),
                                                 matrix_rows(cp.matrix_rows),
                                                 matrix_cols(cp.matrix_cols),
-                                                matrix_data(cp.matrix_data) {
+                                                matrix_stride(cp.matrix_stride) {
+
+}
+
+/**
+ * Move Constructor : takes over the buffer of mv, which is left as an empty 0x0 matrix
+ *
+ * @param  ZTMatrix<T> mv Matrix to be moved
+ * @return nothing
+ *
+ */
+template<typename T>
+ZTMatrix<T>::ZTMatrix(ZTMatrix<T>&& mv) noexcept :
+                                                matrix_data(std::move(mv.matrix_data)),
+                                                matrix_rows(mv.matrix_rows),
+                                                matrix_cols(mv.matrix_cols),
+                                                matrix_stride(mv.matrix_stride) {
+
+    mv.matrix_data.clear();
+    mv.matrix_rows = 0;
+    mv.matrix_cols = 0;
+    mv.matrix_stride = 0;
+
+}
+
+/**
+ * Constructor : Constructs a Matrix holding a copy of the elements of a view
+ *
+ * @param  ZTMatrixView<const T> v view to be copied
+ * @return nothing
+ *
+ */
+template<typename T>
+ZTMatrix<T>::ZTMatrix(const ZTMatrixView<const T>& v) :
+                                                matrix_data(v.get_matrix_rows() * v.get_matrix_cols()),
+                                                matrix_rows(v.get_matrix_rows()),
+                                                matrix_cols(v.get_matrix_cols()),
+                                                matrix_stride(v.get_matrix_cols()) {
+
+    view().assign(v);
 
 }
 
@@ -83,25 +179,249 @@ ZTMatrix<T>::~ZTMatrix() {
   
 }
 
+/**
+ * reshape : gives the matrix the dimensions rows by cols, reusing the current
+ *           buffer when it is large enough. Elements are left unspecified
+ *
+ * @param  std::size_t rows
+ * @param  std::size_t cols
+ * @return nothing
+ *
+ */
+template<typename T>
+void ZTMatrix<T>::reshape(std::size_t rows, std::size_t cols) {
+
+    matrix_data.resize(rows * cols);
+    matrix_rows = rows;
+    matrix_cols = cols;
+    matrix_stride = cols;
+
+}
+
+/**
+ * data : pointer to the first element of the row-major, 64-byte aligned buffer
+ *
+ * @param  nothing
+ * @return T* matrix_data
+ *
+ */
+template<typename T>
+inline T* ZTMatrix<T>::data() {
+
+    return matrix_data.data();
+
+}
+
+/**
+ * data : pointer to the first element of the row-major, 64-byte aligned buffer
+ *
+ * @param  nothing
+ * @return const T* matrix_data
+ *
+ */
+template<typename T>
+inline const T* ZTMatrix<T>::data() const {
+
+    return matrix_data.data();
+
+}
+
+/**
+ * stride : leading dimension, the distance in elements between the starts of
+ *          two consecutive rows (equal to cols for an owned matrix)
+ *
+ * @param  nothing
+ * @return std::size_t matrix_stride
+ *
+ */
+template<typename T>
+inline std::size_t ZTMatrix<T>::stride() const {
+
+    return matrix_stride;
+
+}
+
+/**
+ * Getter : ZTMatrix::matrix_rows getter method
+ *
+ * @param  nothing
+ * @return std::size_t matrix_rows
+ *
+ */
+template<typename T>
+inline std::size_t ZTMatrix<T>::get_matrix_rows() const {
+
+    return matrix_rows;
+
+}
+
+/**
+ * Getter : ZTMatrix::matrix_cols getter method
+ *
+ * @param  nothing
+ * @return std::size_t matrix_cols
+ *
+ */
+template<typename T>
+inline std::size_t ZTMatrix<T>::get_matrix_cols() const {
+
+    return matrix_cols;
+
+}
+
+/**
+ * view : view of all the elements of the matrix
+ *
+ * @param  nothing
+ * @return ZTMatrixView<T> view
+ *
+ */
+template<typename T>
+inline ZTMatrixView<T> ZTMatrix<T>::view() {
+
+    return ZTMatrixView<T>(*this);
+
+}
+
+/**
+ * view : read-only view of all the elements of the matrix
+ *
+ * @param  nothing
+ * @return ZTMatrixView<const T> view
+ *
+ */
+template<typename T>
+inline ZTMatrixView<const T> ZTMatrix<T>::view() const {
+
+    return ZTMatrixView<const T>(*this);
+
+}
+
+/**
+ * block : view of the rows by cols block whose top-left element is (row, col)
+ *
+ * @param  std::size_t row one-based first row
+ * @param  std::size_t col one-based first column
+ * @param  std::size_t rows number of rows
+ * @param  std::size_t cols number of columns
+ * @return ZTMatrixView<T> view
+ *
+ */
+template<typename T>
+inline ZTMatrixView<T> ZTMatrix<T>::block(std::size_t row, std::size_t col, std::size_t rows, std::size_t cols) {
+
+    return view().block(row, col, rows, cols);
+
+}
+
+/**
+ * block : read-only view of the rows by cols block whose top-left element is (row, col)
+ *
+ * @param  std::size_t row one-based first row
+ * @param  std::size_t col one-based first column
+ * @param  std::size_t rows number of rows
+ * @param  std::size_t cols number of columns
+ * @return ZTMatrixView<const T> view
+ *
+ */
+template<typename T>
+inline ZTMatrixView<const T> ZTMatrix<T>::block(std::size_t row, std::size_t col, std::size_t rows, std::size_t cols) const {
+
+    return view().block(row, col, rows, cols);
+
+}
+
+/**
+ * row : view of a row of the matrix
+ *
+ * @param  std::size_t row one-based row
+ * @return ZTVectorView<T> view
+ *
+ */
+template<typename T>
+inline ZTVectorView<T> ZTMatrix<T>::row(std::size_t row) {
+
+    return view().row(row);
+
+}
+
+/**
+ * row : read-only view of a row of the matrix
+ *
+ * @param  std::size_t row one-based row
+ * @return ZTVectorView<const T> view
+ *
+ */
+template<typename T>
+inline ZTVectorView<const T> ZTMatrix<T>::row(std::size_t row) const {
+
+    return view().row(row);
+
+}
+
+/**
+ * col : view of a column of the matrix
+ *
+ * @param  std::size_t col one-based column
+ * @return ZTVectorView<T> view
+ *
+ */
+template<typename T>
+inline ZTVectorView<T> ZTMatrix<T>::col(std::size_t col) {
+
+    return view().col(col);
+
+}
+
+/**
+ * col : read-only view of a column of the matrix
+ *
+ * @param  std::size_t col one-based column
+ * @return ZTVectorView<const T> view
+ *
+ */
+template<typename T>
+inline ZTVectorView<const T> ZTMatrix<T>::col(std::size_t col) const {
+
+    return view().col(col);
+
+}
+
 /**
  * add : performs matrix to scalar addition
  *
  * @param  T& scalar
- * @return std::vector<std::vector<T>> result
+ * @return ZTMatrix<T> result
  *
  */
 template<typename T>
-ZTMatrix<T> ZTMatrix<T>::add(const T& scalar) {
+ZTMatrix<T> ZTMatrix<T>::add(const T& scalar) const {
 
-    ZTMatrix result(matrix_rows, matrix_cols, 0.0);
-    for (std::size_t i = 0; i < matrix_rows; ++i)
+    ZTMatrix result(matrix_rows, matrix_cols);
+    add(scalar, result);
+    return result;
+
+}
+
+/**
+ * add : performs matrix to scalar addition into a preallocated result, out is
+ *       only reallocated when it is too small and may be *this
+ *
+ * @param  T& scalar
+ * @param  ZTMatrix<T>& out result
+ * @return nothing
+ *
+ */
+template<typename T>
+void ZTMatrix<T>::add(const T& scalar, ZTMatrix<T>& out) const {
+
+    out.reshape(matrix_rows, matrix_cols);
+    const T* a = matrix_data.data();
+    T* r = out.matrix_data.data();
+    for (std::size_t i = 0, n = matrix_data.size(); i < n; ++i)
     {
-        for (std::size_t j = 0; j < matrix_cols; ++j)
-        {
-            result.matrix_data[i][j] = matrix_data[i][j] + scalar;
-        }
+        r[i] = a[i] + scalar;
     }
-    return result;
 
 }
 
@@ -109,43 +429,75 @@ ZTMatrix<T> ZTMatrix<T>::add(const T& scalar) {
  * minus : performs matrix to scalar subtraction
  *
  * @param  T& scalar
- * @return std::vector<std::vector<T>> result
+ * @return ZTMatrix<T> result
  *
  */
 template<typename T>
-ZTMatrix<T> ZTMatrix<T>::minus(const T& scalar) {
+ZTMatrix<T> ZTMatrix<T>::minus(const T& scalar) const {
 
-    ZTMatrix result(matrix_rows, matrix_cols, 0.0);
-    for (std::size_t i = 0; i < matrix_rows; ++i)
+    ZTMatrix result(matrix_rows, matrix_cols);
+    minus(scalar, result);
+    return result;
+
+}
+
+/**
+ * minus : performs matrix to scalar subtraction into a preallocated result, out is
+ *         only reallocated when it is too small and may be *this
+ *
+ * @param  T& scalar
+ * @param  ZTMatrix<T>& out result
+ * @return nothing
+ *
+ */
+template<typename T>
+void ZTMatrix<T>::minus(const T& scalar, ZTMatrix<T>& out) const {
+
+    out.reshape(matrix_rows, matrix_cols);
+    const T* a = matrix_data.data();
+    T* r = out.matrix_data.data();
+    for (std::size_t i = 0, n = matrix_data.size(); i < n; ++i)
     {
-        for (std::size_t j = 0; j < matrix_cols; ++j)
-        {
-            result.matrix_data[i][j] = matrix_data[i][j] - scalar;
-        }
+        r[i] = a[i] - scalar;
     }
+
+}
+
+/**
+ * multiply : performs matrix to scalar multiplication
+ *
+ * @param  T& scalar
+ * @return ZTMatrix<T> result
+ *
+ */
+template<typename T>
+ZTMatrix<T> ZTMatrix<T>::multiply(const T& scalar) const {
+
+    ZTMatrix result(matrix_rows, matrix_cols);
+    multiply(scalar, result);
     return result;
 
 }
 
 /**
- * multiply : performs matrix to multiplication
+ * multiply : performs matrix to scalar multiplication into a preallocated result, out is
+ *            only reallocated when it is too small and may be *this
  *
  * @param  T& scalar
- * @return std::vector<std::vector<T>> result
+ * @param  ZTMatrix<T>& out result
+ * @return nothing
  *
  */
 template<typename T>
-ZTMatrix<T> ZTMatrix<T>::multiply(const T& scalar) {
+void ZTMatrix<T>::multiply(const T& scalar, ZTMatrix<T>& out) const {
 
-    ZTMatrix result(matrix_rows, matrix_cols, 0.0);
-    for (std::size_t i = 0; i < matrix_rows; ++i)
+    out.reshape(matrix_rows, matrix_cols);
+    const T* a = matrix_data.data();
+    T* r = out.matrix_data.data();
+    for (std::size_t i = 0, n = matrix_data.size(); i < n; ++i)
     {
-        for (std::size_t j = 0; j < matrix_cols; ++j)
-        {
-            result.matrix_data[i][j] = matrix_data[i][j] * scalar;
-        }
+        r[i] = a[i] * scalar;
     }
-    return result;
 
 }
 
@@ -159,12 +511,10 @@ ZTMatrix<T> ZTMatrix<T>::multiply(const T& scalar) {
 template<typename T>
 ZTMatrix<T>& ZTMatrix<T>::cummulative_add(const T& scalar) {
 
-    for (std::size_t i = 0; i < matrix_rows; ++i)
+    T* a = matrix_data.data();
+    for (std::size_t i = 0, n = matrix_data.size(); i < n; ++i)
     {
-        for (std::size_t j = 0; j < matrix_cols; ++j)
-        {
-            matrix_data[i][j] += scalar;
-        }
+        a[i] += scalar;
     }
     return *this;
 
@@ -180,12 +530,10 @@ ZTMatrix<T>& ZTMatrix<T>::cummulative_add(const T& scalar) {
 template<typename T>
 ZTMatrix<T>& ZTMatrix<T>::cummulative_minus(const T& scalar) {
 
-    for (std::size_t i = 0; i < matrix_rows; ++i)
+    T* a = matrix_data.data();
+    for (std::size_t i = 0, n = matrix_data.size(); i < n; ++i)
     {
-        for (std::size_t j = 0; j < matrix_cols; ++j)
-        {
-            matrix_data[i][j] -= scalar;
-        }
+        a[i] -= scalar;
     }
     return *this;
 
@@ -201,12 +549,10 @@ ZTMatrix<T>& ZTMatrix<T>::cummulative_minus(const T& scalar) {
 template<typename T>
 ZTMatrix<T>& ZTMatrix<T>::cummulative_multiply(const T& scalar) {
 
-    for (std::size_t i = 0; i < matrix_rows; ++i)
+    T* a = matrix_data.data();
+    for (std::size_t i = 0, n = matrix_data.size(); i < n; ++i)
     {
-        for (std::size_t j = 0; j < matrix_cols; ++j)
-        {
-            matrix_data[i][j] *= scalar;
-        }
+        a[i] *= scalar;
     }
     return *this;
 
@@ -216,382 +562,797 @@ ZTMatrix<T>& ZTMatrix<T>::cummulative_multiply(const T& scalar) {
  * add : performs matrix to matrix addition
  *
  * @param  ZTMatrix<T> m
- * @return std::vector<std::vector<T>> result
+ * @return ZTMatrix<T> result
  *
  */
 template<typename T>
-ZTMatrix<T> ZTMatrix<T>::add(const ZTMatrix<T>& m) {
+ZTMatrix<T> ZTMatrix<T>::add(const ZTMatrix<T>& m) const {
 
-    try
-    {
-        valid_matrix_add_minus(m);
-        ZTMatrix result(matrix_rows, matrix_cols, 0.0);
-        for (std::size_t i = 0; i < matrix_rows; ++i)
-        {
-            for (std::size_t j = 0; j < matrix_cols; ++j)
-            {
-                result.matrix_data[i][j] = matrix_data[i][j] + m.matrix_data[i][j];
-            }
-        }
-        return result;
-    }
-    catch (const std::invalid_argument& e)
+    ZTMatrix result(matrix_rows, matrix_cols);
+    add(m, result);
+    return result;
+
+}
+
+/**
+ * add : performs matrix to matrix addition into a preallocated result, out
+ *       is only reallocated when it is too small and may alias either operand
+ *
+ * @param  ZTMatrix<T> m
+ * @param  ZTMatrix<T>& out result
+ * @return nothing
+ *
+ */
+template<typename T>
+void ZTMatrix<T>::add(const ZTMatrix<T>& m, ZTMatrix<T>& out) const {
+
+    ZT_VALIDATE(valid_matrix_add_minus(m));
+    out.reshape(matrix_rows, matrix_cols);
+    const T* a = matrix_data.data();
+    const T* b = m.matrix_data.data();
+    T* r = out.matrix_data.data();
+    for (std::size_t i = 0, n = matrix_data.size(); i < n; ++i)
     {
-        std::cerr << "Exception: " << e.what() << std::endl;
-        std::exit(0);
+        r[i] = a[i] + b[i];
     }
 
 }
 
 /**
- * minus : performs matrix to matrix subtraction
+ * minus : performs matrix to matrix subtraction
+ *
+ * @param  ZTMatrix<T> m
+ * @return ZTMatrix<T> result
+ *
+ */
+template<typename T>
+ZTMatrix<T> ZTMatrix<T>::minus(const ZTMatrix<T>& m) const {
+
+    ZTMatrix result(matrix_rows, matrix_cols);
+    minus(m, result);
+    return result;
+
+}
+
+/**
+ * minus : performs matrix to matrix subtraction into a preallocated result, out
+ *         is only reallocated when it is too small and may alias either operand
+ *
+ * @param  ZTMatrix<T> m
+ * @param  ZTMatrix<T>& out result
+ * @return nothing
+ *
+ */
+template<typename T>
+void ZTMatrix<T>::minus(const ZTMatrix<T>& m, ZTMatrix<T>& out) const {
+
+    ZT_VALIDATE(valid_matrix_add_minus(m));
+    out.reshape(matrix_rows, matrix_cols);
+    const T* a = matrix_data.data();
+    const T* b = m.matrix_data.data();
+    T* r = out.matrix_data.data();
+    for (std::size_t i = 0, n = matrix_data.size(); i < n; ++i)
+    {
+        r[i] = a[i] - b[i];
+    }
+
+}
+
+/**
+ * multiply : performs matrix to matrix multiplication
+ *
+ * @param  ZTMatrix<T> m
+ * @return ZTMatrix<T> result (rows x m.cols)
+ *
+ */
+template<typename T>
+inline ZTMatrix<T> ZTMatrix<T>::multiply(const ZTMatrix<T>& m) const {
+
+    return ZTMatrix<T>::matmul(m);
+
+}
+
+/**
+ * matmul : performs the matrix product through the blocked GEMM engine
+ *
+ * @param  ZTMatrix<T> m
+ * @return ZTMatrix<T> result (rows x m.cols)
+ *
+ */
+template<typename T>
+ZTMatrix<T> ZTMatrix<T>::matmul(const ZTMatrix<T>& m) const {
+
+    ZTMatrix result(matrix_rows, m.matrix_cols);
+    matmul(m, result);
+    return result;
+
+}
+
+/**
+ * matmul : performs the matrix product into a preallocated result, out is only
+ *          reallocated when its shape differs. When out aliases an operand the
+ *          product goes through a temporary first
+ *
+ * @param  ZTMatrix<T> m
+ * @param  ZTMatrix<T>& out result (rows x m.cols)
+ * @return nothing
+ *
+ */
+template<typename T>
+void ZTMatrix<T>::matmul(const ZTMatrix<T>& m, ZTMatrix<T>& out) const {
+
+    ZT_VALIDATE(valid_matrix_product(m));
+    if (&out == this || &out == &m)
+    {
+        out = matmul(m);
+        return;
+    }
+    out.reshape(matrix_rows, m.matrix_cols);
+    ZTGemm<T>::gemm(matrix_rows, m.matrix_cols, matrix_cols, T(1),
+                    data(), matrix_stride, 1,
+                    m.data(), m.matrix_stride, 1,
+                    T(0), out.data(), out.matrix_stride, 1);
+
+}
+
+/**
+ * hadamard : performs matrix to matrix element-wise multiplication
+ *
+ * @param  ZTMatrix<T> m
+ * @return ZTMatrix<T> result
+ *
+ */
+template<typename T>
+ZTMatrix<T> ZTMatrix<T>::hadamard(const ZTMatrix<T>& m) const {
+
+    ZTMatrix result(matrix_rows, matrix_cols);
+    hadamard(m, result);
+    return result;
+
+}
+
+/**
+ * matvec : performs the matrix-vector product through the GEMV engine
+ *
+ * @param  ZTVectorView<const T> v
+ * @return ZTVector<T> result (rows elements)
+ *
+ */
+template<typename T>
+ZTVector<T> ZTMatrix<T>::matvec(const ZTVectorView<const T>& v) const {
+
+    return view().matvec(v);
+
+}
+
+/**
+ * matvec_transposed : performs the product of the transpose with a vector,
+ *                     without forming the transpose
+ *
+ * @param  ZTVectorView<const T> v
+ * @return ZTVector<T> result (cols elements)
+ *
+ */
+template<typename T>
+ZTVector<T> ZTMatrix<T>::matvec_transposed(const ZTVectorView<const T>& v) const {
+
+    return view().matvec_transposed(v);
+
+}
+
+/**
+ * matvec : performs the matrix-vector product into a preallocated result
+ *
+ * @param  ZTVectorView<const T> v
+ * @param  ZTVector<T>& out result (rows elements)
+ * @return nothing
+ *
+ */
+template<typename T>
+void ZTMatrix<T>::matvec(const ZTVectorView<const T>& v, ZTVector<T>& out) const {
+
+    view().matvec(v, out);
+
+}
+
+/**
+ * matvec_transposed : performs the product of the transpose with a vector
+ *                     into a preallocated result
+ *
+ * @param  ZTVectorView<const T> v
+ * @param  ZTVector<T>& out result (cols elements)
+ * @return nothing
+ *
+ */
+template<typename T>
+void ZTMatrix<T>::matvec_transposed(const ZTVectorView<const T>& v, ZTVector<T>& out) const {
+
+    view().matvec_transposed(v, out);
+
+}
+
+/**
+ * apply : performs y = A * x for the iterative solvers
+ *
+ * @param  ZTVector<T> x
+ * @param  ZTVector<T>& y result (rows elements)
+ * @return nothing
+ *
+ */
+template<typename T>
+void ZTMatrix<T>::apply(const ZTVector<T>& x, ZTVector<T>& y) const {
+
+    matvec(x, y);
+
+}
+
+/**
+ * hadamard : performs matrix to matrix element-wise multiplication into a preallocated result, out
+ *            is only reallocated when it is too small and may alias either operand
+ *
+ * @param  ZTMatrix<T> m
+ * @param  ZTMatrix<T>& out result
+ * @return nothing
+ *
+ */
+template<typename T>
+void ZTMatrix<T>::hadamard(const ZTMatrix<T>& m, ZTMatrix<T>& out) const {
+
+    ZT_VALIDATE(valid_matrix_add_minus(m));
+    out.reshape(matrix_rows, matrix_cols);
+    const T* a = matrix_data.data();
+    const T* b = m.matrix_data.data();
+    T* r = out.matrix_data.data();
+    for (std::size_t i = 0, n = matrix_data.size(); i < n; ++i)
+    {
+        r[i] = a[i] * b[i];
+    }
+
+}
+
+/**
+ * cummulative_add : performs matrix to matrix cummulative addition
+ *
+ * @param  ZTMatrix<T>& m
+ * @return *this (instance of ZTMatrix<T>)
+ *
+ */
+template<typename T>
+ZTMatrix<T>& ZTMatrix<T>::cummulative_add(const ZTMatrix<T>& m) {
+
+    ZT_VALIDATE(valid_matrix_add_minus(m));
+    T* a = matrix_data.data();
+    const T* b = m.matrix_data.data();
+    for (std::size_t i = 0, n = matrix_data.size(); i < n; ++i)
+    {
+        a[i] += b[i];
+    }
+    return *this;
+
+}
+
+/**
+ * cummulative_minus : performs matrix to matrix cummulative subtraction
+ *
+ * @param  ZTMatrix<T>& m
+ * @return *this (instance of ZTMatrix<T>)
+ *
+ */
+template<typename T>
+ZTMatrix<T>& ZTMatrix<T>::cummulative_minus(const ZTMatrix<T>& m) {
+
+    ZT_VALIDATE(valid_matrix_add_minus(m));
+    T* a = matrix_data.data();
+    const T* b = m.matrix_data.data();
+    for (std::size_t i = 0, n = matrix_data.size(); i < n; ++i)
+    {
+        a[i] -= b[i];
+    }
+    return *this;
+
+}
+
+/**
+ * cummulative_multiply : performs matrix to matrix cummulative multiplication,
+ *                        *this becomes the (rows x m.cols) matrix product
+ *
+ * @param  ZTMatrix<T>& m
+ * @return *this (instance of ZTMatrix<T>)
+ *
+ */
+template<typename T>
+ZTMatrix<T>& ZTMatrix<T>::cummulative_multiply(const ZTMatrix<T>& m) {
+
+    *this = matmul(m);
+    return *this;
+
+}
+
+/**
+ * cummulative_hadamard : performs matrix to matrix cummulative element-wise multiplication
+ *
+ * @param  ZTMatrix<T>& m
+ * @return *this (instance of ZTMatrix<T>)
+ *
+ */
+template<typename T>
+ZTMatrix<T>& ZTMatrix<T>::cummulative_hadamard(const ZTMatrix<T>& m) {
+
+    ZT_VALIDATE(valid_matrix_add_minus(m));
+    T* a = matrix_data.data();
+    const T* b = m.matrix_data.data();
+    for (std::size_t i = 0, n = matrix_data.size(); i < n; ++i)
+    {
+        a[i] *= b[i];
+    }
+    return *this;
+
+}
+
+/**
+ * inline += operator : performs matrix to scalar cummulative addition
+ *
+ * @param  T& scalar
+ *
+ */
+template <typename T>
+inline ZTMatrix<T>& ZTMatrix<T>::operator+=(const T& scalar) {
+
+    return ZTMatrix<T>::cummulative_add(scalar);
+
+}
+
+/**
+ * inline -= operator : performs matrix to scalar cummulative subtraction
+ *
+ * @param  T& scalar
+ *
+ */
+template <typename T>
+inline ZTMatrix<T>& ZTMatrix<T>::operator-=(const T& scalar) {
+
+    return ZTMatrix<T>::cummulative_minus(scalar);
+
+}
+
+/**
+ * inline *= operator : performs matrix to scalar cummulative multiplication
+ *
+ * @param  T& scalar
+ *
+ */
+template <typename T>
+ZTMatrix<T>& ZTMatrix<T>::operator*=(const T& scalar) {
+
+    return ZTMatrix<T>::cummulative_multiply(scalar);
+
+}
+
+/**
+ * inline += operator : performs matrix to matrix cummulative addition
+ *
+ * @param  ZTMatrix<T> m
+ *
+ */
+template <typename T>
+inline ZTMatrix<T>& ZTMatrix<T>::operator+=(const ZTMatrix<T>& m) {
+
+    return ZTMatrix<T>::cummulative_add(m);
+
+}
+
+/**
+ * inline -= operator : performs matrix to matrix cummulative subtraction
+ *
+ * @param  ZTMatrix<T> m
+ *
+ */
+template <typename T>
+inline ZTMatrix<T>& ZTMatrix<T>::operator-=(const ZTMatrix<T>& m) {
+
+    return ZTMatrix<T>::cummulative_minus(m);
+
+}
+
+/**
+ * inline += operator : performs matrix to expression cummulative addition in a single pass
+ *
+ * @param  ZTMatrixExpression<T, E> e
+ *
+ */
+template <typename T>
+template <typename E>
+inline ZTMatrix<T>& ZTMatrix<T>::operator+=(const ZTMatrixExpression<T, E>& e) {
+
+    ZT_VALIDATE(zt_valid_expression_dimensions(matrix_rows, matrix_cols, e.get_matrix_rows(), e.get_matrix_cols()));
+    if (e.overlaps(matrix_data.data(), matrix_stride))
+    {
+        return *this += ZTMatrix<T>(e);
+    }
+    for (std::size_t r = 0; r < matrix_rows; ++r)
+    {
+        T* z = matrix_data.data() + r * matrix_stride;
+        _Pragma("GCC ivdep")
+        for (std::size_t c = 0; c < matrix_cols; ++c)
+        {
+            z[c] += e(r, c);
+        }
+    }
+    return *this;
+
+}
+
+/**
+ * inline -= operator : performs matrix to expression cummulative subtraction in a single pass
+ *
+ * @param  ZTMatrixExpression<T, E> e
+ *
+ */
+template <typename T>
+template <typename E>
+inline ZTMatrix<T>& ZTMatrix<T>::operator-=(const ZTMatrixExpression<T, E>& e) {
+
+    ZT_VALIDATE(zt_valid_expression_dimensions(matrix_rows, matrix_cols, e.get_matrix_rows(), e.get_matrix_cols()));
+    if (e.overlaps(matrix_data.data(), matrix_stride))
+    {
+        return *this -= ZTMatrix<T>(e);
+    }
+    for (std::size_t r = 0; r < matrix_rows; ++r)
+    {
+        T* z = matrix_data.data() + r * matrix_stride;
+        _Pragma("GCC ivdep")
+        for (std::size_t c = 0; c < matrix_cols; ++c)
+        {
+            z[c] -= e(r, c);
+        }
+    }
+    return *this;
+
+}
+
+/**
+ * inline *= operator : performs matrix to matrix cummulative multiplication
+ *
+ * @param  ZTMatrix<T> m
+ *
+ */
+template <typename T>
+inline ZTMatrix<T>& ZTMatrix<T>::operator*=(const ZTMatrix<T>& m) {
+
+    return ZTMatrix<T>::cummulative_multiply(m);
+
+}
+
+/**
+ * assignment operator : performs assignment of the given matrix to the instance one
  *
  * @param  ZTMatrix<T> m
- * @return std::vector<std::vector<T>> result
+ * @return *this (instance of ZTVector<T>)
  *
  */
-template<typename T>
-ZTMatrix<T> ZTMatrix<T>::minus(const ZTMatrix<T>& m) {
+template <typename T>
+inline ZTMatrix<T>& ZTMatrix<T>::operator=(const ZTMatrix<T>& m) {
 
-    try
-    {
-        valid_matrix_add_minus(m);
-        ZTMatrix result(matrix_rows, matrix_cols, 0.0);
-        for (std::size_t i = 0; i < matrix_rows; ++i)
-        {
-            for (std::size_t j = 0; j < matrix_cols; ++j)
-            {
-                result.matrix_data[i][j] = matrix_data[i][j] - m.matrix_data[i][j];
-            }
-        }
-        return result;
-    }
-    catch (const std::invalid_argument& e)
+    if (&m != this)
     {
-        std::cerr << "Exception: " << e.what() << std::endl;
-        std::exit(0);
+        matrix_data = m.matrix_data;
+        matrix_rows = m.matrix_rows;
+        matrix_cols = m.matrix_cols;
+        matrix_stride = m.matrix_stride;
     }
+    return *this;
 
 }
 
 /**
- * multiply : performs matrix to matrix multiplication
+ * move assignment operator : takes over the buffer of m, which is left as an
+ *                            empty 0x0 matrix
  *
  * @param  ZTMatrix<T> m
- * @return std::vector<std::vector<T>> result
+ * @return *this (instance of ZTMatrix<T>)
  *
  */
-template<typename T>
-ZTMatrix<T> ZTMatrix<T>::multiply(const ZTMatrix<T>& m) {
+template <typename T>
+inline ZTMatrix<T>& ZTMatrix<T>::operator=(ZTMatrix<T>&& m) noexcept {
 
-    try
-    {
-        valid_matrix_product(m);
-        ZTMatrix result(matrix_rows, matrix_cols, 0.0);
-        for (std::size_t i = 0; i < matrix_rows; ++i)
-        {
-            for (std::size_t j = 0; j < matrix_cols; ++j)
-            {
-                result.matrix_data[i][j] = matrix_data[i][j] * m.matrix_data[i][j];
-            }
-        }
-        return result;
-    }
-    catch (const std::invalid_argument& e)
+    if (&m != this)
     {
-        std::cerr << "Exception: " << e.what() << std::endl;
-        std::exit(0);
+        matrix_data.swap(m.matrix_data);
+        matrix_rows = m.matrix_rows;
+        matrix_cols = m.matrix_cols;
+        matrix_stride = m.matrix_stride;
+        m.matrix_data.clear();
+        m.matrix_rows = 0;
+        m.matrix_cols = 0;
+        m.matrix_stride = 0;
     }
+    return *this;
 
 }
 
 /**
- * cummulative_add : performs matrix to matrix cummulative addition
+ * assignment operator : evaluates the expression into the instance in a single
+ *                       pass. The instance may appear in the expression as a
+ *                       whole; when a view in it may read elements of the
+ *                       instance out of place, as a transpose does, the
+ *                       expression is evaluated into a temporary first
  *
- * @param  ZTMatrix<T>& m
+ * @param  ZTMatrixExpression<T, E> e
  * @return *this (instance of ZTMatrix<T>)
  *
  */
-template<typename T>
-ZTMatrix<T>& ZTMatrix<T>::cummulative_add(const ZTMatrix<T>& m) {
+template <typename T>
+template <typename E>
+ZTMatrix<T>& ZTMatrix<T>::operator=(const ZTMatrixExpression<T, E>& e) {
 
-    try
+    if (matrix_rows != e.get_matrix_rows() || matrix_cols != e.get_matrix_cols() ||
+        e.overlaps(matrix_data.data(), matrix_stride))
     {
-        valid_matrix_add_minus(m);
-        for (std::size_t i = 0; i < matrix_rows; ++i)
-        {
-            for (std::size_t j = 0; j < matrix_cols; ++j)
-            {
-                matrix_data[i][j] += m.matrix_data[i][j];
-            }
-        }
+        ZTMatrix<T> result(e);
+        matrix_data.swap(result.matrix_data);
+        matrix_rows = result.matrix_rows;
+        matrix_cols = result.matrix_cols;
+        matrix_stride = result.matrix_stride;
         return *this;
     }
-    catch (const std::invalid_argument& e)
+    // no node reads an element of the instance other than (r, c), so writing in place is safe
+    for (std::size_t r = 0; r < matrix_rows; ++r)
     {
-        std::cerr << "Exception: " << e.what() << std::endl;
-        std::exit(0);
+        T* z = matrix_data.data() + r * matrix_stride;
+        _Pragma("GCC ivdep")
+        for (std::size_t c = 0; c < matrix_cols; ++c)
+        {
+            z[c] = e(r, c);
+        }
     }
+    return *this;
 
 }
 
 /**
- * cummulative_minus : performs matrix to matrix cummulative subtraction
+ * () operator : get the matrix element given the subscripts (row, col)
  *
- * @param  ZTMatrix<T>& m
- * @return *this (instance of ZTMatrix<T>)
+ * @param  std::size_t row_size size for initialization
+ * @param  std::size_t col_size size for initialization
+ * @return T result
  *
  */
 template<typename T>
-ZTMatrix<T>& ZTMatrix<T>::cummulative_minus(const ZTMatrix<T>& m) {
+inline T& ZTMatrix<T>::operator()(std::size_t row_index, std::size_t col_index) {
 
-    try
-    {
-        valid_matrix_add_minus(m);
-        for (std::size_t i = 0; i < matrix_rows; ++i)
-        {
-            for (std::size_t j = 0; j < matrix_cols; ++j)
-            {
-                matrix_data[i][j] -= m.matrix_data[i][j];
-            }
-        }
-        return *this;
-    }
-    catch (const std::invalid_argument& e)
-    {
-        std::cerr << "Exception: " << e.what() << std::endl;
-        std::exit(0);
-    }
+    ZT_VALIDATE(valid_subscript_dimensions(row_index, col_index));
+    return matrix_data[(row_index - 1) * matrix_stride + (col_index - 1)];
 
 }
 
 /**
- * cummulative_minus : performs matrix to matrix cummulative multiplication
+ * () operator : get the matrix element given the subscripts (row, col)
  *
- * @param  ZTMatrix<T>& m
- * @return *this (instance of ZTMatrix<T>)
+ * @param  std::size_t row_size size for initialization
+ * @param  std::size_t col_size size for initialization
+ * @return const T result
  *
  */
 template<typename T>
-ZTMatrix<T>& ZTMatrix<T>::cummulative_multiply(const ZTMatrix<T>& m) {
+inline const T& ZTMatrix<T>::operator()(std::size_t row_index, std::size_t col_index) const {
 
-    try
-    {
-        valid_matrix_product(m);
-        for (std::size_t i = 0; i < matrix_rows; ++i)
-        {
-            for (std::size_t j = 0; j < matrix_cols; ++j)
-            {
-                matrix_data[i][j] *= m.matrix_data[i][j];
-            }
-        }
-        return *this;
-    }
-    catch (const std::invalid_argument& e)
-    {
-        std::cerr << "Exception: " << e.what() << std::endl;
-        std::exit(0);
-    }
+    ZT_VALIDATE(valid_subscript_dimensions(row_index, col_index));
+    return matrix_data[(row_index - 1) * matrix_stride + (col_index - 1)];
 
 }
 
 /**
- * inline + operator : performs matrix to scalar addition
+ * at : get the matrix element at zero-based (row, col), the subscripts are
+ *      checked whatever the error policy
  *
- * @param  T& scalar
+ * @param  std::size_t row zero-based row
+ * @param  std::size_t col zero-based column
+ * @return T& element
  *
  */
-template <typename T>
-inline ZTMatrix<T> ZTMatrix<T>::operator+(const T& scalar) {
+template<typename T>
+inline T& ZTMatrix<T>::at(std::size_t row, std::size_t col) {
 
-    return ZTMatrix<T>::add(scalar);
+    valid_index_dimensions(row, col);
+    return matrix_data[row * matrix_stride + col];
 
 }
 
 /**
- * inline - operator : performs matrix to scalar subtraction
+ * at : get the matrix element at zero-based (row, col), the subscripts are
+ *      checked whatever the error policy
  *
- * @param  T& scalar
+ * @param  std::size_t row zero-based row
+ * @param  std::size_t col zero-based column
+ * @return const T& element
  *
  */
-template <typename T>
-inline ZTMatrix<T> ZTMatrix<T>::operator-(const T& scalar) {
+template<typename T>
+inline const T& ZTMatrix<T>::at(std::size_t row, std::size_t col) const {
 
-    return ZTMatrix<T>::minus(scalar);
+    valid_index_dimensions(row, col);
+    return matrix_data[row * matrix_stride + col];
 
 }
 
 /**
- * inline * operator : performs matrix to scalar multiplication
+ * [] operator : pointer to the first element of zero-based row, m[row][col]
+ *              is a single unchecked load
  *
- * @param  T& scalar
+ * @param  std::size_t row zero-based row
+ * @return T* row
  *
  */
-template <typename T>
-inline ZTMatrix<T> ZTMatrix<T>::operator*(const T& scalar) {
+template<typename T>
+inline T* ZTMatrix<T>::operator[](std::size_t row) {
 
-    return ZTMatrix<T>::multiply(scalar);
+    return matrix_data.data() + row * matrix_stride;
 
 }
 
 /**
- * inline += operator : performs matrix to scalar cummulative addition
+ * [] operator : pointer to the first element of zero-based row, m[row][col]
+ *              is a single unchecked load
  *
- * @param  T& scalar
+ * @param  std::size_t row zero-based row
+ * @return const T* row
  *
  */
-template <typename T>
-inline ZTMatrix<T>& ZTMatrix<T>::operator+=(const T& scalar) {
+template<typename T>
+inline const T* ZTMatrix<T>::operator[](std::size_t row) const {
 
-    return ZTMatrix<T>::cummulative_add(scalar);
+    return matrix_data.data() + row * matrix_stride;
 
 }
 
 /**
- * inline -= operator : performs matrix to scalar cummulative subtraction
+ * unsafe_get : get the matrix element at zero-based (row, col) without checks
  *
- * @param  T& scalar
+ * @param  std::size_t row zero-based row
+ * @param  std::size_t col zero-based column
+ * @return T& element
  *
  */
-template <typename T>
-inline ZTMatrix<T>& ZTMatrix<T>::operator-=(const T& scalar) {
+template<typename T>
+inline T& ZTMatrix<T>::unsafe_get(std::size_t row, std::size_t col) {
 
-    return ZTMatrix<T>::cummulative_minus(scalar);
+    return matrix_data[row * matrix_stride + col];
 
 }
 
 /**
- * inline *= operator : performs matrix to scalar cummulative multiplication
+ * unsafe_get : get the matrix element at zero-based (row, col) without checks
  *
- * @param  T& scalar
+ * @param  std::size_t row zero-based row
+ * @param  std::size_t col zero-based column
+ * @return const T& element
  *
  */
-template <typename T>
-ZTMatrix<T>& ZTMatrix<T>::operator*=(const T& scalar) {
+template<typename T>
+inline const T& ZTMatrix<T>::unsafe_get(std::size_t row, std::size_t col) const {
 
-    return ZTMatrix<T>::cummulative_multiply(scalar);
+    return matrix_data[row * matrix_stride + col];
 
 }
 
 /**
- * inline + operator : performs matrix to matrix addition
+ * lu : factorizes the matrix as P * A = L * U, the result solves systems and
+ *      gives the determinant and inverse without factorizing again
  *
- * @param  ZTMatrix<T> m
+ * @param  nothing
+ * @return ZTLU<T> result
  *
  */
-template <typename T>
-inline ZTMatrix<T> ZTMatrix<T>::operator+(const ZTMatrix<T>& m) {
+template<typename T>
+ZTLU<T> ZTMatrix<T>::lu() const {
 
-    return ZTMatrix<T>::add(m);
+    return ZTLU<T>(*this);
 
 }
 
 /**
- * inline - operator : performs matrix to matrix subtraction
+ * cholesky : factorizes a symmetric positive definite matrix as A = L * L^T,
+ *            reading only its lower triangle. Whether the matrix was positive
+ *            definite is reported by the result, nothing is raised
  *
- * @param  ZTMatrix<T> m
+ * @param  nothing
+ * @return ZTCholesky<T> result
  *
  */
-template <typename T>
-inline ZTMatrix<T> ZTMatrix<T>::operator-(const ZTMatrix<T>& m) {
+template<typename T>
+ZTCholesky<T> ZTMatrix<T>::cholesky() const {
 
-    return ZTMatrix<T>::minus(m);
+    return ZTCholesky<T>(*this);
 
 }
 
 /**
- * inline * operator : performs matrix to matrix multiplication
+ * ldlt : factorizes a symmetric matrix as A = L * D * L^T, reading only its
+ *        lower triangle
  *
- * @param  ZTMatrix<T> m
+ * @param  nothing
+ * @return ZTLDLT<T> result
  *
  */
-template <typename T>
-inline ZTMatrix<T> ZTMatrix<T>::operator*(const ZTMatrix<T>& m) {
+template<typename T>
+ZTLDLT<T> ZTMatrix<T>::ldlt() const {
 
-    return ZTMatrix<T>::multiply(m);
+    return ZTLDLT<T>(*this);
 
 }
 
 /**
- * inline += operator : performs matrix to matrix cummulative addition
+ * qr : factorizes the matrix as A = Q * R with blocked Householder
+ *      reflectors, Q is applied from the result without being formed
  *
- * @param  ZTMatrix<T> m
+ * @param  nothing
+ * @return ZTQR<T> result
  *
  */
-template <typename T>
-inline ZTMatrix<T>& ZTMatrix<T>::operator+=(const ZTMatrix<T>& m) {
+template<typename T>
+ZTQR<T> ZTMatrix<T>::qr() const {
 
-    return ZTMatrix<T>::cummulative_add(m);
+    return ZTQR<T>(*this, ZT_QR_HOUSEHOLDER);
 
 }
 
 /**
- * inline -= operator : performs matrix to matrix cummulative subtraction
+ * tsqr : factorizes a tall-skinny matrix as A = Q * R, cache-sized row blocks
+ *        are factored in parallel and their R factors reduced
  *
- * @param  ZTMatrix<T> m
+ * @param  nothing
+ * @return ZTQR<T> result
  *
  */
-template <typename T>
-inline ZTMatrix<T>& ZTMatrix<T>::operator-=(const ZTMatrix<T>& m) {
+template<typename T>
+ZTQR<T> ZTMatrix<T>::tsqr() const {
 
-    return ZTMatrix<T>::cummulative_minus(m);
+    return ZTQR<T>(*this, ZT_QR_TSQR);
 
 }
 
 /**
- * inline *= operator : performs matrix to matrix cummulative multiplication
+ * symmetric_eigen : eigenvalues, ascending, and eigenvectors of a symmetric
+ *                   matrix from its lower triangle
  *
- * @param  ZTMatrix<T> m
+ * @param  bool compute_vectors whether to compute the eigenvectors too
+ * @return ZTSymmetricEigen<T> result
  *
  */
-template <typename T>
-inline ZTMatrix<T>& ZTMatrix<T>::operator*=(const ZTMatrix<T>& m) {
+template<typename T>
+ZTSymmetricEigen<T> ZTMatrix<T>::symmetric_eigen(bool compute_vectors) const {
 
-    return ZTMatrix<T>::cummulative_multiply(m);
+    return ZTSymmetricEigen<T>(*this, compute_vectors);
 
 }
 
 /**
- * assignment operator : performs assignment of the given matrix to the instance one
+ * svd : singular value decomposition A = U * diag(s) * V^T
  *
- * @param  ZTMatrix<T> m
- * @return *this (instance of ZTVector<T>)
+ * @param  nothing
+ * @return ZTSVD<T> result
  *
  */
-template <typename T>
-inline ZTMatrix<T>& ZTMatrix<T>::operator=(const ZTMatrix<T>& m) {
+template<typename T>
+ZTSVD<T> ZTMatrix<T>::svd() const {
 
-    if (&m != this)
-    {
-        matrix_data = m.matrix_data;
-        matrix_rows = m.matrix_rows;
-        matrix_cols = m.matrix_cols;
-    }
-    return *this;
+    return ZTSVD<T>(*this);
 
 }
 
 /**
- * () operator : get the matrix element given the subscripts (row, col)
+ * truncated_svd : leading rank singular triplets by randomized range
+ *                 finding, with the default oversampling and power
+ *                 iterations
  *
- * @param  std::size_t row_size size for initialization
- * @param  std::size_t col_size size for initialization
- * @return T result
+ * @param  std::size_t rank number of components
+ * @return ZTSVD<T> result
  *
  */
 template<typename T>
-T& ZTMatrix<T>::operator()(std::size_t row_index, std::size_t col_index) {
+ZTSVD<T> ZTMatrix<T>::truncated_svd(std::size_t rank) const {
 
-    try
-    {
-        valid_subscript_dimensions(row_index, col_index);
-        return matrix_data[row_index - 1][col_index - 1];
-    }
-    catch (const std::invalid_argument& e)
-    {
-        std::cerr << "Exception: " << e.what() << std::endl;
-        std::exit(0);
-    }
+    return ZTSVD<T>(view(), rank);
 
 }
 
@@ -603,23 +1364,15 @@ T& ZTMatrix<T>::operator()(std::size_t row_index, std::size_t col_index) {
  *
  */
 template<typename T>
-T ZTMatrix<T>::trace() {
+T ZTMatrix<T>::trace() const {
 
-    try
-    {
-        valid_sqaure_matrix(matrix_rows, matrix_cols);
-        T result = 0;
-        for (std::size_t i = 0; i < matrix_rows; ++i)
-        {
-            result += matrix_data[i][i];
-        }
-        return result;
-    }
-    catch (const std::invalid_argument& e)
+    ZT_VALIDATE(valid_sqaure_matrix(matrix_rows, matrix_cols));
+    T result = 0;
+    for (std::size_t i = 0; i < matrix_rows; ++i)
     {
-        std::cerr << "Exception: " << e.what() << std::endl;
-        std::exit(0);
+        result += matrix_data[i * matrix_stride + i];
     }
+    return result;
 
 }
 
@@ -631,23 +1384,15 @@ T ZTMatrix<T>::trace() {
  *
  */
 template<typename T>
-T ZTMatrix<T>::trace(const ZTMatrix<T>& m) {
+T ZTMatrix<T>::trace(const ZTMatrix<T>& m) const {
 
-    try
-    {
-        valid_sqaure_matrix(m);
-        T result = 0;
-        for (std::size_t i = 0; i < m.matrix_rows; ++i)
-        {
-            result += m.matrix_data[i][i];
-        }
-        return result;
-    }
-    catch (const std::invalid_argument& e)
+    ZT_VALIDATE(valid_sqaure_matrix(m));
+    T result = 0;
+    for (std::size_t i = 0; i < m.matrix_rows; ++i)
     {
-        std::cerr << "Exception: " << e.what() << std::endl;
-        std::exit(0);
+        result += m.matrix_data[i * m.matrix_stride + i];
     }
+    return result;
 
 }
 
@@ -659,17 +1404,10 @@ T ZTMatrix<T>::trace(const ZTMatrix<T>& m) {
  *
  */
 template<typename T>
-T ZTMatrix<T>::norm() {
+T ZTMatrix<T>::norm() const {
 
-    T result = 0;
-    for (std::size_t i = 0; i < matrix_rows; ++i)
-    {
-        for (std::size_t j = 0; j < matrix_cols; ++j)
-        {
-            result += std::pow(matrix_data[i][j], 2);
-        }
-    }
-    return std::sqrt(result);
+    const T* a = matrix_data.data();
+    return std::sqrt(ZTBlas<T>::kernels().dot(matrix_data.size(), a, a));
 
 }
 
@@ -681,17 +1419,10 @@ T ZTMatrix<T>::norm() {
  *
  */
 template<typename T>
-T ZTMatrix<T>::norm(const ZTMatrix<T>& m) {
+T ZTMatrix<T>::norm(const ZTMatrix<T>& m) const {
 
-    T result = 0;
-    for (std::size_t i = 0; i < m.matrix_rows; ++i)
-    {
-        for (std::size_t j = 0; j < m.matrix_cols; ++j)
-        {
-            result += std::pow(m.matrix_data[i][j], 2);
-        }
-    }
-    return std::sqrt(result);
+    const T* a = m.matrix_data.data();
+    return std::sqrt(ZTBlas<T>::kernels().dot(m.matrix_data.size(), a, a));
 
 }
 
@@ -709,7 +1440,7 @@ inline void ZTMatrix<T>::valid_sqaure_matrix(const ZTMatrix<T> &m) const {
     {
         std::ostringstream invalid_dimensions;
         invalid_dimensions << "Matrices of dimensions: " << m.matrix_rows << "x" << m.matrix_cols << " is not a sqaure matrix!.";
-        throw std::invalid_argument(invalid_dimensions.str());
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
     }
 
 }
@@ -729,7 +1460,7 @@ inline void ZTMatrix<T>::valid_sqaure_matrix(std::size_t row_size, std::size_t c
     {
         std::ostringstream invalid_dimensions;
         invalid_dimensions << "Matrices of dimensions: " << row_size << "x" << col_size << " is not a sqaure matrix!.";
-        throw std::invalid_argument(invalid_dimensions.str());
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
     }
 
 }
@@ -748,7 +1479,7 @@ inline void ZTMatrix<T>::valid_matrix_product(const ZTMatrix<T> &m) const {
     {
         std::ostringstream invalid_dimensions;
         invalid_dimensions << "Matrices of dimensions: " << matrix_rows << "x" << matrix_cols << " and " << m.matrix_rows << "x" << m.matrix_cols << " are not suitable for matrix product!.";
-        throw std::invalid_argument(invalid_dimensions.str());
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
     }
 
 }
@@ -763,11 +1494,31 @@ inline void ZTMatrix<T>::valid_matrix_product(const ZTMatrix<T> &m) const {
 template<typename T>
 inline void ZTMatrix<T>::valid_matrix_add_minus(const ZTMatrix<T>& m) const {
 
-    if (matrix_cols != m.matrix_cols && matrix_rows != m.matrix_rows)
+    if (matrix_cols != m.matrix_cols || matrix_rows != m.matrix_rows)
     {
         std::ostringstream invalid_dimensions;
         invalid_dimensions << "Matrices of dimensions: " << matrix_rows << "x" << matrix_cols << " and " << m.matrix_rows << "x" << m.matrix_cols << " are not suitable for matrix add or minus!.";
-        throw std::invalid_argument(invalid_dimensions.str());
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * valid_result_dimensions : checks that the instance has the dimensions of a result
+ *
+ * @param  std::size_t rows expected rows
+ * @param  std::size_t cols expected cols
+ * @return void
+ *
+ */
+template<typename T>
+inline void ZTMatrix<T>::valid_result_dimensions(std::size_t rows, std::size_t cols) const {
+
+    if (matrix_rows != rows || matrix_cols != cols)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Matrix of dimensions: " << matrix_rows << "x" << matrix_cols << " cannot hold a " << rows << "x" << cols << " result!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
     }
 
 }
@@ -786,7 +1537,166 @@ inline void ZTMatrix<T>::valid_subscript_dimensions(std::size_t row_index, std::
     {
         std::ostringstream invalid_dimensions;
         invalid_dimensions << "Matrix subscripts " << row_index << " and " << col_index << " out of range!.";
-        throw std::invalid_argument(invalid_dimensions.str());
+        zt_raise<std::out_of_range>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * valid_index_dimensions : checks for valid zero-based matrix subscripts
+ *
+ * @param  std::size_t row zero-based row
+ * @param  std::size_t col zero-based column
+ * @return void
+ *
+ */
+template<typename T>
+inline void ZTMatrix<T>::valid_index_dimensions(std::size_t row, std::size_t col) const {
+
+    if (row >= matrix_rows || col >= matrix_cols)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Matrix index (" << row << ", " << col << ") out of range for a " << matrix_rows << "x" << matrix_cols << " matrix!.";
+        zt_raise<std::out_of_range>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * gemm : performs C = alpha * A * B + beta * C
+ *
+ * @param  T& alpha scaling of the product
+ * @param  ZTMatrix<T> a left factor (m x k)
+ * @param  ZTMatrix<T> b right factor (k x n)
+ * @param  T& beta scaling of C
+ * @param  ZTMatrix<T> c result (m x n), updated in place
+ * @return nothing
+ *
+ */
+template<typename T>
+void gemm(const T& alpha, const ZTMatrix<T>& a, const ZTMatrix<T>& b, const T& beta, ZTMatrix<T>& c) {
+
+    ZT_VALIDATE(a.valid_matrix_product(b));
+    ZT_VALIDATE(c.valid_result_dimensions(a.get_matrix_rows(), b.get_matrix_cols()));
+    ZTGemm<T>::gemm(a.get_matrix_rows(), b.get_matrix_cols(), a.get_matrix_cols(), alpha,
+                    a.data(), a.stride(), 1,
+                    b.data(), b.stride(), 1,
+                    beta, c.data(), c.stride(), 1);
+
+}
+
+/**
+ * gemv : performs y = alpha * A * x + beta * y
+ *
+ * @param  T& alpha scaling of the product
+ * @param  ZTMatrix<T> a matrix (m x n)
+ * @param  ZTVector<T> x vector (n)
+ * @param  T& beta scaling of y
+ * @param  ZTVector<T> y result (m), updated in place
+ * @return nothing
+ *
+ */
+template<typename T>
+void gemv(const T& alpha, const ZTMatrix<T>& a, const ZTVector<T>& x, const T& beta, ZTVector<T>& y) {
+
+    ZT_VALIDATE(a.view().valid_matrix_vector_product(x));
+    ZT_VALIDATE(a.view().valid_vector_result(y));
+    ZTGemv<T>::gemv(a.get_matrix_rows(), a.get_matrix_cols(), alpha,
+                    a.data(), a.stride(), 1,
+                    x.data(), 1,
+                    beta, y.data(), 1);
+
+}
+
+/**
+ * gemv_transposed : performs y = alpha * A^T * x + beta * y without forming A^T
+ *
+ * @param  T& alpha scaling of the product
+ * @param  ZTMatrix<T> a matrix (m x n)
+ * @param  ZTVector<T> x vector (m)
+ * @param  T& beta scaling of y
+ * @param  ZTVector<T> y result (n), updated in place
+ * @return nothing
+ *
+ */
+template<typename T>
+void gemv_transposed(const T& alpha, const ZTMatrix<T>& a, const ZTVector<T>& x, const T& beta, ZTVector<T>& y) {
+
+    ZT_VALIDATE(a.view().transpose().valid_matrix_vector_product(x));
+    ZT_VALIDATE(a.view().transpose().valid_vector_result(y));
+    ZTGemv<T>::gemv(a.get_matrix_cols(), a.get_matrix_rows(), alpha,
+                    a.data(), 1, a.stride(),
+                    x.data(), 1,
+                    beta, y.data(), 1);
+
+}
+
+/**
+ * gemv_batch : performs y_b = alpha * A * x_b + beta * y_b for every row x_b
+ *              of x and the matching row y_b of y, as a single product that
+ *              streams A once for the whole batch
+ *
+ * @param  T& alpha scaling of the products
+ * @param  ZTMatrix<T> a matrix (m x n)
+ * @param  ZTMatrix<T> x one vector per row (count x n)
+ * @param  T& beta scaling of y
+ * @param  ZTMatrix<T> y one result per row (count x m), updated in place
+ * @return nothing
+ *
+ */
+template<typename T>
+void gemv_batch(const T& alpha, const ZTMatrix<T>& a, const ZTMatrix<T>& x, const T& beta, ZTMatrix<T>& y) {
+
+    ZT_VALIDATE(a.view().valid_matrix_product(x.view().transpose()));
+    ZT_VALIDATE(y.valid_result_dimensions(x.get_matrix_rows(), a.get_matrix_rows()));
+    ZTGemv<T>::batch(a.get_matrix_rows(), a.get_matrix_cols(), x.get_matrix_rows(), alpha,
+                     a.data(), a.stride(), 1,
+                     x.data(), x.stride(),
+                     beta, y.data(), y.stride());
+
+}
+
+/**
+ * gemv_batch : performs y[b] = alpha * A * x[b] + beta * y[b] for every
+ *              vector of x. y is resized to as many vectors as x, the new ones
+ *              zero. The vectors are gathered into contiguous rows so that
+ *              the batch runs as a single product
+ *
+ * @param  T& alpha scaling of the products
+ * @param  ZTMatrix<T> a matrix (m x n)
+ * @param  std::vector<ZTVector<T> > x vectors (n each)
+ * @param  T& beta scaling of y
+ * @param  std::vector<ZTVector<T> > y results (m each), updated in place
+ * @return nothing
+ *
+ */
+template<typename T>
+void gemv_batch(const T& alpha, const ZTMatrix<T>& a, const std::vector<ZTVector<T> >& x,
+                const T& beta, std::vector<ZTVector<T> >& y) {
+
+    const std::size_t m = a.get_matrix_rows();
+    const std::size_t n = a.get_matrix_cols();
+    const std::size_t count = x.size();
+    y.resize(count, ZTVector<T>(std::vector<T>(m, T(0))));
+    for (std::size_t b = 0; b < count; ++b)
+    {
+        ZT_VALIDATE(a.view().valid_matrix_vector_product(x[b]));
+        ZT_VALIDATE(a.view().valid_vector_result(y[b]));
+    }
+    std::vector<T, ZTAlignedAllocator<T> > xs(count * n);
+    std::vector<T, ZTAlignedAllocator<T> > ys(count * m);
+    for (std::size_t b = 0; b < count; ++b)
+    {
+        std::copy(x[b].data(), x[b].data() + n, xs.data() + b * n);
+        if (beta != T(0))
+        {
+            std::copy(y[b].data(), y[b].data() + m, ys.data() + b * m);
+        }
+    }
+    ZTGemv<T>::batch(m, n, count, alpha, a.data(), a.stride(), 1, xs.data(), n, beta, ys.data(), m);
+    for (std::size_t b = 0; b < count; ++b)
+    {
+        std::copy(ys.data() + b * m, ys.data() + (b + 1) * m, y[b].data());
     }
 
 }
@@ -27,69 +27,184 @@
 
 #include <vector>
 
+#include "ZTAlignedAllocator.h"
+
+template <typename T, typename E>
+class ZTMatrixExpression;
+
+template <typename T>
+class ZTVector;
+
+template <typename T>
+class ZTMatrixView;
+
+template <typename T>
+class ZTVectorView;
+
+template <typename T>
+class ZTLU;
+
+template <typename T>
+class ZTCholesky;
+
+template <typename T>
+class ZTLDLT;
+
+template <typename T>
+class ZTQR;
+
+template <typename T>
+class ZTSymmetricEigen;
+
+template <typename T>
+class ZTSVD;
+
 template <typename T>
 class ZTMatrix {
 
 private:
-    std::vector<std::vector<T> > matrix_data;
+    std::vector<T, ZTAlignedAllocator<T> > matrix_data; // row-major, leading dimension matrix_stride
     std::size_t matrix_rows;
     std::size_t matrix_cols;
+    std::size_t matrix_stride;
+
+    ZTMatrix(std::size_t rows, std::size_t cols); // uninitialized storage for results
+
+    void reshape(std::size_t rows, std::size_t cols); // reuses the buffer, elements unspecified
+
+    template <typename U>
+    friend class ZTMatrixView;
 
 public:
     ZTMatrix(std::size_t rows, std::size_t cols, const T& elements);
     ZTMatrix(const ZTMatrix<T> &cp);
+    ZTMatrix(ZTMatrix<T>&& mv) noexcept;
+    explicit ZTMatrix(const ZTMatrixView<const T>& v); // copies the elements of a view
+    template <typename E>
+    ZTMatrix(const ZTMatrixExpression<T, E>& e); // evaluates the expression
     virtual ~ZTMatrix();
 
-    ZTMatrix<T> add(const T& scalar);
-    ZTMatrix<T> minus(const T& scalar);
-    ZTMatrix<T> multiply(const T& scalar);
+    T* data();
+    const T* data() const;
+    std::size_t stride() const;
+
+    std::size_t get_matrix_rows() const;
+    std::size_t get_matrix_cols() const;
+
+    ZTMatrixView<T> view();
+    ZTMatrixView<const T> view() const;
+    ZTMatrixView<T> block(std::size_t row, std::size_t col, std::size_t rows, std::size_t cols);
+    ZTMatrixView<const T> block(std::size_t row, std::size_t col, std::size_t rows, std::size_t cols) const;
+    ZTVectorView<T> row(std::size_t row);
+    ZTVectorView<const T> row(std::size_t row) const;
+    ZTVectorView<T> col(std::size_t col);
+    ZTVectorView<const T> col(std::size_t col) const;
+
+    ZTMatrix<T> add(const T& scalar) const;
+    ZTMatrix<T> minus(const T& scalar) const;
+    ZTMatrix<T> multiply(const T& scalar) const;
+
+    void add(const T& scalar, ZTMatrix<T>& out) const;      // results into a reused buffer
+    void minus(const T& scalar, ZTMatrix<T>& out) const;
+    void multiply(const T& scalar, ZTMatrix<T>& out) const;
 
     ZTMatrix<T>& cummulative_add(const T& scalar);
     ZTMatrix<T>& cummulative_minus(const T& scalar);
     ZTMatrix<T>& cummulative_multiply(const T& scalar);
 
-    ZTMatrix<T> add(const ZTMatrix& m);
-    ZTMatrix<T> minus(const ZTMatrix& m);
-    ZTMatrix<T> multiply(const ZTMatrix& m);
+    ZTMatrix<T> add(const ZTMatrix& m) const;
+    ZTMatrix<T> minus(const ZTMatrix& m) const;
+    ZTMatrix<T> multiply(const ZTMatrix& m) const;
+
+    void add(const ZTMatrix& m, ZTMatrix<T>& out) const;
+    void minus(const ZTMatrix& m, ZTMatrix<T>& out) const;
 
     ZTMatrix<T>& cummulative_add(const ZTMatrix& m);
     ZTMatrix<T>& cummulative_minus(const ZTMatrix& m);
     ZTMatrix<T>& cummulative_multiply(const ZTMatrix& m);
 
-    ZTMatrix<T> operator +(const T& scalar);
-    ZTMatrix<T> operator -(const T& scalar);
-    ZTMatrix<T> operator *(const T &scalar);
+    ZTMatrix<T> matmul(const ZTMatrix& m) const;     // matrix product
+    ZTMatrix<T> hadamard(const ZTMatrix& m) const;   // element-wise product
+
+    void matmul(const ZTMatrix& m, ZTMatrix<T>& out) const;
+
+    ZTVector<T> matvec(const ZTVectorView<const T>& v) const;             // matrix-vector product
+    ZTVector<T> matvec_transposed(const ZTVectorView<const T>& v) const;  // transpose times vector
+
+    void matvec(const ZTVectorView<const T>& v, ZTVector<T>& out) const;
+    void matvec_transposed(const ZTVectorView<const T>& v, ZTVector<T>& out) const;
+    void apply(const ZTVector<T>& x, ZTVector<T>& y) const;  // y = A * x, the ZTKrylov operator interface
+    void hadamard(const ZTMatrix& m, ZTMatrix<T>& out) const;
+    ZTMatrix<T>& cummulative_hadamard(const ZTMatrix& m);
 
     ZTMatrix<T>& operator +=(const T& scalar);
     ZTMatrix<T>& operator -=(const T& scalar);
     ZTMatrix<T>& operator *=(const T& scalar);
 
-    ZTMatrix<T> operator +(const ZTMatrix& m);
-    ZTMatrix<T> operator -(const ZTMatrix& m);
-    ZTMatrix<T> operator *(const ZTMatrix& m);
-
     ZTMatrix<T>& operator +=(const ZTMatrix& m);
     ZTMatrix<T>& operator -=(const ZTMatrix& m);
     ZTMatrix<T>& operator *=(const ZTMatrix& m);
 
+    template <typename E>
+    ZTMatrix<T>& operator +=(const ZTMatrixExpression<T, E>& e);
+    template <typename E>
+    ZTMatrix<T>& operator -=(const ZTMatrixExpression<T, E>& e);
+
     ZTMatrix &operator =(const ZTMatrix& m);
+    ZTMatrix &operator =(ZTMatrix&& m) noexcept;
+    template <typename E>
+    ZTMatrix<T>& operator =(const ZTMatrixExpression<T, E>& e);
 
-    T& operator()(std::size_t row, std::size_t col);
+    T& operator()(std::size_t row, std::size_t col);             // one-based, checked
     const T& operator()(std::size_t row, std::size_t col) const;
 
-    T trace();
-    T trace(const ZTMatrix<T>& m);
+    T& at(std::size_t row, std::size_t col);                     // zero-based, always checked
+    const T& at(std::size_t row, std::size_t col) const;
+
+    T* operator [](std::size_t row);                             // zero-based row, unchecked: m[row][col]
+    const T* operator [](std::size_t row) const;
 
-    T norm();
-    T norm(const ZTMatrix<T>& m);
+    T& unsafe_get(std::size_t row, std::size_t col);             // zero-based, unchecked
+    const T& unsafe_get(std::size_t row, std::size_t col) const;
+
+    ZTLU<T> lu() const;              // LU factorization with partial pivoting, reusable for solves
+    ZTCholesky<T> cholesky() const;  // L * L^T of a symmetric positive definite matrix
+    ZTLDLT<T> ldlt() const;          // L * D * L^T of a symmetric matrix
+    ZTQR<T> qr() const;              // blocked Householder QR, Q kept implicit
+    ZTQR<T> tsqr() const;            // QR of a tall-skinny matrix over row blocks in parallel
+    ZTSymmetricEigen<T> symmetric_eigen(bool compute_vectors = true) const;  // eigenpairs of a symmetric matrix
+    ZTSVD<T> svd() const;                                // full singular value decomposition
+    ZTSVD<T> truncated_svd(std::size_t rank) const;      // leading rank components, randomized
+
+    T trace() const;
+    T trace(const ZTMatrix<T>& m) const;
+
+    T norm() const;
+    T norm(const ZTMatrix<T>& m) const;
     
     void valid_sqaure_matrix(const ZTMatrix<T>& m) const;
     void valid_sqaure_matrix(std::size_t rows, std::size_t cols) const;
      
     void valid_matrix_product(const ZTMatrix<T>& m) const;
-    void valid_matrix_add_minus(const ZTMatrix<T>& m) const;   
+    void valid_matrix_add_minus(const ZTMatrix<T>& m) const;
+    void valid_result_dimensions(std::size_t rows, std::size_t cols) const;
     void valid_subscript_dimensions(std::size_t rows, std::size_t cols) const;
+    void valid_index_dimensions(std::size_t row, std::size_t col) const;
 
 };
 
+template <typename T>
+void gemm(const T& alpha, const ZTMatrix<T>& a, const ZTMatrix<T>& b, const T& beta, ZTMatrix<T>& c);
+
+template <typename T>
+void gemv(const T& alpha, const ZTMatrix<T>& a, const ZTVector<T>& x, const T& beta, ZTVector<T>& y);
+template <typename T>
+void gemv_transposed(const T& alpha, const ZTMatrix<T>& a, const ZTVector<T>& x, const T& beta, ZTVector<T>& y);
+
+template <typename T>
+void gemv_batch(const T& alpha, const ZTMatrix<T>& a, const ZTMatrix<T>& x, const T& beta, ZTMatrix<T>& y); // one vector per row
+template <typename T>
+void gemv_batch(const T& alpha, const ZTMatrix<T>& a, const std::vector<ZTVector<T> >& x,
+                const T& beta, std::vector<ZTVector<T> >& y);
+
 #endif /* ZTMATRIX_H */
@@ -0,0 +1,527 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <utility>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define ZT_FILE_POSIX
+#endif
+
+#include "ZTError.h"
+#include "ZTMatrixFile.h"
+
+static_assert(sizeof(ZTFileHeader) == 64, "ZTFileHeader must be 64 bytes");
+
+/**
+ * zt_file_valid_header : checks that a header describes a matrix file this
+ *                        build can read and that the data fits in size bytes
+ *
+ * @param  ZTFileHeader header
+ * @param  std::uint64_t size bytes in the file
+ * @param  std::string path for the message
+ * @return void
+ *
+ */
+inline void zt_file_valid_header(const ZTFileHeader& header, std::uint64_t size, const std::string& path) {
+
+    std::ostringstream invalid_file;
+    if (size < sizeof(ZTFileHeader) || std::memcmp(header.magic, "ZTMATRIX", 8) != 0)
+    {
+        invalid_file << "File " << path << " is not a matrix file!.";
+        zt_raise<std::runtime_error>(invalid_file.str());
+    }
+    if (header.version > ZTMatrixWriter<double>::version || header.byte_order != 0x01020304u)
+    {
+        invalid_file << "File " << path << " has version " << header.version << " or a byte order this build cannot read!.";
+        zt_raise<std::runtime_error>(invalid_file.str());
+    }
+    const std::uint64_t alignment = header.alignment;
+    const std::uint64_t limit = std::uint64_t(-1);
+    const bool shaped = header.element_size != 0 && header.stride >= header.cols &&
+                        alignment != 0 && (alignment & (alignment - 1)) == 0 &&
+                        header.data_offset >= sizeof(ZTFileHeader) && header.data_offset % alignment == 0 &&
+                        (header.stride == 0 || header.rows <= limit / header.stride / header.element_size);
+    if (!shaped || size - std::min(size, header.data_offset) < header.rows * header.stride * header.element_size)
+    {
+        invalid_file << "File " << path << " header does not describe the " << size << " bytes of the file!.";
+        zt_raise<std::runtime_error>(invalid_file.str());
+    }
+
+}
+
+/**
+ * zt_file_header : reads the header of a matrix file without mapping it,
+ *                  to find the element type and shape before choosing T
+ *
+ * @param  std::string path
+ * @return ZTFileHeader header
+ *
+ */
+ZTFileHeader zt_file_header(const std::string& path) {
+
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file)
+    {
+        zt_raise<std::runtime_error>("File " + path + " cannot be opened for reading!.");
+    }
+    const std::uint64_t size = std::uint64_t(file.tellg());
+    ZTFileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(&header), std::streamsize(std::min<std::uint64_t>(size, sizeof(header))));
+    zt_file_valid_header(header, size, path);
+    return header;
+
+}
+
+/**
+ * Constructor : maps a whole file read-only
+ *
+ * @param  std::string path
+ *
+ */
+ZTFileMapping::ZTFileMapping(const std::string& path) : mapping_data(nullptr), mapping_size(0) {
+
+#ifdef ZT_FILE_POSIX
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        zt_raise<std::runtime_error>("File " + path + " cannot be opened for reading!.");
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0)
+    {
+        ::close(fd);
+        zt_raise<std::runtime_error>("File " + path + " cannot be inspected!.");
+    }
+    mapping_size = std::size_t(info.st_size);
+    if (mapping_size != 0)
+    {
+        void* p = ::mmap(nullptr, mapping_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED)
+        {
+            ::close(fd);
+            zt_raise<std::runtime_error>("File " + path + " cannot be mapped into memory!.");
+        }
+        mapping_data = static_cast<const unsigned char*>(p);
+    }
+    ::close(fd);
+#else
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file)
+    {
+        zt_raise<std::runtime_error>("File " + path + " cannot be opened for reading!.");
+    }
+    mapping_size = std::size_t(file.tellg());
+    fallback.resize(mapping_size);
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(fallback.data()), std::streamsize(mapping_size));
+    mapping_data = fallback.data();
+#endif
+
+}
+
+/**
+ * Move Constructor : takes over the mapping, leaving mv empty
+ *
+ * @param  ZTFileMapping mv
+ *
+ */
+ZTFileMapping::ZTFileMapping(ZTFileMapping&& mv) noexcept : mapping_data(mv.mapping_data),
+                                                            mapping_size(mv.mapping_size),
+                                                            fallback(std::move(mv.fallback)) {
+
+    mv.mapping_data = nullptr;
+    mv.mapping_size = 0;
+
+}
+
+/**
+ * Destructor : unmaps the file
+ *
+ */
+ZTFileMapping::~ZTFileMapping() {
+
+    release();
+
+}
+
+/**
+ * release : unmaps the file, the fallback buffer frees itself
+ *
+ * @param  nothing
+ * @return nothing
+ *
+ */
+void ZTFileMapping::release() noexcept {
+
+#ifdef ZT_FILE_POSIX
+    if (mapping_data != nullptr)
+    {
+        ::munmap(const_cast<unsigned char*>(mapping_data), mapping_size);
+    }
+#endif
+    mapping_data = nullptr;
+    mapping_size = 0;
+
+}
+
+/**
+ * data : gets the first byte of the file
+ *
+ * @param  nothing
+ * @return const unsigned char*
+ *
+ */
+const unsigned char* ZTFileMapping::data() const {
+
+    return mapping_data;
+
+}
+
+/**
+ * size : gets the size of the file in bytes
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+std::size_t ZTFileMapping::size() const {
+
+    return mapping_size;
+
+}
+
+/**
+ * Constructor : maps a matrix file of elements T
+ *
+ * @param  std::string path
+ *
+ */
+template <typename T>
+ZTMappedMatrix<T>::ZTMappedMatrix(const std::string& path) : mapping(path) {
+
+    std::memset(&file_header, 0, sizeof(file_header));
+    std::memcpy(&file_header, mapping.data(), std::min(mapping.size(), sizeof(file_header)));
+    zt_file_valid_header(file_header, mapping.size(), path);
+    if (file_header.type != std::uint32_t(ZTFileTraits<T>::type) || file_header.element_size != sizeof(T) ||
+        file_header.data_offset % alignof(T) != 0)
+    {
+        std::ostringstream invalid_type;
+        invalid_type << "File " << path << " holds elements of type " << file_header.type << " and size " << file_header.element_size << ", not " << ZTFileTraits<T>::type << "!.";
+        zt_raise<std::invalid_argument>(invalid_type.str());
+    }
+
+}
+
+/**
+ * header : gets the header of the file
+ *
+ * @param  nothing
+ * @return const ZTFileHeader&
+ *
+ */
+template <typename T>
+inline const ZTFileHeader& ZTMappedMatrix<T>::header() const {
+
+    return file_header;
+
+}
+
+/**
+ * get_matrix_rows : gets the number of rows
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTMappedMatrix<T>::get_matrix_rows() const {
+
+    return std::size_t(file_header.rows);
+
+}
+
+/**
+ * get_matrix_cols : gets the number of columns
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTMappedMatrix<T>::get_matrix_cols() const {
+
+    return std::size_t(file_header.cols);
+
+}
+
+/**
+ * ld : gets the distance between rows in elements
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTMappedMatrix<T>::ld() const {
+
+    return std::size_t(file_header.stride);
+
+}
+
+/**
+ * data : gets the first element of the mapped rows
+ *
+ * @param  nothing
+ * @return const T*
+ *
+ */
+template <typename T>
+inline const T* ZTMappedMatrix<T>::data() const {
+
+    return reinterpret_cast<const T*>(mapping.data() + file_header.data_offset);
+
+}
+
+/**
+ * view : read-only view of the mapped elements
+ *
+ * @param  nothing
+ * @return ZTMatrixView<const T> view
+ *
+ */
+template <typename T>
+ZTMatrixView<const T> ZTMappedMatrix<T>::view() const {
+
+    return ZTMatrixView<const T>(data(), get_matrix_rows(), get_matrix_cols(), ld());
+
+}
+
+/**
+ * to_matrix : copies the mapped elements into an owning matrix
+ *
+ * @param  nothing
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTMappedMatrix<T>::to_matrix() const {
+
+    return ZTMatrix<T>(view());
+
+}
+
+/**
+ * Constructor : creates or truncates the file and writes the header of a
+ *               rows x cols matrix
+ *
+ * @param  std::string path
+ * @param  std::size_t rows
+ * @param  std::size_t cols
+ *
+ */
+template <typename T>
+ZTMatrixWriter<T>::ZTMatrixWriter(const std::string& path, std::size_t rows, std::size_t cols) :
+                                  file(path, std::ios::binary | std::ios::trunc),
+                                  file_path(path),
+                                  matrix_rows(rows),
+                                  matrix_cols(cols),
+                                  row_stride((cols * sizeof(T) + alignment - 1) / alignment * alignment / sizeof(T)),
+                                  rows_written(0),
+                                  row_buffer(row_stride, T(0)) {
+
+    if (!file)
+    {
+        zt_raise<std::runtime_error>("File " + path + " cannot be opened for writing!.");
+    }
+    ZTFileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, "ZTMATRIX", 8);
+    header.version = version;
+    header.byte_order = 0x01020304u;
+    header.type = ZTFileTraits<T>::type;
+    header.element_size = sizeof(T);
+    header.rows = rows;
+    header.cols = cols;
+    header.stride = row_stride;
+    header.alignment = alignment;
+    header.data_offset = (sizeof(header) + alignment - 1) / alignment * alignment;
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    const char zeros[alignment] = {};
+    file.write(zeros, std::streamsize(header.data_offset - sizeof(header)));
+    valid_stream();
+
+}
+
+/**
+ * Destructor : closes the file, a short file is left as it is
+ *
+ */
+template <typename T>
+ZTMatrixWriter<T>::~ZTMatrixWriter() {
+
+    if (file.is_open())
+    {
+        file.close();
+    }
+
+}
+
+/**
+ * write_row : appends the next row, padded with zeros to the row stride.
+ *             The tail of the row buffer past cols is never written, so it
+ *             is the padding
+ *
+ * @param  ZTVectorView<const T> row
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTMatrixWriter<T>::write_row(const ZTVectorView<const T>& row) {
+
+    valid_row_size(row.size());
+    if (row.stride() == 1)
+    {
+        file.write(reinterpret_cast<const char*>(row.data()), std::streamsize(matrix_cols * sizeof(T)));
+    }
+    else
+    {
+        for (std::size_t j = 0; j < matrix_cols; ++j)
+        {
+            row_buffer[j] = row[j];
+        }
+        file.write(reinterpret_cast<const char*>(row_buffer.data()), std::streamsize(matrix_cols * sizeof(T)));
+    }
+    file.write(reinterpret_cast<const char*>(row_buffer.data() + matrix_cols), std::streamsize((row_stride - matrix_cols) * sizeof(T)));
+    ++rows_written;
+    valid_stream();
+
+}
+
+/**
+ * write_rows : appends every row of a block
+ *
+ * @param  ZTMatrixView<const T> m
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTMatrixWriter<T>::write_rows(const ZTMatrixView<const T>& m) {
+
+    for (std::size_t i = 0; i < m.get_matrix_rows(); ++i)
+    {
+        write_row(ZTVectorView<const T>(m.data(), m.get_matrix_cols(), m.stride(), i * m.ld()));
+    }
+
+}
+
+/**
+ * close : checks that every row was written and flushes the file
+ *
+ * @param  nothing
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTMatrixWriter<T>::close() {
+
+    if (rows_written != matrix_rows)
+    {
+        std::ostringstream invalid_rows;
+        invalid_rows << "File " << file_path << " received " << rows_written << " of its " << matrix_rows << " rows!.";
+        zt_raise<std::logic_error>(invalid_rows.str());
+    }
+    file.close();
+    if (file.fail())
+    {
+        zt_raise<std::runtime_error>("File " + file_path + " could not be written!.");
+    }
+
+}
+
+/**
+ * save : writes a matrix or a block of one to a file, row by row
+ *
+ * @param  std::string path
+ * @param  ZTMatrixView<const T> m
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTMatrixWriter<T>::save(const std::string& path, const ZTMatrixView<const T>& m) {
+
+    ZTMatrixWriter<T> writer(path, m.get_matrix_rows(), m.get_matrix_cols());
+    writer.write_rows(m);
+    writer.close();
+
+}
+
+/**
+ * valid_stream : checks that the writes so far succeeded
+ *
+ * @param  nothing
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTMatrixWriter<T>::valid_stream() const {
+
+    if (!file)
+    {
+        zt_raise<std::runtime_error>("File " + file_path + " could not be written!.");
+    }
+
+}
+
+/**
+ * valid_row_size : checks the size of a row and that the file expects more
+ *
+ * @param  std::size_t size
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTMatrixWriter<T>::valid_row_size(std::size_t size) const {
+
+    if (size != matrix_cols || rows_written == matrix_rows || !file.is_open())
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Row " << rows_written << " of size " << size << " does not fit a " << matrix_rows << "x" << matrix_cols << " matrix file!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+
+}
@@ -0,0 +1,183 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ZTMATRIXFILE_H
+#define ZTMATRIXFILE_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+
+#include "ZTAlignedAllocator.h"
+#include "ZTHalf.h"
+#include "ZTMatrix.h"
+#include "ZTMatrixView.h"
+
+enum ZTFileType {
+    ZT_FILE_FLOAT64 = 1,
+    ZT_FILE_FLOAT32 = 2,
+    ZT_FILE_FLOAT16 = 3,   // ZTHalf
+    ZT_FILE_BFLOAT16 = 4,  // ZTBFloat16
+    ZT_FILE_INT8 = 5,
+    ZT_FILE_UINT8 = 6,
+    ZT_FILE_INT32 = 7,
+    ZT_FILE_INT64 = 8
+};
+
+/*
+ * ZTFileTraits : on-disk element type of T, specialized for every type a
+ *                matrix file can hold.
+ */
+template <typename T>
+struct ZTFileTraits;
+
+template <> struct ZTFileTraits<double> { static constexpr ZTFileType type = ZT_FILE_FLOAT64; };
+template <> struct ZTFileTraits<float> { static constexpr ZTFileType type = ZT_FILE_FLOAT32; };
+template <> struct ZTFileTraits<ZTHalf> { static constexpr ZTFileType type = ZT_FILE_FLOAT16; };
+template <> struct ZTFileTraits<ZTBFloat16> { static constexpr ZTFileType type = ZT_FILE_BFLOAT16; };
+template <> struct ZTFileTraits<std::int8_t> { static constexpr ZTFileType type = ZT_FILE_INT8; };
+template <> struct ZTFileTraits<std::uint8_t> { static constexpr ZTFileType type = ZT_FILE_UINT8; };
+template <> struct ZTFileTraits<std::int32_t> { static constexpr ZTFileType type = ZT_FILE_INT32; };
+template <> struct ZTFileTraits<std::int64_t> { static constexpr ZTFileType type = ZT_FILE_INT64; };
+
+/*
+ * ZTFileHeader : the first 64 bytes of a matrix file, in the byte order of
+ *                the machine that wrote it (byte_order reads 0x01020304 on a
+ *                machine of the same order). Row i starts data_offset +
+ *                i * stride * element_size bytes into the file; the offset
+ *                and every row are aligned to alignment bytes, and the
+ *                padding at the end of a row is zero.
+ */
+struct ZTFileHeader {
+    char magic[8];               // "ZTMATRIX"
+    std::uint32_t version;       // ZTMatrixWriter::version at the time of writing
+    std::uint32_t byte_order;    // 0x01020304
+    std::uint32_t type;          // ZTFileType of the elements
+    std::uint32_t element_size;  // bytes per element
+    std::uint64_t rows;
+    std::uint64_t cols;
+    std::uint64_t stride;        // elements between rows, at least cols
+    std::uint64_t alignment;     // bytes, a power of two
+    std::uint64_t data_offset;   // bytes from the start of the file to row 0
+};
+
+ZTFileHeader zt_file_header(const std::string& path);  // reads and checks the header only
+
+/*
+ * ZTFileMapping : read-only mapping of a whole file, unmapped on destruction.
+ *                 On POSIX systems the file is mmap-ed and pages are read on
+ *                 first touch; elsewhere it is read into aligned memory.
+ */
+class ZTFileMapping {
+
+private:
+    const unsigned char* mapping_data;
+    std::size_t mapping_size;
+    std::vector<unsigned char, ZTAlignedAllocator<unsigned char> > fallback;  // contents when mmap is unavailable
+
+    void release() noexcept;
+
+public:
+    explicit ZTFileMapping(const std::string& path);
+    ZTFileMapping(const ZTFileMapping& cp) = delete;
+    ZTFileMapping(ZTFileMapping&& mv) noexcept;
+    ZTFileMapping& operator =(const ZTFileMapping& rhs) = delete;
+    ~ZTFileMapping();
+
+    const unsigned char* data() const;
+    std::size_t size() const;
+
+};
+
+/*
+ * ZTMappedMatrix : matrix file mapped into memory without copying. The
+ *                  elements are read-only and reached through view(), which
+ *                  has the row stride of the file; pages are only read from
+ *                  disk when they are touched. ZTMatrix always owns its
+ *                  storage, so to_matrix() is the one operation that copies.
+ *                  Views must not outlive the mapped matrix.
+ */
+template <typename T>
+class ZTMappedMatrix {
+
+private:
+    ZTFileMapping mapping;
+    ZTFileHeader file_header;
+
+public:
+    explicit ZTMappedMatrix(const std::string& path);
+
+    const ZTFileHeader& header() const;
+    std::size_t get_matrix_rows() const;
+    std::size_t get_matrix_cols() const;
+    std::size_t ld() const;
+    const T* data() const;
+
+    ZTMatrixView<const T> view() const;
+    ZTMatrix<T> to_matrix() const;  // owning copy
+
+};
+
+/*
+ * ZTMatrixWriter : streams a matrix file one row at a time, so saving never
+ *                  holds more than a row beyond the caller's own data. The
+ *                  header is written first from the shape given up front and
+ *                  close() checks that exactly that many rows arrived; a
+ *                  writer destroyed before close() leaves a truncated file.
+ */
+template <typename T>
+class ZTMatrixWriter {
+
+private:
+    std::ofstream file;
+    std::string file_path;
+    std::size_t matrix_rows;
+    std::size_t matrix_cols;
+    std::size_t row_stride;
+    std::size_t rows_written;
+    std::vector<T> row_buffer;  // a strided row on its way to the file, zeros past cols
+
+    void valid_stream() const;
+    void valid_row_size(std::size_t size) const;
+
+public:
+    static constexpr std::uint32_t version = 1;
+    static constexpr std::size_t alignment = 64;
+
+    ZTMatrixWriter(const std::string& path, std::size_t rows, std::size_t cols);
+    ZTMatrixWriter(const ZTMatrixWriter& cp) = delete;
+    ZTMatrixWriter& operator =(const ZTMatrixWriter& rhs) = delete;
+    ~ZTMatrixWriter();
+
+    void write_row(const ZTVectorView<const T>& row);
+    void write_rows(const ZTMatrixView<const T>& m);
+    void close();
+
+    static void save(const std::string& path, const ZTMatrixView<const T>& m);
+
+};
+
+#endif /* ZTMATRIXFILE_H */
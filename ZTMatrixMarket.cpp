@@ -0,0 +1,557 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <charconv>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <stdexcept>
+#include <functional>
+
+#include "ZTError.h"
+#include "ZTThreadPool.h"
+#include "ZTMatrixFile.h"
+#include "ZTMatrixMarket.h"
+
+/**
+ * zt_market_blank : whether a character separates tokens on a line
+ *
+ * @param  char c
+ * @return bool
+ *
+ */
+inline bool zt_market_blank(char c) {
+
+    return c == ' ' || c == '\t' || c == '\r';
+
+}
+
+/**
+ * zt_market_word : next whitespace separated word of a line, lower-cased
+ *
+ * @param  const char*& p advanced past the word
+ * @param  const char* last end of the line
+ * @return std::string word, empty at the end of the line
+ *
+ */
+inline std::string zt_market_word(const char*& p, const char* last) {
+
+    while (p < last && zt_market_blank(*p))
+    {
+        ++p;
+    }
+    std::string word;
+    while (p < last && !zt_market_blank(*p))
+    {
+        word.push_back(char(*p >= 'A' && *p <= 'Z' ? *p - 'A' + 'a' : *p));
+        ++p;
+    }
+    return word;
+
+}
+
+/**
+ * zt_market_number : parses a number at p, skipping blanks before it
+ *
+ * @param  const char*& p advanced past the number
+ * @param  const char* last
+ * @param  U& value
+ * @return bool whether a number was found
+ *
+ */
+template <typename U>
+inline bool zt_market_number(const char*& p, const char* last, U& value) {
+
+    while (p < last && zt_market_blank(*p))
+    {
+        ++p;
+    }
+    if (p < last && *p == '+')
+    {
+        ++p;  // from_chars takes no explicit plus sign
+    }
+    const std::from_chars_result parsed = std::from_chars(p, last, value);
+    if (parsed.ec != std::errc() || parsed.ptr == p)
+    {
+        return false;
+    }
+    p = parsed.ptr;
+    return true;
+
+}
+
+/**
+ * zt_market_read_header : parses the banner, comments and size line at the
+ *                         start of a Matrix Market file
+ *
+ * @param  const char* first start of the file
+ * @param  const char* last end of the file
+ * @param  std::string path for the messages
+ * @return ZTMarketHeader header
+ *
+ */
+ZTMarketHeader zt_market_read_header(const char* first, const char* last, const std::string& path) {
+
+    std::ostringstream invalid_file;
+    const char* line_end = std::find(first, last, '\n');
+    const char* p = first;
+    const std::string banner = zt_market_word(p, line_end);
+    const std::string object = zt_market_word(p, line_end);
+    const std::string format = zt_market_word(p, line_end);
+    const std::string field = zt_market_word(p, line_end);
+    const std::string symmetry = zt_market_word(p, line_end);
+    if (banner != "%%matrixmarket" || object != "matrix")
+    {
+        invalid_file << "File " << path << " is not a Matrix Market matrix file!.";
+        zt_raise<std::runtime_error>(invalid_file.str());
+    }
+
+    ZTMarketHeader header;
+    header.format = format == "array" ? ZT_MARKET_ARRAY : ZT_MARKET_COORDINATE;
+    header.field = field == "pattern" ? ZT_MARKET_PATTERN : field == "integer" ? ZT_MARKET_INTEGER : ZT_MARKET_REAL;
+    header.symmetry = symmetry == "symmetric" ? ZT_MARKET_SYMMETRIC :
+                      symmetry == "skew-symmetric" ? ZT_MARKET_SKEW_SYMMETRIC : ZT_MARKET_GENERAL;
+    const bool known = (format == "array" || format == "coordinate") &&
+                       (field == "real" || field == "double" || field == "integer" || field == "pattern") &&
+                       (symmetry == "general" || symmetry == "symmetric" || symmetry == "skew-symmetric") &&
+                       !(header.format == ZT_MARKET_ARRAY && header.field == ZT_MARKET_PATTERN);
+    if (!known)
+    {
+        invalid_file << "File " << path << " is a " << format << " " << field << " " << symmetry << " matrix, which this reader does not support!.";
+        zt_raise<std::runtime_error>(invalid_file.str());
+    }
+
+    p = line_end;
+    while (p < last)
+    {
+        p += 1;
+        line_end = std::find(p, last, '\n');
+        const char* q = p;
+        while (q < line_end && zt_market_blank(*q))
+        {
+            ++q;
+        }
+        if (q < line_end && *q != '%')
+        {
+            break;
+        }
+        p = line_end;
+    }
+    const bool sized = zt_market_number(p, line_end, header.rows) && zt_market_number(p, line_end, header.cols) &&
+                       (header.format == ZT_MARKET_ARRAY || zt_market_number(p, line_end, header.entries)) &&
+                       zt_market_word(p, line_end).empty();
+    const bool square = header.rows == header.cols || header.symmetry == ZT_MARKET_GENERAL;
+    if (!sized || !square)
+    {
+        invalid_file << "File " << path << " has no valid size line after its banner!.";
+        zt_raise<std::runtime_error>(invalid_file.str());
+    }
+    if (header.format == ZT_MARKET_ARRAY)
+    {
+        const std::size_t n = header.rows;
+        header.entries = header.symmetry == ZT_MARKET_GENERAL ? header.rows * header.cols :
+                         header.symmetry == ZT_MARKET_SYMMETRIC ? n * (n + 1) / 2 : n * (n - std::min<std::size_t>(n, 1)) / 2;
+    }
+    header.data_offset = std::size_t(std::min(line_end + 1, last) - first);
+    return header;
+
+}
+
+/**
+ * zt_market_header : reads the header of a Matrix Market file, to find its
+ *                    kind and shape before reading it
+ *
+ * @param  std::string path
+ * @return ZTMarketHeader header
+ *
+ */
+ZTMarketHeader zt_market_header(const std::string& path) {
+
+    const ZTFileMapping mapping(path);
+    const char* first = reinterpret_cast<const char*>(mapping.data());
+    return zt_market_read_header(first, first + mapping.size(), path);
+
+}
+
+/**
+ * parse_chunk : parses the entries of one chunk of lines, stopping at the
+ *               first malformed one
+ *
+ * @param  ZTMarketHeader header
+ * @param  ZTMarketChunk chunk
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTMatrixMarket<T>::parse_chunk(const ZTMarketHeader& header, ZTMarketChunk& chunk) {
+
+    const bool coordinate = header.format == ZT_MARKET_COORDINATE;
+    const bool pattern = header.field == ZT_MARKET_PATTERN;
+    const char* p = chunk.first;
+    const char* last = chunk.last;
+    while (p < last)
+    {
+        if (zt_market_blank(*p) || *p == '\n')
+        {
+            ++p;
+            continue;
+        }
+        const char* line = p;
+        if (*p == '%')
+        {
+            p = std::find(p, last, '\n');
+            continue;
+        }
+        std::size_t row = 0, col = 0;
+        parse_type value = parse_type(1);
+        bool parsed = true;
+        if (coordinate)
+        {
+            parsed = zt_market_number(p, last, row) && zt_market_number(p, last, col) &&
+                     row >= 1 && row <= header.rows && col >= 1 && col <= header.cols;
+        }
+        if (parsed && !pattern)
+        {
+            parsed = zt_market_number(p, last, value);
+        }
+        while (p < last && zt_market_blank(*p))
+        {
+            ++p;
+        }
+        if (!parsed || (p < last && *p != '\n'))
+        {
+            chunk.error = line;
+            return;
+        }
+        if (coordinate)
+        {
+            chunk.rows.push_back(row - 1);
+            chunk.cols.push_back(col - 1);
+        }
+        chunk.values.push_back(T(value));
+    }
+
+}
+
+/**
+ * parse : splits the entries of a mapped file at line boundaries and parses
+ *         the chunks on the thread pool
+ *
+ * @param  std::string path for the messages
+ * @param  ZTMarketHeader header
+ * @param  const char* first start of the file
+ * @param  const char* last end of the file
+ * @return std::vector<ZTMarketChunk> chunks in file order
+ *
+ */
+template <typename T>
+std::vector<typename ZTMatrixMarket<T>::ZTMarketChunk>
+ZTMatrixMarket<T>::parse(const std::string& path, const ZTMarketHeader& header, const char* first, const char* last) {
+
+    const std::size_t bytes = chunk_bytes;
+    std::vector<ZTMarketChunk> chunks;
+    for (const char* p = first + header.data_offset; p < last; )
+    {
+        const char* end = last - p > std::ptrdiff_t(bytes) ? std::find(p + bytes, last, '\n') : last;
+        ZTMarketChunk chunk;
+        chunk.first = p;
+        chunk.last = end;
+        chunk.error = nullptr;
+        chunks.push_back(std::move(chunk));
+        p = end;
+    }
+    ZTThreadPool::instance().parallel_for(chunks.size(), [&](std::size_t c) {
+        parse_chunk(header, chunks[c]);
+    });
+
+    std::size_t entries = 0;
+    for (const ZTMarketChunk& chunk : chunks)
+    {
+        if (chunk.error != nullptr)
+        {
+            std::ostringstream invalid_entry;
+            invalid_entry << "File " << path << " has a malformed entry at byte " << (chunk.error - first) << "!.";
+            zt_raise<std::runtime_error>(invalid_entry.str());
+        }
+        entries += chunk.values.size();
+    }
+    if (entries != header.entries)
+    {
+        std::ostringstream invalid_entries;
+        invalid_entries << "File " << path << " holds " << entries << " of its " << header.entries << " entries!.";
+        zt_raise<std::runtime_error>(invalid_entries.str());
+    }
+    return chunks;
+
+}
+
+/**
+ * write_chunks : formats count chunks of text on the thread pool, a batch
+ *                at a time, and writes them in order
+ *
+ * @param  std::ofstream file
+ * @param  std::string path for the messages
+ * @param  std::size_t count
+ * @param  std::function format(c, text) appends chunk c to text
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTMatrixMarket<T>::write_chunks(std::ofstream& file, const std::string& path, std::size_t count,
+                                     const std::function<void(std::size_t, std::string&)>& format) {
+
+    ZTThreadPool& pool = ZTThreadPool::instance();
+    const std::size_t batch = 4 * pool.get_num_threads();
+    std::vector<std::string> texts(batch);
+    for (std::size_t done = 0; done < count; done += batch)
+    {
+        const std::size_t size = std::min(batch, count - done);
+        pool.parallel_for(size, [&](std::size_t b) {
+            texts[b].clear();
+            format(done + b, texts[b]);
+        });
+        for (std::size_t b = 0; b < size; ++b)
+        {
+            file.write(texts[b].data(), std::streamsize(texts[b].size()));
+        }
+        if (!file)
+        {
+            zt_raise<std::runtime_error>("File " + path + " could not be written!.");
+        }
+    }
+
+}
+
+/**
+ * read_dense : reads an array or coordinate file into a dense matrix
+ *
+ * @param  std::string path
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTMatrixMarket<T>::read_dense(const std::string& path) {
+
+    const ZTFileMapping mapping(path);
+    const char* first = reinterpret_cast<const char*>(mapping.data());
+    const char* last = first + mapping.size();
+    const ZTMarketHeader header = zt_market_read_header(first, last, path);
+    const std::vector<ZTMarketChunk> chunks = parse(path, header, first, last);
+
+    ZTMatrix<T> result(header.rows, header.cols, T(0));
+    T* c = result.data();
+    const std::size_t ldc = result.stride();
+    const bool mirrored = header.symmetry != ZT_MARKET_GENERAL;
+    const T sign = header.symmetry == ZT_MARKET_SKEW_SYMMETRIC ? T(-1) : T(1);
+    if (header.format == ZT_MARKET_COORDINATE)
+    {
+        for (const ZTMarketChunk& chunk : chunks)
+        {
+            for (std::size_t k = 0; k < chunk.values.size(); ++k)
+            {
+                const std::size_t i = chunk.rows[k], j = chunk.cols[k];
+                c[i * ldc + j] = T(c[i * ldc + j] + chunk.values[k]);
+                if (mirrored && i != j)
+                {
+                    c[j * ldc + i] = T(c[j * ldc + i] + sign * chunk.values[k]);
+                }
+            }
+        }
+        return result;
+    }
+
+    // column j of an array file starts at row skip(j): all rows when general,
+    // the lower triangle when symmetric, strictly below the diagonal when skew
+    const std::size_t rows = header.rows;
+    const std::size_t below = header.symmetry == ZT_MARKET_SKEW_SYMMETRIC ? 1 : 0;
+    auto skip = [&](std::size_t j) { return mirrored ? j + below : 0; };
+    std::vector<std::size_t> starts(chunks.size() + 1, 0);
+    for (std::size_t k = 0; k < chunks.size(); ++k)
+    {
+        starts[k + 1] = starts[k] + chunks[k].values.size();
+    }
+    ZTThreadPool::instance().parallel_for(chunks.size(), [&](std::size_t k) {
+        std::size_t i = 0, j = 0, before = starts[k];
+        while (j < header.cols && before >= rows - std::min(rows, skip(j)))
+        {
+            before -= rows - std::min(rows, skip(j));
+            ++j;
+        }
+        i = skip(j) + before;
+        for (const T& value : chunks[k].values)
+        {
+            c[i * ldc + j] = value;
+            if (mirrored && i != j)
+            {
+                c[j * ldc + i] = T(sign * value);
+            }
+            if (++i == rows)
+            {
+                ++j;
+                i = skip(j);
+            }
+        }
+    });
+    return result;
+
+}
+
+/**
+ * read_sparse : reads a coordinate or array file into a sparse matrix,
+ *               duplicate coordinates summed
+ *
+ * @param  std::string path
+ * @param  ZTSparseFormat format of the result
+ * @return ZTSparseMatrix<T> result
+ *
+ */
+template <typename T>
+ZTSparseMatrix<T> ZTMatrixMarket<T>::read_sparse(const std::string& path, ZTSparseFormat format) {
+
+    const ZTFileMapping mapping(path);
+    const char* first = reinterpret_cast<const char*>(mapping.data());
+    const char* last = first + mapping.size();
+    const ZTMarketHeader header = zt_market_read_header(first, last, path);
+    if (header.format == ZT_MARKET_ARRAY)
+    {
+        return ZTSparseMatrix<T>(read_dense(path).view(), format);
+    }
+    const std::vector<ZTMarketChunk> chunks = parse(path, header, first, last);
+
+    const bool mirrored = header.symmetry != ZT_MARKET_GENERAL;
+    const T sign = header.symmetry == ZT_MARKET_SKEW_SYMMETRIC ? T(-1) : T(1);
+    std::vector<std::size_t> row_indices, col_indices;
+    std::vector<T> values;
+    row_indices.reserve(header.entries * (mirrored ? 2 : 1));
+    col_indices.reserve(row_indices.capacity());
+    values.reserve(row_indices.capacity());
+    for (const ZTMarketChunk& chunk : chunks)
+    {
+        row_indices.insert(row_indices.end(), chunk.rows.begin(), chunk.rows.end());
+        col_indices.insert(col_indices.end(), chunk.cols.begin(), chunk.cols.end());
+        values.insert(values.end(), chunk.values.begin(), chunk.values.end());
+        for (std::size_t k = 0; mirrored && k < chunk.values.size(); ++k)
+        {
+            if (chunk.rows[k] != chunk.cols[k])
+            {
+                row_indices.push_back(chunk.cols[k]);
+                col_indices.push_back(chunk.rows[k]);
+                values.push_back(T(sign * chunk.values[k]));
+            }
+        }
+    }
+    return ZTSparseMatrix<T>(header.rows, header.cols, row_indices, col_indices, values, format);
+
+}
+
+/**
+ * write : writes a dense matrix or a block of one as a general array
+ *
+ * @param  std::string path
+ * @param  ZTMatrixView<const T> m
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTMatrixMarket<T>::write(const std::string& path, const ZTMatrixView<const T>& m) {
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        zt_raise<std::runtime_error>("File " + path + " cannot be opened for writing!.");
+    }
+    const std::size_t rows = m.get_matrix_rows(), cols = m.get_matrix_cols();
+    const std::size_t entries = chunk_entries;
+    file << "%%MatrixMarket matrix array " << (std::is_integral<T>::value ? "integer" : "real") << " general\n"
+         << rows << " " << cols << "\n";
+    write_chunks(file, path, (rows * cols + entries - 1) / entries, [&](std::size_t c, std::string& text) {
+        char number[64];
+        for (std::size_t k = c * entries; k < std::min(rows * cols, (c + 1) * entries); ++k)
+        {
+            const std::to_chars_result printed = std::to_chars(number, number + sizeof(number), parse_type(m.unsafe_get(k % rows, k / rows)));
+            text.append(number, printed.ptr);
+            text.push_back('\n');
+        }
+    });
+    file.close();
+    if (file.fail())
+    {
+        zt_raise<std::runtime_error>("File " + path + " could not be written!.");
+    }
+
+}
+
+/**
+ * write : writes the stored entries of a sparse matrix as general
+ *         coordinates, explicit zeros included
+ *
+ * @param  std::string path
+ * @param  ZTSparseMatrix<T> m
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTMatrixMarket<T>::write(const std::string& path, const ZTSparseMatrix<T>& m) {
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        zt_raise<std::runtime_error>("File " + path + " cannot be opened for writing!.");
+    }
+    const std::size_t nonzeros = m.nonzeros();
+    const std::size_t entries = chunk_entries;
+    const std::vector<std::size_t>& pointers = m.pointers();
+    const bool csr = m.format() == ZT_SPARSE_CSR;
+    file << "%%MatrixMarket matrix coordinate " << (std::is_integral<T>::value ? "integer" : "real") << " general\n"
+         << m.get_matrix_rows() << " " << m.get_matrix_cols() << " " << nonzeros << "\n";
+    write_chunks(file, path, (nonzeros + entries - 1) / entries, [&](std::size_t c, std::string& text) {
+        char number[64];
+        const std::size_t k0 = c * entries;
+        std::size_t slice = std::size_t(std::upper_bound(pointers.begin(), pointers.end(), k0) - pointers.begin()) - 1;
+        for (std::size_t k = k0; k < std::min(nonzeros, k0 + entries); ++k)
+        {
+            while (pointers[slice + 1] <= k)
+            {
+                ++slice;
+            }
+            const std::size_t row = csr ? slice : m.indices()[k];
+            const std::size_t col = csr ? m.indices()[k] : slice;
+            text.append(number, std::to_chars(number, number + sizeof(number), row + 1).ptr);
+            text.push_back(' ');
+            text.append(number, std::to_chars(number, number + sizeof(number), col + 1).ptr);
+            text.push_back(' ');
+            text.append(number, std::to_chars(number, number + sizeof(number), parse_type(m.values()[k])).ptr);
+            text.push_back('\n');
+        }
+    });
+    file.close();
+    if (file.fail())
+    {
+        zt_raise<std::runtime_error>("File " + path + " could not be written!.");
+    }
+
+}
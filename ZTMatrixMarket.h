@@ -0,0 +1,141 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ZTMATRIXMARKET_H
+#define ZTMATRIXMARKET_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <fstream>
+#include <functional>
+#include <type_traits>
+
+#include "ZTHalf.h"
+#include "ZTMatrix.h"
+#include "ZTMatrixView.h"
+#include "ZTSparseMatrix.h"
+
+enum ZTMarketFormat {
+    ZT_MARKET_COORDINATE = 0,  // one "row col value" line per stored entry
+    ZT_MARKET_ARRAY = 1        // every entry in column-major order, one per line
+};
+
+enum ZTMarketField {
+    ZT_MARKET_REAL = 0,
+    ZT_MARKET_INTEGER = 1,
+    ZT_MARKET_PATTERN = 2      // coordinates only, every value is one
+};
+
+enum ZTMarketSymmetry {
+    ZT_MARKET_GENERAL = 0,
+    ZT_MARKET_SYMMETRIC = 1,       // lower triangle stored, mirrored on reading
+    ZT_MARKET_SKEW_SYMMETRIC = 2   // strictly lower triangle stored, mirrored negated
+};
+
+/*
+ * ZTMarketHeader : banner and size line of a Matrix Market file. Entries are
+ *                  the lines the file holds, before any symmetric mirroring;
+ *                  data_offset is the byte at which the first of them starts.
+ */
+struct ZTMarketHeader {
+    ZTMarketFormat format;
+    ZTMarketField field;
+    ZTMarketSymmetry symmetry;
+    std::size_t rows;
+    std::size_t cols;
+    std::size_t entries;
+    std::size_t data_offset;
+};
+
+ZTMarketHeader zt_market_header(const std::string& path);  // reads and checks the header only
+
+/*
+ * ZTMarketTraits : type an element of T is parsed into and printed from.
+ *                  Integers go through long long, float and the 16-bit
+ *                  storage types through float, everything else through
+ *                  double; std::from_chars and std::to_chars give correctly
+ *                  rounded parsing and the shortest text that reads back
+ *                  to the same value.
+ */
+template <typename T>
+struct ZTMarketTraits {
+    typedef typename std::conditional<std::is_integral<T>::value, long long, double>::type type;
+};
+
+template <> struct ZTMarketTraits<float> { typedef float type; };
+template <> struct ZTMarketTraits<ZTHalf> { typedef float type; };
+template <> struct ZTMarketTraits<ZTBFloat16> { typedef float type; };
+
+/*
+ * ZTMatrixMarket : reader and writer for the real, integer and pattern
+ *                  fields of the Matrix Market exchange format, general,
+ *                  symmetric or skew-symmetric. Complex files are rejected.
+ *
+ *                  The file is mapped into memory and the entries after the
+ *                  header are split at line boundaries into chunks that the
+ *                  thread pool parses in parallel, each into its own list of
+ *                  entries. Array entries are then placed chunk by chunk in
+ *                  parallel, as the position of every entry follows from the
+ *                  count before it. Dense reads take array files, and
+ *                  coordinate files scattered into zeros with duplicates
+ *                  summed; sparse reads take coordinate files and the
+ *                  nonzeros of array files. Writers format chunks of entries
+ *                  in parallel and write them in order: dense matrices as
+ *                  general arrays, sparse matrices as general coordinates.
+ */
+template <typename T>
+class ZTMatrixMarket {
+
+private:
+    typedef typename ZTMarketTraits<T>::type parse_type;
+
+    struct ZTMarketChunk {
+        const char* first;
+        const char* last;
+        std::vector<std::size_t> rows;  // zero-based, coordinate files only
+        std::vector<std::size_t> cols;
+        std::vector<T> values;
+        const char* error;              // first malformed entry, or nullptr
+    };
+
+    static constexpr std::size_t chunk_bytes = 1 << 20;     // text parsed by one task
+    static constexpr std::size_t chunk_entries = 64 * 1024; // entries formatted by one task
+
+    static std::vector<ZTMarketChunk> parse(const std::string& path, const ZTMarketHeader& header,
+                                            const char* first, const char* last);
+    static void parse_chunk(const ZTMarketHeader& header, ZTMarketChunk& chunk);
+    static void write_chunks(std::ofstream& file, const std::string& path, std::size_t count,
+                             const std::function<void(std::size_t, std::string&)>& format);
+
+public:
+    static ZTMatrix<T> read_dense(const std::string& path);
+    static ZTSparseMatrix<T> read_sparse(const std::string& path, ZTSparseFormat format = ZT_SPARSE_CSR);
+
+    static void write(const std::string& path, const ZTMatrixView<const T>& m);  // general array
+    static void write(const std::string& path, const ZTSparseMatrix<T>& m);      // general coordinates
+
+};
+
+#endif /* ZTMATRIXMARKET_H */
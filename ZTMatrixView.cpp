@@ -0,0 +1,1168 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <functional>
+
+#include "ZTError.h"
+#include "ZTGemm.h"
+#include "ZTGemv.h"
+#include "ZTMatrixView.h"
+#include "ZTExpression.h"
+
+/**
+ * Constructor : Constructs a view of a rows by cols block of a caller-owned buffer
+ *
+ * @param  T* data buffer
+ * @param  std::size_t rows number of rows
+ * @param  std::size_t cols number of columns
+ * @param  std::size_t ld distance between consecutive rows
+ * @param  std::size_t stride distance between consecutive columns
+ * @param  std::size_t offset position of the first element in the buffer
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTMatrixView<T>::ZTMatrixView(T* data, std::size_t rows, std::size_t cols, std::size_t ld, std::size_t stride, std::size_t offset) :
+                                                view_data(data + offset),
+                                                view_rows(rows),
+                                                view_cols(cols),
+                                                view_ld(ld),
+                                                view_stride(stride) {
+
+}
+
+/**
+ * Constructor : Constructs a view of all the elements of a ZTMatrix
+ *
+ * @param  ZTMatrix<T> m
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTMatrixView<T>::ZTMatrixView(ZTMatrix<value_type>& m) :
+                                                view_data(m.data()),
+                                                view_rows(m.get_matrix_rows()),
+                                                view_cols(m.get_matrix_cols()),
+                                                view_ld(m.stride()),
+                                                view_stride(1) {
+
+}
+
+/**
+ * Constructor : Constructs a read-only view of all the elements of a ZTMatrix
+ *
+ * @param  ZTMatrix<T> m
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTMatrixView<T>::ZTMatrixView(const ZTMatrix<value_type>& m) :
+                                                view_data(m.data()),
+                                                view_rows(m.get_matrix_rows()),
+                                                view_cols(m.get_matrix_cols()),
+                                                view_ld(m.stride()),
+                                                view_stride(1) {
+
+}
+
+/**
+ * Converting Constructor : a read-only view of the elements of a writable view
+ *
+ * @param  ZTMatrixView<U> cp view to be copied
+ * @return nothing
+ *
+ */
+template <typename T>
+template <typename U, typename>
+ZTMatrixView<T>::ZTMatrixView(const ZTMatrixView<U>& cp) :
+                                                view_data(cp.data()),
+                                                view_rows(cp.get_matrix_rows()),
+                                                view_cols(cp.get_matrix_cols()),
+                                                view_ld(cp.ld()),
+                                                view_stride(cp.stride()) {
+
+}
+
+/**
+ * data : pointer to the first element of the view
+ *
+ * @param  nothing
+ * @return T* view_data
+ *
+ */
+template <typename T>
+inline T* ZTMatrixView<T>::data() const {
+
+    return view_data;
+
+}
+
+/**
+ * ld : leading dimension, the distance between consecutive rows
+ *
+ * @param  nothing
+ * @return std::size_t view_ld
+ *
+ */
+template <typename T>
+inline std::size_t ZTMatrixView<T>::ld() const {
+
+    return view_ld;
+
+}
+
+/**
+ * stride : distance between consecutive columns
+ *
+ * @param  nothing
+ * @return std::size_t view_stride
+ *
+ */
+template <typename T>
+inline std::size_t ZTMatrixView<T>::stride() const {
+
+    return view_stride;
+
+}
+
+/**
+ * Getter : ZTMatrixView::view_rows getter method
+ *
+ * @param  nothing
+ * @return std::size_t view_rows
+ *
+ */
+template <typename T>
+inline std::size_t ZTMatrixView<T>::get_matrix_rows() const {
+
+    return view_rows;
+
+}
+
+/**
+ * Getter : ZTMatrixView::view_cols getter method
+ *
+ * @param  nothing
+ * @return std::size_t view_cols
+ *
+ */
+template <typename T>
+inline std::size_t ZTMatrixView<T>::get_matrix_cols() const {
+
+    return view_cols;
+
+}
+
+/**
+ * () operator : get the view element given the subscripts (row, col)
+ *
+ * @param  std::size_t row_index one-based row
+ * @param  std::size_t col_index one-based column
+ * @return T& element
+ *
+ */
+template <typename T>
+inline T& ZTMatrixView<T>::operator()(std::size_t row_index, std::size_t col_index) const {
+
+    ZT_VALIDATE(valid_subscript_dimensions(row_index, col_index));
+    return view_data[(row_index - 1) * view_ld + (col_index - 1) * view_stride];
+
+}
+
+/**
+ * at : get the view element at zero-based (row, col), the subscripts are
+ *      checked whatever the error policy
+ *
+ * @param  std::size_t row zero-based row
+ * @param  std::size_t col zero-based column
+ * @return T& element
+ *
+ */
+template <typename T>
+inline T& ZTMatrixView<T>::at(std::size_t row, std::size_t col) const {
+
+    valid_index_dimensions(row, col);
+    return view_data[row * view_ld + col * view_stride];
+
+}
+
+/**
+ * unsafe_get : get the view element at zero-based (row, col) without checks
+ *
+ * @param  std::size_t row zero-based row
+ * @param  std::size_t col zero-based column
+ * @return T& element
+ *
+ */
+template <typename T>
+inline T& ZTMatrixView<T>::unsafe_get(std::size_t row, std::size_t col) const {
+
+    return view_data[row * view_ld + col * view_stride];
+
+}
+
+/**
+ * block : view of the rows by cols block whose top-left element is (row, col)
+ *
+ * @param  std::size_t row one-based first row
+ * @param  std::size_t col one-based first column
+ * @param  std::size_t rows number of rows
+ * @param  std::size_t cols number of columns
+ * @return ZTMatrixView<T> view
+ *
+ */
+template <typename T>
+ZTMatrixView<T> ZTMatrixView<T>::block(std::size_t row, std::size_t col, std::size_t rows, std::size_t cols) const {
+
+    if (rows != 0 && cols != 0)
+    {
+        ZT_VALIDATE(valid_subscript_dimensions(row, col));
+        ZT_VALIDATE(valid_subscript_dimensions(row + rows - 1, col + cols - 1));
+    }
+    return ZTMatrixView<T>(view_data, rows, cols, view_ld, view_stride, (row - 1) * view_ld + (col - 1) * view_stride);
+
+}
+
+/**
+ * row : view of a row
+ *
+ * @param  std::size_t row one-based row
+ * @return ZTVectorView<T> view
+ *
+ */
+template <typename T>
+ZTVectorView<T> ZTMatrixView<T>::row(std::size_t row) const {
+
+    ZT_VALIDATE(valid_subscript_dimensions(row, 1));
+    return ZTVectorView<T>(view_data, view_cols, view_stride, (row - 1) * view_ld);
+
+}
+
+/**
+ * col : view of a column
+ *
+ * @param  std::size_t col one-based column
+ * @return ZTVectorView<T> view
+ *
+ */
+template <typename T>
+ZTVectorView<T> ZTMatrixView<T>::col(std::size_t col) const {
+
+    ZT_VALIDATE(valid_subscript_dimensions(1, col));
+    return ZTVectorView<T>(view_data, view_rows, view_ld, (col - 1) * view_stride);
+
+}
+
+/**
+ * transpose : view of the same elements with rows and columns exchanged
+ *
+ * @param  nothing
+ * @return ZTMatrixView<T> view (cols x rows)
+ *
+ */
+template <typename T>
+inline ZTMatrixView<T> ZTMatrixView<T>::transpose() const {
+
+    return ZTMatrixView<T>(view_data, view_cols, view_rows, view_stride, view_ld);
+
+}
+
+/**
+ * add : performs view to scalar addition
+ *
+ * @param  T& scalar
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<typename ZTMatrixView<T>::value_type> ZTMatrixView<T>::add(const value_type& scalar) const {
+
+    return ZTMatrix<value_type>(*this + scalar);
+
+}
+
+/**
+ * minus : performs view to scalar subtraction
+ *
+ * @param  T& scalar
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<typename ZTMatrixView<T>::value_type> ZTMatrixView<T>::minus(const value_type& scalar) const {
+
+    return ZTMatrix<value_type>(*this - scalar);
+
+}
+
+/**
+ * multiply : performs view to scalar multiplication
+ *
+ * @param  T& scalar
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<typename ZTMatrixView<T>::value_type> ZTMatrixView<T>::multiply(const value_type& scalar) const {
+
+    return ZTMatrix<value_type>(*this * scalar);
+
+}
+
+/**
+ * add : performs view to scalar addition into a preallocated result
+ *
+ * @param  T& scalar
+ * @param  ZTMatrix<T>& out result
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTMatrixView<T>::add(const value_type& scalar, ZTMatrix<value_type>& out) const {
+
+    out = *this + scalar;
+
+}
+
+/**
+ * minus : performs view to scalar subtraction into a preallocated result
+ *
+ * @param  T& scalar
+ * @param  ZTMatrix<T>& out result
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTMatrixView<T>::minus(const value_type& scalar, ZTMatrix<value_type>& out) const {
+
+    out = *this - scalar;
+
+}
+
+/**
+ * multiply : performs view to scalar multiplication into a preallocated result
+ *
+ * @param  T& scalar
+ * @param  ZTMatrix<T>& out result
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTMatrixView<T>::multiply(const value_type& scalar, ZTMatrix<value_type>& out) const {
+
+    out = *this * scalar;
+
+}
+
+/**
+ * cummulative_add : performs view to scalar cummulative addition in place
+ *
+ * @param  T& scalar
+ * @return *this (instance of ZTMatrixView<T>)
+ *
+ */
+template <typename T>
+const ZTMatrixView<T>& ZTMatrixView<T>::cummulative_add(const value_type& scalar) const {
+
+    return *this = *this + scalar;
+
+}
+
+/**
+ * cummulative_minus : performs view to scalar cummulative subtraction in place
+ *
+ * @param  T& scalar
+ * @return *this (instance of ZTMatrixView<T>)
+ *
+ */
+template <typename T>
+const ZTMatrixView<T>& ZTMatrixView<T>::cummulative_minus(const value_type& scalar) const {
+
+    return *this = *this - scalar;
+
+}
+
+/**
+ * cummulative_multiply : performs view to scalar cummulative multiplication in place
+ *
+ * @param  T& scalar
+ * @return *this (instance of ZTMatrixView<T>)
+ *
+ */
+template <typename T>
+const ZTMatrixView<T>& ZTMatrixView<T>::cummulative_multiply(const value_type& scalar) const {
+
+    return *this = *this * scalar;
+
+}
+
+/**
+ * add : performs view to view addition
+ *
+ * @param  ZTMatrixView<const T> m
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<typename ZTMatrixView<T>::value_type> ZTMatrixView<T>::add(const ZTMatrixView<const value_type>& m) const {
+
+    ZTMatrix<value_type> result(view_rows, view_cols);
+    add(m, result);
+    return result;
+
+}
+
+/**
+ * minus : performs view to view subtraction
+ *
+ * @param  ZTMatrixView<const T> m
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<typename ZTMatrixView<T>::value_type> ZTMatrixView<T>::minus(const ZTMatrixView<const value_type>& m) const {
+
+    ZTMatrix<value_type> result(view_rows, view_cols);
+    minus(m, result);
+    return result;
+
+}
+
+/**
+ * multiply : performs view to view multiplication
+ *
+ * @param  ZTMatrixView<const T> m
+ * @return ZTMatrix<T> result (rows x m.cols)
+ *
+ */
+template <typename T>
+inline ZTMatrix<typename ZTMatrixView<T>::value_type> ZTMatrixView<T>::multiply(const ZTMatrixView<const value_type>& m) const {
+
+    return ZTMatrixView<T>::matmul(m);
+
+}
+
+/**
+ * add : performs view to view addition into a preallocated result
+ *
+ * @param  ZTMatrixView<const T> m
+ * @param  ZTMatrix<T>& out result
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTMatrixView<T>::add(const ZTMatrixView<const value_type>& m, ZTMatrix<value_type>& out) const {
+
+    ZT_VALIDATE(valid_matrix_add_minus(m));
+    out = *this + m;
+
+}
+
+/**
+ * minus : performs view to view subtraction into a preallocated result
+ *
+ * @param  ZTMatrixView<const T> m
+ * @param  ZTMatrix<T>& out result
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTMatrixView<T>::minus(const ZTMatrixView<const value_type>& m, ZTMatrix<value_type>& out) const {
+
+    ZT_VALIDATE(valid_matrix_add_minus(m));
+    out = *this - m;
+
+}
+
+/**
+ * cummulative_add : performs view to view cummulative addition in place
+ *
+ * @param  ZTMatrixView<const T> m
+ * @return *this (instance of ZTMatrixView<T>)
+ *
+ */
+template <typename T>
+const ZTMatrixView<T>& ZTMatrixView<T>::cummulative_add(const ZTMatrixView<const value_type>& m) const {
+
+    ZT_VALIDATE(valid_matrix_add_minus(m));
+    return *this = *this + m;
+
+}
+
+/**
+ * cummulative_minus : performs view to view cummulative subtraction in place
+ *
+ * @param  ZTMatrixView<const T> m
+ * @return *this (instance of ZTMatrixView<T>)
+ *
+ */
+template <typename T>
+const ZTMatrixView<T>& ZTMatrixView<T>::cummulative_minus(const ZTMatrixView<const value_type>& m) const {
+
+    ZT_VALIDATE(valid_matrix_add_minus(m));
+    return *this = *this - m;
+
+}
+
+/**
+ * cummulative_multiply : performs view to view cummulative multiplication, the
+ *                        product must have the dimensions of the view
+ *
+ * @param  ZTMatrixView<const T> m
+ * @return *this (instance of ZTMatrixView<T>)
+ *
+ */
+template <typename T>
+const ZTMatrixView<T>& ZTMatrixView<T>::cummulative_multiply(const ZTMatrixView<const value_type>& m) const {
+
+    return ZTMatrixView<T>::assign(matmul(m));
+
+}
+
+/**
+ * matmul : performs the matrix product through the blocked GEMM engine
+ *
+ * @param  ZTMatrixView<const T> m
+ * @return ZTMatrix<T> result (rows x m.cols)
+ *
+ */
+template <typename T>
+ZTMatrix<typename ZTMatrixView<T>::value_type> ZTMatrixView<T>::matmul(const ZTMatrixView<const value_type>& m) const {
+
+    ZTMatrix<value_type> result(view_rows, m.get_matrix_cols());
+    matmul(m, result);
+    return result;
+
+}
+
+/**
+ * hadamard : performs view to view element-wise multiplication
+ *
+ * @param  ZTMatrixView<const T> m
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<typename ZTMatrixView<T>::value_type> ZTMatrixView<T>::hadamard(const ZTMatrixView<const value_type>& m) const {
+
+    ZTMatrix<value_type> result(view_rows, view_cols);
+    hadamard(m, result);
+    return result;
+
+}
+
+/**
+ * cummulative_hadamard : performs view to view cummulative element-wise multiplication in place
+ *
+ * @param  ZTMatrixView<const T> m
+ * @return *this (instance of ZTMatrixView<T>)
+ *
+ */
+template <typename T>
+const ZTMatrixView<T>& ZTMatrixView<T>::cummulative_hadamard(const ZTMatrixView<const value_type>& m) const {
+
+    ZT_VALIDATE(valid_matrix_add_minus(m));
+    return *this = zt_matrix_binary<ZTExprMultiply>(*this, m);
+
+}
+
+/**
+ * matmul : performs the matrix product into a preallocated result through the
+ *          strided GEMM engine. When out shares elements with an operand the
+ *          product goes through a temporary first
+ *
+ * @param  ZTMatrixView<const T> m
+ * @param  ZTMatrix<T>& out result (rows x m.cols)
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTMatrixView<T>::matmul(const ZTMatrixView<const value_type>& m, ZTMatrix<value_type>& out) const {
+
+    ZT_VALIDATE(valid_matrix_product(m));
+    if (overlaps(out.data(), out.get_matrix_rows(), out.get_matrix_cols(), out.stride(), 1) ||
+        m.overlaps(out.data(), out.get_matrix_rows(), out.get_matrix_cols(), out.stride(), 1))
+    {
+        out = matmul(m);
+        return;
+    }
+    out.reshape(view_rows, m.get_matrix_cols());
+    ZTGemm<value_type>::gemm(view_rows, m.get_matrix_cols(), view_cols, value_type(1),
+                             view_data, view_ld, view_stride,
+                             m.data(), m.ld(), m.stride(),
+                             value_type(0), out.data(), out.stride(), 1);
+
+}
+
+/**
+ * matvec : performs the matrix-vector product through the GEMV engine
+ *
+ * @param  ZTVectorView<const T> v
+ * @return ZTVector<T> result (rows elements)
+ *
+ */
+template <typename T>
+ZTVector<typename ZTMatrixView<T>::value_type> ZTMatrixView<T>::matvec(const ZTVectorView<const value_type>& v) const {
+
+    ZTVector<value_type> result((std::vector<value_type>()));
+    matvec(v, result);
+    return result;
+
+}
+
+/**
+ * matvec_transposed : performs the product of the transpose with a vector,
+ *                     without forming the transpose
+ *
+ * @param  ZTVectorView<const T> v
+ * @return ZTVector<T> result (cols elements)
+ *
+ */
+template <typename T>
+ZTVector<typename ZTMatrixView<T>::value_type> ZTMatrixView<T>::matvec_transposed(const ZTVectorView<const value_type>& v) const {
+
+    return transpose().matvec(v);
+
+}
+
+/**
+ * matvec : performs the matrix-vector product into a preallocated result,
+ *          out is only reallocated when its size differs. When out aliases
+ *          an operand the product goes through a temporary first
+ *
+ * @param  ZTVectorView<const T> v
+ * @param  ZTVector<T>& out result (rows elements)
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTMatrixView<T>::matvec(const ZTVectorView<const value_type>& v, ZTVector<value_type>& out) const {
+
+    ZT_VALIDATE(valid_matrix_vector_product(v));
+    const ZTMatrixView<const value_type> column(v.data(), v.size(), 1, v.stride(), 1);
+    if (overlaps(out.data(), 1, out.size(), 0, 1) || column.overlaps(out.data(), 1, out.size(), 0, 1))
+    {
+        out = matvec(v);
+        return;
+    }
+    out.set_vector_size(view_rows);
+    ZTGemv<value_type>::gemv(view_rows, view_cols, value_type(1),
+                             view_data, view_ld, view_stride,
+                             v.data(), v.stride(),
+                             value_type(0), out.data(), 1);
+
+}
+
+/**
+ * matvec_transposed : performs the product of the transpose with a vector
+ *                     into a preallocated result
+ *
+ * @param  ZTVectorView<const T> v
+ * @param  ZTVector<T>& out result (cols elements)
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTMatrixView<T>::matvec_transposed(const ZTVectorView<const value_type>& v, ZTVector<value_type>& out) const {
+
+    transpose().matvec(v, out);
+
+}
+
+/**
+ * hadamard : performs view to view element-wise multiplication into a preallocated result
+ *
+ * @param  ZTMatrixView<const T> m
+ * @param  ZTMatrix<T>& out result
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTMatrixView<T>::hadamard(const ZTMatrixView<const value_type>& m, ZTMatrix<value_type>& out) const {
+
+    ZT_VALIDATE(valid_matrix_add_minus(m));
+    out = zt_matrix_binary<ZTExprMultiply>(*this, m);
+
+}
+
+/**
+ * inline += operator : performs view to scalar cummulative addition
+ *
+ * @param  T& scalar
+ *
+ */
+template <typename T>
+inline const ZTMatrixView<T>& ZTMatrixView<T>::operator+=(const value_type& scalar) const {
+
+    return ZTMatrixView<T>::cummulative_add(scalar);
+
+}
+
+/**
+ * inline -= operator : performs view to scalar cummulative subtraction
+ *
+ * @param  T& scalar
+ *
+ */
+template <typename T>
+inline const ZTMatrixView<T>& ZTMatrixView<T>::operator-=(const value_type& scalar) const {
+
+    return ZTMatrixView<T>::cummulative_minus(scalar);
+
+}
+
+/**
+ * inline *= operator : performs view to scalar cummulative multiplication
+ *
+ * @param  T& scalar
+ *
+ */
+template <typename T>
+inline const ZTMatrixView<T>& ZTMatrixView<T>::operator*=(const value_type& scalar) const {
+
+    return ZTMatrixView<T>::cummulative_multiply(scalar);
+
+}
+
+/**
+ * inline += operator : performs view to view cummulative addition
+ *
+ * @param  ZTMatrixView<const T> m
+ *
+ */
+template <typename T>
+inline const ZTMatrixView<T>& ZTMatrixView<T>::operator+=(const ZTMatrixView<const value_type>& m) const {
+
+    return ZTMatrixView<T>::cummulative_add(m);
+
+}
+
+/**
+ * inline -= operator : performs view to view cummulative subtraction
+ *
+ * @param  ZTMatrixView<const T> m
+ *
+ */
+template <typename T>
+inline const ZTMatrixView<T>& ZTMatrixView<T>::operator-=(const ZTMatrixView<const value_type>& m) const {
+
+    return ZTMatrixView<T>::cummulative_minus(m);
+
+}
+
+/**
+ * inline *= operator : performs view to view cummulative multiplication
+ *
+ * @param  ZTMatrixView<const T> m
+ *
+ */
+template <typename T>
+inline const ZTMatrixView<T>& ZTMatrixView<T>::operator*=(const ZTMatrixView<const value_type>& m) const {
+
+    return ZTMatrixView<T>::cummulative_multiply(m);
+
+}
+
+/**
+ * inline += operator : performs view to expression cummulative addition in a single pass
+ *
+ * @param  ZTMatrixExpression<T, E> e
+ *
+ */
+template <typename T>
+template <typename E>
+inline const ZTMatrixView<T>& ZTMatrixView<T>::operator+=(const ZTMatrixExpression<value_type, E>& e) const {
+
+    ZT_VALIDATE(zt_valid_expression_dimensions(view_rows, view_cols, e.get_matrix_rows(), e.get_matrix_cols()));
+    if (e.overlaps(view_data, view_ld, view_stride))
+    {
+        return *this += ZTMatrix<value_type>(e);
+    }
+    for (std::size_t r = 0; r < view_rows; ++r)
+    {
+        T* z = view_data + r * view_ld;
+        for (std::size_t c = 0; c < view_cols; ++c)
+        {
+            z[c * view_stride] += e(r, c);
+        }
+    }
+    return *this;
+
+}
+
+/**
+ * inline -= operator : performs view to expression cummulative subtraction in a single pass
+ *
+ * @param  ZTMatrixExpression<T, E> e
+ *
+ */
+template <typename T>
+template <typename E>
+inline const ZTMatrixView<T>& ZTMatrixView<T>::operator-=(const ZTMatrixExpression<value_type, E>& e) const {
+
+    ZT_VALIDATE(zt_valid_expression_dimensions(view_rows, view_cols, e.get_matrix_rows(), e.get_matrix_cols()));
+    if (e.overlaps(view_data, view_ld, view_stride))
+    {
+        return *this -= ZTMatrix<value_type>(e);
+    }
+    for (std::size_t r = 0; r < view_rows; ++r)
+    {
+        T* z = view_data + r * view_ld;
+        for (std::size_t c = 0; c < view_cols; ++c)
+        {
+            z[c * view_stride] -= e(r, c);
+        }
+    }
+    return *this;
+
+}
+
+/**
+ * assign : copies the elements of m into the elements of the view
+ *
+ * @param  ZTMatrixView<const T> m
+ * @return *this (instance of ZTMatrixView<T>)
+ *
+ */
+template <typename T>
+const ZTMatrixView<T>& ZTMatrixView<T>::assign(const ZTMatrixView<const value_type>& m) const {
+
+    ZT_VALIDATE(valid_matrix_add_minus(m));
+    if (m.data() == view_data && m.ld() == view_ld && m.stride() == view_stride)
+    {
+        return *this;
+    }
+    if (m.overlaps(view_data, view_rows, view_cols, view_ld, view_stride))
+    {
+        return ZTMatrixView<T>::assign(ZTMatrix<value_type>(m));
+    }
+    for (std::size_t r = 0; r < view_rows; ++r)
+    {
+        T* z = view_data + r * view_ld;
+        const value_type* a = m.data() + r * m.ld();
+        for (std::size_t c = 0; c < view_cols; ++c)
+        {
+            z[c * view_stride] = a[c * m.stride()];
+        }
+    }
+    return *this;
+
+}
+
+/**
+ * assignment operator : copies the elements of m into the elements of the view
+ *
+ * @param  ZTMatrixView<T> m
+ * @return *this (instance of ZTMatrixView<T>)
+ *
+ */
+template <typename T>
+inline const ZTMatrixView<T>& ZTMatrixView<T>::operator=(const ZTMatrixView<T>& m) const {
+
+    return ZTMatrixView<T>::assign(m);
+
+}
+
+/**
+ * assignment operator : copies the elements of m into the elements of the view
+ *
+ * @param  ZTMatrix<T> m
+ * @return *this (instance of ZTMatrixView<T>)
+ *
+ */
+template <typename T>
+inline const ZTMatrixView<T>& ZTMatrixView<T>::operator=(const ZTMatrix<value_type>& m) const {
+
+    return ZTMatrixView<T>::assign(m);
+
+}
+
+/**
+ * assignment operator : evaluates the expression into the elements of the view
+ *                       in a single pass. Views of the same elements may appear
+ *                       in the expression; when operands overlap them laid out
+ *                       differently, the expression is evaluated into a
+ *                       temporary first
+ *
+ * @param  ZTMatrixExpression<T, E> e
+ * @return *this (instance of ZTMatrixView<T>)
+ *
+ */
+template <typename T>
+template <typename E>
+const ZTMatrixView<T>& ZTMatrixView<T>::operator=(const ZTMatrixExpression<value_type, E>& e) const {
+
+    ZT_VALIDATE(zt_valid_expression_dimensions(view_rows, view_cols, e.get_matrix_rows(), e.get_matrix_cols()));
+    if (e.overlaps(view_data, view_ld, view_stride))
+    {
+        return ZTMatrixView<T>::assign(ZTMatrix<value_type>(e));
+    }
+    for (std::size_t r = 0; r < view_rows; ++r)
+    {
+        T* z = view_data + r * view_ld;
+        for (std::size_t c = 0; c < view_cols; ++c)
+        {
+            z[c * view_stride] = e(r, c);
+        }
+    }
+    return *this;
+
+}
+
+/**
+ * trace : performs view trace operation
+ *
+ * @param  nothing
+ * @return T result
+ *
+ */
+template <typename T>
+typename ZTMatrixView<T>::value_type ZTMatrixView<T>::trace() const {
+
+    ZT_VALIDATE(valid_sqaure_matrix(view_rows, view_cols));
+    value_type result = 0;
+    for (std::size_t i = 0; i < view_rows; ++i)
+    {
+        result += view_data[i * (view_ld + view_stride)];
+    }
+    return result;
+
+}
+
+/**
+ * trace : performs view to view trace operation
+ *
+ * @param  ZTMatrixView<const T> m
+ * @return T result
+ *
+ */
+template <typename T>
+inline typename ZTMatrixView<T>::value_type ZTMatrixView<T>::trace(const ZTMatrixView<const value_type>& m) const {
+
+    return m.trace();
+
+}
+
+/**
+ * norm : performs view norm operation
+ *
+ * @param  nothing
+ * @return T result
+ *
+ */
+template <typename T>
+typename ZTMatrixView<T>::value_type ZTMatrixView<T>::norm() const {
+
+    typedef typename ZTAccumulator<value_type>::type accumulator_type;
+    accumulator_type result = 0;
+    for (std::size_t r = 0; r < view_rows; ++r)
+    {
+        const T* a = view_data + r * view_ld;
+        for (std::size_t c = 0; c < view_cols; ++c)
+        {
+            const accumulator_type x = a[c * view_stride];
+            result += x * x;
+        }
+    }
+    return std::sqrt(result);
+
+}
+
+/**
+ * norm : performs view to view norm operation
+ *
+ * @param  ZTMatrixView<const T> m
+ * @return T result
+ *
+ */
+template <typename T>
+inline typename ZTMatrixView<T>::value_type ZTMatrixView<T>::norm(const ZTMatrixView<const value_type>& m) const {
+
+    return m.norm();
+
+}
+
+/**
+ * overlaps : whether the elements of the view may share memory with another
+ *            rows by cols block, judged from the address ranges they span
+ *
+ * @param  void* p first element of the block
+ * @param  std::size_t rows, cols, ld, stride shape of the block
+ * @return bool overlap
+ *
+ */
+template <typename T>
+bool ZTMatrixView<T>::overlaps(const void* p, std::size_t rows, std::size_t cols, std::size_t ld, std::size_t stride) const {
+
+    if (rows == 0 || cols == 0 || view_rows == 0 || view_cols == 0)
+    {
+        return false;
+    }
+    const value_type* first = static_cast<const value_type*>(p);
+    const value_type* last = first + (rows - 1) * ld + (cols - 1) * stride;
+    const value_type* view_first = view_data;
+    const value_type* view_last = view_data + (view_rows - 1) * view_ld + (view_cols - 1) * view_stride;
+    std::less_equal<const value_type*> before;
+    return before(first, view_last) && before(view_first, last);
+
+}
+
+/**
+ * valid_sqaure_matrix : checks for valid sqaure matrix dimensions
+ *
+ * @param  std::size_t row_size
+ * @param  std::size_t col_size
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTMatrixView<T>::valid_sqaure_matrix(std::size_t row_size, std::size_t col_size) const {
+
+    if (row_size != col_size)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Matrices of dimensions: " << row_size << "x" << col_size << " is not a sqaure matrix!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * valid_matrix_product : checks for dimensions valid matrix product
+ *
+ * @param  ZTMatrixView<const T> m
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTMatrixView<T>::valid_matrix_product(const ZTMatrixView<const value_type>& m) const {
+
+    if (view_cols != m.get_matrix_rows())
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Matrices of dimensions: " << view_rows << "x" << view_cols << " and " << m.get_matrix_rows() << "x" << m.get_matrix_cols() << " are not suitable for matrix product!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * valid_matrix_vector_product : checks for valid matrix-vector product dimensions
+ *
+ * @param  ZTVectorView<const T> v
+ * @return void
+ *
+ */
+template <typename T>
+void ZTMatrixView<T>::valid_matrix_vector_product(const ZTVectorView<const value_type>& v) const {
+
+    if (view_cols != v.size())
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Matrix of dimensions: " << view_rows << "x" << view_cols << " and vector of size " << v.size() << " are not suitable for matrix-vector product!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * valid_vector_result : checks that a vector can hold the matrix-vector product
+ *
+ * @param  ZTVectorView<const T> v
+ * @return void
+ *
+ */
+template <typename T>
+void ZTMatrixView<T>::valid_vector_result(const ZTVectorView<const value_type>& v) const {
+
+    if (view_rows != v.size())
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Vector of size " << v.size() << " cannot hold the result of a " << view_rows << "x" << view_cols << " matrix-vector product!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * valid_matrix_add_minus : checks for dimensions valid matrix addition or subtraction
+ *
+ * @param  ZTMatrixView<const T> m
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTMatrixView<T>::valid_matrix_add_minus(const ZTMatrixView<const value_type>& m) const {
+
+    if (view_cols != m.get_matrix_cols() || view_rows != m.get_matrix_rows())
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Matrices of dimensions: " << view_rows << "x" << view_cols << " and " << m.get_matrix_rows() << "x" << m.get_matrix_cols() << " are not suitable for matrix add or minus!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * valid_subscript_dimensions : checks for valid view subscript dimensions
+ *
+ * @param  std::size_t row_index
+ * @param  std::size_t col_index
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTMatrixView<T>::valid_subscript_dimensions(std::size_t row_index, std::size_t col_index) const {
+
+    if (row_index > view_rows || row_index < 1 || col_index > view_cols || col_index < 1)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Matrix subscripts " << row_index << " and " << col_index << " out of range!.";
+        zt_raise<std::out_of_range>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * valid_index_dimensions : checks for valid zero-based view subscripts
+ *
+ * @param  std::size_t row zero-based row
+ * @param  std::size_t col zero-based column
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTMatrixView<T>::valid_index_dimensions(std::size_t row, std::size_t col) const {
+
+    if (row >= view_rows || col >= view_cols)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Matrix index (" << row << ", " << col << ") out of range for a " << view_rows << "x" << view_cols << " matrix!.";
+        zt_raise<std::out_of_range>(invalid_dimensions.str());
+    }
+
+}
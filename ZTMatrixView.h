@@ -0,0 +1,164 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ZTMATRIXVIEW_H
+#define ZTMATRIXVIEW_H
+
+#include <type_traits>
+
+#include "ZTMatrix.h"
+#include "ZTVectorView.h"
+
+template <typename T, typename E>
+class ZTMatrixExpression;
+
+template <typename T>
+class ZTExprStridedLeaf;
+
+/*
+ * ZTMatrixView : non-owning view of a rows by cols block whose rows are ld
+ *                elements apart and whose columns are stride elements apart,
+ *                over a ZTMatrix, another view or any caller-owned buffer.
+ *                Blocks, rows, columns and the transpose of a view are views
+ *                of the same elements. ZTMatrixView<const T> is read-only.
+ *
+ *                Copying a view copies the reference, assigning to a view
+ *                copies the elements, which must outlive the view. Subscripts
+ *                are one-based as for ZTMatrix.
+ */
+template <typename T>
+class ZTMatrixView {
+
+private:
+    T* view_data;
+    std::size_t view_rows;
+    std::size_t view_cols;
+    std::size_t view_ld;       // distance between rows
+    std::size_t view_stride;   // distance between columns
+
+    bool overlaps(const void* p, std::size_t rows, std::size_t cols, std::size_t ld, std::size_t stride) const;
+
+    template <typename U>
+    friend class ZTMatrixView;
+    template <typename U>
+    friend class ZTExprStridedLeaf;
+
+public:
+    typedef typename std::remove_const<T>::type value_type;
+
+    ZTMatrixView(T* data, std::size_t rows, std::size_t cols, std::size_t ld, std::size_t stride = 1, std::size_t offset = 0);
+    ZTMatrixView(ZTMatrix<value_type>& m);
+    ZTMatrixView(const ZTMatrix<value_type>& m);
+    ZTMatrixView(const ZTMatrixView<T>& cp) = default;
+    template <typename U, typename = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+    ZTMatrixView(const ZTMatrixView<U>& cp);
+
+    T* data() const;
+    std::size_t ld() const;
+    std::size_t stride() const;
+
+    std::size_t get_matrix_rows() const;
+    std::size_t get_matrix_cols() const;
+
+    T& operator()(std::size_t row, std::size_t col) const;   // one-based, checked
+    T& at(std::size_t row, std::size_t col) const;           // zero-based, always checked
+    T& unsafe_get(std::size_t row, std::size_t col) const;   // zero-based, unchecked
+
+    ZTMatrixView<T> block(std::size_t row, std::size_t col, std::size_t rows, std::size_t cols) const;
+    ZTVectorView<T> row(std::size_t row) const;
+    ZTVectorView<T> col(std::size_t col) const;
+    ZTMatrixView<T> transpose() const;
+
+    ZTMatrix<value_type> add(const value_type& scalar) const;
+    ZTMatrix<value_type> minus(const value_type& scalar) const;
+    ZTMatrix<value_type> multiply(const value_type& scalar) const;
+
+    void add(const value_type& scalar, ZTMatrix<value_type>& out) const;
+    void minus(const value_type& scalar, ZTMatrix<value_type>& out) const;
+    void multiply(const value_type& scalar, ZTMatrix<value_type>& out) const;
+
+    const ZTMatrixView<T>& cummulative_add(const value_type& scalar) const;
+    const ZTMatrixView<T>& cummulative_minus(const value_type& scalar) const;
+    const ZTMatrixView<T>& cummulative_multiply(const value_type& scalar) const;
+
+    ZTMatrix<value_type> add(const ZTMatrixView<const value_type>& m) const;
+    ZTMatrix<value_type> minus(const ZTMatrixView<const value_type>& m) const;
+    ZTMatrix<value_type> multiply(const ZTMatrixView<const value_type>& m) const;
+
+    void add(const ZTMatrixView<const value_type>& m, ZTMatrix<value_type>& out) const;
+    void minus(const ZTMatrixView<const value_type>& m, ZTMatrix<value_type>& out) const;
+
+    const ZTMatrixView<T>& cummulative_add(const ZTMatrixView<const value_type>& m) const;
+    const ZTMatrixView<T>& cummulative_minus(const ZTMatrixView<const value_type>& m) const;
+    const ZTMatrixView<T>& cummulative_multiply(const ZTMatrixView<const value_type>& m) const;
+
+    ZTMatrix<value_type> matmul(const ZTMatrixView<const value_type>& m) const;     // matrix product
+    ZTMatrix<value_type> hadamard(const ZTMatrixView<const value_type>& m) const;   // element-wise product
+    const ZTMatrixView<T>& cummulative_hadamard(const ZTMatrixView<const value_type>& m) const;
+
+    void matmul(const ZTMatrixView<const value_type>& m, ZTMatrix<value_type>& out) const;
+
+    ZTVector<value_type> matvec(const ZTVectorView<const value_type>& v) const;             // matrix-vector product
+    ZTVector<value_type> matvec_transposed(const ZTVectorView<const value_type>& v) const;  // transpose times vector
+
+    void matvec(const ZTVectorView<const value_type>& v, ZTVector<value_type>& out) const;
+    void matvec_transposed(const ZTVectorView<const value_type>& v, ZTVector<value_type>& out) const;
+    void hadamard(const ZTMatrixView<const value_type>& m, ZTMatrix<value_type>& out) const;
+
+    const ZTMatrixView<T>& operator +=(const value_type& scalar) const;
+    const ZTMatrixView<T>& operator -=(const value_type& scalar) const;
+    const ZTMatrixView<T>& operator *=(const value_type& scalar) const;
+
+    const ZTMatrixView<T>& operator +=(const ZTMatrixView<const value_type>& m) const;
+    const ZTMatrixView<T>& operator -=(const ZTMatrixView<const value_type>& m) const;
+    const ZTMatrixView<T>& operator *=(const ZTMatrixView<const value_type>& m) const;
+
+    template <typename E>
+    const ZTMatrixView<T>& operator +=(const ZTMatrixExpression<value_type, E>& e) const;
+    template <typename E>
+    const ZTMatrixView<T>& operator -=(const ZTMatrixExpression<value_type, E>& e) const;
+
+    const ZTMatrixView<T>& assign(const ZTMatrixView<const value_type>& m) const; // copies the elements
+    const ZTMatrixView<T>& operator =(const ZTMatrixView<T>& m) const;
+    const ZTMatrixView<T>& operator =(const ZTMatrix<value_type>& m) const;
+    template <typename E>
+    const ZTMatrixView<T>& operator =(const ZTMatrixExpression<value_type, E>& e) const;
+
+    value_type trace() const;
+    value_type trace(const ZTMatrixView<const value_type>& m) const;
+
+    value_type norm() const;
+    value_type norm(const ZTMatrixView<const value_type>& m) const;
+
+    void valid_sqaure_matrix(std::size_t rows, std::size_t cols) const;
+    void valid_matrix_product(const ZTMatrixView<const value_type>& m) const;
+    void valid_matrix_vector_product(const ZTVectorView<const value_type>& v) const;
+    void valid_vector_result(const ZTVectorView<const value_type>& v) const;
+    void valid_matrix_add_minus(const ZTMatrixView<const value_type>& m) const;
+    void valid_subscript_dimensions(std::size_t rows, std::size_t cols) const;
+    void valid_index_dimensions(std::size_t row, std::size_t col) const;
+
+};
+
+#endif /* ZTMATRIXVIEW_H */
@@ -0,0 +1,441 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <stdexcept>
+
+#include "ZTError.h"
+#include "ZTNpy.h"
+
+/**
+ * zt_npy_little_endian : whether this machine stores the low byte first
+ *
+ * @param  nothing
+ * @return bool
+ *
+ */
+inline bool zt_npy_little_endian() {
+
+    const std::uint16_t probe = 1;
+    unsigned char first;
+    std::memcpy(&first, &probe, 1);
+    return first == 1;
+
+}
+
+/**
+ * zt_npy_value : start of the value of a key in a header dictionary
+ *
+ * @param  std::string dict
+ * @param  std::string key without quotes
+ * @return std::size_t position after the colon and blanks, npos when absent
+ *
+ */
+inline std::size_t zt_npy_value(const std::string& dict, const std::string& key) {
+
+    std::size_t found = dict.find("'" + key + "'");
+    found = found == std::string::npos ? dict.find("\"" + key + "\"") : found;
+    if (found == std::string::npos)
+    {
+        return found;
+    }
+    found = dict.find(':', found + key.size() + 2);
+    return found == std::string::npos ? found : dict.find_first_not_of(" \t", found + 1);
+
+}
+
+/**
+ * zt_npy_read_header : parses the magic string, version and dictionary at
+ *                      the start of a .npy file
+ *
+ * @param  const unsigned char* p start of the file
+ * @param  std::size_t size bytes in the file
+ * @param  std::string path for the messages
+ * @return ZTNpyHeader header
+ *
+ */
+ZTNpyHeader zt_npy_read_header(const unsigned char* p, std::size_t size, const std::string& path) {
+
+    std::ostringstream invalid_file;
+    if (size < 10 || std::memcmp(p, "\x93NUMPY", 6) != 0 || p[6] < 1 || p[6] > 3)
+    {
+        invalid_file << "File " << path << " is not a .npy file of version 1.0 to 3.0!.";
+        zt_raise<std::runtime_error>(invalid_file.str());
+    }
+    const std::size_t prefix = p[6] == 1 ? 10 : 12;
+    std::size_t length = std::size_t(p[8]) | std::size_t(p[9]) << 8;
+    if (prefix == 12 && size >= 12)
+    {
+        length |= std::size_t(p[10]) << 16 | std::size_t(p[11]) << 24;
+    }
+
+    ZTNpyHeader header;
+    header.fortran_order = false;
+    header.data_offset = prefix + length;
+    const std::string dict = size >= header.data_offset ? std::string(reinterpret_cast<const char*>(p) + prefix, length) : std::string();
+    const std::size_t descr = zt_npy_value(dict, "descr");
+    const std::size_t order = zt_npy_value(dict, "fortran_order");
+    const std::size_t shape = zt_npy_value(dict, "shape");
+    bool parsed = descr != std::string::npos && order != std::string::npos && shape != std::string::npos &&
+                  (dict[descr] == '\'' || dict[descr] == '"') && dict[shape] == '(';
+    if (parsed)
+    {
+        const std::size_t close = dict.find(dict[descr], descr + 1);
+        parsed = close != std::string::npos;
+        header.descr = parsed ? dict.substr(descr + 1, close - descr - 1) : std::string();
+        header.fortran_order = dict.compare(order, 4, "True") == 0;
+        parsed = parsed && (header.fortran_order || dict.compare(order, 5, "False") == 0);
+    }
+    if (parsed)
+    {
+        const std::size_t close = dict.find(')', shape);
+        std::istringstream dimensions(dict.substr(shape + 1, close == std::string::npos ? 0 : close - shape - 1));
+        std::string dimension;
+        while (parsed && std::getline(dimensions, dimension, ','))
+        {
+            const std::size_t digits = dimension.find_first_not_of(" \t");
+            if (digits == std::string::npos)
+            {
+                continue;  // the empty item after a trailing comma
+            }
+            char* end = nullptr;
+            header.shape.push_back(std::size_t(std::strtoull(dimension.c_str() + digits, &end, 10)));
+            parsed = end != dimension.c_str() + digits && dimension.find_first_not_of(" \t", std::size_t(end - dimension.c_str())) == std::string::npos;
+        }
+        parsed = parsed && close != std::string::npos;
+    }
+    if (!parsed)
+    {
+        invalid_file << "File " << path << " has a .npy header that cannot be parsed!.";
+        zt_raise<std::runtime_error>(invalid_file.str());
+    }
+    return header;
+
+}
+
+/**
+ * zt_npy_header : reads the header of a .npy file, to find the type and
+ *                 shape of the array before choosing T
+ *
+ * @param  std::string path
+ * @return ZTNpyHeader header
+ *
+ */
+ZTNpyHeader zt_npy_header(const std::string& path) {
+
+    const ZTFileMapping mapping(path);
+    return zt_npy_read_header(mapping.data(), mapping.size(), path);
+
+}
+
+/**
+ * Constructor : maps a .npy file and checks that it holds T, reading the
+ *               elements into memory when they cannot be used in place
+ *
+ * @param  std::string path
+ *
+ */
+template <typename T>
+ZTNpyArray<T>::ZTNpyArray(const std::string& path) : mapping(path), elements(nullptr), matrix_rows(1), matrix_cols(1) {
+
+    file_header = zt_npy_read_header(mapping.data(), mapping.size(), path);
+    const std::string& descr = file_header.descr;
+    const std::vector<std::size_t>& shape = file_header.shape;
+    std::ostringstream invalid_file;
+    if (descr.size() < 2 || descr.compare(1, std::string::npos, ZTNpyTraits<T>::code()) != 0 ||
+        std::string("<>|=").find(descr[0]) == std::string::npos)
+    {
+        invalid_file << "File " << path << " holds elements of type " << descr << ", not " << ZTNpyTraits<T>::code() << "!.";
+        zt_raise<std::invalid_argument>(invalid_file.str());
+    }
+    if (shape.size() > 2)
+    {
+        invalid_file << "File " << path << " holds an array of " << shape.size() << " dimensions, not a matrix!.";
+        zt_raise<std::invalid_argument>(invalid_file.str());
+    }
+    matrix_rows = shape.size() == 2 ? shape[0] : 1;
+    matrix_cols = shape.empty() ? 1 : shape.back();
+    const std::size_t count = matrix_rows * matrix_cols;
+    if (matrix_cols != 0 && (matrix_rows > std::size_t(-1) / matrix_cols || count > (mapping.size() - file_header.data_offset) / sizeof(T)))
+    {
+        invalid_file << "File " << path << " is too short for its " << matrix_rows << "x" << matrix_cols << " elements!.";
+        zt_raise<std::runtime_error>(invalid_file.str());
+    }
+
+    const unsigned char* p = mapping.data() + file_header.data_offset;
+    const bool swapped = (descr[0] == '<' && !zt_npy_little_endian()) || (descr[0] == '>' && zt_npy_little_endian());
+    if (!swapped && reinterpret_cast<std::uintptr_t>(p) % alignof(T) == 0)
+    {
+        elements = reinterpret_cast<const T*>(p);
+        return;
+    }
+    converted.resize(count);
+    unsigned char* q = reinterpret_cast<unsigned char*>(converted.data());
+    std::memcpy(q, p, count * sizeof(T));
+    for (std::size_t i = 0; swapped && i < count; ++i)
+    {
+        std::reverse(q + i * sizeof(T), q + (i + 1) * sizeof(T));
+    }
+    elements = converted.data();
+
+}
+
+/**
+ * header : gets the header read from the file
+ *
+ * @param  nothing
+ * @return ZTNpyHeader
+ *
+ */
+template <typename T>
+inline const ZTNpyHeader& ZTNpyArray<T>::header() const {
+
+    return file_header;
+
+}
+
+/**
+ * get_matrix_rows : gets the number of rows, one for a 1-D array
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTNpyArray<T>::get_matrix_rows() const {
+
+    return matrix_rows;
+
+}
+
+/**
+ * get_matrix_cols : gets the number of columns
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTNpyArray<T>::get_matrix_cols() const {
+
+    return matrix_cols;
+
+}
+
+/**
+ * mapped : whether the elements are read from the mapped file in place
+ *
+ * @param  nothing
+ * @return bool
+ *
+ */
+template <typename T>
+inline bool ZTNpyArray<T>::mapped() const {
+
+    return converted.empty() && matrix_rows * matrix_cols != 0;
+
+}
+
+/**
+ * data : gets the elements, in the order of the file
+ *
+ * @param  nothing
+ * @return const T*
+ *
+ */
+template <typename T>
+inline const T* ZTNpyArray<T>::data() const {
+
+    return elements;
+
+}
+
+/**
+ * view : the array as a matrix, Fortran order files seen column by column
+ *
+ * @param  nothing
+ * @return ZTMatrixView<const T> view
+ *
+ */
+template <typename T>
+ZTMatrixView<const T> ZTNpyArray<T>::view() const {
+
+    if (file_header.fortran_order)
+    {
+        return ZTMatrixView<const T>(elements, matrix_rows, matrix_cols, 1, matrix_rows);
+    }
+    return ZTMatrixView<const T>(elements, matrix_rows, matrix_cols, matrix_cols);
+
+}
+
+/**
+ * vector_view : a one-dimensional array as a vector
+ *
+ * @param  nothing
+ * @return ZTVectorView<const T> view
+ *
+ */
+template <typename T>
+ZTVectorView<const T> ZTNpyArray<T>::vector_view() const {
+
+    ZT_VALIDATE(valid_vector());
+    return ZTVectorView<const T>(elements, matrix_cols);
+
+}
+
+/**
+ * to_matrix : copies the array into a matrix
+ *
+ * @param  nothing
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTNpyArray<T>::to_matrix() const {
+
+    return ZTMatrix<T>(view());
+
+}
+
+/**
+ * to_vector : copies a one-dimensional array into a vector
+ *
+ * @param  nothing
+ * @return ZTVector<T> result
+ *
+ */
+template <typename T>
+ZTVector<T> ZTNpyArray<T>::to_vector() const {
+
+    return ZTVector<T>(vector_view());
+
+}
+
+/**
+ * write : writes a version 1.0 header for shape and the rows of m after it
+ *
+ * @param  std::string path
+ * @param  std::string shape Python tuple of the dimensions
+ * @param  ZTMatrixView<const T> m
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTNpyArray<T>::write(const std::string& path, const std::string& shape, const ZTMatrixView<const T>& m) {
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        zt_raise<std::runtime_error>("File " + path + " cannot be opened for writing!.");
+    }
+    const char order = sizeof(T) == 1 ? '|' : zt_npy_little_endian() ? '<' : '>';
+    std::string dict = std::string("{'descr': '") + order + ZTNpyTraits<T>::code() + "', 'fortran_order': False, 'shape': " + shape + ", }";
+    const std::size_t aligned = alignment;
+    dict.append((aligned - (10 + dict.size() + 1) % aligned) % aligned, ' ');
+    dict.push_back('\n');
+    const unsigned char prefix[10] = { 0x93, 'N', 'U', 'M', 'P', 'Y', 1, 0,
+                                       (unsigned char)(dict.size() & 0xff), (unsigned char)(dict.size() >> 8) };
+    file.write(reinterpret_cast<const char*>(prefix), sizeof(prefix));
+    file.write(dict.data(), std::streamsize(dict.size()));
+
+    const std::size_t rows = m.get_matrix_rows(), cols = m.get_matrix_cols();
+    std::vector<T> row(m.stride() == 1 ? 0 : cols);
+    for (std::size_t i = 0; i < rows && file; ++i)
+    {
+        const T* source = m.data() + i * m.ld();
+        if (m.stride() != 1)
+        {
+            for (std::size_t j = 0; j < cols; ++j)
+            {
+                row[j] = m.unsafe_get(i, j);
+            }
+            source = row.data();
+        }
+        file.write(reinterpret_cast<const char*>(source), std::streamsize(cols * sizeof(T)));
+    }
+    file.close();
+    if (file.fail())
+    {
+        zt_raise<std::runtime_error>("File " + path + " could not be written!.");
+    }
+
+}
+
+/**
+ * save : writes a matrix or a block of one as a two-dimensional array
+ *
+ * @param  std::string path
+ * @param  ZTMatrixView<const T> m
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTNpyArray<T>::save(const std::string& path, const ZTMatrixView<const T>& m) {
+
+    write(path, "(" + std::to_string(m.get_matrix_rows()) + ", " + std::to_string(m.get_matrix_cols()) + ")", m);
+
+}
+
+/**
+ * save : writes a vector as a one-dimensional array
+ *
+ * @param  std::string path
+ * @param  ZTVectorView<const T> v
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTNpyArray<T>::save(const std::string& path, const ZTVectorView<const T>& v) {
+
+    const std::size_t n = v.get_vector_size();
+    write(path, "(" + std::to_string(n) + ",)", ZTMatrixView<const T>(v.data(), 1, n, n * v.stride(), v.stride()));
+
+}
+
+/**
+ * valid_vector : checks that the array has one dimension
+ *
+ * @param  nothing
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTNpyArray<T>::valid_vector() const {
+
+    if (file_header.shape.size() != 1)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Array of " << file_header.shape.size() << " dimensions is not a vector!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+
+}
@@ -0,0 +1,121 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ZTNPY_H
+#define ZTNPY_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#include "ZTAlignedAllocator.h"
+#include "ZTHalf.h"
+#include "ZTMatrix.h"
+#include "ZTVector.h"
+#include "ZTMatrixFile.h"
+#include "ZTMatrixView.h"
+#include "ZTVectorView.h"
+
+/*
+ * ZTNpyTraits : NumPy type code of T without its byte order character,
+ *               specialized for every type a .npy file can hold here.
+ *               ZTBFloat16 has no NumPy counterpart.
+ */
+template <typename T>
+struct ZTNpyTraits;
+
+template <> struct ZTNpyTraits<double> { static const char* code() { return "f8"; } };
+template <> struct ZTNpyTraits<float> { static const char* code() { return "f4"; } };
+template <> struct ZTNpyTraits<ZTHalf> { static const char* code() { return "f2"; } };
+template <> struct ZTNpyTraits<std::int8_t> { static const char* code() { return "i1"; } };
+template <> struct ZTNpyTraits<std::uint8_t> { static const char* code() { return "u1"; } };
+template <> struct ZTNpyTraits<std::int32_t> { static const char* code() { return "i4"; } };
+template <> struct ZTNpyTraits<std::int64_t> { static const char* code() { return "i8"; } };
+
+/*
+ * ZTNpyHeader : the dictionary at the start of a .npy file, versions 1.0 to
+ *               3.0. descr is the NumPy type string such as "<f8"; data
+ *               starts data_offset bytes into the file.
+ */
+struct ZTNpyHeader {
+    std::string descr;
+    bool fortran_order;
+    std::vector<std::size_t> shape;
+    std::size_t data_offset;
+};
+
+ZTNpyHeader zt_npy_header(const std::string& path);  // reads and checks the header only
+
+/*
+ * ZTNpyArray : NumPy array of zero, one or two dimensions mapped from a .npy
+ *              file. When the file is in the byte order of this machine and
+ *              its data is aligned for T, view() reads the mapped pages
+ *              directly, C order as rows and Fortran order as columns,
+ *              without copying; otherwise the elements are read once into
+ *              aligned memory, byte-swapped if need be. One-dimensional
+ *              arrays are seen as a single row, or whole by vector_view().
+ *              The type code must match T exactly. Views must not outlive
+ *              the array.
+ *
+ *              save() writes version 1.0 files in C order, with the data
+ *              aligned to 64 bytes, which NumPy maps back without copying.
+ */
+template <typename T>
+class ZTNpyArray {
+
+private:
+    ZTFileMapping mapping;
+    ZTNpyHeader file_header;
+    std::vector<T, ZTAlignedAllocator<T> > converted;  // elements when the file cannot be used in place
+    const T* elements;
+    std::size_t matrix_rows;
+    std::size_t matrix_cols;
+
+    static void write(const std::string& path, const std::string& shape, const ZTMatrixView<const T>& m);
+
+public:
+    static constexpr std::size_t alignment = 64;
+
+    explicit ZTNpyArray(const std::string& path);
+
+    const ZTNpyHeader& header() const;
+    std::size_t get_matrix_rows() const;
+    std::size_t get_matrix_cols() const;
+    bool mapped() const;  // whether the elements are read in place
+    const T* data() const;
+
+    ZTMatrixView<const T> view() const;
+    ZTVectorView<const T> vector_view() const;  // one-dimensional arrays only
+    ZTMatrix<T> to_matrix() const;              // owning copies
+    ZTVector<T> to_vector() const;
+
+    static void save(const std::string& path, const ZTMatrixView<const T>& m);
+    static void save(const std::string& path, const ZTVectorView<const T>& v);
+
+    void valid_vector() const;
+
+};
+
+#endif /* ZTNPY_H */
@@ -0,0 +1,397 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cmath>
+#include <vector>
+#include <limits>
+#include <cstddef>
+#include <sstream>
+#include <stdexcept>
+#include <algorithm>
+
+#include "ZTError.h"
+#include "ZTPreconditioner.h"
+
+/**
+ * apply : performs z = r
+ *
+ * @param  ZTVector<T> r residual
+ * @param  ZTVector<T>& z result
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTIdentityPreconditioner<T>::apply(const ZTVector<T>& r, ZTVector<T>& z) const {
+
+    if (&z != &r)
+    {
+        z.set_vector_size(r.size());
+        std::copy(r.data(), r.data() + r.size(), z.data());
+    }
+
+}
+
+/**
+ * Constructor : Constructs the Jacobi preconditioner of a dense matrix
+ *
+ * @param  ZTMatrix<T> m square matrix
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTJacobiPreconditioner<T>::ZTJacobiPreconditioner(const ZTMatrix<T>& m) {
+
+    ZT_VALIDATE(m.valid_sqaure_matrix(m.get_matrix_rows(), m.get_matrix_cols()));
+    inverse_diagonal.resize(m.get_matrix_rows());
+    for (std::size_t i = 0; i < inverse_diagonal.size(); ++i)
+    {
+        inverse_diagonal[i] = m[i][i];
+    }
+    invert();
+
+}
+
+/**
+ * Constructor : Constructs the Jacobi preconditioner of a sparse matrix
+ *
+ * @param  ZTSparseMatrix<T> m square matrix
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTJacobiPreconditioner<T>::ZTJacobiPreconditioner(const ZTSparseMatrix<T>& m) {
+
+    ZT_VALIDATE(m.valid_sqaure_matrix(m.get_matrix_rows(), m.get_matrix_cols()));
+    inverse_diagonal.resize(m.get_matrix_rows());
+    for (std::size_t i = 0; i < inverse_diagonal.size(); ++i)
+    {
+        inverse_diagonal[i] = m.at(i, i);
+    }
+    invert();
+
+}
+
+/**
+ * invert : replaces the diagonal by its inverse
+ *
+ * @param  nothing
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTJacobiPreconditioner<T>::invert() {
+
+    for (std::size_t i = 0; i < inverse_diagonal.size(); ++i)
+    {
+        if (inverse_diagonal[i] == T(0))
+        {
+            std::ostringstream invalid_diagonal;
+            invalid_diagonal << "Jacobi preconditioner needs a nonzero diagonal, entry " << i << " is zero!.";
+            zt_raise<std::domain_error>(invalid_diagonal.str());
+        }
+        inverse_diagonal[i] = T(1) / inverse_diagonal[i];
+    }
+
+}
+
+/**
+ * apply : performs z = D^-1 * r
+ *
+ * @param  ZTVector<T> r residual
+ * @param  ZTVector<T>& z result (may be r)
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTJacobiPreconditioner<T>::apply(const ZTVector<T>& r, ZTVector<T>& z) const {
+
+    const std::size_t n = inverse_diagonal.size();
+    z.set_vector_size(n);
+    const T* x = r.data();
+    const T* d = inverse_diagonal.data();
+    T* y = z.data();
+    _Pragma("GCC ivdep")
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        y[i] = d[i] * x[i];
+    }
+
+}
+
+/**
+ * Constructor : Constructs the ILU(0) preconditioner of a sparse matrix
+ *
+ * @param  ZTSparseMatrix<T> m square matrix with every diagonal entry stored
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTILU0Preconditioner<T>::ZTILU0Preconditioner(const ZTSparseMatrix<T>& m) {
+
+    ZT_VALIDATE(m.valid_sqaure_matrix(m.get_matrix_rows(), m.get_matrix_cols()));
+    const ZTSparseMatrix<T> csr = m.to_csr();
+    pointers = csr.pointers();
+    indices = csr.indices();
+    factors = csr.values();
+    factorize();
+
+}
+
+/**
+ * Constructor : Constructs the ILU(0) preconditioner of a dense matrix, on
+ *               the pattern of its nonzero entries
+ *
+ * @param  ZTMatrix<T> m square matrix
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTILU0Preconditioner<T>::ZTILU0Preconditioner(const ZTMatrix<T>& m) : ZTILU0Preconditioner(ZTSparseMatrix<T>(m)) {
+
+}
+
+/**
+ * factorize : IKJ incomplete LU in place on the CSR arrays. Row i is
+ *             eliminated by the rows j < i it references, updating only the
+ *             entries row i already stores, found through a column marker
+ *
+ * @param  nothing
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTILU0Preconditioner<T>::factorize() {
+
+    const std::size_t n = pointers.size() - 1;
+    const std::size_t unmarked = std::numeric_limits<std::size_t>::max();
+    diagonal.assign(n, unmarked);
+    std::vector<std::size_t> marker(n, unmarked);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        for (std::size_t k = pointers[i]; k < pointers[i + 1]; ++k)
+        {
+            marker[indices[k]] = k;
+        }
+        for (std::size_t k = pointers[i]; k < pointers[i + 1] && indices[k] < i; ++k)
+        {
+            const std::size_t j = indices[k];
+            const T lij = factors[k] /= factors[diagonal[j]];
+            for (std::size_t l = diagonal[j] + 1; l < pointers[j + 1]; ++l)
+            {
+                const std::size_t position = marker[indices[l]];
+                if (position != unmarked)
+                {
+                    factors[position] -= lij * factors[l];
+                }
+            }
+        }
+        diagonal[i] = marker[i];
+        for (std::size_t k = pointers[i]; k < pointers[i + 1]; ++k)
+        {
+            marker[indices[k]] = unmarked;
+        }
+        if (diagonal[i] == unmarked || factors[diagonal[i]] == T(0))
+        {
+            std::ostringstream invalid_pivot;
+            invalid_pivot << "ILU(0) preconditioner has a zero pivot in row " << i << "!.";
+            zt_raise<std::domain_error>(invalid_pivot.str());
+        }
+    }
+
+}
+
+/**
+ * apply : performs z = U^-1 * L^-1 * r by forward and backward substitution
+ *
+ * @param  ZTVector<T> r residual
+ * @param  ZTVector<T>& z result (may be r)
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTILU0Preconditioner<T>::apply(const ZTVector<T>& r, ZTVector<T>& z) const {
+
+    const std::size_t n = diagonal.size();
+    z.set_vector_size(n);
+    const T* x = r.data();
+    T* y = z.data();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        T sum = x[i];
+        for (std::size_t k = pointers[i]; k < diagonal[i]; ++k)
+        {
+            sum -= factors[k] * y[indices[k]];
+        }
+        y[i] = sum;
+    }
+    for (std::size_t i = n; i-- > 0;)
+    {
+        T sum = y[i];
+        for (std::size_t k = diagonal[i] + 1; k < pointers[i + 1]; ++k)
+        {
+            sum -= factors[k] * y[indices[k]];
+        }
+        y[i] = sum / factors[diagonal[i]];
+    }
+
+}
+
+/**
+ * Constructor : Constructs the IC(0) preconditioner of a sparse symmetric
+ *               positive definite matrix, from its lower triangle
+ *
+ * @param  ZTSparseMatrix<T> m square matrix with every diagonal entry stored
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTIC0Preconditioner<T>::ZTIC0Preconditioner(const ZTSparseMatrix<T>& m) {
+
+    ZT_VALIDATE(m.valid_sqaure_matrix(m.get_matrix_rows(), m.get_matrix_cols()));
+    factorize(m.to_csr());
+
+}
+
+/**
+ * Constructor : Constructs the IC(0) preconditioner of a dense symmetric
+ *               positive definite matrix, on the pattern of its nonzero
+ *               entries
+ *
+ * @param  ZTMatrix<T> m square matrix
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTIC0Preconditioner<T>::ZTIC0Preconditioner(const ZTMatrix<T>& m) : ZTIC0Preconditioner(ZTSparseMatrix<T>(m)) {
+
+}
+
+/**
+ * factorize : row-oriented incomplete Cholesky. Entry (i, k) of L is the
+ *             entry of A less the sparse dot product of rows i and k left
+ *             of column k, merged over their sorted indices, over L_kk
+ *
+ * @param  ZTSparseMatrix<T> m matrix in CSR
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTIC0Preconditioner<T>::factorize(const ZTSparseMatrix<T>& m) {
+
+    const std::size_t n = m.get_matrix_rows();
+    const std::vector<std::size_t>& p = m.pointers();
+    const std::vector<std::size_t>& idx = m.indices();
+    const std::vector<T>& a = m.values();
+    pointers.assign(1, 0);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        for (std::size_t k = p[i]; k < p[i + 1] && idx[k] <= i; ++k)
+        {
+            indices.push_back(idx[k]);
+            factors.push_back(a[k]);
+        }
+        pointers.push_back(indices.size());
+    }
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const std::size_t last = pointers[i + 1];
+        if (last == pointers[i] || indices[last - 1] != i)
+        {
+            std::ostringstream invalid_pivot;
+            invalid_pivot << "IC(0) preconditioner needs a stored diagonal, row " << i << " has none!.";
+            zt_raise<std::domain_error>(invalid_pivot.str());
+        }
+        T pivot = factors[last - 1];
+        for (std::size_t k = pointers[i]; k + 1 < last; ++k)
+        {
+            const std::size_t col = indices[k];
+            std::size_t a_pos = pointers[i];
+            std::size_t b_pos = pointers[col];
+            const std::size_t b_end = pointers[col + 1] - 1;
+            T sum = T(0);
+            while (a_pos < k && b_pos < b_end)
+            {
+                if (indices[a_pos] == indices[b_pos])
+                {
+                    sum += factors[a_pos++] * factors[b_pos++];
+                }
+                else if (indices[a_pos] < indices[b_pos])
+                {
+                    ++a_pos;
+                }
+                else
+                {
+                    ++b_pos;
+                }
+            }
+            factors[k] = (factors[k] - sum) / factors[b_end];
+            pivot -= factors[k] * factors[k];
+        }
+        if (!(pivot > T(0)))
+        {
+            std::ostringstream invalid_pivot;
+            invalid_pivot << "IC(0) preconditioner has a non-positive pivot in row " << i << "!.";
+            zt_raise<std::domain_error>(invalid_pivot.str());
+        }
+        factors[last - 1] = std::sqrt(pivot);
+    }
+
+}
+
+/**
+ * apply : performs z = L^-T * L^-1 * r, the backward solve running over the
+ *         rows of L as columns of L^T
+ *
+ * @param  ZTVector<T> r residual
+ * @param  ZTVector<T>& z result (may be r)
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTIC0Preconditioner<T>::apply(const ZTVector<T>& r, ZTVector<T>& z) const {
+
+    const std::size_t n = pointers.size() - 1;
+    z.set_vector_size(n);
+    const T* x = r.data();
+    T* y = z.data();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        T sum = x[i];
+        for (std::size_t k = pointers[i]; k + 1 < pointers[i + 1]; ++k)
+        {
+            sum -= factors[k] * y[indices[k]];
+        }
+        y[i] = sum / factors[pointers[i + 1] - 1];
+    }
+    for (std::size_t i = n; i-- > 0;)
+    {
+        const T yi = y[i] /= factors[pointers[i + 1] - 1];
+        for (std::size_t k = pointers[i]; k + 1 < pointers[i + 1]; ++k)
+        {
+            y[indices[k]] -= factors[k] * yi;
+        }
+    }
+
+}
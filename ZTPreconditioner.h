@@ -0,0 +1,124 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ZTPRECONDITIONER_H
+#define ZTPRECONDITIONER_H
+
+#include <vector>
+#include <cstddef>
+
+#include "ZTMatrix.h"
+#include "ZTVector.h"
+#include "ZTSparseMatrix.h"
+
+/*
+ * Preconditioners for the ZTKrylov solvers. Each applies an approximation
+ * of A^-1 through apply(r, z), z = M^-1 * r, and is built once from the
+ * matrix and reused for every iteration and right-hand side.
+ */
+
+/*
+ * ZTIdentityPreconditioner : no preconditioning, z = r.
+ */
+template <typename T>
+class ZTIdentityPreconditioner {
+
+public:
+    void apply(const ZTVector<T>& r, ZTVector<T>& z) const;
+
+};
+
+/*
+ * ZTJacobiPreconditioner : the inverse of the diagonal of A, applied as one
+ *                          element-wise product.
+ */
+template <typename T>
+class ZTJacobiPreconditioner {
+
+private:
+    std::vector<T> inverse_diagonal;
+
+    void invert();
+
+public:
+    explicit ZTJacobiPreconditioner(const ZTMatrix<T>& m);
+    explicit ZTJacobiPreconditioner(const ZTSparseMatrix<T>& m);
+
+    void apply(const ZTVector<T>& r, ZTVector<T>& z) const;
+
+};
+
+/*
+ * ZTILU0Preconditioner : incomplete LU factorization with no fill, L * U
+ *                        restricted to the nonzero pattern of A, stored as
+ *                        one CSR matrix with the unit diagonal of L implied.
+ *                        Applied as a forward and a backward sparse
+ *                        triangular solve.
+ */
+template <typename T>
+class ZTILU0Preconditioner {
+
+private:
+    std::vector<std::size_t> pointers;
+    std::vector<std::size_t> indices;
+    std::vector<T> factors;
+    std::vector<std::size_t> diagonal;  // position of each diagonal entry in factors
+
+    void factorize();
+
+public:
+    explicit ZTILU0Preconditioner(const ZTSparseMatrix<T>& m);
+    explicit ZTILU0Preconditioner(const ZTMatrix<T>& m);  // on the nonzero pattern of m
+
+    void apply(const ZTVector<T>& r, ZTVector<T>& z) const;
+
+};
+
+/*
+ * ZTIC0Preconditioner : incomplete Cholesky factorization with no fill of a
+ *                       symmetric positive definite A, L * L^T restricted to
+ *                       the pattern of the lower triangle of A, stored by
+ *                       rows. Raises std::domain_error when a pivot is not
+ *                       positive, which can happen even for a positive
+ *                       definite A.
+ */
+template <typename T>
+class ZTIC0Preconditioner {
+
+private:
+    std::vector<std::size_t> pointers;
+    std::vector<std::size_t> indices;
+    std::vector<T> factors;  // each row ends with its diagonal
+
+    void factorize(const ZTSparseMatrix<T>& m);
+
+public:
+    explicit ZTIC0Preconditioner(const ZTSparseMatrix<T>& m);
+    explicit ZTIC0Preconditioner(const ZTMatrix<T>& m);  // on the nonzero pattern of m
+
+    void apply(const ZTVector<T>& r, ZTVector<T>& z) const;
+
+};
+
+#endif /* ZTPRECONDITIONER_H */
@@ -0,0 +1,880 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cmath>
+#include <vector>
+#include <limits>
+#include <cstddef>
+#include <sstream>
+#include <utility>
+#include <stdexcept>
+#include <algorithm>
+
+#include "ZTQR.h"
+#include "ZTBlas.h"
+#include "ZTGemm.h"
+#include "ZTError.h"
+#include "ZTThreadPool.h"
+
+/**
+ * Constructor : Constructs the QR factorization of a matrix
+ *
+ * @param  ZTMatrix<T> m matrix to factorize, left unchanged
+ * @param  ZTQRMethod method blocked Householder or tall-skinny QR
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTQR<T>::ZTQR(const ZTMatrix<T>& m, ZTQRMethod method) : levels(1, m),
+                                                          block_rows(m.get_matrix_rows()),
+                                                          matrix_rows(m.get_matrix_rows()),
+                                                          matrix_cols(m.get_matrix_cols()) {
+
+    factorize(method);
+
+}
+
+/**
+ * Constructor : Constructs the QR factorization of a matrix, reusing its
+ *               buffer for the factors
+ *
+ * @param  ZTMatrix<T> m matrix to factorize, left empty
+ * @param  ZTQRMethod method blocked Householder or tall-skinny QR
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTQR<T>::ZTQR(ZTMatrix<T>&& m, ZTQRMethod method) : block_rows(m.get_matrix_rows()),
+                                                     matrix_rows(m.get_matrix_rows()),
+                                                     matrix_cols(m.get_matrix_cols()) {
+
+    levels.push_back(std::move(m));
+    factorize(method);
+
+}
+
+/**
+ * Constructor : Constructs the QR factorization of a view
+ *
+ * @param  ZTMatrixView<const T> m block to factorize, left unchanged
+ * @param  ZTQRMethod method blocked Householder or tall-skinny QR
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTQR<T>::ZTQR(const ZTMatrixView<const T>& m, ZTQRMethod method) : levels(1, ZTMatrix<T>(m)),
+                                                                    block_rows(m.get_matrix_rows()),
+                                                                    matrix_rows(m.get_matrix_rows()),
+                                                                    matrix_cols(m.get_matrix_cols()) {
+
+    factorize(method);
+
+}
+
+/**
+ * panel : unblocked Householder factorization of a rows x cols panel. Each
+ *         reflector H = I - tau * v * v^T is stored below the diagonal with
+ *         its leading one implied, and is applied to the rest of the panel
+ *         one contiguous row at a time
+ *
+ * @param  std::size_t rows rows of the panel
+ * @param  std::size_t cols cols of the panel, at most block_size and rows
+ * @param  T* a panel, rows ld elements apart, overwritten
+ * @param  T* tau cols scalings of the reflectors
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTQR<T>::panel(std::size_t rows, std::size_t cols, T* a, std::size_t ld, T* tau) {
+
+    T w[block_size];
+    for (std::size_t j = 0; j < cols; ++j)
+    {
+        T* pivot_row = a + j * ld;
+        T sigma = T(0);
+        for (std::size_t i = j + 1; i < rows; ++i)
+        {
+            const T x = a[i * ld + j];
+            sigma += x * x;
+        }
+        const T alpha = pivot_row[j];
+        if (sigma == T(0))
+        {
+            tau[j] = T(0);
+            continue;
+        }
+
+        T beta = std::sqrt(alpha * alpha + sigma);
+        if (alpha > T(0))
+        {
+            beta = -beta;
+        }
+        tau[j] = (beta - alpha) / beta;
+        const T scale = T(1) / (alpha - beta);
+        for (std::size_t i = j + 1; i < rows; ++i)
+        {
+            a[i * ld + j] *= scale;
+        }
+        pivot_row[j] = beta;
+
+        // w = tau * v^T * A(j:, j+1:), then A(j:, j+1:) -= v * w
+        const std::size_t width = cols - j - 1;
+        for (std::size_t c = 0; c < width; ++c)
+        {
+            w[c] = pivot_row[j + 1 + c];
+        }
+        for (std::size_t i = j + 1; i < rows; ++i)
+        {
+            const T v = a[i * ld + j];
+            const T* row = a + i * ld + j + 1;
+            _Pragma("GCC ivdep") for (std::size_t c = 0; c < width; ++c)
+            {
+                w[c] += v * row[c];
+            }
+        }
+        for (std::size_t c = 0; c < width; ++c)
+        {
+            w[c] *= tau[j];
+            pivot_row[j + 1 + c] -= w[c];
+        }
+        for (std::size_t i = j + 1; i < rows; ++i)
+        {
+            const T v = a[i * ld + j];
+            T* row = a + i * ld + j + 1;
+            _Pragma("GCC ivdep") for (std::size_t c = 0; c < width; ++c)
+            {
+                row[c] -= v * w[c];
+            }
+        }
+    }
+
+}
+
+/**
+ * triangle : forms the upper triangular T of the compact WY form
+ *            H1 * ... * Hk = I - V * T * V^T of a panel, from the Gram matrix
+ *            V^T * V whose bulk is one GEMM
+ *
+ * @param  std::size_t rows rows of V
+ * @param  std::size_t cols number of reflectors
+ * @param  T* v reflectors below the diagonal, rows ld elements apart
+ * @param  T* tau scalings of the reflectors
+ * @param  T* t cols x cols result, rows block_size elements apart
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTQR<T>::triangle(std::size_t rows, std::size_t cols, const T* v, std::size_t ld,
+                       const T* tau, T* t) {
+
+    T g[block_size * block_size] = {};
+    if (rows > cols)
+    {
+        ZTGemm<T>::gemm(cols, cols, rows - cols, T(1),
+                        v + cols * ld, 1, ld,
+                        v + cols * ld, ld, 1,
+                        T(0), g, block_size, 1);
+    }
+    for (std::size_t j = 0; j < cols; ++j)
+    {
+        for (std::size_t p = 0; p < j; ++p)
+        {
+            T s = v[j * ld + p];
+            for (std::size_t i = j + 1; i < cols; ++i)
+            {
+                s += v[i * ld + p] * v[i * ld + j];
+            }
+            g[p * block_size + j] += s;
+        }
+    }
+
+    for (std::size_t j = 0; j < cols; ++j)
+    {
+        for (std::size_t i = 0; i < j; ++i)
+        {
+            T s = T(0);
+            for (std::size_t p = i; p < j; ++p)
+            {
+                s += t[i * block_size + p] * g[p * block_size + j];
+            }
+            t[i * block_size + j] = -tau[j] * s;
+        }
+        t[j * block_size + j] = tau[j];
+        for (std::size_t i = j + 1; i < cols; ++i)
+        {
+            t[i * block_size + j] = T(0);
+        }
+    }
+
+}
+
+/**
+ * apply_panel : performs C = (I - V * op(T) * V^T) * C for one panel of k
+ *               reflectors, with op(T) = T^T for Q^T and T for Q. W = V^T * C
+ *               and C -= V * W are GEMMs over the rows below the unit lower
+ *               triangle of V, which is handled row by row
+ *
+ * @param  std::size_t rows rows of V and C
+ * @param  std::size_t k number of reflectors
+ * @param  T* v reflectors below the diagonal, rows ld elements apart
+ * @param  T* t k x k triangular factor, rows block_size elements apart
+ * @param  bool transposed whether to apply Q^T
+ * @param  std::size_t cols cols of C
+ * @param  T* c C, rows ldc elements apart
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTQR<T>::apply_panel(std::size_t rows, std::size_t k, const T* v, std::size_t ld, const T* t,
+                          bool transposed, std::size_t cols, T* c, std::size_t ldc) {
+
+    if (cols == 0 || k == 0)
+    {
+        return;
+    }
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    buffer_type w(k * cols);
+
+    // W = V1^T * C1 + V2^T * C2
+    for (std::size_t i = 0; i < k; ++i)
+    {
+        std::copy(c + i * ldc, c + i * ldc + cols, w.data() + i * cols);
+        for (std::size_t p = 0; p < i; ++p)
+        {
+            blas.axpy(cols, v[i * ld + p], c + i * ldc, w.data() + p * cols);
+        }
+    }
+    if (rows > k)
+    {
+        ZTGemm<T>::gemm(k, cols, rows - k, T(1),
+                        v + k * ld, 1, ld,
+                        c + k * ldc, ldc, 1,
+                        T(1), w.data(), cols, 1);
+    }
+
+    // W = op(T) * W, in place from the end that is read last
+    if (transposed)
+    {
+        for (std::size_t i = k; i-- > 0;)
+        {
+            T* w_row = w.data() + i * cols;
+            blas.multiply_scalar(cols, w_row, t[i * block_size + i], w_row);
+            for (std::size_t p = 0; p < i; ++p)
+            {
+                blas.axpy(cols, t[p * block_size + i], w.data() + p * cols, w_row);
+            }
+        }
+    }
+    else
+    {
+        for (std::size_t i = 0; i < k; ++i)
+        {
+            T* w_row = w.data() + i * cols;
+            blas.multiply_scalar(cols, w_row, t[i * block_size + i], w_row);
+            for (std::size_t p = i + 1; p < k; ++p)
+            {
+                blas.axpy(cols, t[i * block_size + p], w.data() + p * cols, w_row);
+            }
+        }
+    }
+
+    // C2 -= V2 * W, C1 -= V1 * W
+    if (rows > k)
+    {
+        ZTGemm<T>::gemm(rows - k, cols, k, T(-1),
+                        v + k * ld, ld, 1,
+                        w.data(), cols, 1,
+                        T(1), c + k * ldc, ldc, 1);
+    }
+    for (std::size_t i = 0; i < k; ++i)
+    {
+        T* c_row = c + i * ldc;
+        blas.minus(cols, c_row, w.data() + i * cols, c_row);
+        for (std::size_t p = 0; p < i; ++p)
+        {
+            blas.axpy(cols, -v[i * ld + p], w.data() + p * cols, c_row);
+        }
+    }
+
+}
+
+/**
+ * factor_block : blocked Householder factorization of a rows x cols block.
+ *                Each panel of block_size columns is factored, its T factor
+ *                formed, and its reflectors applied to the trailing columns
+ *
+ * @param  std::size_t rows rows of the block
+ * @param  std::size_t cols cols of the block
+ * @param  T* a block, rows ld elements apart, overwritten by R and V
+ * @param  T* t cols x block_size T factors, one per panel
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTQR<T>::factor_block(std::size_t rows, std::size_t cols, T* a, std::size_t ld, T* t) {
+
+    const std::size_t k = std::min(rows, cols);
+    T tau[block_size];
+    for (std::size_t j0 = 0; j0 < k; j0 += block_size)
+    {
+        const std::size_t w = std::min(block_size, k - j0);
+        T* v = a + j0 * ld + j0;
+        panel(rows - j0, w, v, ld, tau);
+        triangle(rows - j0, w, v, ld, tau, t + j0 * block_size);
+        if (j0 + w < cols)
+        {
+            apply_panel(rows - j0, w, v, ld, t + j0 * block_size, true, cols - j0 - w, v + w, ld);
+        }
+    }
+
+}
+
+/**
+ * apply_block : performs C = Q^T * C or C = Q * C for the Q of one factored
+ *               block, panel by panel
+ *
+ * @param  std::size_t rows rows of the block and of C
+ * @param  std::size_t k number of reflectors
+ * @param  T* a factored block, rows ld elements apart
+ * @param  T* t T factors of the block
+ * @param  bool transposed whether to apply Q^T
+ * @param  std::size_t cols cols of C
+ * @param  T* c C, rows ldc elements apart
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTQR<T>::apply_block(std::size_t rows, std::size_t k, const T* a, std::size_t ld, const T* t,
+                          bool transposed, std::size_t cols, T* c, std::size_t ldc) {
+
+    const std::size_t panels = (k + block_size - 1) / block_size;
+    for (std::size_t q = 0; q < panels; ++q)
+    {
+        const std::size_t j0 = (transposed ? q : panels - 1 - q) * block_size;
+        const std::size_t w = std::min(block_size, k - j0);
+        apply_panel(rows - j0, w, a + j0 * ld + j0, ld, t + j0 * block_size,
+                    transposed, cols, c + j0 * ldc, ldc);
+    }
+
+}
+
+/**
+ * factorize : factors every row block of the current level on the thread
+ *             pool, and while there is more than one block stacks their R
+ *             factors into the next level
+ *
+ * @param  ZTQRMethod method blocked Householder or tall-skinny QR
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTQR<T>::factorize(ZTQRMethod method) {
+
+    const std::size_t n = matrix_cols;
+    if (method == ZT_QR_TSQR)
+    {
+        block_rows = std::max(2 * n, leaf_bytes / (std::max<std::size_t>(n, 1) * sizeof(T)));
+    }
+    block_rows = std::max<std::size_t>(block_rows, 1);
+
+    for (;;)
+    {
+        const std::size_t level = levels.size() - 1;
+        const std::size_t rows = levels[level].get_matrix_rows();
+        const std::size_t blocks = rows <= block_rows ? 1 : (rows + block_rows - 1) / block_rows;
+        const std::size_t ld = levels[level].stride();
+        T* a = levels[level].data();
+        triangles.push_back(buffer_type(blocks * n * block_size));
+        T* t = triangles.back().data();
+        ZTThreadPool::instance().parallel_for(blocks, [&](std::size_t block) {
+            const std::size_t i0 = block * block_rows;
+            factor_block(std::min(block_rows, rows - i0), n, a + i0 * ld, ld, t + block * n * block_size);
+        });
+        if (blocks == 1)
+        {
+            break;
+        }
+
+        std::size_t next_rows = 0;
+        for (std::size_t block = 0; block < blocks; ++block)
+        {
+            next_rows += std::min(n, std::min(block_rows, rows - block * block_rows));
+        }
+        ZTMatrix<T> next(next_rows, n, T(0));
+        std::size_t offset = 0;
+        for (std::size_t block = 0; block < blocks; ++block)
+        {
+            const std::size_t i0 = block * block_rows;
+            const std::size_t kb = std::min(n, std::min(block_rows, rows - i0));
+            for (std::size_t i = 0; i < kb; ++i)
+            {
+                std::copy(a + (i0 + i) * ld + i, a + (i0 + i) * ld + n, next[offset + i] + i);
+            }
+            offset += kb;
+        }
+        levels.push_back(std::move(next));
+    }
+
+}
+
+/**
+ * apply : performs C = Q^T * C or C = Q * C from the given level up. The
+ *         blocks of the level are applied on the thread pool, and the top
+ *         rows of every block, which the next level factored, are gathered
+ *         into a buffer for it and scattered back
+ *
+ * @param  std::size_t level first level to apply
+ * @param  bool transposed whether to apply Q^T
+ * @param  std::size_t cols cols of C
+ * @param  T* c C with as many rows as the level, rows ldc elements apart
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTQR<T>::apply(std::size_t level, bool transposed, std::size_t cols, T* c, std::size_t ldc) const {
+
+    const std::size_t n = matrix_cols;
+    const std::size_t rows = levels[level].get_matrix_rows();
+    const std::size_t blocks = rows <= block_rows ? 1 : (rows + block_rows - 1) / block_rows;
+    const std::size_t ld = levels[level].stride();
+    const T* a = levels[level].data();
+    const T* t = triangles[level].data();
+    auto blockwise = [&](std::size_t block) {
+        const std::size_t i0 = block * block_rows;
+        const std::size_t rb = std::min(block_rows, rows - i0);
+        apply_block(rb, std::min(rb, n), a + i0 * ld, ld, t + block * n * block_size,
+                    transposed, cols, c + i0 * ldc, ldc);
+    };
+
+    if (transposed)
+    {
+        ZTThreadPool::instance().parallel_for(blocks, blockwise);
+    }
+    if (level + 1 < levels.size())
+    {
+        buffer_type next(levels[level + 1].get_matrix_rows() * cols);
+        std::size_t offset = 0;
+        for (std::size_t block = 0; block < blocks; ++block)
+        {
+            const std::size_t i0 = block * block_rows;
+            const std::size_t kb = std::min(n, std::min(block_rows, rows - i0));
+            for (std::size_t i = 0; i < kb; ++i)
+            {
+                std::copy(c + (i0 + i) * ldc, c + (i0 + i) * ldc + cols, next.data() + (offset + i) * cols);
+            }
+            offset += kb;
+        }
+        apply(level + 1, transposed, cols, next.data(), cols);
+        offset = 0;
+        for (std::size_t block = 0; block < blocks; ++block)
+        {
+            const std::size_t i0 = block * block_rows;
+            const std::size_t kb = std::min(n, std::min(block_rows, rows - i0));
+            for (std::size_t i = 0; i < kb; ++i)
+            {
+                std::copy(next.data() + (offset + i) * cols, next.data() + (offset + i + 1) * cols, c + (i0 + i) * ldc);
+            }
+            offset += kb;
+        }
+    }
+    if (!transposed)
+    {
+        ZTThreadPool::instance().parallel_for(blocks, blockwise);
+    }
+
+}
+
+/**
+ * upper_solve : solves R * X = B in place for cols right-hand sides, by
+ *               blocks of block_size rows from the bottom up
+ *
+ * @param  std::size_t cols number of right-hand sides
+ * @param  T* b right-hand sides, rows ldb elements apart, overwritten by X
+ * @param  std::size_t ldb distance between rows of b
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTQR<T>::upper_solve(std::size_t cols, T* b, std::size_t ldb) const {
+
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    const std::size_t n = matrix_cols;
+    const std::size_t ld = levels.back().stride();
+    const T* a = levels.back().data();
+    const std::size_t blocks = (n + block_size - 1) / block_size;
+    for (std::size_t block = blocks; block-- > 0;)
+    {
+        const std::size_t i0 = block * block_size;
+        const std::size_t i1 = std::min(i0 + block_size, n);
+        if (i1 < n)
+        {
+            ZTGemm<T>::gemm(i1 - i0, cols, n - i1, T(-1),
+                            a + i0 * ld + i1, ld, 1,
+                            b + i1 * ldb, ldb, 1,
+                            T(1), b + i0 * ldb, ldb, 1);
+        }
+        for (std::size_t i = i1; i-- > i0;)
+        {
+            for (std::size_t p = i + 1; p < i1; ++p)
+            {
+                blas.axpy(cols, -a[i * ld + p], b + p * ldb, b + i * ldb);
+            }
+            blas.multiply_scalar(cols, b + i * ldb, T(1) / a[i * ld + i], b + i * ldb);
+        }
+    }
+
+}
+
+/**
+ * Getter : ZTQR::matrix_rows getter method
+ *
+ * @param  nothing
+ * @return std::size_t matrix_rows
+ *
+ */
+template <typename T>
+inline std::size_t ZTQR<T>::get_matrix_rows() const {
+
+    return matrix_rows;
+
+}
+
+/**
+ * Getter : ZTQR::matrix_cols getter method
+ *
+ * @param  nothing
+ * @return std::size_t matrix_cols
+ *
+ */
+template <typename T>
+inline std::size_t ZTQR<T>::get_matrix_cols() const {
+
+    return matrix_cols;
+
+}
+
+/**
+ * is_full_rank : whether every diagonal element of R is above the rounding
+ *                level max(m, n) * epsilon * max |r_ii|
+ *
+ * @param  nothing
+ * @return bool
+ *
+ */
+template <typename T>
+bool ZTQR<T>::is_full_rank() const {
+
+    const ZTMatrix<T>& top = levels.back();
+    const std::size_t k = std::min(top.get_matrix_rows(), matrix_cols);
+    T largest = T(0);
+    for (std::size_t i = 0; i < k; ++i)
+    {
+        largest = std::max(largest, T(std::abs(top[i][i])));
+    }
+    const T tolerance = T(std::max(matrix_rows, matrix_cols)) * std::numeric_limits<T>::epsilon() * largest;
+    for (std::size_t i = 0; i < k; ++i)
+    {
+        if (!(std::abs(top[i][i]) > tolerance))
+        {
+            return false;
+        }
+    }
+    return true;
+
+}
+
+/**
+ * q : forms the first min(m, n) columns of Q, by applying Q to the leading
+ *     columns of the identity
+ *
+ * @param  nothing
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTQR<T>::q() const {
+
+    const std::size_t k = std::min(matrix_rows, matrix_cols);
+    ZTMatrix<T> result(matrix_rows, k, T(0));
+    for (std::size_t i = 0; i < k; ++i)
+    {
+        result[i][i] = T(1);
+    }
+    apply(0, false, k, result.data(), result.stride());
+    return result;
+
+}
+
+/**
+ * r : upper triangular factor R
+ *
+ * @param  nothing
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTQR<T>::r() const {
+
+    const ZTMatrix<T>& top = levels.back();
+    const std::size_t k = std::min(matrix_rows, matrix_cols);
+    ZTMatrix<T> result(k, matrix_cols, T(0));
+    for (std::size_t i = 0; i < k; ++i)
+    {
+        std::copy(top[i] + i, top[i] + matrix_cols, result[i] + i);
+    }
+    return result;
+
+}
+
+/**
+ * apply_q : performs Q * C without forming Q
+ *
+ * @param  ZTMatrixView<const T> c matrix of m rows
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTQR<T>::apply_q(const ZTMatrixView<const T>& c) const {
+
+    ZTMatrix<T> result(c);
+    apply_q(result.view(), result);
+    return result;
+
+}
+
+/**
+ * apply_qt : performs Q^T * C without forming Q
+ *
+ * @param  ZTMatrixView<const T> c matrix of m rows
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTQR<T>::apply_qt(const ZTMatrixView<const T>& c) const {
+
+    ZTMatrix<T> result(c);
+    apply_qt(result.view(), result);
+    return result;
+
+}
+
+/**
+ * apply_q : performs Q * c without forming Q
+ *
+ * @param  ZTVectorView<const T> c vector of m elements
+ * @return ZTVector<T> result
+ *
+ */
+template <typename T>
+ZTVector<T> ZTQR<T>::apply_q(const ZTVectorView<const T>& c) const {
+
+    ZT_VALIDATE(valid_apply_dimensions(c.size()));
+    ZTVector<T> result(c);
+    apply(0, false, 1, result.data(), 1);
+    return result;
+
+}
+
+/**
+ * apply_qt : performs Q^T * c without forming Q
+ *
+ * @param  ZTVectorView<const T> c vector of m elements
+ * @return ZTVector<T> result
+ *
+ */
+template <typename T>
+ZTVector<T> ZTQR<T>::apply_qt(const ZTVectorView<const T>& c) const {
+
+    ZT_VALIDATE(valid_apply_dimensions(c.size()));
+    ZTVector<T> result(c);
+    apply(0, true, 1, result.data(), 1);
+    return result;
+
+}
+
+/**
+ * apply_q : performs Q * C into a reused buffer, c may be a view of out
+ *
+ * @param  ZTMatrixView<const T> c matrix of m rows
+ * @param  ZTMatrix<T> out result
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTQR<T>::apply_q(const ZTMatrixView<const T>& c, ZTMatrix<T>& out) const {
+
+    ZT_VALIDATE(valid_apply_dimensions(c.get_matrix_rows()));
+    if (c.data() != out.data() || c.ld() != out.stride() || c.stride() != 1 ||
+        c.get_matrix_rows() != out.get_matrix_rows() || c.get_matrix_cols() != out.get_matrix_cols())
+    {
+        ZTMatrix<T> copy(c);
+        out = std::move(copy);
+    }
+    apply(0, false, out.get_matrix_cols(), out.data(), out.stride());
+
+}
+
+/**
+ * apply_qt : performs Q^T * C into a reused buffer, c may be a view of out
+ *
+ * @param  ZTMatrixView<const T> c matrix of m rows
+ * @param  ZTMatrix<T> out result
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTQR<T>::apply_qt(const ZTMatrixView<const T>& c, ZTMatrix<T>& out) const {
+
+    ZT_VALIDATE(valid_apply_dimensions(c.get_matrix_rows()));
+    if (c.data() != out.data() || c.ld() != out.stride() || c.stride() != 1 ||
+        c.get_matrix_rows() != out.get_matrix_rows() || c.get_matrix_cols() != out.get_matrix_cols())
+    {
+        ZTMatrix<T> copy(c);
+        out = std::move(copy);
+    }
+    apply(0, true, out.get_matrix_cols(), out.data(), out.stride());
+
+}
+
+/**
+ * solve : least-squares solution of A * x = b, R * x = (Q^T * b)(0 : n)
+ *
+ * @param  ZTVectorView<const T> b right-hand side of m elements
+ * @return ZTVector<T> result (n elements)
+ *
+ */
+template <typename T>
+ZTVector<T> ZTQR<T>::solve(const ZTVectorView<const T>& b) const {
+
+    ZTVector<T> result(b);
+    solve(result.view(), result);
+    return result;
+
+}
+
+/**
+ * solve : least-squares solutions of A * X = B, one column of X for each
+ *         column of B
+ *
+ * @param  ZTMatrixView<const T> b right-hand sides of m rows
+ * @return ZTMatrix<T> result (n rows)
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTQR<T>::solve(const ZTMatrixView<const T>& b) const {
+
+    ZTMatrix<T> result(b);
+    solve(result.view(), result);
+    return result;
+
+}
+
+/**
+ * solve : least-squares solution of A * x = b into a reused buffer, b may be
+ *         a view of out
+ *
+ * @param  ZTVectorView<const T> b right-hand side of m elements
+ * @param  ZTVector<T> out solution (n elements)
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTQR<T>::solve(const ZTVectorView<const T>& b, ZTVector<T>& out) const {
+
+    ZT_VALIDATE(valid_apply_dimensions(b.size()));
+    ZT_VALIDATE(valid_least_squares());
+    ZTVector<T> work(b);
+    apply(0, true, 1, work.data(), 1);
+    work.set_vector_size(matrix_cols);
+    upper_solve(1, work.data(), 1);
+    out = std::move(work);
+
+}
+
+/**
+ * solve : least-squares solutions of A * X = B into a reused buffer, b may be
+ *         a view of out
+ *
+ * @param  ZTMatrixView<const T> b right-hand sides of m rows
+ * @param  ZTMatrix<T> out solutions (n rows)
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTQR<T>::solve(const ZTMatrixView<const T>& b, ZTMatrix<T>& out) const {
+
+    ZT_VALIDATE(valid_apply_dimensions(b.get_matrix_rows()));
+    ZT_VALIDATE(valid_least_squares());
+    const std::size_t cols = b.get_matrix_cols();
+    ZTMatrix<T> work(b);
+    apply(0, true, cols, work.data(), work.stride());
+    ZTMatrix<T> result(ZTMatrixView<const T>(work.data(), matrix_cols, cols, work.stride()));
+    upper_solve(cols, result.data(), result.stride());
+    out = std::move(result);
+
+}
+
+/**
+ * valid_apply_dimensions : checks that an operand has one row per row of the
+ *                          factorized matrix
+ *
+ * @param  std::size_t rows rows of the operand
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTQR<T>::valid_apply_dimensions(std::size_t rows) const {
+
+    if (rows != matrix_rows)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Operand of " << rows << " rows does not match Q of order: " << matrix_rows << "!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * valid_least_squares : checks that the factorized matrix has at least as
+ *                       many rows as columns and full column rank
+ *
+ * @param  nothing
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTQR<T>::valid_least_squares() const {
+
+    if (matrix_rows < matrix_cols)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Matrices of dimensions: " << matrix_rows << "x" << matrix_cols << " has fewer rows than columns for least squares!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+    if (!is_full_rank())
+    {
+        zt_raise<std::domain_error>("Matrix is rank deficient, the least-squares solution is not unique!.");
+    }
+
+}
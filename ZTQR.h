@@ -0,0 +1,124 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ZTQR_H
+#define ZTQR_H
+
+#include <vector>
+#include <cstddef>
+
+#include "ZTMatrix.h"
+#include "ZTVector.h"
+#include "ZTMatrixView.h"
+#include "ZTVectorView.h"
+#include "ZTAlignedAllocator.h"
+
+enum ZTQRMethod {
+    ZT_QR_HOUSEHOLDER = 0, // blocked Householder over the whole matrix
+    ZT_QR_TSQR = 1         // tall-skinny: cache-sized row blocks in parallel, then their R factors
+};
+
+/*
+ * ZTQR : Householder QR factorization A = Q * R of an m x n matrix. Q is
+ *        never formed: it is kept as the Householder vectors below the
+ *        diagonal and the triangular T factors of their compact WY form
+ *        Q = I - V * T * V^T, and applied to any block of vectors with two
+ *        GEMMs and a small triangular product per panel of reflectors.
+ *
+ *        ZT_QR_HOUSEHOLDER factors panels of block_size columns and applies
+ *        each panel to the trailing columns through the GEMM engine.
+ *
+ *        ZT_QR_TSQR cuts the rows into blocks that fit in L2, factors them
+ *        on the thread pool, stacks their R factors and factors the stack
+ *        the same way until a single block remains. Q is then the product of
+ *        the block reflectors of every level, applied level by level, and
+ *        the first n rows of Q^T * A are R in both methods.
+ *
+ *        solve gives the least-squares solution of A * x = b for m >= n and
+ *        a full-rank A.
+ */
+template <typename T>
+class ZTQR {
+
+private:
+    typedef std::vector<T, ZTAlignedAllocator<T> > buffer_type;
+
+    static constexpr std::size_t block_size = 32;          // reflectors per compact WY panel
+    static constexpr std::size_t leaf_bytes = 512 * 1024;  // TSQR row blocks sized to stay in L2
+
+    std::vector<ZTMatrix<T> > levels;    // row blocks with R above and reflectors below the diagonal
+    std::vector<buffer_type> triangles;  // T factors of every panel, cols x block_size per row block
+    std::size_t block_rows;              // rows per block at every level
+    std::size_t matrix_rows;
+    std::size_t matrix_cols;
+
+    void factorize(ZTQRMethod method);
+    void apply(std::size_t level, bool transposed, std::size_t cols, T* c, std::size_t ldc) const;
+
+    static void panel(std::size_t rows, std::size_t cols, T* a, std::size_t ld, T* tau);
+    static void triangle(std::size_t rows, std::size_t cols, const T* v, std::size_t ld,
+                         const T* tau, T* t);
+    static void apply_panel(std::size_t rows, std::size_t k, const T* v, std::size_t ld, const T* t,
+                            bool transposed, std::size_t cols, T* c, std::size_t ldc);
+    static void factor_block(std::size_t rows, std::size_t cols, T* a, std::size_t ld, T* t);
+    static void apply_block(std::size_t rows, std::size_t k, const T* a, std::size_t ld, const T* t,
+                            bool transposed, std::size_t cols, T* c, std::size_t ldc);
+
+    void upper_solve(std::size_t cols, T* b, std::size_t ldb) const;
+
+    template <typename U>
+    friend class ZTSymmetricEigen; // applies its tridiagonalizing reflectors in compact WY form
+
+public:
+    explicit ZTQR(const ZTMatrix<T>& m, ZTQRMethod method = ZT_QR_HOUSEHOLDER);
+    explicit ZTQR(ZTMatrix<T>&& m, ZTQRMethod method = ZT_QR_HOUSEHOLDER);  // factorizes in the buffer of m
+    explicit ZTQR(const ZTMatrixView<const T>& m, ZTQRMethod method = ZT_QR_HOUSEHOLDER);
+
+    std::size_t get_matrix_rows() const;
+    std::size_t get_matrix_cols() const;
+    bool is_full_rank() const;
+
+    ZTMatrix<T> q() const;  // thin Q, m x min(m, n)
+    ZTMatrix<T> r() const;  // min(m, n) x n upper triangular
+
+    ZTMatrix<T> apply_q(const ZTMatrixView<const T>& c) const;    // Q * C, without forming Q
+    ZTMatrix<T> apply_qt(const ZTMatrixView<const T>& c) const;   // Q^T * C
+    ZTVector<T> apply_q(const ZTVectorView<const T>& c) const;
+    ZTVector<T> apply_qt(const ZTVectorView<const T>& c) const;
+
+    void apply_q(const ZTMatrixView<const T>& c, ZTMatrix<T>& out) const;
+    void apply_qt(const ZTMatrixView<const T>& c, ZTMatrix<T>& out) const;
+
+    ZTVector<T> solve(const ZTVectorView<const T>& b) const;   // x minimizing || A * x - b ||
+    ZTMatrix<T> solve(const ZTMatrixView<const T>& b) const;
+
+    void solve(const ZTVectorView<const T>& b, ZTVector<T>& out) const;
+    void solve(const ZTMatrixView<const T>& b, ZTMatrix<T>& out) const;
+
+    void valid_apply_dimensions(std::size_t rows) const;
+    void valid_least_squares() const;
+
+};
+
+#endif /* ZTQR_H */
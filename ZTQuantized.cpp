@@ -0,0 +1,1044 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cmath>
+#include <vector>
+#include <limits>
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <algorithm>
+
+#include "ZTCpu.h"
+#include "ZTError.h"
+#include "ZTSimd.h"
+#include "ZTQuantized.h"
+#include "ZTThreadPool.h"
+
+/**
+ * zt_quantized_dot : portable kernel, the int32 sum of x[j] * w[j]
+ *
+ * @param  std::size_t n number of elements
+ * @param  std::uint8_t* x unsigned input
+ * @param  std::int8_t* w signed input
+ * @return std::int32_t result
+ *
+ */
+std::int32_t zt_quantized_dot(std::size_t n, const std::uint8_t* x, const std::int8_t* w) {
+
+    std::int32_t s = 0;
+    for (std::size_t j = 0; j < n; ++j)
+    {
+        s += std::int32_t(x[j]) * std::int32_t(w[j]);
+    }
+    return s;
+
+}
+
+/**
+ * zt_quantized_dot_rows : portable kernel, r[i] = w[i * ldw + 0 .. n) . x
+ *                         for the four rows i = 0 .. 3
+ *
+ * @param  std::size_t n number of elements
+ * @param  std::uint8_t* x unsigned input
+ * @param  std::int8_t* w first element of the first row
+ * @param  std::size_t ldw distance between rows
+ * @param  std::int32_t* r four results
+ * @return nothing
+ *
+ */
+void zt_quantized_dot_rows(std::size_t n, const std::uint8_t* x, const std::int8_t* w, std::size_t ldw, std::int32_t* r) {
+
+    const std::int8_t* w1 = w + ldw;
+    const std::int8_t* w2 = w + 2 * ldw;
+    const std::int8_t* w3 = w + 3 * ldw;
+    std::int32_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (std::size_t j = 0; j < n; ++j)
+    {
+        const std::int32_t xj = x[j];
+        s0 += xj * w[j];
+        s1 += xj * w1[j];
+        s2 += xj * w2[j];
+        s3 += xj * w3[j];
+    }
+    r[0] = s0;
+    r[1] = s1;
+    r[2] = s2;
+    r[3] = s3;
+
+}
+
+#ifdef ZT_SIMD_X86
+
+/**
+ * zt_quantized_avx2_sum : horizontal sum of eight int32 lanes
+ *
+ * @param  __m256i v
+ * @return std::int32_t result
+ *
+ */
+ZT_AVX2_INLINE std::int32_t zt_quantized_avx2_sum(__m256i v) {
+
+    __m128i s = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0x4e));
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0xb1));
+    return _mm_cvtsi128_si32(s);
+
+}
+
+/**
+ * zt_quantized_avx512_sum : horizontal sum of sixteen int32 lanes, spilled
+ *                           rather than extracted since the extract intrinsics
+ *                           behind _mm512_reduce_add_epi32 trip -Wuninitialized
+ *                           on GCC 12
+ *
+ * @param  __m512i v
+ * @return std::int32_t result
+ *
+ */
+ZT_AVX512_INLINE std::int32_t zt_quantized_avx512_sum(__m512i v) {
+
+    alignas(64) std::int32_t lanes[16];
+    _mm512_store_si512(lanes, v);
+    const __m256i lo = _mm256_load_si256(reinterpret_cast<const __m256i*>(lanes));
+    const __m256i hi = _mm256_load_si256(reinterpret_cast<const __m256i*>(lanes + 8));
+    return zt_quantized_avx2_sum(_mm256_add_epi32(lo, hi));
+
+}
+
+/**
+ * zt_quantized_avx2_madd : int32 pair sums of 16 bytes of x and w, widened
+ *                          to int16 first so that vpmaddwd cannot saturate
+ *
+ * @param  __m256i x 16 bytes of x already widened to int16
+ * @param  std::int8_t* w signed input
+ * @return __m256i eight pair sums
+ *
+ */
+ZT_AVX2_INLINE __m256i zt_quantized_avx2_madd(__m256i x, const std::int8_t* w) {
+
+    const __m256i w16 = _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(w)));
+    return _mm256_madd_epi16(x, w16);
+
+}
+
+/**
+ * zt_quantized_avx2_dot : AVX2 kernel, 16 bytes of x widened once per step
+ *
+ * @param  std::size_t n number of elements
+ * @param  std::uint8_t* x unsigned input
+ * @param  std::int8_t* w signed input
+ * @return std::int32_t result
+ *
+ */
+ZT_AVX2_TARGET std::int32_t zt_quantized_avx2_dot(std::size_t n, const std::uint8_t* x, const std::int8_t* w) {
+
+    __m256i s = _mm256_setzero_si256();
+    __m256i t = _mm256_setzero_si256();
+    std::size_t j = 0;
+    for (; j + 32 <= n; j += 32)
+    {
+        const __m256i x0 = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(x + j)));
+        const __m256i x1 = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(x + j + 16)));
+        s = _mm256_add_epi32(s, zt_quantized_avx2_madd(x0, w + j));
+        t = _mm256_add_epi32(t, zt_quantized_avx2_madd(x1, w + j + 16));
+    }
+    for (; j + 16 <= n; j += 16)
+    {
+        const __m256i x0 = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(x + j)));
+        s = _mm256_add_epi32(s, zt_quantized_avx2_madd(x0, w + j));
+    }
+    std::int32_t r = zt_quantized_avx2_sum(_mm256_add_epi32(s, t));
+    for (; j < n; ++j)
+    {
+        r += std::int32_t(x[j]) * std::int32_t(w[j]);
+    }
+    return r;
+
+}
+
+/**
+ * zt_quantized_avx2_dot_rows : AVX2 kernel for four rows of w, every block
+ *                              of x widened once for the four rows
+ *
+ * @param  std::size_t n number of elements
+ * @param  std::uint8_t* x unsigned input
+ * @param  std::int8_t* w first element of the first row
+ * @param  std::size_t ldw distance between rows
+ * @param  std::int32_t* r four results
+ * @return nothing
+ *
+ */
+ZT_AVX2_TARGET void zt_quantized_avx2_dot_rows(std::size_t n, const std::uint8_t* x, const std::int8_t* w, std::size_t ldw, std::int32_t* r) {
+
+    const std::int8_t* w1 = w + ldw;
+    const std::int8_t* w2 = w + 2 * ldw;
+    const std::int8_t* w3 = w + 3 * ldw;
+    __m256i s0 = _mm256_setzero_si256();
+    __m256i s1 = s0, s2 = s0, s3 = s0;
+    std::size_t j = 0;
+    for (; j + 16 <= n; j += 16)
+    {
+        const __m256i x0 = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(x + j)));
+        s0 = _mm256_add_epi32(s0, zt_quantized_avx2_madd(x0, w + j));
+        s1 = _mm256_add_epi32(s1, zt_quantized_avx2_madd(x0, w1 + j));
+        s2 = _mm256_add_epi32(s2, zt_quantized_avx2_madd(x0, w2 + j));
+        s3 = _mm256_add_epi32(s3, zt_quantized_avx2_madd(x0, w3 + j));
+    }
+    std::int32_t r0 = zt_quantized_avx2_sum(s0);
+    std::int32_t r1 = zt_quantized_avx2_sum(s1);
+    std::int32_t r2 = zt_quantized_avx2_sum(s2);
+    std::int32_t r3 = zt_quantized_avx2_sum(s3);
+    for (; j < n; ++j)
+    {
+        const std::int32_t xj = x[j];
+        r0 += xj * w[j];
+        r1 += xj * w1[j];
+        r2 += xj * w2[j];
+        r3 += xj * w3[j];
+    }
+    r[0] = r0;
+    r[1] = r1;
+    r[2] = r2;
+    r[3] = r3;
+
+}
+
+/**
+ * zt_quantized_vnni_dot : AVX-512 VNNI kernel, vpdpbusd multiplies 64 byte
+ *                         pairs and adds them into int32 lanes without any
+ *                         intermediate saturation, the tail is a masked load
+ *
+ * @param  std::size_t n number of elements
+ * @param  std::uint8_t* x unsigned input
+ * @param  std::int8_t* w signed input
+ * @return std::int32_t result
+ *
+ */
+ZT_VNNI_TARGET std::int32_t zt_quantized_vnni_dot(std::size_t n, const std::uint8_t* x, const std::int8_t* w) {
+
+    __m512i s = _mm512_setzero_si512();
+    __m512i t = _mm512_setzero_si512();
+    std::size_t j = 0;
+    for (; j + 128 <= n; j += 128)
+    {
+        s = _mm512_dpbusd_epi32(s, _mm512_loadu_si512(x + j), _mm512_loadu_si512(w + j));
+        t = _mm512_dpbusd_epi32(t, _mm512_loadu_si512(x + j + 64), _mm512_loadu_si512(w + j + 64));
+    }
+    for (; j + 64 <= n; j += 64)
+    {
+        s = _mm512_dpbusd_epi32(s, _mm512_loadu_si512(x + j), _mm512_loadu_si512(w + j));
+    }
+    if (j < n)
+    {
+        const __mmask64 tail = (~__mmask64(0)) >> (64 - (n - j));
+        s = _mm512_dpbusd_epi32(s, _mm512_maskz_loadu_epi8(tail, x + j), _mm512_maskz_loadu_epi8(tail, w + j));
+    }
+    return zt_quantized_avx512_sum(_mm512_add_epi32(s, t));
+
+}
+
+/**
+ * zt_quantized_vnni_dot_rows : AVX-512 VNNI kernel for four rows of w
+ *
+ * @param  std::size_t n number of elements
+ * @param  std::uint8_t* x unsigned input
+ * @param  std::int8_t* w first element of the first row
+ * @param  std::size_t ldw distance between rows
+ * @param  std::int32_t* r four results
+ * @return nothing
+ *
+ */
+ZT_VNNI_TARGET void zt_quantized_vnni_dot_rows(std::size_t n, const std::uint8_t* x, const std::int8_t* w, std::size_t ldw, std::int32_t* r) {
+
+    const std::int8_t* w1 = w + ldw;
+    const std::int8_t* w2 = w + 2 * ldw;
+    const std::int8_t* w3 = w + 3 * ldw;
+    __m512i s0 = _mm512_setzero_si512();
+    __m512i s1 = s0, s2 = s0, s3 = s0;
+    std::size_t j = 0;
+    for (; j + 64 <= n; j += 64)
+    {
+        const __m512i x0 = _mm512_loadu_si512(x + j);
+        s0 = _mm512_dpbusd_epi32(s0, x0, _mm512_loadu_si512(w + j));
+        s1 = _mm512_dpbusd_epi32(s1, x0, _mm512_loadu_si512(w1 + j));
+        s2 = _mm512_dpbusd_epi32(s2, x0, _mm512_loadu_si512(w2 + j));
+        s3 = _mm512_dpbusd_epi32(s3, x0, _mm512_loadu_si512(w3 + j));
+    }
+    if (j < n)
+    {
+        const __mmask64 tail = (~__mmask64(0)) >> (64 - (n - j));
+        const __m512i x0 = _mm512_maskz_loadu_epi8(tail, x + j);
+        s0 = _mm512_dpbusd_epi32(s0, x0, _mm512_maskz_loadu_epi8(tail, w + j));
+        s1 = _mm512_dpbusd_epi32(s1, x0, _mm512_maskz_loadu_epi8(tail, w1 + j));
+        s2 = _mm512_dpbusd_epi32(s2, x0, _mm512_maskz_loadu_epi8(tail, w2 + j));
+        s3 = _mm512_dpbusd_epi32(s3, x0, _mm512_maskz_loadu_epi8(tail, w3 + j));
+    }
+    r[0] = zt_quantized_avx512_sum(s0);
+    r[1] = zt_quantized_avx512_sum(s1);
+    r[2] = zt_quantized_avx512_sum(s2);
+    r[3] = zt_quantized_avx512_sum(s3);
+
+}
+
+#endif /* ZT_SIMD_X86 */
+
+/**
+ * zt_quantized_dequantize : turns the integer sum S of a row of w with x into
+ *                           the float product, the corrections for the
+ *                           zero-points taken in 64 bits
+ *
+ * @param  std::int32_t s integer sum S
+ * @param  std::size_t k length of the rows
+ * @param  float w_scale
+ * @param  std::int32_t w_zero
+ * @param  std::int32_t w_sum sum of the raw row of w
+ * @param  float x_scale
+ * @param  std::int32_t x_zero
+ * @param  std::int32_t x_sum sum of the raw x
+ * @return float result
+ *
+ */
+inline float zt_quantized_dequantize(std::int32_t s, std::size_t k,
+                                     float w_scale, std::int32_t w_zero, std::int32_t w_sum,
+                                     float x_scale, std::int32_t x_zero, std::int32_t x_sum) {
+
+    const std::int64_t centred = std::int64_t(s) - std::int64_t(x_zero) * w_sum - std::int64_t(w_zero) * x_sum
+                               + std::int64_t(k) * w_zero * x_zero;
+    return w_scale * x_scale * float(centred);
+
+}
+
+/**
+ * zt_quantized_parameters : scale and zero-point mapping [lo, hi], widened
+ *                           to contain 0, onto the range of Q
+ *
+ * @param  double lo smallest value
+ * @param  double hi largest value
+ * @param  float& scale
+ * @param  std::int32_t& zero_point
+ * @return nothing
+ *
+ */
+template <typename Q>
+void zt_quantized_parameters(double lo, double hi, float& scale, std::int32_t& zero_point) {
+
+    const double qmin = std::numeric_limits<Q>::min();
+    const double qmax = std::numeric_limits<Q>::max();
+    lo = std::min(lo, 0.0);
+    hi = std::max(hi, 0.0);
+    const double step = (hi - lo) / (qmax - qmin);
+    scale = step > 0.0 && std::isfinite(step) ? float(step) : 1.0f;
+    zero_point = std::int32_t(std::min(qmax, std::max(qmin, qmin - std::nearbyint(lo / scale))));
+
+}
+
+/**
+ * zt_quantized_round : nearest Q of scale * (q - zero_point) to x, clamped to
+ *                      the range of Q
+ *
+ * @param  double x value
+ * @param  float scale
+ * @param  std::int32_t zero_point
+ * @return Q result
+ *
+ */
+template <typename Q>
+inline Q zt_quantized_round(double x, float scale, std::int32_t zero_point) {
+
+    const double qmin = std::numeric_limits<Q>::min();
+    const double qmax = std::numeric_limits<Q>::max();
+    return Q(std::min(qmax, std::max(qmin, std::nearbyint(x / scale) + zero_point)));
+
+}
+
+/**
+ * zt_quantized_valid_parameters : checks an already quantized scale and
+ *                                 zero-point
+ *
+ * @param  float scale
+ * @param  std::int32_t zero_point
+ * @return void
+ *
+ */
+template <typename Q>
+inline void zt_quantized_valid_parameters(float scale, std::int32_t zero_point) {
+
+    if (!(scale > 0.0f) || !std::isfinite(scale) ||
+        zero_point < std::numeric_limits<Q>::min() || zero_point > std::numeric_limits<Q>::max())
+    {
+        std::ostringstream invalid_parameters;
+        invalid_parameters << "Scale " << scale << " and zero-point " << zero_point << " are not valid quantization parameters!.";
+        zt_raise<std::invalid_argument>(invalid_parameters.str());
+    }
+
+}
+
+/**
+ * select_kernels : widest kernels the processor supports
+ *
+ * @param  nothing
+ * @return ZTQuantizedKernels kernels
+ *
+ */
+ZTQuantizedKernels ZTQuantizedGemm::select_kernels() {
+
+#ifdef ZT_SIMD_X86
+    if (ZTCpu::vnni())
+    {
+        ZTQuantizedKernels k = { zt_quantized_vnni_dot, zt_quantized_vnni_dot_rows };
+        return k;
+    }
+    if (ZTCpu::instruction_set() >= ZT_ISA_AVX2)
+    {
+        ZTQuantizedKernels k = { zt_quantized_avx2_dot, zt_quantized_avx2_dot_rows };
+        return k;
+    }
+#endif
+    ZTQuantizedKernels k = { zt_quantized_dot, zt_quantized_dot_rows };
+    return k;
+
+}
+
+/**
+ * kernels : kernels in use, selected once on first call
+ *
+ * @param  nothing
+ * @return const ZTQuantizedKernels& kernels
+ *
+ */
+const ZTQuantizedKernels& ZTQuantizedGemm::kernels() {
+
+    static const ZTQuantizedKernels selected = select_kernels();
+    return selected;
+
+}
+
+/**
+ * gemv : performs y = W * x for an m x k matrix W with rows ldw bytes apart,
+ *        four rows at a time; large products split the rows of y over the
+ *        thread pool
+ *
+ * @param  std::size_t m rows of W, size of y
+ * @param  std::size_t k cols of W, size of x
+ * @param  std::int8_t* w W
+ * @param  float* w_scale scale of every row of W
+ * @param  std::int32_t* w_zero zero-point of every row of W
+ * @param  std::int32_t* w_sum sum of every raw row of W
+ * @param  std::uint8_t* x x
+ * @param  float x_scale
+ * @param  std::int32_t x_zero
+ * @param  std::int32_t x_sum sum of the raw x
+ * @param  float* y contiguous result
+ * @return nothing
+ *
+ */
+void ZTQuantizedGemm::gemv(std::size_t m, std::size_t k,
+                           const std::int8_t* w, std::size_t ldw, const float* w_scale,
+                           const std::int32_t* w_zero, const std::int32_t* w_sum,
+                           const std::uint8_t* x, float x_scale, std::int32_t x_zero, std::int32_t x_sum,
+                           float* y) {
+
+    const ZTQuantizedKernels& kern = kernels();
+    auto rows = [&](std::size_t i0, std::size_t i1) {
+        std::int32_t r[4];
+        std::size_t i = i0;
+        for (; i + 4 <= i1; i += 4)
+        {
+            kern.dot_rows(k, x, w + i * ldw, ldw, r);
+            for (std::size_t q = 0; q < 4; ++q)
+            {
+                y[i + q] = zt_quantized_dequantize(r[q], k, w_scale[i + q], w_zero[i + q], w_sum[i + q], x_scale, x_zero, x_sum);
+            }
+        }
+        for (; i < i1; ++i)
+        {
+            y[i] = zt_quantized_dequantize(kern.dot(k, x, w + i * ldw), k, w_scale[i], w_zero[i], w_sum[i], x_scale, x_zero, x_sum);
+        }
+    };
+    ZTThreadPool& pool = ZTThreadPool::instance();
+    if (m * k >= parallel_product && m >= 8 && pool.get_num_threads() > 1)
+    {
+        const std::size_t chunks = std::min(4 * pool.get_num_threads(), m / 4);
+        const std::size_t chunk_rows = ((m + chunks - 1) / chunks + 3) / 4 * 4;
+        pool.parallel_for((m + chunk_rows - 1) / chunk_rows, [&](std::size_t chunk) {
+            const std::size_t i0 = chunk * chunk_rows;
+            rows(i0, std::min(m, i0 + chunk_rows));
+        });
+        return;
+    }
+    rows(0, m);
+
+}
+
+/**
+ * gemm : performs C = W * X^T for an m x k matrix W and an n x k matrix X.
+ *        Blocks of rows of W that fit in L2 are swept against every row of
+ *        X, which stays in L1 across the four row kernel calls; large
+ *        products split the blocks over the thread pool, so the threads
+ *        never write the same rows of C
+ *
+ * @param  std::size_t m rows of W and C
+ * @param  std::size_t n rows of X, cols of C
+ * @param  std::size_t k cols of W and X
+ * @param  std::int8_t* w W with rows ldw bytes apart
+ * @param  float* w_scale scale of every row of W
+ * @param  std::int32_t* w_zero zero-point of every row of W
+ * @param  std::int32_t* w_sum sum of every raw row of W
+ * @param  std::uint8_t* x X with rows ldx bytes apart
+ * @param  float* x_scale scale of every row of X
+ * @param  std::int32_t* x_zero zero-point of every row of X
+ * @param  std::int32_t* x_sum sum of every raw row of X
+ * @param  float* c C with rows ldc elements apart
+ * @return nothing
+ *
+ */
+void ZTQuantizedGemm::gemm(std::size_t m, std::size_t n, std::size_t k,
+                           const std::int8_t* w, std::size_t ldw, const float* w_scale,
+                           const std::int32_t* w_zero, const std::int32_t* w_sum,
+                           const std::uint8_t* x, std::size_t ldx, const float* x_scale,
+                           const std::int32_t* x_zero, const std::int32_t* x_sum,
+                           float* c, std::size_t ldc) {
+
+    if (m == 0 || n == 0)
+    {
+        return;
+    }
+    const ZTQuantizedKernels& kern = kernels();
+    ZTThreadPool& pool = ZTThreadPool::instance();
+    const bool threaded = m * n * k >= parallel_product && pool.get_num_threads() > 1;
+    std::size_t block_rows = std::max<std::size_t>(4, block_bytes / std::max<std::size_t>(k, 1) / 4 * 4);
+    if (threaded)
+    {
+        block_rows = std::min(block_rows, ((m + pool.get_num_threads() - 1) / pool.get_num_threads() + 3) / 4 * 4);
+    }
+    auto block = [&](std::size_t b) {
+        const std::size_t i0 = b * block_rows;
+        const std::size_t i1 = std::min(m, i0 + block_rows);
+        std::int32_t r[4];
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            const std::uint8_t* xj = x + j * ldx;
+            std::size_t i = i0;
+            for (; i + 4 <= i1; i += 4)
+            {
+                kern.dot_rows(k, xj, w + i * ldw, ldw, r);
+                for (std::size_t q = 0; q < 4; ++q)
+                {
+                    c[(i + q) * ldc + j] = zt_quantized_dequantize(r[q], k, w_scale[i + q], w_zero[i + q], w_sum[i + q],
+                                                                   x_scale[j], x_zero[j], x_sum[j]);
+                }
+            }
+            for (; i < i1; ++i)
+            {
+                c[i * ldc + j] = zt_quantized_dequantize(kern.dot(k, xj, w + i * ldw), k, w_scale[i], w_zero[i], w_sum[i],
+                                                         x_scale[j], x_zero[j], x_sum[j]);
+            }
+        }
+    };
+    const std::size_t blocks = (m + block_rows - 1) / block_rows;
+    if (threaded && blocks > 1)
+    {
+        pool.parallel_for(blocks, block);
+        return;
+    }
+    for (std::size_t b = 0; b < blocks; ++b)
+    {
+        block(b);
+    }
+
+}
+
+/**
+ * Constructor : quantizes a vector, the range of its values mapped onto the
+ *               range of Q
+ *
+ * @param  ZTVector<T> v
+ *
+ */
+template <typename Q>
+template <typename T>
+ZTQuantizedVector<Q>::ZTQuantizedVector(const ZTVector<T>& v) : quantized_data(v.size()), quantized_sum(0) {
+
+    const T* a = v.data();
+    double lo = 0.0, hi = 0.0;
+    for (std::size_t i = 0, n = v.size(); i < n; ++i)
+    {
+        lo = std::min(lo, double(a[i]));
+        hi = std::max(hi, double(a[i]));
+    }
+    zt_quantized_parameters<Q>(lo, hi, quantized_scale, quantized_zero_point);
+    for (std::size_t i = 0, n = v.size(); i < n; ++i)
+    {
+        quantized_data[i] = zt_quantized_round<Q>(a[i], quantized_scale, quantized_zero_point);
+        quantized_sum += quantized_data[i];
+    }
+
+}
+
+/**
+ * Constructor : takes over already quantized values
+ *
+ * @param  std::vector<Q> values
+ * @param  float scale
+ * @param  std::int32_t zero_point
+ *
+ */
+template <typename Q>
+ZTQuantizedVector<Q>::ZTQuantizedVector(const std::vector<Q>& values, float scale, std::int32_t zero_point)
+    : quantized_data(values.begin(), values.end()), quantized_scale(scale), quantized_zero_point(zero_point), quantized_sum(0) {
+
+    zt_quantized_valid_parameters<Q>(scale, zero_point);
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        quantized_sum += values[i];
+    }
+
+}
+
+/**
+ * get_vector_size : gets the number of elements
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename Q>
+inline std::size_t ZTQuantizedVector<Q>::get_vector_size() const {
+
+    return quantized_data.size();
+
+}
+
+/**
+ * data : gets the raw quantized elements
+ *
+ * @param  nothing
+ * @return const Q*
+ *
+ */
+template <typename Q>
+inline const Q* ZTQuantizedVector<Q>::data() const {
+
+    return quantized_data.data();
+
+}
+
+/**
+ * scale : gets the scale
+ *
+ * @param  nothing
+ * @return float
+ *
+ */
+template <typename Q>
+inline float ZTQuantizedVector<Q>::scale() const {
+
+    return quantized_scale;
+
+}
+
+/**
+ * zero_point : gets the zero-point
+ *
+ * @param  nothing
+ * @return std::int32_t
+ *
+ */
+template <typename Q>
+inline std::int32_t ZTQuantizedVector<Q>::zero_point() const {
+
+    return quantized_zero_point;
+
+}
+
+/**
+ * at : dequantized element at a zero-based index
+ *
+ * @param  std::size_t i
+ * @return float result
+ *
+ */
+template <typename Q>
+float ZTQuantizedVector<Q>::at(std::size_t i) const {
+
+    valid_index(i);
+    return quantized_scale * float(std::int32_t(quantized_data[i]) - quantized_zero_point);
+
+}
+
+/**
+ * dequantize : the values the vector stands for
+ *
+ * @param  nothing
+ * @return ZTVector<float> result
+ *
+ */
+template <typename Q>
+ZTVector<float> ZTQuantizedVector<Q>::dequantize() const {
+
+    const std::size_t n = quantized_data.size();
+    ZTVector<float> result((std::vector<float>()));
+    result.set_vector_size(n);
+    float* y = result.data();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        y[i] = quantized_scale * float(std::int32_t(quantized_data[i]) - quantized_zero_point);
+    }
+    return result;
+
+}
+
+/**
+ * valid_index : checks that a zero-based index is inside the vector
+ *
+ * @param  std::size_t i
+ * @return void
+ *
+ */
+template <typename Q>
+inline void ZTQuantizedVector<Q>::valid_index(std::size_t i) const {
+
+    if (i >= quantized_data.size())
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Vector index " << i << " out of range for a vector of size " << quantized_data.size() << "!.";
+        zt_raise<std::out_of_range>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * Constructor : quantizes a matrix, the range of every row (ZT_PER_ROW) or
+ *               of the whole matrix (ZT_PER_TENSOR) mapped onto the range of Q
+ *
+ * @param  ZTMatrix<T> m
+ * @param  ZTQuantization scheme
+ *
+ */
+template <typename Q>
+template <typename T>
+ZTQuantizedMatrix<Q>::ZTQuantizedMatrix(const ZTMatrix<T>& m, ZTQuantization scheme)
+    : quantized_data(m.get_matrix_rows() * m.get_matrix_cols()), row_scales(m.get_matrix_rows()),
+      row_zero_points(m.get_matrix_rows()), row_sums(m.get_matrix_rows(), 0),
+      matrix_rows(m.get_matrix_rows()), matrix_cols(m.get_matrix_cols()), quantization(scheme) {
+
+    std::vector<double> lo(matrix_rows, 0.0), hi(matrix_rows, 0.0);
+    for (std::size_t i = 0; i < matrix_rows; ++i)
+    {
+        const T* a = m.data() + i * m.stride();
+        for (std::size_t j = 0; j < matrix_cols; ++j)
+        {
+            lo[i] = std::min(lo[i], double(a[j]));
+            hi[i] = std::max(hi[i], double(a[j]));
+        }
+    }
+    if (scheme == ZT_PER_TENSOR && matrix_rows > 0)
+    {
+        const double all_lo = *std::min_element(lo.begin(), lo.end());
+        const double all_hi = *std::max_element(hi.begin(), hi.end());
+        std::fill(lo.begin(), lo.end(), all_lo);
+        std::fill(hi.begin(), hi.end(), all_hi);
+    }
+    for (std::size_t i = 0; i < matrix_rows; ++i)
+    {
+        zt_quantized_parameters<Q>(lo[i], hi[i], row_scales[i], row_zero_points[i]);
+        const T* a = m.data() + i * m.stride();
+        Q* q = quantized_data.data() + i * matrix_cols;
+        for (std::size_t j = 0; j < matrix_cols; ++j)
+        {
+            q[j] = zt_quantized_round<Q>(a[j], row_scales[i], row_zero_points[i]);
+            row_sums[i] += q[j];
+        }
+    }
+
+}
+
+/**
+ * Constructor : takes over already quantized row-major values, with one
+ *               scale and zero-point (per tensor) or one per row
+ *
+ * @param  std::size_t rows
+ * @param  std::size_t cols
+ * @param  std::vector<Q> values
+ * @param  std::vector<float> scales
+ * @param  std::vector<std::int32_t> zero_points
+ *
+ */
+template <typename Q>
+ZTQuantizedMatrix<Q>::ZTQuantizedMatrix(std::size_t rows, std::size_t cols, const std::vector<Q>& values,
+                                        const std::vector<float>& scales,
+                                        const std::vector<std::int32_t>& zero_points)
+    : quantized_data(values.begin(), values.end()), row_scales(rows), row_zero_points(rows), row_sums(rows, 0),
+      matrix_rows(rows), matrix_cols(cols), quantization(scales.size() == 1 ? ZT_PER_TENSOR : ZT_PER_ROW) {
+
+    if (values.size() != rows * cols || zero_points.size() != scales.size() || (scales.size() != 1 && scales.size() != rows))
+    {
+        std::ostringstream invalid_arrays;
+        invalid_arrays << "Arrays of sizes: " << values.size() << ", " << scales.size() << " and " << zero_points.size() << " do not describe a quantized " << rows << "x" << cols << " matrix!.";
+        zt_raise<std::invalid_argument>(invalid_arrays.str());
+    }
+    for (std::size_t i = 0; i < rows; ++i)
+    {
+        const std::size_t p = quantization == ZT_PER_TENSOR ? 0 : i;
+        zt_quantized_valid_parameters<Q>(scales[p], zero_points[p]);
+        row_scales[i] = scales[p];
+        row_zero_points[i] = zero_points[p];
+        for (std::size_t j = 0; j < cols; ++j)
+        {
+            row_sums[i] += values[i * cols + j];
+        }
+    }
+
+}
+
+/**
+ * get_matrix_rows : gets the number of rows
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename Q>
+inline std::size_t ZTQuantizedMatrix<Q>::get_matrix_rows() const {
+
+    return matrix_rows;
+
+}
+
+/**
+ * get_matrix_cols : gets the number of columns
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename Q>
+inline std::size_t ZTQuantizedMatrix<Q>::get_matrix_cols() const {
+
+    return matrix_cols;
+
+}
+
+/**
+ * scheme : gets whether the parameters are per tensor or per row
+ *
+ * @param  nothing
+ * @return ZTQuantization
+ *
+ */
+template <typename Q>
+inline ZTQuantization ZTQuantizedMatrix<Q>::scheme() const {
+
+    return quantization;
+
+}
+
+/**
+ * data : gets the raw quantized elements, row-major
+ *
+ * @param  nothing
+ * @return const Q*
+ *
+ */
+template <typename Q>
+inline const Q* ZTQuantizedMatrix<Q>::data() const {
+
+    return quantized_data.data();
+
+}
+
+/**
+ * scale : gets the scale of a row
+ *
+ * @param  std::size_t row
+ * @return float
+ *
+ */
+template <typename Q>
+inline float ZTQuantizedMatrix<Q>::scale(std::size_t row) const {
+
+    valid_index(row, 0);
+    return row_scales[row];
+
+}
+
+/**
+ * zero_point : gets the zero-point of a row
+ *
+ * @param  std::size_t row
+ * @return std::int32_t
+ *
+ */
+template <typename Q>
+inline std::int32_t ZTQuantizedMatrix<Q>::zero_point(std::size_t row) const {
+
+    valid_index(row, 0);
+    return row_zero_points[row];
+
+}
+
+/**
+ * at : dequantized element at a zero-based index
+ *
+ * @param  std::size_t row
+ * @param  std::size_t col
+ * @return float result
+ *
+ */
+template <typename Q>
+float ZTQuantizedMatrix<Q>::at(std::size_t row, std::size_t col) const {
+
+    valid_index(row, col);
+    return row_scales[row] * float(std::int32_t(quantized_data[row * matrix_cols + col]) - row_zero_points[row]);
+
+}
+
+/**
+ * dequantize : the values the matrix stands for
+ *
+ * @param  nothing
+ * @return ZTMatrix<float> result
+ *
+ */
+template <typename Q>
+ZTMatrix<float> ZTQuantizedMatrix<Q>::dequantize() const {
+
+    ZTMatrix<float> result(matrix_rows, matrix_cols, 0.0f);
+    for (std::size_t i = 0; i < matrix_rows; ++i)
+    {
+        const Q* q = quantized_data.data() + i * matrix_cols;
+        float* a = result.data() + i * result.stride();
+        for (std::size_t j = 0; j < matrix_cols; ++j)
+        {
+            a[j] = row_scales[i] * float(std::int32_t(q[j]) - row_zero_points[i]);
+        }
+    }
+    return result;
+
+}
+
+/**
+ * matvec : performs W * x into float, without dequantizing either operand
+ *
+ * @param  ZTQuantizedVector<std::uint8_t> x
+ * @return ZTVector<float> result
+ *
+ */
+template <typename Q>
+ZTVector<float> ZTQuantizedMatrix<Q>::matvec(const ZTQuantizedVector<std::uint8_t>& x) const {
+
+    static_assert(std::is_same<Q, std::int8_t>::value, "Products take signed 8-bit weights on the left!.");
+    ZT_VALIDATE(valid_matrix_vector_product(x.get_vector_size()));
+    ZTVector<float> result((std::vector<float>()));
+    result.set_vector_size(matrix_rows);
+    ZTQuantizedGemm::gemv(matrix_rows, matrix_cols, quantized_data.data(), matrix_cols, row_scales.data(),
+                          row_zero_points.data(), row_sums.data(),
+                          x.data(), x.quantized_scale, x.quantized_zero_point, x.quantized_sum, result.data());
+    return result;
+
+}
+
+/**
+ * multiply : performs W * X^T into float for X holding one activation
+ *            vector per row, without dequantizing either operand
+ *
+ * @param  ZTQuantizedMatrix<std::uint8_t> x
+ * @return ZTMatrix<float> result
+ *
+ */
+template <typename Q>
+ZTMatrix<float> ZTQuantizedMatrix<Q>::multiply(const ZTQuantizedMatrix<std::uint8_t>& x) const {
+
+    static_assert(std::is_same<Q, std::int8_t>::value, "Products take signed 8-bit weights on the left!.");
+    ZT_VALIDATE(valid_matrix_product(x.matrix_rows, x.matrix_cols));
+    ZTMatrix<float> result(matrix_rows, x.matrix_rows, 0.0f);
+    ZTQuantizedGemm::gemm(matrix_rows, x.matrix_rows, matrix_cols,
+                          quantized_data.data(), matrix_cols, row_scales.data(), row_zero_points.data(), row_sums.data(),
+                          x.quantized_data.data(), x.matrix_cols, x.row_scales.data(), x.row_zero_points.data(), x.row_sums.data(),
+                          result.data(), result.stride());
+    return result;
+
+}
+
+/**
+ * valid_matrix_vector_product : checks for valid matrix-vector product dimensions
+ *
+ * @param  std::size_t size size of the vector
+ * @return void
+ *
+ */
+template <typename Q>
+inline void ZTQuantizedMatrix<Q>::valid_matrix_vector_product(std::size_t size) const {
+
+    if (matrix_cols != size)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Matrix of dimensions: " << matrix_rows << "x" << matrix_cols << " and vector of size " << size << " are not suitable for matrix-vector product!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * valid_matrix_product : checks that the rows of both operands have the same
+ *                        length, as W * X^T requires
+ *
+ * @param  std::size_t rows rows of X
+ * @param  std::size_t cols cols of X
+ * @return void
+ *
+ */
+template <typename Q>
+inline void ZTQuantizedMatrix<Q>::valid_matrix_product(std::size_t rows, std::size_t cols) const {
+
+    if (matrix_cols != cols)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Matrices of dimensions: " << matrix_rows << "x" << matrix_cols << " and " << rows << "x" << cols << " are not suitable for matrix product with the transpose!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * valid_index : checks that a zero-based index is inside the matrix
+ *
+ * @param  std::size_t row
+ * @param  std::size_t col
+ * @return void
+ *
+ */
+template <typename Q>
+inline void ZTQuantizedMatrix<Q>::valid_index(std::size_t row, std::size_t col) const {
+
+    if (row >= matrix_rows || col >= matrix_cols)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Matrix index (" << row << ", " << col << ") out of range for a " << matrix_rows << "x" << matrix_cols << " matrix!.";
+        zt_raise<std::out_of_range>(invalid_dimensions.str());
+    }
+
+}
@@ -0,0 +1,196 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ZTQUANTIZED_H
+#define ZTQUANTIZED_H
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "ZTAlignedAllocator.h"
+#include "ZTMatrix.h"
+#include "ZTVector.h"
+
+enum ZTQuantization {
+    ZT_PER_TENSOR = 0, // one scale and zero-point for the whole matrix
+    ZT_PER_ROW = 1     // one scale and zero-point per row
+};
+
+/*
+ * Quantized kernels : dot products of unsigned 8-bit x with signed 8-bit w,
+ * accumulated exactly in int32. dot_rows does four rows of w (ldw bytes
+ * apart) at once, so that every load of x serves four rows.
+ */
+struct ZTQuantizedKernels {
+    std::int32_t (*dot)(std::size_t n, const std::uint8_t* x, const std::int8_t* w);
+    void (*dot_rows)(std::size_t n, const std::uint8_t* x, const std::int8_t* w, std::size_t ldw, std::int32_t* r);
+};
+
+/*
+ * ZTQuantizedGemm : int8 products on raw row-major storage, dequantized into
+ *                   float on the fly. A real value is scale * (q - zero), so
+ *                   with the integer sum S = sum_p w_p * x_p the product of a
+ *                   row of w with x is
+ *
+ *                   scale_w * scale_x * (S - zero_x * sum w - zero_w * sum x
+ *                                        + k * zero_w * zero_x)
+ *
+ *                   and only S touches every element: the sums of w and x are
+ *                   kept with the quantized data. S runs on AVX-512 VNNI
+ *                   (vpdpbusd) or on AVX2 bytes widened to int16 and paired
+ *                   by vpmaddwd, both exact where the saturating vpmaddubsw
+ *                   of the usual u8 x s8 trick is not.
+ *
+ *                   gemm computes C = W * X^T with the rows of both operands
+ *                   k bytes long, so blocks of W that stay in L2 are swept
+ *                   against every row of X; the blocks of rows of C are split
+ *                   over the thread pool.
+ */
+class ZTQuantizedGemm {
+
+private:
+    static constexpr std::size_t block_bytes = 128 * 1024;     // rows of W kept in L2
+    static constexpr std::size_t parallel_product = 1 << 20;   // below this threads do not pay off
+
+    static ZTQuantizedKernels select_kernels();
+
+public:
+    static const ZTQuantizedKernels& kernels();
+
+    static void gemv(std::size_t m, std::size_t k,
+                     const std::int8_t* w, std::size_t ldw, const float* w_scale,
+                     const std::int32_t* w_zero, const std::int32_t* w_sum,
+                     const std::uint8_t* x, float x_scale, std::int32_t x_zero, std::int32_t x_sum,
+                     float* y);
+
+    static void gemm(std::size_t m, std::size_t n, std::size_t k,
+                     const std::int8_t* w, std::size_t ldw, const float* w_scale,
+                     const std::int32_t* w_zero, const std::int32_t* w_sum,
+                     const std::uint8_t* x, std::size_t ldx, const float* x_scale,
+                     const std::int32_t* x_zero, const std::int32_t* x_sum,
+                     float* c, std::size_t ldc);
+
+};
+
+/*
+ * ZTQuantizedVector : vector of 8-bit integers Q (std::int8_t or
+ *                     std::uint8_t) with a single scale and zero-point,
+ *                     element i standing for scale * (q_i - zero_point).
+ *                     Quantizing maps the range of the values, widened to
+ *                     contain 0 so that zero stays exact, onto the range of Q.
+ */
+template <typename Q>
+class ZTQuantizedVector {
+
+private:
+    static_assert(std::is_same<Q, std::int8_t>::value || std::is_same<Q, std::uint8_t>::value,
+                  "ZTQuantizedVector holds std::int8_t or std::uint8_t");
+
+    std::vector<Q, ZTAlignedAllocator<Q> > quantized_data;
+    float quantized_scale;
+    std::int32_t quantized_zero_point;
+    std::int32_t quantized_sum;  // sum of the raw q_i
+
+    template <typename U>
+    friend class ZTQuantizedMatrix;
+
+public:
+    template <typename T>
+    explicit ZTQuantizedVector(const ZTVector<T>& v);  // quantizes the values
+    ZTQuantizedVector(const std::vector<Q>& values, float scale, std::int32_t zero_point);  // already quantized
+
+    std::size_t get_vector_size() const;
+    const Q* data() const;
+    float scale() const;
+    std::int32_t zero_point() const;
+
+    float at(std::size_t i) const;  // zero-based, checked, dequantized
+    ZTVector<float> dequantize() const;
+
+    void valid_index(std::size_t i) const;
+
+};
+
+/*
+ * ZTQuantizedMatrix : row-major matrix of 8-bit integers Q (std::int8_t or
+ *                     std::uint8_t) with a scale and zero-point per row or
+ *                     for the whole matrix, element (i, j) standing for
+ *                     scale_i * (q_ij - zero_point_i). Per-tensor parameters
+ *                     are stored once per row all the same, so the products
+ *                     read them alike.
+ *
+ *                     Products take signed weights on the left and unsigned
+ *                     activations on the right, the operand order of the
+ *                     u8 x s8 instructions, and return float:
+ *                     multiply(x) is W * X^T for a matrix X holding one
+ *                     activation vector per row (any quantization), matvec(x)
+ *                     is W * x.
+ */
+template <typename Q>
+class ZTQuantizedMatrix {
+
+private:
+    static_assert(std::is_same<Q, std::int8_t>::value || std::is_same<Q, std::uint8_t>::value,
+                  "ZTQuantizedMatrix holds std::int8_t or std::uint8_t");
+
+    std::vector<Q, ZTAlignedAllocator<Q> > quantized_data;
+    std::vector<float> row_scales;
+    std::vector<std::int32_t> row_zero_points;
+    std::vector<std::int32_t> row_sums;  // sum of the raw q_ij of every row
+    std::size_t matrix_rows;
+    std::size_t matrix_cols;
+    ZTQuantization quantization;
+
+    template <typename U>
+    friend class ZTQuantizedMatrix;
+
+public:
+    template <typename T>
+    explicit ZTQuantizedMatrix(const ZTMatrix<T>& m, ZTQuantization scheme = ZT_PER_ROW);  // quantizes the values
+    ZTQuantizedMatrix(std::size_t rows, std::size_t cols, const std::vector<Q>& values,
+                      const std::vector<float>& scales,
+                      const std::vector<std::int32_t>& zero_points);  // already quantized, one or rows parameters
+
+    std::size_t get_matrix_rows() const;
+    std::size_t get_matrix_cols() const;
+    ZTQuantization scheme() const;
+    const Q* data() const;
+    float scale(std::size_t row) const;
+    std::int32_t zero_point(std::size_t row) const;
+
+    float at(std::size_t row, std::size_t col) const;  // zero-based, checked, dequantized
+    ZTMatrix<float> dequantize() const;
+
+    ZTVector<float> matvec(const ZTQuantizedVector<std::uint8_t>& x) const;    // W * x
+    ZTMatrix<float> multiply(const ZTQuantizedMatrix<std::uint8_t>& x) const;  // W * X^T
+
+    void valid_matrix_vector_product(std::size_t size) const;
+    void valid_matrix_product(std::size_t rows, std::size_t cols) const;
+    void valid_index(std::size_t row, std::size_t col) const;
+
+};
+
+#endif /* ZTQUANTIZED_H */
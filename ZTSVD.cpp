@@ -0,0 +1,409 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cmath>
+#include <random>
+#include <vector>
+#include <limits>
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+
+#include "ZTQR.h"
+#include "ZTSVD.h"
+#include "ZTBlas.h"
+#include "ZTGemm.h"
+
+/**
+ * Constructor : Constructs the singular value decomposition of a matrix
+ *
+ * @param  ZTMatrix<T> m matrix to decompose, left unchanged
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTSVD<T>::ZTSVD(const ZTMatrix<T>& m) : left(0, 0, T(0)), right(0, 0, T(0)) {
+
+    decompose(m);
+
+}
+
+/**
+ * Constructor : Constructs the singular value decomposition of a view
+ *
+ * @param  ZTMatrixView<const T> m block to decompose, left unchanged
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTSVD<T>::ZTSVD(const ZTMatrixView<const T>& m) : left(0, 0, T(0)), right(0, 0, T(0)) {
+
+    decompose(m);
+
+}
+
+/**
+ * Constructor : Constructs the leading rank components of the singular
+ *               value decomposition by randomized range finding
+ *
+ * @param  ZTMatrixView<const T> m block to decompose, left unchanged
+ * @param  std::size_t rank number of components, at most min(m, n)
+ * @param  std::size_t oversampling extra columns sampled beyond rank
+ * @param  std::size_t power_iterations passes over A^T * A to sharpen the range
+ * @param  unsigned long seed seed of the Gaussian sample
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTSVD<T>::ZTSVD(const ZTMatrixView<const T>& m, std::size_t rank, std::size_t oversampling,
+                std::size_t power_iterations, unsigned long seed) : left(0, 0, T(0)), right(0, 0, T(0)) {
+
+    randomized(m, rank, oversampling, power_iterations, seed);
+
+}
+
+/**
+ * jacobi : one-sided Jacobi orthogonalization of the n rows of G. Every
+ *          pair of rows that is not orthogonal to working precision is
+ *          rotated to make it so, and the same rotation is applied to the
+ *          rows of V, until a whole sweep rotates nothing
+ *
+ * @param  std::size_t n number and length of the rows of G and V
+ * @param  T* g n x n rows to orthogonalize, ldg elements apart
+ * @param  T* v n x n rows rotated along, ldv elements apart
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTSVD<T>::jacobi(std::size_t n, T* g, std::size_t ldg, T* v, std::size_t ldv) {
+
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    const T tolerance = std::numeric_limits<T>::epsilon() * std::sqrt(T(std::max<std::size_t>(n, 1)));
+    std::vector<T> norms(n);
+    for (std::size_t sweep = 0; sweep < max_sweeps; ++sweep)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            norms[i] = blas.dot(n, g + i * ldg, g + i * ldg);
+        }
+        bool rotated = false;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            for (std::size_t j = i + 1; j < n; ++j)
+            {
+                T* gi = g + i * ldg;
+                T* gj = g + j * ldg;
+                const T gamma = blas.dot(n, gi, gj);
+                if (std::abs(gamma) <= tolerance * std::sqrt(norms[i] * norms[j]))
+                {
+                    continue;
+                }
+                rotated = true;
+
+                const T zeta = (norms[j] - norms[i]) / (T(2) * gamma);
+                const T t = std::copysign(T(1), zeta) / (std::abs(zeta) + std::sqrt(T(1) + zeta * zeta));
+                const T c = T(1) / std::sqrt(T(1) + t * t);
+                const T s = c * t;
+                T* vi = v + i * ldv;
+                T* vj = v + j * ldv;
+                _Pragma("GCC ivdep")
+                for (std::size_t k = 0; k < n; ++k)
+                {
+                    const T x = gi[k];
+                    gi[k] = c * x - s * gj[k];
+                    gj[k] = s * x + c * gj[k];
+                }
+                _Pragma("GCC ivdep")
+                for (std::size_t k = 0; k < n; ++k)
+                {
+                    const T x = vi[k];
+                    vi[k] = c * x - s * vj[k];
+                    vj[k] = s * x + c * vj[k];
+                }
+                norms[i] -= t * gamma;
+                norms[j] += t * gamma;
+            }
+        }
+        if (!rotated)
+        {
+            break;
+        }
+    }
+
+}
+
+/**
+ * orthonormalize : replaces the columns of Y by an orthonormal basis of
+ *                  their span, the thin Q of its QR factorization
+ *
+ * @param  ZTMatrix<T> y tall matrix, overwritten
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTSVD<T>::orthonormalize(ZTMatrix<T>& y) {
+
+    ZTQR<T> qr(std::move(y));
+    y = qr.q();
+
+}
+
+/**
+ * decompose : full decomposition. A wide matrix is decomposed through its
+ *             transpose. A tall one is reduced to R, R^T is orthogonalized
+ *             by Jacobi rotations into U_R * diag(s) with the rotations
+ *             accumulating V^T, and U = Q * U_R. Columns of U for
+ *             negligible singular values are completed to an orthonormal
+ *             set
+ *
+ * @param  ZTMatrixView<const T> m block to decompose
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTSVD<T>::decompose(const ZTMatrixView<const T>& m) {
+
+    const std::size_t rows = m.get_matrix_rows();
+    const std::size_t cols = m.get_matrix_cols();
+    if (rows < cols)
+    {
+        ZTSVD<T> transposed(m.transpose());
+        values.swap(transposed.values);
+        left = std::move(transposed.right);
+        right = std::move(transposed.left);
+        return;
+    }
+
+    const std::size_t n = cols;
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    ZTQR<T> qr(m);
+    const ZTMatrix<T> r = qr.r();
+    ZTMatrix<T> g(n, n, T(0));
+    ZTMatrix<T> vt(n, n, T(0));
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        for (std::size_t j = i; j < n; ++j)
+        {
+            g[j][i] = r[i][j];
+        }
+        vt[i][i] = T(1);
+    }
+    jacobi(n, g.data(), g.stride(), vt.data(), vt.stride());
+
+    std::vector<T> norms(n);
+    std::vector<std::size_t> order(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        norms[i] = std::sqrt(blas.dot(n, g[i], g[i]));
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&norms](std::size_t i, std::size_t j) { return norms[i] > norms[j]; });
+
+    values.resize(n);
+    ZTMatrix<T> small(rows, n, T(0));
+    right = ZTMatrix<T>(n, n, T(0));
+    const T negligible = n == 0 ? T(0) : T(n) * std::numeric_limits<T>::epsilon() * norms[order[0]];
+    std::vector<std::size_t> incomplete;
+    for (std::size_t c = 0; c < n; ++c)
+    {
+        const std::size_t i = order[c];
+        values[c] = norms[i];
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            right[k][c] = vt[i][k];
+        }
+        if (!(norms[i] > negligible))
+        {
+            incomplete.push_back(c);
+            continue;
+        }
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            small[k][c] = g[i][k] / norms[i];
+        }
+    }
+
+    // unit vectors orthogonalized twice against the columns already set
+    std::vector<T> x(n);
+    std::size_t candidate = 0;
+    for (std::size_t c : incomplete)
+    {
+        for (; candidate < n; ++candidate)
+        {
+            std::fill(x.begin(), x.end(), T(0));
+            x[candidate] = T(1);
+            for (std::size_t pass = 0; pass < 2; ++pass)
+            {
+                for (std::size_t q = 0; q < n; ++q)
+                {
+                    T projection = T(0);
+                    for (std::size_t k = 0; k < n; ++k)
+                    {
+                        projection += small[k][q] * x[k];
+                    }
+                    for (std::size_t k = 0; k < n; ++k)
+                    {
+                        x[k] -= projection * small[k][q];
+                    }
+                }
+            }
+            const T norm = std::sqrt(blas.dot(n, x.data(), x.data()));
+            if (norm > T(0.5))
+            {
+                for (std::size_t k = 0; k < n; ++k)
+                {
+                    small[k][c] = x[k] / norm;
+                }
+                ++candidate;
+                break;
+            }
+        }
+    }
+    left = qr.apply_q(small);
+
+}
+
+/**
+ * randomized : leading rank components by randomized range finding. Y =
+ *              A * Omega for a Gaussian Omega of rank + oversampling
+ *              columns, power iterations Y = A * (A^T * Y) with
+ *              re-orthonormalization in between, Q = orth(Y), and the full
+ *              decomposition of the small B = Q^T * A = U_B * diag(s) * V^T
+ *              gives U = Q * U_B
+ *
+ * @param  ZTMatrixView<const T> m block to decompose
+ * @param  std::size_t rank number of components
+ * @param  std::size_t oversampling extra columns sampled beyond rank
+ * @param  std::size_t power_iterations passes over A^T * A
+ * @param  unsigned long seed seed of the Gaussian sample
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTSVD<T>::randomized(const ZTMatrixView<const T>& m, std::size_t rank, std::size_t oversampling,
+                          std::size_t power_iterations, unsigned long seed) {
+
+    const std::size_t rows = m.get_matrix_rows();
+    const std::size_t cols = m.get_matrix_cols();
+    const std::size_t k = std::min(rows, cols);
+    rank = std::min(rank, k);
+    const std::size_t l = std::min(rank + oversampling, k);
+    const T* a = m.data();
+    const std::size_t rsa = m.ld();
+    const std::size_t csa = m.stride();
+
+    std::mt19937_64 generator(seed);
+    std::normal_distribution<double> gaussian(0.0, 1.0);
+    ZTMatrix<T> omega(cols, l, T(0));
+    for (std::size_t i = 0; i < cols; ++i)
+    {
+        for (std::size_t j = 0; j < l; ++j)
+        {
+            omega[i][j] = T(gaussian(generator));
+        }
+    }
+
+    ZTMatrix<T> y(rows, l, T(0));
+    ZTMatrix<T> z(cols, l, T(0));
+    ZTGemm<T>::gemm(rows, l, cols, T(1), a, rsa, csa, omega.data(), l, 1, T(0), y.data(), l, 1);
+    for (std::size_t q = 0; q < power_iterations; ++q)
+    {
+        orthonormalize(y);
+        ZTGemm<T>::gemm(cols, l, rows, T(1), a, csa, rsa, y.data(), l, 1, T(0), z.data(), l, 1);
+        orthonormalize(z);
+        ZTGemm<T>::gemm(rows, l, cols, T(1), a, rsa, csa, z.data(), l, 1, T(0), y.data(), l, 1);
+    }
+    orthonormalize(y);
+
+    ZTMatrix<T> b(l, cols, T(0));
+    ZTGemm<T>::gemm(l, cols, rows, T(1), y.data(), 1, l, a, rsa, csa, T(0), b.data(), cols, 1);
+    ZTSVD<T> projected(b);
+
+    values.assign(projected.values.begin(), projected.values.begin() + rank);
+    left = ZTMatrix<T>(rows, rank, T(0));
+    ZTGemm<T>::gemm(rows, rank, l, T(1), y.data(), l, 1, projected.left.data(), projected.left.stride(), 1,
+                    T(0), left.data(), rank, 1);
+    right = ZTMatrix<T>(cols, rank, T(0));
+    for (std::size_t i = 0; i < cols; ++i)
+    {
+        std::copy(projected.right[i], projected.right[i] + rank, right[i]);
+    }
+
+}
+
+/**
+ * size : number of singular values
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTSVD<T>::size() const {
+
+    return values.size();
+
+}
+
+/**
+ * singular_values : singular values in descending order
+ *
+ * @param  nothing
+ * @return ZTVector<T> result
+ *
+ */
+template <typename T>
+ZTVector<T> ZTSVD<T>::singular_values() const {
+
+    return ZTVector<T>(values);
+
+}
+
+/**
+ * u : left singular vectors, column i belonging to singular value i
+ *
+ * @param  nothing
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+inline const ZTMatrix<T>& ZTSVD<T>::u() const {
+
+    return left;
+
+}
+
+/**
+ * v : right singular vectors, column i belonging to singular value i
+ *
+ * @param  nothing
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+inline const ZTMatrix<T>& ZTSVD<T>::v() const {
+
+    return right;
+
+}
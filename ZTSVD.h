@@ -0,0 +1,82 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ZTSVD_H
+#define ZTSVD_H
+
+#include <vector>
+#include <cstddef>
+
+#include "ZTMatrix.h"
+#include "ZTVector.h"
+#include "ZTMatrixView.h"
+
+/*
+ * ZTSVD : singular value decomposition A = U * diag(s) * V^T of an m x n
+ *         matrix, singular values in descending order.
+ *
+ *         The full decomposition reduces A (or A^T when it is wide) to the
+ *         square R of its QR factorization, and orthogonalizes R by one-sided
+ *         Jacobi rotations on contiguous rows of R^T, which gives the small
+ *         singular values to high relative accuracy. U is Q times the left
+ *         vectors of R, applied through the implicit Q.
+ *
+ *         The truncated decomposition keeps the leading rank components and
+ *         finds them by randomized range finding: A is multiplied by a
+ *         Gaussian block of rank + oversampling columns, a few power
+ *         iterations sharpen the range, and the full decomposition is taken
+ *         only of the small projection Q^T * A. All the work on A is GEMM.
+ */
+template <typename T>
+class ZTSVD {
+
+private:
+    static constexpr std::size_t max_sweeps = 60;
+
+    std::vector<T> values;  // descending
+    ZTMatrix<T> left;       // U, one column per singular value
+    ZTMatrix<T> right;      // V, one column per singular value
+
+    void decompose(const ZTMatrixView<const T>& m);
+    void randomized(const ZTMatrixView<const T>& m, std::size_t rank, std::size_t oversampling,
+                    std::size_t power_iterations, unsigned long seed);
+
+    static void jacobi(std::size_t n, T* g, std::size_t ldg, T* v, std::size_t ldv);
+    static void orthonormalize(ZTMatrix<T>& y);
+
+public:
+    explicit ZTSVD(const ZTMatrix<T>& m);
+    explicit ZTSVD(const ZTMatrixView<const T>& m);
+    ZTSVD(const ZTMatrixView<const T>& m, std::size_t rank, std::size_t oversampling = 10,
+          std::size_t power_iterations = 2, unsigned long seed = 0); // leading rank components
+
+    std::size_t size() const;
+
+    ZTVector<T> singular_values() const;  // descending
+    const ZTMatrix<T>& u() const;         // m x size()
+    const ZTMatrix<T>& v() const;         // n x size()
+
+};
+
+#endif /* ZTSVD_H */
@@ -0,0 +1,119 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ZTSIMD_H
+#define ZTSIMD_H
+
+/*
+ * Thin overloaded wrappers over the SSE2, AVX2/FMA and AVX-512F intrinsics for
+ * float and double. Kernels that use them carry the matching ZT_*_TARGET
+ * attribute and are only called after ZTCpu has confirmed the instruction set,
+ * so the library itself is built without any -m flags.
+ */
+
+#if defined(__x86_64__) || defined(__i386__)
+
+#include <immintrin.h>
+
+#define ZT_SIMD_X86
+
+#define ZT_SSE2_TARGET __attribute__((target("sse2")))
+#define ZT_AVX2_TARGET __attribute__((target("avx2,fma")))
+#define ZT_AVX512_TARGET __attribute__((target("avx512f,avx2,fma")))
+#define ZT_F16C_TARGET __attribute__((target("avx2,fma,f16c")))
+#define ZT_VNNI_TARGET __attribute__((target("avx512f,avx512bw,avx512vnni,avx2,fma")))
+
+#define ZT_SSE2_INLINE __attribute__((target("sse2"), always_inline)) inline
+#define ZT_AVX2_INLINE __attribute__((target("avx2,fma"), always_inline)) inline
+#define ZT_AVX512_INLINE __attribute__((target("avx512f,avx2,fma"), always_inline)) inline
+
+ZT_SSE2_INLINE __m128d zt_sse2_load(const double* p) { return _mm_loadu_pd(p); }
+ZT_SSE2_INLINE __m128 zt_sse2_load(const float* p) { return _mm_loadu_ps(p); }
+ZT_SSE2_INLINE void zt_sse2_store(double* p, __m128d v) { _mm_storeu_pd(p, v); }
+ZT_SSE2_INLINE void zt_sse2_store(float* p, __m128 v) { _mm_storeu_ps(p, v); }
+ZT_SSE2_INLINE __m128d zt_sse2_set1(double x) { return _mm_set1_pd(x); }
+ZT_SSE2_INLINE __m128 zt_sse2_set1(float x) { return _mm_set1_ps(x); }
+ZT_SSE2_INLINE __m128d zt_sse2_add(__m128d a, __m128d b) { return _mm_add_pd(a, b); }
+ZT_SSE2_INLINE __m128 zt_sse2_add(__m128 a, __m128 b) { return _mm_add_ps(a, b); }
+ZT_SSE2_INLINE __m128d zt_sse2_sub(__m128d a, __m128d b) { return _mm_sub_pd(a, b); }
+ZT_SSE2_INLINE __m128 zt_sse2_sub(__m128 a, __m128 b) { return _mm_sub_ps(a, b); }
+ZT_SSE2_INLINE __m128d zt_sse2_mul(__m128d a, __m128d b) { return _mm_mul_pd(a, b); }
+ZT_SSE2_INLINE __m128 zt_sse2_mul(__m128 a, __m128 b) { return _mm_mul_ps(a, b); }
+ZT_SSE2_INLINE __m128d zt_sse2_fmadd(__m128d a, __m128d b, __m128d c) { return _mm_add_pd(_mm_mul_pd(a, b), c); }
+ZT_SSE2_INLINE __m128 zt_sse2_fmadd(__m128 a, __m128 b, __m128 c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+ZT_SSE2_INLINE double zt_sse2_sum(__m128d v) { return _mm_cvtsd_f64(_mm_add_sd(v, _mm_unpackhi_pd(v, v))); }
+ZT_SSE2_INLINE float zt_sse2_sum(__m128 v) {
+    __m128 pairs = _mm_add_ps(v, _mm_movehl_ps(v, v));
+    return _mm_cvtss_f32(_mm_add_ss(pairs, _mm_shuffle_ps(pairs, pairs, 1)));
+}
+
+ZT_AVX2_INLINE __m256d zt_avx2_load(const double* p) { return _mm256_loadu_pd(p); }
+ZT_AVX2_INLINE __m256 zt_avx2_load(const float* p) { return _mm256_loadu_ps(p); }
+ZT_AVX2_INLINE void zt_avx2_store(double* p, __m256d v) { _mm256_storeu_pd(p, v); }
+ZT_AVX2_INLINE void zt_avx2_store(float* p, __m256 v) { _mm256_storeu_ps(p, v); }
+ZT_AVX2_INLINE __m256d zt_avx2_set1(double x) { return _mm256_set1_pd(x); }
+ZT_AVX2_INLINE __m256 zt_avx2_set1(float x) { return _mm256_set1_ps(x); }
+ZT_AVX2_INLINE __m256d zt_avx2_add(__m256d a, __m256d b) { return _mm256_add_pd(a, b); }
+ZT_AVX2_INLINE __m256 zt_avx2_add(__m256 a, __m256 b) { return _mm256_add_ps(a, b); }
+ZT_AVX2_INLINE __m256d zt_avx2_sub(__m256d a, __m256d b) { return _mm256_sub_pd(a, b); }
+ZT_AVX2_INLINE __m256 zt_avx2_sub(__m256 a, __m256 b) { return _mm256_sub_ps(a, b); }
+ZT_AVX2_INLINE __m256d zt_avx2_mul(__m256d a, __m256d b) { return _mm256_mul_pd(a, b); }
+ZT_AVX2_INLINE __m256 zt_avx2_mul(__m256 a, __m256 b) { return _mm256_mul_ps(a, b); }
+ZT_AVX2_INLINE __m256d zt_avx2_fmadd(__m256d a, __m256d b, __m256d c) { return _mm256_fmadd_pd(a, b, c); }
+ZT_AVX2_INLINE __m256 zt_avx2_fmadd(__m256 a, __m256 b, __m256 c) { return _mm256_fmadd_ps(a, b, c); }
+ZT_AVX2_INLINE double zt_avx2_sum(__m256d v) {
+    return zt_sse2_sum(_mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1)));
+}
+ZT_AVX2_INLINE float zt_avx2_sum(__m256 v) {
+    return zt_sse2_sum(_mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1)));
+}
+
+ZT_AVX512_INLINE __m512d zt_avx512_load(const double* p) { return _mm512_loadu_pd(p); }
+ZT_AVX512_INLINE __m512 zt_avx512_load(const float* p) { return _mm512_loadu_ps(p); }
+ZT_AVX512_INLINE void zt_avx512_store(double* p, __m512d v) { _mm512_storeu_pd(p, v); }
+ZT_AVX512_INLINE void zt_avx512_store(float* p, __m512 v) { _mm512_storeu_ps(p, v); }
+ZT_AVX512_INLINE __m512d zt_avx512_set1(double x) { return _mm512_set1_pd(x); }
+ZT_AVX512_INLINE __m512 zt_avx512_set1(float x) { return _mm512_set1_ps(x); }
+ZT_AVX512_INLINE __m512d zt_avx512_add(__m512d a, __m512d b) { return _mm512_add_pd(a, b); }
+ZT_AVX512_INLINE __m512 zt_avx512_add(__m512 a, __m512 b) { return _mm512_add_ps(a, b); }
+ZT_AVX512_INLINE __m512d zt_avx512_sub(__m512d a, __m512d b) { return _mm512_sub_pd(a, b); }
+ZT_AVX512_INLINE __m512 zt_avx512_sub(__m512 a, __m512 b) { return _mm512_sub_ps(a, b); }
+ZT_AVX512_INLINE __m512d zt_avx512_mul(__m512d a, __m512d b) { return _mm512_mul_pd(a, b); }
+ZT_AVX512_INLINE __m512 zt_avx512_mul(__m512 a, __m512 b) { return _mm512_mul_ps(a, b); }
+ZT_AVX512_INLINE __m512d zt_avx512_fmadd(__m512d a, __m512d b, __m512d c) { return _mm512_fmadd_pd(a, b, c); }
+ZT_AVX512_INLINE __m512 zt_avx512_fmadd(__m512 a, __m512 b, __m512 c) { return _mm512_fmadd_ps(a, b, c); }
+ZT_AVX512_INLINE double zt_avx512_sum(__m512d v) {
+    alignas(64) double lanes[8]; // spilled rather than extracted, the extract intrinsics trip -Wuninitialized on GCC 12
+    _mm512_store_pd(lanes, v);
+    return zt_avx2_sum(_mm256_add_pd(_mm256_load_pd(lanes), _mm256_load_pd(lanes + 4)));
+}
+ZT_AVX512_INLINE float zt_avx512_sum(__m512 v) {
+    alignas(64) float lanes[16];
+    _mm512_store_ps(lanes, v);
+    return zt_avx2_sum(_mm256_add_ps(_mm256_load_ps(lanes), _mm256_load_ps(lanes + 8)));
+}
+
+#endif /* __x86_64__ || __i386__ */
+
+#endif /* ZTSIMD_H */
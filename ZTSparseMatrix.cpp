@@ -0,0 +1,1130 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cmath>
+#include <vector>
+#include <limits>
+#include <cstddef>
+#include <sstream>
+#include <utility>
+#include <stdexcept>
+#include <algorithm>
+
+#include "ZTBlas.h"
+#include "ZTError.h"
+#include "ZTThreadPool.h"
+#include "ZTSparseMatrix.h"
+
+/**
+ * Constructor : Constructs an all-zero sparse matrix
+ *
+ * @param  std::size_t rows
+ * @param  std::size_t cols
+ * @param  ZTSparseFormat format CSR or CSC
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTSparseMatrix<T>::ZTSparseMatrix(std::size_t rows, std::size_t cols, ZTSparseFormat format) : matrix_rows(rows),
+                                                                                                 matrix_cols(cols),
+                                                                                                 sparse_format(format) {
+
+    sparse_pointers.assign(major() + 1, 0);
+
+}
+
+/**
+ * Constructor : Constructs a sparse matrix from coordinate triplets, in any
+ *               order. Entries repeated at the same position are summed
+ *
+ * @param  std::size_t rows
+ * @param  std::size_t cols
+ * @param  std::vector<std::size_t> row_indices zero-based row of every entry
+ * @param  std::vector<std::size_t> col_indices zero-based col of every entry
+ * @param  std::vector<T> values value of every entry
+ * @param  ZTSparseFormat format CSR or CSC
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTSparseMatrix<T>::ZTSparseMatrix(std::size_t rows, std::size_t cols,
+                                  const std::vector<std::size_t>& row_indices,
+                                  const std::vector<std::size_t>& col_indices,
+                                  const std::vector<T>& values,
+                                  ZTSparseFormat format) : matrix_rows(rows),
+                                                           matrix_cols(cols),
+                                                           sparse_format(format) {
+
+    const std::size_t count = values.size();
+    if (row_indices.size() != count || col_indices.size() != count)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Coordinate arrays of sizes: " << row_indices.size() << ", " << col_indices.size() << " and " << count << " do not describe the same entries!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+    for (std::size_t k = 0; k < count; ++k)
+    {
+        ZT_VALIDATE(valid_index_dimensions(row_indices[k], col_indices[k]));
+    }
+
+    const std::vector<std::size_t>& majors = format == ZT_SPARSE_CSR ? row_indices : col_indices;
+    const std::vector<std::size_t>& minors = format == ZT_SPARSE_CSR ? col_indices : row_indices;
+    std::vector<std::size_t> starts(major() + 1, 0);
+    for (std::size_t k = 0; k < count; ++k)
+    {
+        ++starts[majors[k] + 1];
+    }
+    for (std::size_t i = 0; i < major(); ++i)
+    {
+        starts[i + 1] += starts[i];
+    }
+    std::vector<std::pair<std::size_t, T> > entries(count);
+    std::vector<std::size_t> next(starts.begin(), starts.end() - 1);
+    for (std::size_t k = 0; k < count; ++k)
+    {
+        entries[next[majors[k]]++] = std::make_pair(minors[k], values[k]);
+    }
+
+    sparse_pointers.assign(major() + 1, 0);
+    sparse_indices.reserve(count);
+    sparse_values.reserve(count);
+    for (std::size_t i = 0; i < major(); ++i)
+    {
+        std::stable_sort(entries.begin() + starts[i], entries.begin() + starts[i + 1],
+                         [](const std::pair<std::size_t, T>& a, const std::pair<std::size_t, T>& b) { return a.first < b.first; });
+        for (std::size_t k = starts[i]; k < starts[i + 1]; ++k)
+        {
+            if (sparse_indices.size() > sparse_pointers[i] && sparse_indices.back() == entries[k].first)
+            {
+                sparse_values.back() += entries[k].second;
+                continue;
+            }
+            sparse_indices.push_back(entries[k].first);
+            sparse_values.push_back(entries[k].second);
+        }
+        sparse_pointers[i + 1] = sparse_indices.size();
+    }
+
+}
+
+/**
+ * Constructor : Constructs a sparse matrix over compressed arrays, which are
+ *               moved in and checked for consistency
+ *
+ * @param  ZTSparseFormat format CSR or CSC
+ * @param  std::size_t rows
+ * @param  std::size_t cols
+ * @param  std::vector<std::size_t> pointers major + 1 slice offsets
+ * @param  std::vector<std::size_t> indices minor index of every entry, ascending in a slice
+ * @param  std::vector<T> values value of every entry
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTSparseMatrix<T>::ZTSparseMatrix(ZTSparseFormat format, std::size_t rows, std::size_t cols,
+                                  std::vector<std::size_t>&& pointers,
+                                  std::vector<std::size_t>&& indices,
+                                  std::vector<T>&& values) : sparse_pointers(std::move(pointers)),
+                                                             sparse_indices(std::move(indices)),
+                                                             sparse_values(std::move(values)),
+                                                             matrix_rows(rows),
+                                                             matrix_cols(cols),
+                                                             sparse_format(format) {
+
+    ZT_VALIDATE(valid_compressed_arrays());
+
+}
+
+/**
+ * Constructor : Constructs a sparse matrix from the nonzero entries of a
+ *               dense view
+ *
+ * @param  ZTMatrixView<const T> m dense block
+ * @param  ZTSparseFormat format CSR or CSC
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTSparseMatrix<T>::ZTSparseMatrix(const ZTMatrixView<const T>& m, ZTSparseFormat format) : matrix_rows(m.get_matrix_rows()),
+                                                                                            matrix_cols(m.get_matrix_cols()),
+                                                                                            sparse_format(format) {
+
+    const ZTMatrixView<const T> slices = format == ZT_SPARSE_CSR ? m : m.transpose();
+    sparse_pointers.assign(major() + 1, 0);
+    for (std::size_t i = 0; i < major(); ++i)
+    {
+        for (std::size_t j = 0; j < minor(); ++j)
+        {
+            const T x = slices.unsafe_get(i, j);
+            if (x != T(0))
+            {
+                sparse_indices.push_back(j);
+                sparse_values.push_back(x);
+            }
+        }
+        sparse_pointers[i + 1] = sparse_indices.size();
+    }
+
+}
+
+/**
+ * major : number of compressed slices, rows in CSR and cols in CSC
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTSparseMatrix<T>::major() const {
+
+    return sparse_format == ZT_SPARSE_CSR ? matrix_rows : matrix_cols;
+
+}
+
+/**
+ * minor : length of a compressed slice, cols in CSR and rows in CSC
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTSparseMatrix<T>::minor() const {
+
+    return sparse_format == ZT_SPARSE_CSR ? matrix_cols : matrix_rows;
+
+}
+
+/**
+ * partition : splits the slices into chunks of consecutive slices holding
+ *             about the same number of nonzeros
+ *
+ * @param  std::size_t chunks number of chunks
+ * @return std::vector<std::size_t> chunks + 1 slice boundaries
+ *
+ */
+template <typename T>
+std::vector<std::size_t> ZTSparseMatrix<T>::partition(std::size_t chunks) const {
+
+    std::vector<std::size_t> bounds(chunks + 1, major());
+    bounds[0] = 0;
+    const std::size_t total = nonzeros();
+    for (std::size_t c = 1; c < chunks; ++c)
+    {
+        const std::size_t target = total / chunks * c + total % chunks * c / chunks;
+        const std::size_t slice = std::lower_bound(sparse_pointers.begin(), sparse_pointers.end(), target) - sparse_pointers.begin();
+        bounds[c] = std::max(bounds[c - 1], std::min(slice, major()));
+    }
+    return bounds;
+
+}
+
+/**
+ * find : position of an entry in a slice
+ *
+ * @param  std::size_t slice major index
+ * @param  std::size_t index minor index
+ * @return std::size_t position in indices and values, npos when not stored
+ *
+ */
+template <typename T>
+std::size_t ZTSparseMatrix<T>::find(std::size_t slice, std::size_t index) const {
+
+    const std::size_t* first = sparse_indices.data() + sparse_pointers[slice];
+    const std::size_t* last = sparse_indices.data() + sparse_pointers[slice + 1];
+    const std::size_t* found = std::lower_bound(first, last, index);
+    if (found == last || *found != index)
+    {
+        return std::numeric_limits<std::size_t>::max();
+    }
+    return found - sparse_indices.data();
+
+}
+
+/**
+ * gather : y_i = sum over slice i of value * x[index], the product of the
+ *          matrix in CSR or of its transpose in CSC. Chunks of slices with
+ *          equal nonzeros run on the thread pool, each writing its own y_i
+ *
+ * @param  T* x operand of minor elements, incx apart
+ * @param  T* y result of major elements
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTSparseMatrix<T>::gather(const T* x, std::size_t incx, T* y) const {
+
+    const std::size_t* p = sparse_pointers.data();
+    const std::size_t* idx = sparse_indices.data();
+    const T* a = sparse_values.data();
+    auto rows = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            T sum = T(0);
+            for (std::size_t k = p[i]; k < p[i + 1]; ++k)
+            {
+                sum += a[k] * x[idx[k] * incx];
+            }
+            y[i] = sum;
+        }
+    };
+
+    ZTThreadPool& pool = ZTThreadPool::instance();
+    if (nonzeros() >= parallel_nonzeros && pool.get_num_threads() > 1)
+    {
+        const std::vector<std::size_t> bounds = partition(4 * pool.get_num_threads());
+        pool.parallel_for(bounds.size() - 1, [&](std::size_t c) {
+            rows(bounds[c], bounds[c + 1]);
+        });
+        return;
+    }
+    rows(0, major());
+
+}
+
+/**
+ * scatter : y += sum over slices i of x_i * slice i, the product of the
+ *           matrix in CSC or of its transpose in CSR. In parallel every
+ *           chunk scatters into a private buffer, and the buffers are then
+ *           summed into y over disjoint ranges
+ *
+ * @param  T* x operand of major elements, incx apart
+ * @param  T* y result of size minor elements, accumulated into
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTSparseMatrix<T>::scatter(const T* x, std::size_t incx, T* y, std::size_t size) const {
+
+    const std::size_t* p = sparse_pointers.data();
+    const std::size_t* idx = sparse_indices.data();
+    const T* a = sparse_values.data();
+    auto slices = [&](std::size_t begin, std::size_t end, T* out) {
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            const T xi = x[i * incx];
+            for (std::size_t k = p[i]; k < p[i + 1]; ++k)
+            {
+                out[idx[k]] += a[k] * xi;
+            }
+        }
+    };
+
+    ZTThreadPool& pool = ZTThreadPool::instance();
+    if (nonzeros() >= parallel_nonzeros && pool.get_num_threads() > 1)
+    {
+        const std::size_t chunks = pool.get_num_threads();
+        const std::vector<std::size_t> bounds = partition(chunks);
+        std::vector<T> buffers((chunks - 1) * size, T(0));
+        pool.parallel_for(chunks, [&](std::size_t c) {
+            slices(bounds[c], bounds[c + 1], c == 0 ? y : buffers.data() + (c - 1) * size);
+        });
+        const std::size_t range = (size + chunks - 1) / chunks;
+        pool.parallel_for(chunks, [&](std::size_t c) {
+            const std::size_t begin = std::min(size, c * range);
+            const std::size_t end = std::min(size, begin + range);
+            for (std::size_t b = 0; b + 1 < chunks; ++b)
+            {
+                const T* buffer = buffers.data() + b * size;
+                _Pragma("GCC ivdep")
+                for (std::size_t j = begin; j < end; ++j)
+                {
+                    y[j] += buffer[j];
+                }
+            }
+        });
+        return;
+    }
+    slices(0, major(), y);
+
+}
+
+/**
+ * converted : the same matrix with its entries compressed in the other
+ *             format, by a counting sort on the minor indices
+ *
+ * @param  nothing
+ * @return ZTSparseMatrix<T> result
+ *
+ */
+template <typename T>
+ZTSparseMatrix<T> ZTSparseMatrix<T>::converted() const {
+
+    ZTSparseMatrix<T> result(matrix_rows, matrix_cols, sparse_format == ZT_SPARSE_CSR ? ZT_SPARSE_CSC : ZT_SPARSE_CSR);
+    std::vector<std::size_t>& p = result.sparse_pointers;
+    for (std::size_t k = 0; k < nonzeros(); ++k)
+    {
+        ++p[sparse_indices[k] + 1];
+    }
+    for (std::size_t j = 0; j < minor(); ++j)
+    {
+        p[j + 1] += p[j];
+    }
+    result.sparse_indices.resize(nonzeros());
+    result.sparse_values.resize(nonzeros());
+    std::vector<std::size_t> next(p.begin(), p.end() - 1);
+    for (std::size_t i = 0; i < major(); ++i)
+    {
+        for (std::size_t k = sparse_pointers[i]; k < sparse_pointers[i + 1]; ++k)
+        {
+            const std::size_t position = next[sparse_indices[k]]++;
+            result.sparse_indices[position] = i;
+            result.sparse_values[position] = sparse_values[k];
+        }
+    }
+    return result;
+
+}
+
+/**
+ * combine : merges the entries of two matrices slice by slice, as this
+ *           plus sign times m, in the format of this matrix
+ *
+ * @param  ZTSparseMatrix<T> m
+ * @param  T& sign 1 to add, -1 to subtract
+ * @return ZTSparseMatrix<T> result
+ *
+ */
+template <typename T>
+ZTSparseMatrix<T> ZTSparseMatrix<T>::combine(const ZTSparseMatrix& m, const T& sign) const {
+
+    ZT_VALIDATE(valid_matrix_add_minus(m));
+    ZTSparseMatrix<T> other(0, 0, sparse_format);
+    const ZTSparseMatrix<T>* b = &m;
+    if (m.sparse_format != sparse_format)
+    {
+        other = m.converted();
+        b = &other;
+    }
+
+    ZTSparseMatrix<T> result(matrix_rows, matrix_cols, sparse_format);
+    result.sparse_indices.reserve(nonzeros() + b->nonzeros());
+    result.sparse_values.reserve(nonzeros() + b->nonzeros());
+    for (std::size_t i = 0; i < major(); ++i)
+    {
+        std::size_t k = sparse_pointers[i];
+        std::size_t l = b->sparse_pointers[i];
+        const std::size_t k_end = sparse_pointers[i + 1];
+        const std::size_t l_end = b->sparse_pointers[i + 1];
+        while (k < k_end || l < l_end)
+        {
+            const std::size_t ka = k < k_end ? sparse_indices[k] : minor();
+            const std::size_t lb = l < l_end ? b->sparse_indices[l] : minor();
+            if (ka < lb)
+            {
+                result.sparse_indices.push_back(ka);
+                result.sparse_values.push_back(sparse_values[k++]);
+            }
+            else if (lb < ka)
+            {
+                result.sparse_indices.push_back(lb);
+                result.sparse_values.push_back(sign * b->sparse_values[l++]);
+            }
+            else
+            {
+                result.sparse_indices.push_back(ka);
+                result.sparse_values.push_back(sparse_values[k++] + sign * b->sparse_values[l++]);
+            }
+        }
+        result.sparse_pointers[i + 1] = result.sparse_indices.size();
+    }
+    return result;
+
+}
+
+/**
+ * get_matrix_rows : gets the number of rows
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTSparseMatrix<T>::get_matrix_rows() const {
+
+    return matrix_rows;
+
+}
+
+/**
+ * get_matrix_cols : gets the number of cols
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTSparseMatrix<T>::get_matrix_cols() const {
+
+    return matrix_cols;
+
+}
+
+/**
+ * nonzeros : number of stored entries
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTSparseMatrix<T>::nonzeros() const {
+
+    return sparse_values.size();
+
+}
+
+/**
+ * format : compression format, CSR or CSC
+ *
+ * @param  nothing
+ * @return ZTSparseFormat
+ *
+ */
+template <typename T>
+inline ZTSparseFormat ZTSparseMatrix<T>::format() const {
+
+    return sparse_format;
+
+}
+
+/**
+ * pointers : offsets of the slices into indices and values
+ *
+ * @param  nothing
+ * @return std::vector<std::size_t>
+ *
+ */
+template <typename T>
+inline const std::vector<std::size_t>& ZTSparseMatrix<T>::pointers() const {
+
+    return sparse_pointers;
+
+}
+
+/**
+ * indices : minor index of every stored entry
+ *
+ * @param  nothing
+ * @return std::vector<std::size_t>
+ *
+ */
+template <typename T>
+inline const std::vector<std::size_t>& ZTSparseMatrix<T>::indices() const {
+
+    return sparse_indices;
+
+}
+
+/**
+ * values : value of every stored entry
+ *
+ * @param  nothing
+ * @return std::vector<T>
+ *
+ */
+template <typename T>
+inline const std::vector<T>& ZTSparseMatrix<T>::values() const {
+
+    return sparse_values;
+
+}
+
+/**
+ * at : element access by zero-based index, by binary search in its slice
+ *
+ * @param  std::size_t row
+ * @param  std::size_t col
+ * @return T element, zero when not stored
+ *
+ */
+template <typename T>
+T ZTSparseMatrix<T>::at(std::size_t row, std::size_t col) const {
+
+    valid_index_dimensions(row, col);
+    const std::size_t k = sparse_format == ZT_SPARSE_CSR ? find(row, col) : find(col, row);
+    return k == std::numeric_limits<std::size_t>::max() ? T(0) : sparse_values[k];
+
+}
+
+/**
+ * to_csr : the matrix compressed by rows
+ *
+ * @param  nothing
+ * @return ZTSparseMatrix<T> result
+ *
+ */
+template <typename T>
+ZTSparseMatrix<T> ZTSparseMatrix<T>::to_csr() const {
+
+    return sparse_format == ZT_SPARSE_CSR ? *this : converted();
+
+}
+
+/**
+ * to_csc : the matrix compressed by columns
+ *
+ * @param  nothing
+ * @return ZTSparseMatrix<T> result
+ *
+ */
+template <typename T>
+ZTSparseMatrix<T> ZTSparseMatrix<T>::to_csc() const {
+
+    return sparse_format == ZT_SPARSE_CSC ? *this : converted();
+
+}
+
+/**
+ * transpose : the transpose, which is the same arrays read in the other
+ *             format
+ *
+ * @param  nothing
+ * @return ZTSparseMatrix<T> result
+ *
+ */
+template <typename T>
+ZTSparseMatrix<T> ZTSparseMatrix<T>::transpose() const {
+
+    ZTSparseMatrix<T> result(*this);
+    std::swap(result.matrix_rows, result.matrix_cols);
+    result.sparse_format = sparse_format == ZT_SPARSE_CSR ? ZT_SPARSE_CSC : ZT_SPARSE_CSR;
+    return result;
+
+}
+
+/**
+ * to_dense : expands the matrix into dense storage
+ *
+ * @param  nothing
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTSparseMatrix<T>::to_dense() const {
+
+    ZTMatrix<T> result(matrix_rows, matrix_cols, T(0));
+    for (std::size_t i = 0; i < major(); ++i)
+    {
+        for (std::size_t k = sparse_pointers[i]; k < sparse_pointers[i + 1]; ++k)
+        {
+            if (sparse_format == ZT_SPARSE_CSR)
+            {
+                result[i][sparse_indices[k]] = sparse_values[k];
+            }
+            else
+            {
+                result[sparse_indices[k]][i] = sparse_values[k];
+            }
+        }
+    }
+    return result;
+
+}
+
+/**
+ * multiply : performs sparse matrix to scalar multiplication
+ *
+ * @param  T& scalar
+ * @return ZTSparseMatrix<T> result
+ *
+ */
+template <typename T>
+ZTSparseMatrix<T> ZTSparseMatrix<T>::multiply(const T& scalar) const {
+
+    ZTSparseMatrix<T> result(*this);
+    result.cummulative_multiply(scalar);
+    return result;
+
+}
+
+/**
+ * cummulative_multiply : performs cummulative sparse matrix to scalar multiplication
+ *
+ * @param  T& scalar
+ * @return ZTSparseMatrix<T>& result
+ *
+ */
+template <typename T>
+ZTSparseMatrix<T>& ZTSparseMatrix<T>::cummulative_multiply(const T& scalar) {
+
+    ZTBlas<T>::kernels().multiply_scalar(nonzeros(), sparse_values.data(), scalar, sparse_values.data());
+    return *this;
+
+}
+
+/**
+ * operator *= : performs cummulative sparse matrix to scalar multiplication
+ *
+ * @param  T& scalar
+ * @return ZTSparseMatrix<T>& result
+ *
+ */
+template <typename T>
+ZTSparseMatrix<T>& ZTSparseMatrix<T>::operator *=(const T& scalar) {
+
+    return cummulative_multiply(scalar);
+
+}
+
+/**
+ * add : performs sparse matrix to sparse matrix addition
+ *
+ * @param  ZTSparseMatrix<T> m
+ * @return ZTSparseMatrix<T> result, in the format of this matrix
+ *
+ */
+template <typename T>
+ZTSparseMatrix<T> ZTSparseMatrix<T>::add(const ZTSparseMatrix& m) const {
+
+    return combine(m, T(1));
+
+}
+
+/**
+ * minus : performs sparse matrix to sparse matrix subtraction
+ *
+ * @param  ZTSparseMatrix<T> m
+ * @return ZTSparseMatrix<T> result, in the format of this matrix
+ *
+ */
+template <typename T>
+ZTSparseMatrix<T> ZTSparseMatrix<T>::minus(const ZTSparseMatrix& m) const {
+
+    return combine(m, T(-1));
+
+}
+
+/**
+ * multiply : performs the sparse matrix product (SpGEMM) by Gustavson's
+ *            algorithm: row i of the result accumulates a_ik * row k of m
+ *            in a dense accumulator over the touched columns. A symbolic
+ *            pass counts every row so that the numeric pass of each chunk
+ *            writes straight into its place in the result
+ *
+ * @param  ZTSparseMatrix<T> m
+ * @return ZTSparseMatrix<T> result in CSR
+ *
+ */
+template <typename T>
+ZTSparseMatrix<T> ZTSparseMatrix<T>::multiply(const ZTSparseMatrix& m) const {
+
+    ZT_VALIDATE(valid_matrix_product(m.matrix_rows, m.matrix_cols));
+    const ZTSparseMatrix<T> a = to_csr();
+    const ZTSparseMatrix<T> b = m.to_csr();
+    const std::size_t rows = matrix_rows;
+    const std::size_t cols = m.matrix_cols;
+    const std::size_t unmarked = std::numeric_limits<std::size_t>::max();
+
+    ZTThreadPool& pool = ZTThreadPool::instance();
+    const std::size_t chunks = a.nonzeros() + b.nonzeros() >= parallel_nonzeros && pool.get_num_threads() > 1 ? 4 * pool.get_num_threads() : 1;
+    const std::vector<std::size_t> bounds = a.partition(chunks);
+
+    std::vector<std::size_t> pointers(rows + 1, 0);
+    pool.parallel_for(chunks, [&](std::size_t c) {
+        std::vector<std::size_t> marker(cols, unmarked);
+        for (std::size_t i = bounds[c]; i < bounds[c + 1]; ++i)
+        {
+            std::size_t count = 0;
+            for (std::size_t k = a.sparse_pointers[i]; k < a.sparse_pointers[i + 1]; ++k)
+            {
+                const std::size_t j = a.sparse_indices[k];
+                for (std::size_t l = b.sparse_pointers[j]; l < b.sparse_pointers[j + 1]; ++l)
+                {
+                    const std::size_t col = b.sparse_indices[l];
+                    if (marker[col] != i)
+                    {
+                        marker[col] = i;
+                        ++count;
+                    }
+                }
+            }
+            pointers[i + 1] = count;
+        }
+    });
+    for (std::size_t i = 0; i < rows; ++i)
+    {
+        pointers[i + 1] += pointers[i];
+    }
+
+    std::vector<std::size_t> indices(pointers[rows]);
+    std::vector<T> values(pointers[rows]);
+    pool.parallel_for(chunks, [&](std::size_t c) {
+        std::vector<std::size_t> marker(cols, unmarked);
+        std::vector<std::size_t> touched;
+        std::vector<T> accumulator(cols);
+        for (std::size_t i = bounds[c]; i < bounds[c + 1]; ++i)
+        {
+            touched.clear();
+            for (std::size_t k = a.sparse_pointers[i]; k < a.sparse_pointers[i + 1]; ++k)
+            {
+                const std::size_t j = a.sparse_indices[k];
+                const T aik = a.sparse_values[k];
+                for (std::size_t l = b.sparse_pointers[j]; l < b.sparse_pointers[j + 1]; ++l)
+                {
+                    const std::size_t col = b.sparse_indices[l];
+                    if (marker[col] != i)
+                    {
+                        marker[col] = i;
+                        accumulator[col] = aik * b.sparse_values[l];
+                        touched.push_back(col);
+                    }
+                    else
+                    {
+                        accumulator[col] += aik * b.sparse_values[l];
+                    }
+                }
+            }
+            std::sort(touched.begin(), touched.end());
+            std::size_t position = pointers[i];
+            for (std::size_t col : touched)
+            {
+                indices[position] = col;
+                values[position] = accumulator[col];
+                ++position;
+            }
+        }
+    });
+    return ZTSparseMatrix<T>(ZT_SPARSE_CSR, rows, cols, std::move(pointers), std::move(indices), std::move(values));
+
+}
+
+/**
+ * multiply : performs the sparse times dense product, each row of the result
+ *            accumulating scaled rows of m with AXPY over chunks of rows
+ *            holding equal nonzeros
+ *
+ * @param  ZTMatrixView<const T> m dense block of cols rows
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTSparseMatrix<T>::multiply(const ZTMatrixView<const T>& m) const {
+
+    ZT_VALIDATE(valid_matrix_product(m.get_matrix_rows(), m.get_matrix_cols()));
+    const ZTSparseMatrix<T> a = to_csr();
+    const std::size_t p = m.get_matrix_cols();
+    ZTMatrix<T> packed(0, 0, T(0));
+    const T* b = m.data();
+    std::size_t ldb = m.ld();
+    if (m.stride() != 1)
+    {
+        packed = ZTMatrix<T>(m);
+        b = packed.data();
+        ldb = packed.stride();
+    }
+
+    ZTMatrix<T> result(matrix_rows, p, T(0));
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    auto rows = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            for (std::size_t k = a.sparse_pointers[i]; k < a.sparse_pointers[i + 1]; ++k)
+            {
+                blas.axpy(p, a.sparse_values[k], b + a.sparse_indices[k] * ldb, result[i]);
+            }
+        }
+    };
+
+    ZTThreadPool& pool = ZTThreadPool::instance();
+    if (a.nonzeros() * p >= parallel_nonzeros && pool.get_num_threads() > 1)
+    {
+        const std::vector<std::size_t> bounds = a.partition(4 * pool.get_num_threads());
+        pool.parallel_for(bounds.size() - 1, [&](std::size_t c) {
+            rows(bounds[c], bounds[c + 1]);
+        });
+        return result;
+    }
+    rows(0, matrix_rows);
+    return result;
+
+}
+
+/**
+ * matvec : performs the sparse matrix-vector product (SpMV)
+ *
+ * @param  ZTVectorView<const T> v
+ * @return ZTVector<T> result (rows elements)
+ *
+ */
+template <typename T>
+ZTVector<T> ZTSparseMatrix<T>::matvec(const ZTVectorView<const T>& v) const {
+
+    ZTVector<T> result((std::vector<T>()));
+    matvec(v, result);
+    return result;
+
+}
+
+/**
+ * matvec_transposed : performs the product of the transpose with a vector,
+ *                     without forming the transpose
+ *
+ * @param  ZTVectorView<const T> v
+ * @return ZTVector<T> result (cols elements)
+ *
+ */
+template <typename T>
+ZTVector<T> ZTSparseMatrix<T>::matvec_transposed(const ZTVectorView<const T>& v) const {
+
+    ZTVector<T> result((std::vector<T>()));
+    matvec_transposed(v, result);
+    return result;
+
+}
+
+/**
+ * matvec : performs the sparse matrix-vector product into a preallocated
+ *          result, out is only reallocated when its size differs. When out
+ *          aliases the operand the product goes through a temporary first
+ *
+ * @param  ZTVectorView<const T> v
+ * @param  ZTVector<T>& out result (rows elements)
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTSparseMatrix<T>::matvec(const ZTVectorView<const T>& v, ZTVector<T>& out) const {
+
+    ZT_VALIDATE(valid_matrix_vector_product(v.size()));
+    if (v.data() >= out.data() && v.data() < out.data() + out.size())
+    {
+        out = matvec(v);
+        return;
+    }
+    out.set_vector_size(matrix_rows);
+    if (sparse_format == ZT_SPARSE_CSR)
+    {
+        gather(v.data(), v.stride(), out.data());
+        return;
+    }
+    std::fill(out.data(), out.data() + matrix_rows, T(0));
+    scatter(v.data(), v.stride(), out.data(), matrix_rows);
+
+}
+
+/**
+ * matvec_transposed : performs the product of the transpose with a vector
+ *                     into a preallocated result
+ *
+ * @param  ZTVectorView<const T> v
+ * @param  ZTVector<T>& out result (cols elements)
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTSparseMatrix<T>::matvec_transposed(const ZTVectorView<const T>& v, ZTVector<T>& out) const {
+
+    transpose().matvec(v, out);
+
+}
+
+/**
+ * apply : performs y = A * x for the iterative solvers
+ *
+ * @param  ZTVector<T> x
+ * @param  ZTVector<T>& y result (rows elements)
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTSparseMatrix<T>::apply(const ZTVector<T>& x, ZTVector<T>& y) const {
+
+    matvec(x, y);
+
+}
+
+/**
+ * trace : performs sparse matrix trace operation
+ *
+ * @param  nothing
+ * @return T result
+ *
+ */
+template <typename T>
+T ZTSparseMatrix<T>::trace() const {
+
+    ZT_VALIDATE(valid_sqaure_matrix(matrix_rows, matrix_cols));
+    T result = 0;
+    for (std::size_t i = 0; i < matrix_rows; ++i)
+    {
+        const std::size_t k = find(i, i);
+        if (k != std::numeric_limits<std::size_t>::max())
+        {
+            result += sparse_values[k];
+        }
+    }
+    return result;
+
+}
+
+/**
+ * norm : performs sparse matrix Frobenius norm operation over the stored entries
+ *
+ * @param  nothing
+ * @return T result
+ *
+ */
+template <typename T>
+T ZTSparseMatrix<T>::norm() const {
+
+    return std::sqrt(ZTBlas<T>::kernels().dot(nonzeros(), sparse_values.data(), sparse_values.data()));
+
+}
+
+/**
+ * valid_compressed_arrays : checks that the pointers, indices and values
+ *                           describe a compressed matrix of these dimensions
+ *
+ * @param  nothing
+ * @return void
+ *
+ */
+template <typename T>
+void ZTSparseMatrix<T>::valid_compressed_arrays() const {
+
+    std::ostringstream invalid_arrays;
+    if (sparse_pointers.size() != major() + 1 || sparse_pointers.front() != 0 ||
+        sparse_pointers.back() != sparse_indices.size() || sparse_indices.size() != sparse_values.size())
+    {
+        invalid_arrays << "Compressed arrays of sizes: " << sparse_pointers.size() << ", " << sparse_indices.size() << " and " << sparse_values.size() << " do not describe a " << matrix_rows << "x" << matrix_cols << " matrix!.";
+        zt_raise<std::invalid_argument>(invalid_arrays.str());
+    }
+    for (std::size_t i = 0; i < major(); ++i)
+    {
+        if (sparse_pointers[i] > sparse_pointers[i + 1])
+        {
+            invalid_arrays << "Compressed pointers decrease at slice " << i << "!.";
+            zt_raise<std::invalid_argument>(invalid_arrays.str());
+        }
+        for (std::size_t k = sparse_pointers[i]; k < sparse_pointers[i + 1]; ++k)
+        {
+            if (sparse_indices[k] >= minor() || (k > sparse_pointers[i] && sparse_indices[k] <= sparse_indices[k - 1]))
+            {
+                invalid_arrays << "Compressed indices of slice " << i << " are out of range or not strictly ascending!.";
+                zt_raise<std::invalid_argument>(invalid_arrays.str());
+            }
+        }
+    }
+
+}
+
+/**
+ * valid_sqaure_matrix : checks for a square matrix
+ *
+ * @param  std::size_t rows
+ * @param  std::size_t cols
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTSparseMatrix<T>::valid_sqaure_matrix(std::size_t rows, std::size_t cols) const {
+
+    if (rows != cols)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Matrices of dimensions: " << rows << "x" << cols << " is not a sqaure matrix!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * valid_matrix_product : checks for valid product dimensions with a matrix
+ *                        of the given dimensions
+ *
+ * @param  std::size_t rows rows of the right operand
+ * @param  std::size_t cols cols of the right operand
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTSparseMatrix<T>::valid_matrix_product(std::size_t rows, std::size_t cols) const {
+
+    if (matrix_cols != rows)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Matrices of dimensions: " << matrix_rows << "x" << matrix_cols << " and " << rows << "x" << cols << " are not suitable for matrix product!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * valid_matrix_vector_product : checks for valid matrix-vector product dimensions
+ *
+ * @param  std::size_t size size of the vector
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTSparseMatrix<T>::valid_matrix_vector_product(std::size_t size) const {
+
+    if (matrix_cols != size)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Matrix of dimensions: " << matrix_rows << "x" << matrix_cols << " and vector of size " << size << " are not suitable for matrix-vector product!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * valid_matrix_add_minus : checks for dimensions valid matrix addition or subtraction
+ *
+ * @param  ZTSparseMatrix<T> m
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTSparseMatrix<T>::valid_matrix_add_minus(const ZTSparseMatrix& m) const {
+
+    if (matrix_cols != m.matrix_cols || matrix_rows != m.matrix_rows)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Matrices of dimensions: " << matrix_rows << "x" << matrix_cols << " and " << m.matrix_rows << "x" << m.matrix_cols << " are not suitable for matrix add or minus!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * valid_index_dimensions : checks that a zero-based index is inside the matrix
+ *
+ * @param  std::size_t row
+ * @param  std::size_t col
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTSparseMatrix<T>::valid_index_dimensions(std::size_t row, std::size_t col) const {
+
+    if (row >= matrix_rows || col >= matrix_cols)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Matrix index (" << row << ", " << col << ") out of range for a " << matrix_rows << "x" << matrix_cols << " matrix!.";
+        zt_raise<std::out_of_range>(invalid_dimensions.str());
+    }
+
+}
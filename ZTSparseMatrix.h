@@ -0,0 +1,140 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ZTSPARSEMATRIX_H
+#define ZTSPARSEMATRIX_H
+
+#include <vector>
+#include <cstddef>
+
+#include "ZTMatrix.h"
+#include "ZTVector.h"
+#include "ZTMatrixView.h"
+#include "ZTVectorView.h"
+
+enum ZTSparseFormat {
+    ZT_SPARSE_CSR = 0, // compressed sparse rows: row slices of column indices
+    ZT_SPARSE_CSC = 1  // compressed sparse columns: column slices of row indices
+};
+
+/*
+ * ZTSparseMatrix : compressed sparse matrix storing only its nonzero entries.
+ *                  Entries are grouped by major index (rows in CSR, columns
+ *                  in CSC): slice i holds entries pointers[i] up to
+ *                  pointers[i + 1] of indices and values, with strictly
+ *                  ascending minor indices.
+ *
+ *                  Products are split across the thread pool into chunks of
+ *                  major slices holding equal numbers of nonzeros, so that a
+ *                  few dense rows do not serialize the work. CSR products
+ *                  gather into disjoint rows of the result; CSC products
+ *                  scatter into private buffers that are reduced afterwards.
+ *                  SpGEMM is Gustavson's row by row algorithm with a
+ *                  symbolic pass sizing the result and a numeric pass filling
+ *                  it, on the CSR forms of both operands.
+ *
+ *                  Results of add, minus and SpGEMM keep every entry either
+ *                  operand structurally produces, even if it cancels to zero.
+ */
+template <typename T>
+class ZTSparseMatrix {
+
+private:
+    static constexpr std::size_t parallel_nonzeros = 64 * 1024; // below this threads do not pay off
+
+    std::vector<std::size_t> sparse_pointers;  // major + 1 offsets into indices and values
+    std::vector<std::size_t> sparse_indices;   // minor index of every entry
+    std::vector<T> sparse_values;
+    std::size_t matrix_rows;
+    std::size_t matrix_cols;
+    ZTSparseFormat sparse_format;
+
+    std::size_t major() const;
+    std::size_t minor() const;
+    std::vector<std::size_t> partition(std::size_t chunks) const;
+    std::size_t find(std::size_t slice, std::size_t index) const;
+
+    void gather(const T* x, std::size_t incx, T* y) const;
+    void scatter(const T* x, std::size_t incx, T* y, std::size_t size) const;
+    ZTSparseMatrix<T> combine(const ZTSparseMatrix& m, const T& sign) const;
+    ZTSparseMatrix<T> converted() const;
+
+public:
+    ZTSparseMatrix(std::size_t rows, std::size_t cols, ZTSparseFormat format = ZT_SPARSE_CSR);  // all zeros
+    ZTSparseMatrix(std::size_t rows, std::size_t cols,
+                   const std::vector<std::size_t>& row_indices,
+                   const std::vector<std::size_t>& col_indices,
+                   const std::vector<T>& values,
+                   ZTSparseFormat format = ZT_SPARSE_CSR);  // coordinate triplets, duplicates summed
+    ZTSparseMatrix(ZTSparseFormat format, std::size_t rows, std::size_t cols,
+                   std::vector<std::size_t>&& pointers,
+                   std::vector<std::size_t>&& indices,
+                   std::vector<T>&& values);  // compressed arrays, taken over after validation
+    explicit ZTSparseMatrix(const ZTMatrixView<const T>& m, ZTSparseFormat format = ZT_SPARSE_CSR);  // nonzeros of a dense block
+
+    std::size_t get_matrix_rows() const;
+    std::size_t get_matrix_cols() const;
+    std::size_t nonzeros() const;
+    ZTSparseFormat format() const;
+
+    const std::vector<std::size_t>& pointers() const;
+    const std::vector<std::size_t>& indices() const;
+    const std::vector<T>& values() const;
+
+    T at(std::size_t row, std::size_t col) const;  // zero-based, checked, zero when not stored
+
+    ZTSparseMatrix<T> to_csr() const;
+    ZTSparseMatrix<T> to_csc() const;
+    ZTSparseMatrix<T> transpose() const;  // same arrays in the other format
+    ZTMatrix<T> to_dense() const;
+
+    ZTSparseMatrix<T> multiply(const T& scalar) const;
+    ZTSparseMatrix<T>& cummulative_multiply(const T& scalar);
+    ZTSparseMatrix<T>& operator *=(const T& scalar);
+
+    ZTSparseMatrix<T> add(const ZTSparseMatrix& m) const;
+    ZTSparseMatrix<T> minus(const ZTSparseMatrix& m) const;
+    ZTSparseMatrix<T> multiply(const ZTSparseMatrix& m) const;  // SpGEMM, result in CSR
+    ZTMatrix<T> multiply(const ZTMatrixView<const T>& m) const; // sparse times dense
+
+    ZTVector<T> matvec(const ZTVectorView<const T>& v) const;             // SpMV
+    ZTVector<T> matvec_transposed(const ZTVectorView<const T>& v) const;  // transpose times vector
+
+    void matvec(const ZTVectorView<const T>& v, ZTVector<T>& out) const;
+    void matvec_transposed(const ZTVectorView<const T>& v, ZTVector<T>& out) const;
+    void apply(const ZTVector<T>& x, ZTVector<T>& y) const;  // y = A * x, the ZTKrylov operator interface
+
+    T trace() const;
+    T norm() const;
+
+    void valid_compressed_arrays() const;
+    void valid_sqaure_matrix(std::size_t rows, std::size_t cols) const;
+    void valid_matrix_product(std::size_t rows, std::size_t cols) const;
+    void valid_matrix_vector_product(std::size_t size) const;
+    void valid_matrix_add_minus(const ZTSparseMatrix& m) const;
+    void valid_index_dimensions(std::size_t row, std::size_t col) const;
+
+};
+
+#endif /* ZTSPARSEMATRIX_H */
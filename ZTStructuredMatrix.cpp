@@ -0,0 +1,2044 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cmath>
+#include <vector>
+#include <cstddef>
+#include <sstream>
+#include <utility>
+#include <stdexcept>
+#include <algorithm>
+
+#include "ZTBlas.h"
+#include "ZTError.h"
+#include "ZTStructuredMatrix.h"
+
+/**
+ * zt_structured_valid_square : checks that a dense block is square
+ *
+ * @param  std::size_t rows
+ * @param  std::size_t cols
+ * @return void
+ *
+ */
+inline void zt_structured_valid_square(std::size_t rows, std::size_t cols) {
+
+    if (rows != cols)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Matrices of dimensions: " << rows << "x" << cols << " is not a sqaure matrix!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * zt_structured_valid_product : checks that a matrix of order n can
+ *                               multiply an operand of rows x cols
+ *
+ * @param  std::size_t n order of the structured matrix
+ * @param  std::size_t rows rows of the operand
+ * @param  std::size_t cols cols of the operand
+ * @return void
+ *
+ */
+inline void zt_structured_valid_product(std::size_t n, std::size_t rows, std::size_t cols) {
+
+    if (rows != n)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Matrices of dimensions: " << n << "x" << n << " and " << rows << "x" << cols << " are not suitable for matrix product!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * zt_structured_valid_add_minus : checks that a matrix of order n can be
+ *                                 added to an operand of rows x cols
+ *
+ * @param  std::size_t n order of the structured matrix
+ * @param  std::size_t rows rows of the operand
+ * @param  std::size_t cols cols of the operand
+ * @return void
+ *
+ */
+inline void zt_structured_valid_add_minus(std::size_t n, std::size_t rows, std::size_t cols) {
+
+    if (rows != n || cols != n)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Matrices of dimensions: " << n << "x" << n << " and " << rows << "x" << cols << " are not suitable for matrix add or minus!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * zt_structured_valid_vector : checks that a vector has one element per
+ *                              column, for products, or per row, for solves
+ *
+ * @param  std::size_t n order of the structured matrix
+ * @param  std::size_t size size of the vector
+ * @return void
+ *
+ */
+inline void zt_structured_valid_vector(std::size_t n, std::size_t size) {
+
+    if (size != n)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Matrix of dimensions: " << n << "x" << n << " and vector of size " << size << " are not suitable for matrix-vector product!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * zt_structured_invalid_index : reports an index outside the matrix or
+ *                               outside its stored structure
+ *
+ * @param  std::size_t row
+ * @param  std::size_t col
+ * @param  std::size_t n order of the structured matrix
+ * @param  char* structure name of the structure
+ * @return void
+ *
+ */
+inline void zt_structured_invalid_index(std::size_t row, std::size_t col, std::size_t n, const char* structure) {
+
+    std::ostringstream invalid_dimensions;
+    invalid_dimensions << "Matrix index (" << row << ", " << col << ") out of range for a " << n << "x" << n << " " << structure << " matrix!.";
+    zt_raise<std::out_of_range>(invalid_dimensions.str());
+
+}
+
+/**
+ * zt_structured_contiguous : elements of a vector view, gathered into
+ *                            buffer only when they are strided
+ *
+ * @param  ZTVectorView<const T> v
+ * @param  std::vector<T>& buffer storage for the strided case
+ * @return const T* contiguous elements
+ *
+ */
+template <typename T>
+const T* zt_structured_contiguous(const ZTVectorView<const T>& v, std::vector<T>& buffer) {
+
+    if (v.stride() == 1)
+    {
+        return v.data();
+    }
+    buffer.resize(v.size());
+    for (std::size_t i = 0; i < v.size(); ++i)
+    {
+        buffer[i] = v[i];
+    }
+    return buffer.data();
+
+}
+
+/**
+ * zt_structured_rows : rows of a dense view with unit column stride, packed
+ *                      into buffer only when the view is strided
+ *
+ * @param  ZTMatrixView<const T> m
+ * @param  ZTMatrix<T>& buffer storage for the strided case
+ * @param  std::size_t& ld distance between the returned rows
+ * @return const T* first row
+ *
+ */
+template <typename T>
+const T* zt_structured_rows(const ZTMatrixView<const T>& m, ZTMatrix<T>& buffer, std::size_t& ld) {
+
+    if (m.stride() == 1)
+    {
+        ld = m.ld();
+        return m.data();
+    }
+    buffer = ZTMatrix<T>(m);
+    ld = buffer.stride();
+    return buffer.data();
+
+}
+
+/**
+ * zt_structured_aliases : whether a vector view reads from the storage of
+ *                         the result vector
+ *
+ * @param  ZTVectorView<const T> v
+ * @param  ZTVector<T> out
+ * @return bool
+ *
+ */
+template <typename T>
+bool zt_structured_aliases(const ZTVectorView<const T>& v, const ZTVector<T>& out) {
+
+    return v.data() >= out.data() && v.data() < out.data() + out.size();
+
+}
+
+/**
+ * Constructor : Constructs an n x n diagonal matrix with a constant diagonal
+ *
+ * @param  std::size_t n order
+ * @param  T& value diagonal entries
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTDiagonalMatrix<T>::ZTDiagonalMatrix(std::size_t n, const T& value) : diagonal(n, value) {
+
+}
+
+/**
+ * Constructor : Constructs a diagonal matrix from its entries
+ *
+ * @param  std::vector<T> entries diagonal entries
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTDiagonalMatrix<T>::ZTDiagonalMatrix(const std::vector<T>& entries) : diagonal(entries) {
+
+}
+
+/**
+ * Constructor : Constructs a diagonal matrix from the diagonal of a square
+ *               dense block
+ *
+ * @param  ZTMatrixView<const T> m square block
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTDiagonalMatrix<T>::ZTDiagonalMatrix(const ZTMatrixView<const T>& m) {
+
+    ZT_VALIDATE(zt_structured_valid_square(m.get_matrix_rows(), m.get_matrix_cols()));
+    diagonal.resize(m.get_matrix_rows());
+    for (std::size_t i = 0; i < diagonal.size(); ++i)
+    {
+        diagonal[i] = m.unsafe_get(i, i);
+    }
+
+}
+
+/**
+ * get_matrix_rows : gets the number of rows
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTDiagonalMatrix<T>::get_matrix_rows() const {
+
+    return diagonal.size();
+
+}
+
+/**
+ * get_matrix_cols : gets the number of cols
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTDiagonalMatrix<T>::get_matrix_cols() const {
+
+    return diagonal.size();
+
+}
+
+/**
+ * data : diagonal entries
+ *
+ * @param  nothing
+ * @return T* data
+ *
+ */
+template <typename T>
+inline T* ZTDiagonalMatrix<T>::data() {
+
+    return diagonal.data();
+
+}
+
+/**
+ * data : diagonal entries
+ *
+ * @param  nothing
+ * @return const T* data
+ *
+ */
+template <typename T>
+inline const T* ZTDiagonalMatrix<T>::data() const {
+
+    return diagonal.data();
+
+}
+
+/**
+ * at : diagonal entry by zero-based index, always checked
+ *
+ * @param  std::size_t row
+ * @param  std::size_t col equal to row
+ * @return T& element
+ *
+ */
+template <typename T>
+T& ZTDiagonalMatrix<T>::at(std::size_t row, std::size_t col) {
+
+    if (row != col || row >= diagonal.size())
+    {
+        zt_structured_invalid_index(row, col, diagonal.size(), "diagonal");
+    }
+    return diagonal[row];
+
+}
+
+/**
+ * at : diagonal entry by zero-based index, always checked
+ *
+ * @param  std::size_t row
+ * @param  std::size_t col equal to row
+ * @return const T& element
+ *
+ */
+template <typename T>
+const T& ZTDiagonalMatrix<T>::at(std::size_t row, std::size_t col) const {
+
+    if (row != col || row >= diagonal.size())
+    {
+        zt_structured_invalid_index(row, col, diagonal.size(), "diagonal");
+    }
+    return diagonal[row];
+
+}
+
+/**
+ * to_dense : expands the matrix into dense storage
+ *
+ * @param  nothing
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTDiagonalMatrix<T>::to_dense() const {
+
+    const std::size_t n = diagonal.size();
+    ZTMatrix<T> result(n, n, T(0));
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        result[i][i] = diagonal[i];
+    }
+    return result;
+
+}
+
+/**
+ * multiply : performs diagonal matrix to scalar multiplication
+ *
+ * @param  T& scalar
+ * @return ZTDiagonalMatrix<T> result
+ *
+ */
+template <typename T>
+ZTDiagonalMatrix<T> ZTDiagonalMatrix<T>::multiply(const T& scalar) const {
+
+    ZTDiagonalMatrix<T> result(*this);
+    ZTBlas<T>::kernels().multiply_scalar(diagonal.size(), diagonal.data(), scalar, result.diagonal.data());
+    return result;
+
+}
+
+/**
+ * add : performs diagonal matrix to diagonal matrix addition
+ *
+ * @param  ZTDiagonalMatrix<T> m
+ * @return ZTDiagonalMatrix<T> result
+ *
+ */
+template <typename T>
+ZTDiagonalMatrix<T> ZTDiagonalMatrix<T>::add(const ZTDiagonalMatrix& m) const {
+
+    ZT_VALIDATE(zt_structured_valid_add_minus(diagonal.size(), m.diagonal.size(), m.diagonal.size()));
+    ZTDiagonalMatrix<T> result(*this);
+    ZTBlas<T>::kernels().add(diagonal.size(), diagonal.data(), m.diagonal.data(), result.diagonal.data());
+    return result;
+
+}
+
+/**
+ * minus : performs diagonal matrix to diagonal matrix subtraction
+ *
+ * @param  ZTDiagonalMatrix<T> m
+ * @return ZTDiagonalMatrix<T> result
+ *
+ */
+template <typename T>
+ZTDiagonalMatrix<T> ZTDiagonalMatrix<T>::minus(const ZTDiagonalMatrix& m) const {
+
+    ZT_VALIDATE(zt_structured_valid_add_minus(diagonal.size(), m.diagonal.size(), m.diagonal.size()));
+    ZTDiagonalMatrix<T> result(*this);
+    ZTBlas<T>::kernels().minus(diagonal.size(), diagonal.data(), m.diagonal.data(), result.diagonal.data());
+    return result;
+
+}
+
+/**
+ * multiply : performs diagonal matrix to diagonal matrix product
+ *
+ * @param  ZTDiagonalMatrix<T> m
+ * @return ZTDiagonalMatrix<T> result
+ *
+ */
+template <typename T>
+ZTDiagonalMatrix<T> ZTDiagonalMatrix<T>::multiply(const ZTDiagonalMatrix& m) const {
+
+    ZT_VALIDATE(zt_structured_valid_product(diagonal.size(), m.diagonal.size(), m.diagonal.size()));
+    ZTDiagonalMatrix<T> result(*this);
+    for (std::size_t i = 0; i < diagonal.size(); ++i)
+    {
+        result.diagonal[i] *= m.diagonal[i];
+    }
+    return result;
+
+}
+
+/**
+ * add : performs diagonal matrix to dense matrix addition
+ *
+ * @param  ZTMatrixView<const T> m
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTDiagonalMatrix<T>::add(const ZTMatrixView<const T>& m) const {
+
+    ZT_VALIDATE(zt_structured_valid_add_minus(diagonal.size(), m.get_matrix_rows(), m.get_matrix_cols()));
+    ZTMatrix<T> result(m);
+    for (std::size_t i = 0; i < diagonal.size(); ++i)
+    {
+        result[i][i] += diagonal[i];
+    }
+    return result;
+
+}
+
+/**
+ * multiply : performs diagonal matrix to dense matrix product, scaling row
+ *            i of m by entry i
+ *
+ * @param  ZTMatrixView<const T> m
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTDiagonalMatrix<T>::multiply(const ZTMatrixView<const T>& m) const {
+
+    ZT_VALIDATE(zt_structured_valid_product(diagonal.size(), m.get_matrix_rows(), m.get_matrix_cols()));
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    ZTMatrix<T> result(m);
+    for (std::size_t i = 0; i < diagonal.size(); ++i)
+    {
+        blas.multiply_scalar(result.get_matrix_cols(), result[i], diagonal[i], result[i]);
+    }
+    return result;
+
+}
+
+/**
+ * matvec : performs the diagonal matrix-vector product
+ *
+ * @param  ZTVectorView<const T> v
+ * @return ZTVector<T> result
+ *
+ */
+template <typename T>
+ZTVector<T> ZTDiagonalMatrix<T>::matvec(const ZTVectorView<const T>& v) const {
+
+    ZTVector<T> result((std::vector<T>()));
+    matvec(v, result);
+    return result;
+
+}
+
+/**
+ * matvec : performs the diagonal matrix-vector product into a preallocated
+ *          result
+ *
+ * @param  ZTVectorView<const T> v
+ * @param  ZTVector<T>& out result
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTDiagonalMatrix<T>::matvec(const ZTVectorView<const T>& v, ZTVector<T>& out) const {
+
+    ZT_VALIDATE(zt_structured_valid_vector(diagonal.size(), v.size()));
+    out.set_vector_size(diagonal.size());
+    T* y = out.data();
+    for (std::size_t i = 0; i < diagonal.size(); ++i)
+    {
+        y[i] = diagonal[i] * v[i];
+    }
+
+}
+
+/**
+ * apply : performs y = A * x for the iterative solvers
+ *
+ * @param  ZTVector<T> x
+ * @param  ZTVector<T>& y result
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTDiagonalMatrix<T>::apply(const ZTVector<T>& x, ZTVector<T>& y) const {
+
+    matvec(x, y);
+
+}
+
+/**
+ * solve : solves D * x = b by division
+ *
+ * @param  ZTVectorView<const T> b right-hand side
+ * @return ZTVector<T> result
+ *
+ */
+template <typename T>
+ZTVector<T> ZTDiagonalMatrix<T>::solve(const ZTVectorView<const T>& b) const {
+
+    ZT_VALIDATE(zt_structured_valid_vector(diagonal.size(), b.size()));
+    ZTVector<T> result(b);
+    for (std::size_t i = 0; i < diagonal.size(); ++i)
+    {
+        if (diagonal[i] == T(0))
+        {
+            zt_raise<std::domain_error>("Matrix is singular, the system has no unique solution!.");
+        }
+        result.data()[i] /= diagonal[i];
+    }
+    return result;
+
+}
+
+/**
+ * solve : solves D * X = B by scaling the rows of B
+ *
+ * @param  ZTMatrixView<const T> b right-hand sides
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTDiagonalMatrix<T>::solve(const ZTMatrixView<const T>& b) const {
+
+    ZT_VALIDATE(zt_structured_valid_product(diagonal.size(), b.get_matrix_rows(), b.get_matrix_cols()));
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    ZTMatrix<T> result(b);
+    for (std::size_t i = 0; i < diagonal.size(); ++i)
+    {
+        if (diagonal[i] == T(0))
+        {
+            zt_raise<std::domain_error>("Matrix is singular, the system has no unique solution!.");
+        }
+        blas.multiply_scalar(result.get_matrix_cols(), result[i], T(1) / diagonal[i], result[i]);
+    }
+    return result;
+
+}
+
+/**
+ * determinant : product of the diagonal
+ *
+ * @param  nothing
+ * @return T result
+ *
+ */
+template <typename T>
+T ZTDiagonalMatrix<T>::determinant() const {
+
+    T result = T(1);
+    for (std::size_t i = 0; i < diagonal.size(); ++i)
+    {
+        result *= diagonal[i];
+    }
+    return result;
+
+}
+
+/**
+ * trace : sum of the diagonal
+ *
+ * @param  nothing
+ * @return T result
+ *
+ */
+template <typename T>
+T ZTDiagonalMatrix<T>::trace() const {
+
+    T result = 0;
+    for (std::size_t i = 0; i < diagonal.size(); ++i)
+    {
+        result += diagonal[i];
+    }
+    return result;
+
+}
+
+/**
+ * norm : Frobenius norm
+ *
+ * @param  nothing
+ * @return T result
+ *
+ */
+template <typename T>
+T ZTDiagonalMatrix<T>::norm() const {
+
+    return std::sqrt(ZTBlas<T>::kernels().dot(diagonal.size(), diagonal.data(), diagonal.data()));
+
+}
+
+/**
+ * Constructor : Constructs an n x n banded matrix with every entry inside
+ *               the band set to value
+ *
+ * @param  std::size_t n order
+ * @param  std::size_t lower_bandwidth number of sub-diagonals
+ * @param  std::size_t upper_bandwidth number of super-diagonals
+ * @param  T& value entries inside the band
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTBandedMatrix<T>::ZTBandedMatrix(std::size_t n, std::size_t lower_bandwidth, std::size_t upper_bandwidth,
+                                  const T& value) : band(n * (lower_bandwidth + upper_bandwidth + 1), T(0)),
+                                                    order(n),
+                                                    lower(lower_bandwidth),
+                                                    upper(upper_bandwidth) {
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const std::size_t first = i > lower ? i - lower : 0;
+        const std::size_t last = std::min(n - 1, i + upper);
+        for (std::size_t j = first; j <= last; ++j)
+        {
+            band[i * width() + j + lower - i] = value;
+        }
+    }
+
+}
+
+/**
+ * Constructor : Constructs a banded matrix from the band of a square dense
+ *               block, entries outside the band are dropped
+ *
+ * @param  ZTMatrixView<const T> m square block
+ * @param  std::size_t lower_bandwidth number of sub-diagonals
+ * @param  std::size_t upper_bandwidth number of super-diagonals
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTBandedMatrix<T>::ZTBandedMatrix(const ZTMatrixView<const T>& m, std::size_t lower_bandwidth,
+                                  std::size_t upper_bandwidth) : order(m.get_matrix_rows()),
+                                                                 lower(lower_bandwidth),
+                                                                 upper(upper_bandwidth) {
+
+    ZT_VALIDATE(zt_structured_valid_square(m.get_matrix_rows(), m.get_matrix_cols()));
+    band.assign(order * width(), T(0));
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        const std::size_t first = i > lower ? i - lower : 0;
+        const std::size_t last = std::min(order - 1, i + upper);
+        for (std::size_t j = first; j <= last; ++j)
+        {
+            band[i * width() + j + lower - i] = m.unsafe_get(i, j);
+        }
+    }
+
+}
+
+/**
+ * tridiagonal : the tridiagonal matrix of the given diagonals
+ *
+ * @param  std::vector<T> sub n - 1 entries below the diagonal
+ * @param  std::vector<T> diagonal n diagonal entries
+ * @param  std::vector<T> super n - 1 entries above the diagonal
+ * @return ZTBandedMatrix<T> result
+ *
+ */
+template <typename T>
+ZTBandedMatrix<T> ZTBandedMatrix<T>::tridiagonal(const std::vector<T>& sub, const std::vector<T>& diagonal,
+                                                 const std::vector<T>& super) {
+
+    const std::size_t n = diagonal.size();
+    if (sub.size() + 1 != std::max<std::size_t>(n, 1) || super.size() != sub.size())
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Diagonals of sizes: " << sub.size() << ", " << n << " and " << super.size() << " do not form a tridiagonal matrix!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+    ZTBandedMatrix<T> result(n, 1, 1);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        result.band[i * 3 + 1] = diagonal[i];
+        if (i > 0)
+        {
+            result.band[i * 3] = sub[i - 1];
+        }
+        if (i + 1 < n)
+        {
+            result.band[i * 3 + 2] = super[i];
+        }
+    }
+    return result;
+
+}
+
+/**
+ * width : entries stored per row
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTBandedMatrix<T>::width() const {
+
+    return lower + upper + 1;
+
+}
+
+/**
+ * get_matrix_rows : gets the number of rows
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTBandedMatrix<T>::get_matrix_rows() const {
+
+    return order;
+
+}
+
+/**
+ * get_matrix_cols : gets the number of cols
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTBandedMatrix<T>::get_matrix_cols() const {
+
+    return order;
+
+}
+
+/**
+ * lower_bandwidth : number of sub-diagonals
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTBandedMatrix<T>::lower_bandwidth() const {
+
+    return lower;
+
+}
+
+/**
+ * upper_bandwidth : number of super-diagonals
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTBandedMatrix<T>::upper_bandwidth() const {
+
+    return upper;
+
+}
+
+/**
+ * at : entry inside the band by zero-based index, always checked
+ *
+ * @param  std::size_t row
+ * @param  std::size_t col
+ * @return T& element
+ *
+ */
+template <typename T>
+T& ZTBandedMatrix<T>::at(std::size_t row, std::size_t col) {
+
+    valid_band_index(row, col);
+    return band[row * width() + col + lower - row];
+
+}
+
+/**
+ * at : entry inside the band by zero-based index, always checked
+ *
+ * @param  std::size_t row
+ * @param  std::size_t col
+ * @return const T& element
+ *
+ */
+template <typename T>
+const T& ZTBandedMatrix<T>::at(std::size_t row, std::size_t col) const {
+
+    valid_band_index(row, col);
+    return band[row * width() + col + lower - row];
+
+}
+
+/**
+ * to_dense : expands the matrix into dense storage
+ *
+ * @param  nothing
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTBandedMatrix<T>::to_dense() const {
+
+    ZTMatrix<T> result(order, order, T(0));
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        const std::size_t first = i > lower ? i - lower : 0;
+        const std::size_t last = std::min(order - 1, i + upper);
+        for (std::size_t j = first; j <= last; ++j)
+        {
+            result[i][j] = band[i * width() + j + lower - i];
+        }
+    }
+    return result;
+
+}
+
+/**
+ * multiply : performs banded matrix to scalar multiplication
+ *
+ * @param  T& scalar
+ * @return ZTBandedMatrix<T> result
+ *
+ */
+template <typename T>
+ZTBandedMatrix<T> ZTBandedMatrix<T>::multiply(const T& scalar) const {
+
+    ZTBandedMatrix<T> result(*this);
+    ZTBlas<T>::kernels().multiply_scalar(band.size(), band.data(), scalar, result.band.data());
+    return result;
+
+}
+
+/**
+ * add : performs banded matrix to banded matrix addition, the result has
+ *       the wider of the two bandwidths on each side
+ *
+ * @param  ZTBandedMatrix<T> m
+ * @return ZTBandedMatrix<T> result
+ *
+ */
+template <typename T>
+ZTBandedMatrix<T> ZTBandedMatrix<T>::add(const ZTBandedMatrix& m) const {
+
+    ZT_VALIDATE(zt_structured_valid_add_minus(order, m.order, m.order));
+    ZTBandedMatrix<T> result(order, std::max(lower, m.lower), std::max(upper, m.upper));
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        const std::size_t first = i > result.lower ? i - result.lower : 0;
+        const std::size_t last = std::min(order - 1, i + result.upper);
+        for (std::size_t j = first; j <= last; ++j)
+        {
+            T sum = T(0);
+            if (j + lower >= i && j <= i + upper)
+            {
+                sum += band[i * width() + j + lower - i];
+            }
+            if (j + m.lower >= i && j <= i + m.upper)
+            {
+                sum += m.band[i * m.width() + j + m.lower - i];
+            }
+            result.band[i * result.width() + j + result.lower - i] = sum;
+        }
+    }
+    return result;
+
+}
+
+/**
+ * minus : performs banded matrix to banded matrix subtraction
+ *
+ * @param  ZTBandedMatrix<T> m
+ * @return ZTBandedMatrix<T> result
+ *
+ */
+template <typename T>
+ZTBandedMatrix<T> ZTBandedMatrix<T>::minus(const ZTBandedMatrix& m) const {
+
+    return add(m.multiply(T(-1)));
+
+}
+
+/**
+ * add : performs banded matrix to dense matrix addition
+ *
+ * @param  ZTMatrixView<const T> m
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTBandedMatrix<T>::add(const ZTMatrixView<const T>& m) const {
+
+    ZT_VALIDATE(zt_structured_valid_add_minus(order, m.get_matrix_rows(), m.get_matrix_cols()));
+    ZTMatrix<T> result(m);
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        const std::size_t first = i > lower ? i - lower : 0;
+        const std::size_t last = std::min(order - 1, i + upper);
+        for (std::size_t j = first; j <= last; ++j)
+        {
+            result[i][j] += band[i * width() + j + lower - i];
+        }
+    }
+    return result;
+
+}
+
+/**
+ * multiply : performs banded matrix to dense matrix product, row i of the
+ *            result accumulating the band of row i times rows of m
+ *
+ * @param  ZTMatrixView<const T> m
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTBandedMatrix<T>::multiply(const ZTMatrixView<const T>& m) const {
+
+    ZT_VALIDATE(zt_structured_valid_product(order, m.get_matrix_rows(), m.get_matrix_cols()));
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    const std::size_t cols = m.get_matrix_cols();
+    ZTMatrix<T> packed(0, 0, T(0));
+    std::size_t ldb = 0;
+    const T* b = zt_structured_rows(m, packed, ldb);
+    ZTMatrix<T> result(order, cols, T(0));
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        const std::size_t first = i > lower ? i - lower : 0;
+        const std::size_t last = std::min(order - 1, i + upper);
+        for (std::size_t j = first; j <= last; ++j)
+        {
+            blas.axpy(cols, band[i * width() + j + lower - i], b + j * ldb, result[i]);
+        }
+    }
+    return result;
+
+}
+
+/**
+ * matvec : performs the banded matrix-vector product
+ *
+ * @param  ZTVectorView<const T> v
+ * @return ZTVector<T> result
+ *
+ */
+template <typename T>
+ZTVector<T> ZTBandedMatrix<T>::matvec(const ZTVectorView<const T>& v) const {
+
+    ZTVector<T> result((std::vector<T>()));
+    matvec(v, result);
+    return result;
+
+}
+
+/**
+ * matvec : performs the banded matrix-vector product into a preallocated
+ *          result, one short dot product per row
+ *
+ * @param  ZTVectorView<const T> v
+ * @param  ZTVector<T>& out result
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTBandedMatrix<T>::matvec(const ZTVectorView<const T>& v, ZTVector<T>& out) const {
+
+    ZT_VALIDATE(zt_structured_valid_vector(order, v.size()));
+    if (zt_structured_aliases(v, out))
+    {
+        out = matvec(v);
+        return;
+    }
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    std::vector<T> buffer;
+    const T* x = zt_structured_contiguous(v, buffer);
+    out.set_vector_size(order);
+    T* y = out.data();
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        const std::size_t first = i > lower ? i - lower : 0;
+        const std::size_t last = std::min(order - 1, i + upper);
+        y[i] = blas.dot(last + 1 - first, band.data() + i * width() + first + lower - i, x + first);
+    }
+
+}
+
+/**
+ * apply : performs y = A * x for the iterative solvers
+ *
+ * @param  ZTVector<T> x
+ * @param  ZTVector<T>& y result
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTBandedMatrix<T>::apply(const ZTVector<T>& x, ZTVector<T>& y) const {
+
+    matvec(x, y);
+
+}
+
+/**
+ * factor_solve : LU with partial pivoting inside the band, applied to the
+ *                right-hand sides as it goes, then back substitution. Row
+ *                swaps widen U by the lower bandwidth, so the working copy
+ *                keeps lower extra super-diagonals
+ *
+ * @param  std::size_t cols number of right-hand sides
+ * @param  T* b right-hand sides, rows ldb elements apart, overwritten by the solution
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTBandedMatrix<T>::factor_solve(std::size_t cols, T* b, std::size_t ldb) const {
+
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    const std::size_t n = order;
+    const std::size_t w = 2 * lower + upper + 1;
+    std::vector<T> lu(n * w, T(0));
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        std::copy(band.data() + i * width(), band.data() + (i + 1) * width(), lu.data() + i * w);
+    }
+    auto entry = [&](std::size_t i, std::size_t j) -> T& { return lu[i * w + j + lower - i]; };
+
+    for (std::size_t k = 0; k < n; ++k)
+    {
+        const std::size_t last_row = std::min(n - 1, k + lower);
+        const std::size_t last_col = std::min(n - 1, k + lower + upper);
+        std::size_t pivot = k;
+        for (std::size_t i = k + 1; i <= last_row; ++i)
+        {
+            if (std::abs(entry(i, k)) > std::abs(entry(pivot, k)))
+            {
+                pivot = i;
+            }
+        }
+        if (entry(pivot, k) == T(0))
+        {
+            zt_raise<std::domain_error>("Matrix is singular, the system has no unique solution!.");
+        }
+        if (pivot != k)
+        {
+            for (std::size_t j = k; j <= last_col; ++j)
+            {
+                std::swap(entry(k, j), entry(pivot, j));
+            }
+            std::swap_ranges(b + k * ldb, b + k * ldb + cols, b + pivot * ldb);
+        }
+        for (std::size_t i = k + 1; i <= last_row; ++i)
+        {
+            const T l = entry(i, k) / entry(k, k);
+            if (l == T(0))
+            {
+                continue;
+            }
+            for (std::size_t j = k + 1; j <= last_col; ++j)
+            {
+                entry(i, j) -= l * entry(k, j);
+            }
+            blas.axpy(cols, -l, b + k * ldb, b + i * ldb);
+        }
+    }
+    for (std::size_t i = n; i-- > 0;)
+    {
+        const std::size_t last_col = std::min(n - 1, i + lower + upper);
+        for (std::size_t j = i + 1; j <= last_col; ++j)
+        {
+            blas.axpy(cols, -entry(i, j), b + j * ldb, b + i * ldb);
+        }
+        blas.multiply_scalar(cols, b + i * ldb, T(1) / entry(i, i), b + i * ldb);
+    }
+
+}
+
+/**
+ * solve : solves A * x = b by banded LU with partial pivoting
+ *
+ * @param  ZTVectorView<const T> b right-hand side
+ * @return ZTVector<T> result
+ *
+ */
+template <typename T>
+ZTVector<T> ZTBandedMatrix<T>::solve(const ZTVectorView<const T>& b) const {
+
+    ZT_VALIDATE(zt_structured_valid_vector(order, b.size()));
+    ZTVector<T> result(b);
+    factor_solve(1, result.data(), 1);
+    return result;
+
+}
+
+/**
+ * solve : solves A * X = B by banded LU with partial pivoting
+ *
+ * @param  ZTMatrixView<const T> b right-hand sides
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTBandedMatrix<T>::solve(const ZTMatrixView<const T>& b) const {
+
+    ZT_VALIDATE(zt_structured_valid_product(order, b.get_matrix_rows(), b.get_matrix_cols()));
+    ZTMatrix<T> result(b);
+    factor_solve(result.get_matrix_cols(), result.data(), result.stride());
+    return result;
+
+}
+
+/**
+ * trace : sum of the diagonal
+ *
+ * @param  nothing
+ * @return T result
+ *
+ */
+template <typename T>
+T ZTBandedMatrix<T>::trace() const {
+
+    T result = 0;
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        result += band[i * width() + lower];
+    }
+    return result;
+
+}
+
+/**
+ * norm : Frobenius norm, the slots of the band outside the matrix hold zeros
+ *
+ * @param  nothing
+ * @return T result
+ *
+ */
+template <typename T>
+T ZTBandedMatrix<T>::norm() const {
+
+    return std::sqrt(ZTBlas<T>::kernels().dot(band.size(), band.data(), band.data()));
+
+}
+
+/**
+ * valid_band_index : checks that a zero-based index is inside the matrix
+ *                    and inside the band
+ *
+ * @param  std::size_t row
+ * @param  std::size_t col
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTBandedMatrix<T>::valid_band_index(std::size_t row, std::size_t col) const {
+
+    if (row >= order || col >= order || col + lower < row || col > row + upper)
+    {
+        zt_structured_invalid_index(row, col, order, "banded");
+    }
+
+}
+
+/**
+ * Constructor : Constructs an n x n triangular matrix with every entry of
+ *               the triangle set to value
+ *
+ * @param  std::size_t n order
+ * @param  ZTTriangle part ZT_LOWER or ZT_UPPER
+ * @param  T& value entries of the triangle
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTTriangularMatrix<T>::ZTTriangularMatrix(std::size_t n, ZTTriangle part, const T& value) : packed(n * (n + 1) / 2, value),
+                                                                                              order(n),
+                                                                                              triangle(part) {
+
+}
+
+/**
+ * Constructor : Constructs a triangular matrix from one triangle of a
+ *               square dense block
+ *
+ * @param  ZTMatrixView<const T> m square block
+ * @param  ZTTriangle part ZT_LOWER or ZT_UPPER
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTTriangularMatrix<T>::ZTTriangularMatrix(const ZTMatrixView<const T>& m, ZTTriangle part) : order(m.get_matrix_rows()),
+                                                                                              triangle(part) {
+
+    ZT_VALIDATE(zt_structured_valid_square(m.get_matrix_rows(), m.get_matrix_cols()));
+    packed.resize(order * (order + 1) / 2);
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        for (std::size_t j = row_begin(i); j < row_end(i); ++j)
+        {
+            packed[offset(i) + j - row_begin(i)] = m.unsafe_get(i, j);
+        }
+    }
+
+}
+
+/**
+ * row_begin : first stored column of a row
+ *
+ * @param  std::size_t row
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTTriangularMatrix<T>::row_begin(std::size_t row) const {
+
+    return triangle == ZT_LOWER ? 0 : row;
+
+}
+
+/**
+ * row_end : one past the last stored column of a row
+ *
+ * @param  std::size_t row
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTTriangularMatrix<T>::row_end(std::size_t row) const {
+
+    return triangle == ZT_LOWER ? row + 1 : order;
+
+}
+
+/**
+ * offset : position of the first stored entry of a row
+ *
+ * @param  std::size_t row
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTTriangularMatrix<T>::offset(std::size_t row) const {
+
+    return triangle == ZT_LOWER ? row * (row + 1) / 2 : row * order - row * (row - 1) / 2;
+
+}
+
+/**
+ * get_matrix_rows : gets the number of rows
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTTriangularMatrix<T>::get_matrix_rows() const {
+
+    return order;
+
+}
+
+/**
+ * get_matrix_cols : gets the number of cols
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTTriangularMatrix<T>::get_matrix_cols() const {
+
+    return order;
+
+}
+
+/**
+ * get_triangle : stored triangle
+ *
+ * @param  nothing
+ * @return ZTTriangle
+ *
+ */
+template <typename T>
+inline ZTTriangle ZTTriangularMatrix<T>::get_triangle() const {
+
+    return triangle;
+
+}
+
+/**
+ * at : entry inside the triangle by zero-based index, always checked
+ *
+ * @param  std::size_t row
+ * @param  std::size_t col
+ * @return T& element
+ *
+ */
+template <typename T>
+T& ZTTriangularMatrix<T>::at(std::size_t row, std::size_t col) {
+
+    valid_triangle_index(row, col);
+    return packed[offset(row) + col - row_begin(row)];
+
+}
+
+/**
+ * at : entry inside the triangle by zero-based index, always checked
+ *
+ * @param  std::size_t row
+ * @param  std::size_t col
+ * @return const T& element
+ *
+ */
+template <typename T>
+const T& ZTTriangularMatrix<T>::at(std::size_t row, std::size_t col) const {
+
+    valid_triangle_index(row, col);
+    return packed[offset(row) + col - row_begin(row)];
+
+}
+
+/**
+ * to_dense : expands the matrix into dense storage
+ *
+ * @param  nothing
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTTriangularMatrix<T>::to_dense() const {
+
+    ZTMatrix<T> result(order, order, T(0));
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        std::copy(packed.data() + offset(i), packed.data() + offset(i) + row_end(i) - row_begin(i), result[i] + row_begin(i));
+    }
+    return result;
+
+}
+
+/**
+ * multiply : performs triangular matrix to scalar multiplication
+ *
+ * @param  T& scalar
+ * @return ZTTriangularMatrix<T> result
+ *
+ */
+template <typename T>
+ZTTriangularMatrix<T> ZTTriangularMatrix<T>::multiply(const T& scalar) const {
+
+    ZTTriangularMatrix<T> result(*this);
+    ZTBlas<T>::kernels().multiply_scalar(packed.size(), packed.data(), scalar, result.packed.data());
+    return result;
+
+}
+
+/**
+ * add : performs triangular matrix to triangular matrix addition
+ *
+ * @param  ZTTriangularMatrix<T> m same triangle
+ * @return ZTTriangularMatrix<T> result
+ *
+ */
+template <typename T>
+ZTTriangularMatrix<T> ZTTriangularMatrix<T>::add(const ZTTriangularMatrix& m) const {
+
+    ZT_VALIDATE(valid_same_triangle(m));
+    ZTTriangularMatrix<T> result(*this);
+    ZTBlas<T>::kernels().add(packed.size(), packed.data(), m.packed.data(), result.packed.data());
+    return result;
+
+}
+
+/**
+ * minus : performs triangular matrix to triangular matrix subtraction
+ *
+ * @param  ZTTriangularMatrix<T> m same triangle
+ * @return ZTTriangularMatrix<T> result
+ *
+ */
+template <typename T>
+ZTTriangularMatrix<T> ZTTriangularMatrix<T>::minus(const ZTTriangularMatrix& m) const {
+
+    ZT_VALIDATE(valid_same_triangle(m));
+    ZTTriangularMatrix<T> result(*this);
+    ZTBlas<T>::kernels().minus(packed.size(), packed.data(), m.packed.data(), result.packed.data());
+    return result;
+
+}
+
+/**
+ * add : performs triangular matrix to dense matrix addition
+ *
+ * @param  ZTMatrixView<const T> m
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTTriangularMatrix<T>::add(const ZTMatrixView<const T>& m) const {
+
+    ZT_VALIDATE(zt_structured_valid_add_minus(order, m.get_matrix_rows(), m.get_matrix_cols()));
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    ZTMatrix<T> result(m);
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        blas.add(row_end(i) - row_begin(i), result[i] + row_begin(i), packed.data() + offset(i), result[i] + row_begin(i));
+    }
+    return result;
+
+}
+
+/**
+ * multiply : performs triangular matrix to dense matrix product, row i of
+ *            the result accumulating the stored row i times rows of m
+ *
+ * @param  ZTMatrixView<const T> m
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTTriangularMatrix<T>::multiply(const ZTMatrixView<const T>& m) const {
+
+    ZT_VALIDATE(zt_structured_valid_product(order, m.get_matrix_rows(), m.get_matrix_cols()));
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    const std::size_t cols = m.get_matrix_cols();
+    ZTMatrix<T> buffer(0, 0, T(0));
+    std::size_t ldb = 0;
+    const T* b = zt_structured_rows(m, buffer, ldb);
+    ZTMatrix<T> result(order, cols, T(0));
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        const T* a = packed.data() + offset(i) - row_begin(i);
+        for (std::size_t j = row_begin(i); j < row_end(i); ++j)
+        {
+            blas.axpy(cols, a[j], b + j * ldb, result[i]);
+        }
+    }
+    return result;
+
+}
+
+/**
+ * matvec : performs the triangular matrix-vector product
+ *
+ * @param  ZTVectorView<const T> v
+ * @return ZTVector<T> result
+ *
+ */
+template <typename T>
+ZTVector<T> ZTTriangularMatrix<T>::matvec(const ZTVectorView<const T>& v) const {
+
+    ZTVector<T> result((std::vector<T>()));
+    matvec(v, result);
+    return result;
+
+}
+
+/**
+ * matvec : performs the triangular matrix-vector product into a
+ *          preallocated result, one dot product per packed row
+ *
+ * @param  ZTVectorView<const T> v
+ * @param  ZTVector<T>& out result
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTTriangularMatrix<T>::matvec(const ZTVectorView<const T>& v, ZTVector<T>& out) const {
+
+    ZT_VALIDATE(zt_structured_valid_vector(order, v.size()));
+    if (zt_structured_aliases(v, out))
+    {
+        out = matvec(v);
+        return;
+    }
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    std::vector<T> buffer;
+    const T* x = zt_structured_contiguous(v, buffer);
+    out.set_vector_size(order);
+    T* y = out.data();
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        y[i] = blas.dot(row_end(i) - row_begin(i), packed.data() + offset(i), x + row_begin(i));
+    }
+
+}
+
+/**
+ * apply : performs y = A * x for the iterative solvers
+ *
+ * @param  ZTVector<T> x
+ * @param  ZTVector<T>& y result
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTTriangularMatrix<T>::apply(const ZTVector<T>& x, ZTVector<T>& y) const {
+
+    matvec(x, y);
+
+}
+
+/**
+ * substitute : forward substitution for a lower triangle and backward
+ *              substitution for an upper one, row operations on B
+ *
+ * @param  std::size_t cols number of right-hand sides
+ * @param  T* b right-hand sides, rows ldb elements apart, overwritten by the solution
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTTriangularMatrix<T>::substitute(std::size_t cols, T* b, std::size_t ldb) const {
+
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    for (std::size_t step = 0; step < order; ++step)
+    {
+        const std::size_t i = triangle == ZT_LOWER ? step : order - 1 - step;
+        const T* a = packed.data() + offset(i) - row_begin(i);
+        if (a[i] == T(0))
+        {
+            zt_raise<std::domain_error>("Matrix is singular, the system has no unique solution!.");
+        }
+        for (std::size_t j = row_begin(i); j < row_end(i); ++j)
+        {
+            if (j != i)
+            {
+                blas.axpy(cols, -a[j], b + j * ldb, b + i * ldb);
+            }
+        }
+        blas.multiply_scalar(cols, b + i * ldb, T(1) / a[i], b + i * ldb);
+    }
+
+}
+
+/**
+ * solve : solves A * x = b by substitution
+ *
+ * @param  ZTVectorView<const T> b right-hand side
+ * @return ZTVector<T> result
+ *
+ */
+template <typename T>
+ZTVector<T> ZTTriangularMatrix<T>::solve(const ZTVectorView<const T>& b) const {
+
+    ZT_VALIDATE(zt_structured_valid_vector(order, b.size()));
+    ZTVector<T> result(b);
+    substitute(1, result.data(), 1);
+    return result;
+
+}
+
+/**
+ * solve : solves A * X = B by substitution
+ *
+ * @param  ZTMatrixView<const T> b right-hand sides
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTTriangularMatrix<T>::solve(const ZTMatrixView<const T>& b) const {
+
+    ZT_VALIDATE(zt_structured_valid_product(order, b.get_matrix_rows(), b.get_matrix_cols()));
+    ZTMatrix<T> result(b);
+    substitute(result.get_matrix_cols(), result.data(), result.stride());
+    return result;
+
+}
+
+/**
+ * determinant : product of the diagonal
+ *
+ * @param  nothing
+ * @return T result
+ *
+ */
+template <typename T>
+T ZTTriangularMatrix<T>::determinant() const {
+
+    T result = T(1);
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        result *= packed[offset(i) + i - row_begin(i)];
+    }
+    return result;
+
+}
+
+/**
+ * trace : sum of the diagonal
+ *
+ * @param  nothing
+ * @return T result
+ *
+ */
+template <typename T>
+T ZTTriangularMatrix<T>::trace() const {
+
+    T result = 0;
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        result += packed[offset(i) + i - row_begin(i)];
+    }
+    return result;
+
+}
+
+/**
+ * norm : Frobenius norm
+ *
+ * @param  nothing
+ * @return T result
+ *
+ */
+template <typename T>
+T ZTTriangularMatrix<T>::norm() const {
+
+    return std::sqrt(ZTBlas<T>::kernels().dot(packed.size(), packed.data(), packed.data()));
+
+}
+
+/**
+ * valid_triangle_index : checks that a zero-based index is inside the
+ *                        matrix and inside the stored triangle
+ *
+ * @param  std::size_t row
+ * @param  std::size_t col
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTTriangularMatrix<T>::valid_triangle_index(std::size_t row, std::size_t col) const {
+
+    if (row >= order || col >= order || col < row_begin(row) || col >= row_end(row))
+    {
+        zt_structured_invalid_index(row, col, order, triangle == ZT_LOWER ? "lower triangular" : "upper triangular");
+    }
+
+}
+
+/**
+ * valid_same_triangle : checks that two triangular matrices have the same
+ *                       order and store the same triangle
+ *
+ * @param  ZTTriangularMatrix<T> m
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTTriangularMatrix<T>::valid_same_triangle(const ZTTriangularMatrix& m) const {
+
+    zt_structured_valid_add_minus(order, m.order, m.order);
+    if (triangle != m.triangle)
+    {
+        zt_raise<std::invalid_argument>("Lower and upper triangular matrices are not suitable for packed add or minus!.");
+    }
+
+}
+
+/**
+ * Constructor : Constructs an n x n symmetric matrix with every entry set
+ *               to value
+ *
+ * @param  std::size_t n order
+ * @param  T& value entries
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTSymmetricMatrix<T>::ZTSymmetricMatrix(std::size_t n, const T& value) : packed(n * (n + 1) / 2, value),
+                                                                          order(n) {
+
+}
+
+/**
+ * Constructor : Constructs a symmetric matrix from the lower triangle of a
+ *               square dense block
+ *
+ * @param  ZTMatrixView<const T> m square block
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTSymmetricMatrix<T>::ZTSymmetricMatrix(const ZTMatrixView<const T>& m) : order(m.get_matrix_rows()) {
+
+    ZT_VALIDATE(zt_structured_valid_square(m.get_matrix_rows(), m.get_matrix_cols()));
+    packed.resize(order * (order + 1) / 2);
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        for (std::size_t j = 0; j <= i; ++j)
+        {
+            packed[position(i, j)] = m.unsafe_get(i, j);
+        }
+    }
+
+}
+
+/**
+ * position : packed position of an entry, of its lower mirror when above
+ *            the diagonal
+ *
+ * @param  std::size_t row
+ * @param  std::size_t col
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTSymmetricMatrix<T>::position(std::size_t row, std::size_t col) const {
+
+    if (col > row)
+    {
+        std::swap(row, col);
+    }
+    return row * (row + 1) / 2 + col;
+
+}
+
+/**
+ * get_matrix_rows : gets the number of rows
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTSymmetricMatrix<T>::get_matrix_rows() const {
+
+    return order;
+
+}
+
+/**
+ * get_matrix_cols : gets the number of cols
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTSymmetricMatrix<T>::get_matrix_cols() const {
+
+    return order;
+
+}
+
+/**
+ * at : entry by zero-based index, always checked
+ *
+ * @param  std::size_t row
+ * @param  std::size_t col
+ * @return T& element, shared with (col, row)
+ *
+ */
+template <typename T>
+T& ZTSymmetricMatrix<T>::at(std::size_t row, std::size_t col) {
+
+    if (row >= order || col >= order)
+    {
+        zt_structured_invalid_index(row, col, order, "symmetric");
+    }
+    return packed[position(row, col)];
+
+}
+
+/**
+ * at : entry by zero-based index, always checked
+ *
+ * @param  std::size_t row
+ * @param  std::size_t col
+ * @return const T& element, shared with (col, row)
+ *
+ */
+template <typename T>
+const T& ZTSymmetricMatrix<T>::at(std::size_t row, std::size_t col) const {
+
+    if (row >= order || col >= order)
+    {
+        zt_structured_invalid_index(row, col, order, "symmetric");
+    }
+    return packed[position(row, col)];
+
+}
+
+/**
+ * to_dense : expands the matrix into dense storage, both triangles
+ *
+ * @param  nothing
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTSymmetricMatrix<T>::to_dense() const {
+
+    ZTMatrix<T> result(order, order, T(0));
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        for (std::size_t j = 0; j <= i; ++j)
+        {
+            result[i][j] = result[j][i] = packed[position(i, j)];
+        }
+    }
+    return result;
+
+}
+
+/**
+ * multiply : performs symmetric matrix to scalar multiplication
+ *
+ * @param  T& scalar
+ * @return ZTSymmetricMatrix<T> result
+ *
+ */
+template <typename T>
+ZTSymmetricMatrix<T> ZTSymmetricMatrix<T>::multiply(const T& scalar) const {
+
+    ZTSymmetricMatrix<T> result(*this);
+    ZTBlas<T>::kernels().multiply_scalar(packed.size(), packed.data(), scalar, result.packed.data());
+    return result;
+
+}
+
+/**
+ * add : performs symmetric matrix to symmetric matrix addition
+ *
+ * @param  ZTSymmetricMatrix<T> m
+ * @return ZTSymmetricMatrix<T> result
+ *
+ */
+template <typename T>
+ZTSymmetricMatrix<T> ZTSymmetricMatrix<T>::add(const ZTSymmetricMatrix& m) const {
+
+    ZT_VALIDATE(zt_structured_valid_add_minus(order, m.order, m.order));
+    ZTSymmetricMatrix<T> result(*this);
+    ZTBlas<T>::kernels().add(packed.size(), packed.data(), m.packed.data(), result.packed.data());
+    return result;
+
+}
+
+/**
+ * minus : performs symmetric matrix to symmetric matrix subtraction
+ *
+ * @param  ZTSymmetricMatrix<T> m
+ * @return ZTSymmetricMatrix<T> result
+ *
+ */
+template <typename T>
+ZTSymmetricMatrix<T> ZTSymmetricMatrix<T>::minus(const ZTSymmetricMatrix& m) const {
+
+    ZT_VALIDATE(zt_structured_valid_add_minus(order, m.order, m.order));
+    ZTSymmetricMatrix<T> result(*this);
+    ZTBlas<T>::kernels().minus(packed.size(), packed.data(), m.packed.data(), result.packed.data());
+    return result;
+
+}
+
+/**
+ * add : performs symmetric matrix to dense matrix addition
+ *
+ * @param  ZTMatrixView<const T> m
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTSymmetricMatrix<T>::add(const ZTMatrixView<const T>& m) const {
+
+    ZT_VALIDATE(zt_structured_valid_add_minus(order, m.get_matrix_rows(), m.get_matrix_cols()));
+    ZTMatrix<T> result(m);
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        for (std::size_t j = 0; j < order; ++j)
+        {
+            result[i][j] += packed[position(i, j)];
+        }
+    }
+    return result;
+
+}
+
+/**
+ * multiply : performs symmetric matrix to dense matrix product from the
+ *            stored half, each entry a_ij below the diagonal adding
+ *            a_ij * row j of m to row i and a_ij * row i of m to row j
+ *
+ * @param  ZTMatrixView<const T> m
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTSymmetricMatrix<T>::multiply(const ZTMatrixView<const T>& m) const {
+
+    ZT_VALIDATE(zt_structured_valid_product(order, m.get_matrix_rows(), m.get_matrix_cols()));
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    const std::size_t cols = m.get_matrix_cols();
+    ZTMatrix<T> buffer(0, 0, T(0));
+    std::size_t ldb = 0;
+    const T* b = zt_structured_rows(m, buffer, ldb);
+    ZTMatrix<T> result(order, cols, T(0));
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        const T* a = packed.data() + i * (i + 1) / 2;
+        for (std::size_t j = 0; j < i; ++j)
+        {
+            blas.axpy(cols, a[j], b + j * ldb, result[i]);
+            blas.axpy(cols, a[j], b + i * ldb, result[j]);
+        }
+        blas.axpy(cols, a[i], b + i * ldb, result[i]);
+    }
+    return result;
+
+}
+
+/**
+ * matvec : performs the symmetric matrix-vector product
+ *
+ * @param  ZTVectorView<const T> v
+ * @return ZTVector<T> result
+ *
+ */
+template <typename T>
+ZTVector<T> ZTSymmetricMatrix<T>::matvec(const ZTVectorView<const T>& v) const {
+
+    ZTVector<T> result((std::vector<T>()));
+    matvec(v, result);
+    return result;
+
+}
+
+/**
+ * matvec : performs the symmetric matrix-vector product into a preallocated
+ *          result, every packed row read once for a dot product into y_i
+ *          and an AXPY of x_i into the leading entries of y
+ *
+ * @param  ZTVectorView<const T> v
+ * @param  ZTVector<T>& out result
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTSymmetricMatrix<T>::matvec(const ZTVectorView<const T>& v, ZTVector<T>& out) const {
+
+    ZT_VALIDATE(zt_structured_valid_vector(order, v.size()));
+    if (zt_structured_aliases(v, out))
+    {
+        out = matvec(v);
+        return;
+    }
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    std::vector<T> buffer;
+    const T* x = zt_structured_contiguous(v, buffer);
+    out.set_vector_size(order);
+    T* y = out.data();
+    std::fill(y, y + order, T(0));
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        const T* a = packed.data() + i * (i + 1) / 2;
+        y[i] += blas.dot(i + 1, a, x);
+        blas.axpy(i, x[i], a, y);
+    }
+
+}
+
+/**
+ * apply : performs y = A * x for the iterative solvers
+ *
+ * @param  ZTVector<T> x
+ * @param  ZTVector<T>& y result
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTSymmetricMatrix<T>::apply(const ZTVector<T>& x, ZTVector<T>& y) const {
+
+    matvec(x, y);
+
+}
+
+/**
+ * trace : sum of the diagonal
+ *
+ * @param  nothing
+ * @return T result
+ *
+ */
+template <typename T>
+T ZTSymmetricMatrix<T>::trace() const {
+
+    T result = 0;
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        result += packed[position(i, i)];
+    }
+    return result;
+
+}
+
+/**
+ * norm : Frobenius norm, entries off the diagonal counted twice
+ *
+ * @param  nothing
+ * @return T result
+ *
+ */
+template <typename T>
+T ZTSymmetricMatrix<T>::norm() const {
+
+    T diagonal = 0;
+    for (std::size_t i = 0; i < order; ++i)
+    {
+        diagonal += packed[position(i, i)] * packed[position(i, i)];
+    }
+    const T all = ZTBlas<T>::kernels().dot(packed.size(), packed.data(), packed.data());
+    return std::sqrt(T(2) * all - diagonal);
+
+}
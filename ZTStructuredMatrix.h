@@ -0,0 +1,245 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ZTSTRUCTUREDMATRIX_H
+#define ZTSTRUCTUREDMATRIX_H
+
+#include <vector>
+#include <cstddef>
+
+#include "ZTMatrix.h"
+#include "ZTVector.h"
+#include "ZTMatrixView.h"
+#include "ZTVectorView.h"
+
+/*
+ * Square matrices with a known structure, stored without their structural
+ * zeros (or, for symmetric matrices, without their mirrored half). Products
+ * with vectors and dense matrices, solves and the arithmetic between two
+ * matrices of the same structure run on the packed storage; anything that
+ * would leave the structure (adding a dense matrix, to_dense) promotes to a
+ * ZTMatrix. Every type has apply(x, y) for the ZTKrylov solvers.
+ */
+
+enum ZTTriangle {
+    ZT_LOWER = 0,
+    ZT_UPPER = 1
+};
+
+/*
+ * ZTDiagonalMatrix : the n diagonal entries only.
+ */
+template <typename T>
+class ZTDiagonalMatrix {
+
+private:
+    std::vector<T> diagonal;
+
+public:
+    ZTDiagonalMatrix(std::size_t n, const T& value);
+    explicit ZTDiagonalMatrix(const std::vector<T>& entries);
+    explicit ZTDiagonalMatrix(const ZTMatrixView<const T>& m);  // takes the diagonal of a square block
+
+    std::size_t get_matrix_rows() const;
+    std::size_t get_matrix_cols() const;
+    T* data();
+    const T* data() const;
+
+    T& at(std::size_t row, std::size_t col);  // zero-based, checked, on the diagonal only
+    const T& at(std::size_t row, std::size_t col) const;
+
+    ZTMatrix<T> to_dense() const;
+
+    ZTDiagonalMatrix<T> multiply(const T& scalar) const;
+    ZTDiagonalMatrix<T> add(const ZTDiagonalMatrix& m) const;
+    ZTDiagonalMatrix<T> minus(const ZTDiagonalMatrix& m) const;
+    ZTDiagonalMatrix<T> multiply(const ZTDiagonalMatrix& m) const;
+    ZTMatrix<T> add(const ZTMatrixView<const T>& m) const;       // promotes to dense
+    ZTMatrix<T> multiply(const ZTMatrixView<const T>& m) const;  // scales the rows of m
+
+    ZTVector<T> matvec(const ZTVectorView<const T>& v) const;
+    void matvec(const ZTVectorView<const T>& v, ZTVector<T>& out) const;
+    void apply(const ZTVector<T>& x, ZTVector<T>& y) const;
+
+    ZTVector<T> solve(const ZTVectorView<const T>& b) const;
+    ZTMatrix<T> solve(const ZTMatrixView<const T>& b) const;
+
+    T determinant() const;
+    T trace() const;
+    T norm() const;
+
+};
+
+/*
+ * ZTBandedMatrix : entries within lower sub-diagonals and upper
+ *                  super-diagonals of the diagonal, in row-major band
+ *                  storage: row i keeps columns i - lower up to i + upper
+ *                  contiguously, so products are short dense dot products.
+ *                  Solves use LU with partial pivoting inside the band,
+ *                  which costs O(n * lower * (lower + upper)), O(n) for a
+ *                  tridiagonal matrix.
+ */
+template <typename T>
+class ZTBandedMatrix {
+
+private:
+    std::vector<T> band;  // n rows of lower + upper + 1 entries
+    std::size_t order;
+    std::size_t lower;
+    std::size_t upper;
+
+    std::size_t width() const;
+    void factor_solve(std::size_t cols, T* b, std::size_t ldb) const;
+
+public:
+    ZTBandedMatrix(std::size_t n, std::size_t lower_bandwidth, std::size_t upper_bandwidth, const T& value = T(0));
+    ZTBandedMatrix(const ZTMatrixView<const T>& m, std::size_t lower_bandwidth, std::size_t upper_bandwidth);  // drops entries outside the band
+
+    static ZTBandedMatrix<T> tridiagonal(const std::vector<T>& sub, const std::vector<T>& diagonal, const std::vector<T>& super);
+
+    std::size_t get_matrix_rows() const;
+    std::size_t get_matrix_cols() const;
+    std::size_t lower_bandwidth() const;
+    std::size_t upper_bandwidth() const;
+
+    T& at(std::size_t row, std::size_t col);  // zero-based, checked, inside the band only
+    const T& at(std::size_t row, std::size_t col) const;
+
+    ZTMatrix<T> to_dense() const;
+
+    ZTBandedMatrix<T> multiply(const T& scalar) const;
+    ZTBandedMatrix<T> add(const ZTBandedMatrix& m) const;    // band of the wider operand
+    ZTBandedMatrix<T> minus(const ZTBandedMatrix& m) const;
+    ZTMatrix<T> add(const ZTMatrixView<const T>& m) const;       // promotes to dense
+    ZTMatrix<T> multiply(const ZTMatrixView<const T>& m) const;
+
+    ZTVector<T> matvec(const ZTVectorView<const T>& v) const;
+    void matvec(const ZTVectorView<const T>& v, ZTVector<T>& out) const;
+    void apply(const ZTVector<T>& x, ZTVector<T>& y) const;
+
+    ZTVector<T> solve(const ZTVectorView<const T>& b) const;
+    ZTMatrix<T> solve(const ZTMatrixView<const T>& b) const;
+
+    T trace() const;
+    T norm() const;
+
+    void valid_band_index(std::size_t row, std::size_t col) const;
+
+};
+
+/*
+ * ZTTriangularMatrix : lower or upper triangle packed by rows, n * (n + 1) / 2
+ *                      entries. Solves are forward or backward substitution.
+ */
+template <typename T>
+class ZTTriangularMatrix {
+
+private:
+    std::vector<T> packed;
+    std::size_t order;
+    ZTTriangle triangle;
+
+    std::size_t row_begin(std::size_t row) const;  // first stored column of a row
+    std::size_t row_end(std::size_t row) const;    // one past the last stored column
+    std::size_t offset(std::size_t row) const;     // position of the row in packed
+    void substitute(std::size_t cols, T* b, std::size_t ldb) const;
+
+public:
+    ZTTriangularMatrix(std::size_t n, ZTTriangle part, const T& value = T(0));
+    ZTTriangularMatrix(const ZTMatrixView<const T>& m, ZTTriangle part);  // takes one triangle of a square block
+
+    std::size_t get_matrix_rows() const;
+    std::size_t get_matrix_cols() const;
+    ZTTriangle get_triangle() const;
+
+    T& at(std::size_t row, std::size_t col);  // zero-based, checked, inside the triangle only
+    const T& at(std::size_t row, std::size_t col) const;
+
+    ZTMatrix<T> to_dense() const;
+
+    ZTTriangularMatrix<T> multiply(const T& scalar) const;
+    ZTTriangularMatrix<T> add(const ZTTriangularMatrix& m) const;
+    ZTTriangularMatrix<T> minus(const ZTTriangularMatrix& m) const;
+    ZTMatrix<T> add(const ZTMatrixView<const T>& m) const;       // promotes to dense
+    ZTMatrix<T> multiply(const ZTMatrixView<const T>& m) const;
+
+    ZTVector<T> matvec(const ZTVectorView<const T>& v) const;
+    void matvec(const ZTVectorView<const T>& v, ZTVector<T>& out) const;
+    void apply(const ZTVector<T>& x, ZTVector<T>& y) const;
+
+    ZTVector<T> solve(const ZTVectorView<const T>& b) const;
+    ZTMatrix<T> solve(const ZTMatrixView<const T>& b) const;
+
+    T determinant() const;
+    T trace() const;
+    T norm() const;
+
+    void valid_triangle_index(std::size_t row, std::size_t col) const;
+    void valid_same_triangle(const ZTTriangularMatrix& m) const;
+
+};
+
+/*
+ * ZTSymmetricMatrix : lower triangle packed by rows, the upper one implied.
+ *                     Products read each stored entry once and use it for
+ *                     both of its mirrored positions: row i contributes a
+ *                     dot product to y_i and an AXPY x_i * row into y.
+ */
+template <typename T>
+class ZTSymmetricMatrix {
+
+private:
+    std::vector<T> packed;
+    std::size_t order;
+
+    std::size_t position(std::size_t row, std::size_t col) const;
+
+public:
+    ZTSymmetricMatrix(std::size_t n, const T& value = T(0));
+    explicit ZTSymmetricMatrix(const ZTMatrixView<const T>& m);  // takes the lower triangle of a square block
+
+    std::size_t get_matrix_rows() const;
+    std::size_t get_matrix_cols() const;
+
+    T& at(std::size_t row, std::size_t col);  // zero-based, checked, (i, j) and (j, i) are the same entry
+    const T& at(std::size_t row, std::size_t col) const;
+
+    ZTMatrix<T> to_dense() const;
+
+    ZTSymmetricMatrix<T> multiply(const T& scalar) const;
+    ZTSymmetricMatrix<T> add(const ZTSymmetricMatrix& m) const;
+    ZTSymmetricMatrix<T> minus(const ZTSymmetricMatrix& m) const;
+    ZTMatrix<T> add(const ZTMatrixView<const T>& m) const;       // promotes to dense
+    ZTMatrix<T> multiply(const ZTMatrixView<const T>& m) const;
+
+    ZTVector<T> matvec(const ZTVectorView<const T>& v) const;
+    void matvec(const ZTVectorView<const T>& v, ZTVector<T>& out) const;
+    void apply(const ZTVector<T>& x, ZTVector<T>& y) const;
+
+    T trace() const;
+    T norm() const;
+
+};
+
+#endif /* ZTSTRUCTUREDMATRIX_H */
@@ -0,0 +1,700 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cmath>
+#include <vector>
+#include <limits>
+#include <cstddef>
+#include <sstream>
+#include <utility>
+#include <stdexcept>
+#include <algorithm>
+
+#include "ZTQR.h"
+#include "ZTBlas.h"
+#include "ZTGemm.h"
+#include "ZTGemv.h"
+#include "ZTError.h"
+#include "ZTSymmetricEigen.h"
+
+/**
+ * Constructor : Constructs the eigendecomposition of a symmetric matrix
+ *
+ * @param  ZTMatrix<T> m symmetric matrix, only its lower triangle is read
+ * @param  bool compute_vectors whether to compute the eigenvectors too
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTSymmetricEigen<T>::ZTSymmetricEigen(const ZTMatrix<T>& m, bool compute_vectors) : vectors(0, 0, T(0)),
+                                                                                      order(m.get_matrix_rows()),
+                                                                                      with_vectors(compute_vectors) {
+
+    ZT_VALIDATE(m.valid_sqaure_matrix(m.get_matrix_rows(), m.get_matrix_cols()));
+    ZTMatrix<T> a(m);
+    compute(a);
+
+}
+
+/**
+ * Constructor : Constructs the eigendecomposition of a symmetric view
+ *
+ * @param  ZTMatrixView<const T> m symmetric block, only its lower triangle is read
+ * @param  bool compute_vectors whether to compute the eigenvectors too
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTSymmetricEigen<T>::ZTSymmetricEigen(const ZTMatrixView<const T>& m, bool compute_vectors) : vectors(0, 0, T(0)),
+                                                                                               order(m.get_matrix_rows()),
+                                                                                               with_vectors(compute_vectors) {
+
+    ZTMatrix<T> a(m);
+    ZT_VALIDATE(a.valid_sqaure_matrix(a.get_matrix_rows(), a.get_matrix_cols()));
+    compute(a);
+
+}
+
+/**
+ * tridiagonalize : reduces a symmetric matrix to tridiagonal form
+ *                  Q^T * A * Q by n - 2 Householder reflectors. Reflector k
+ *                  annihilates row and column k beyond the subdiagonal; its
+ *                  matrix-vector product with the trailing block is one GEMV
+ *                  and the symmetric rank-two update two AXPYs per row. The
+ *                  reflectors are stored below the subdiagonal with their
+ *                  leading one implied, as a ZTQR block starting at row 1
+ *
+ * @param  std::size_t n order of the matrix
+ * @param  T* a full symmetric matrix, rows ld elements apart, overwritten
+ * @param  T* d n diagonal entries of the result
+ * @param  T* e n - 1 off-diagonal entries of the result, e[n - 1] is set to 0
+ * @param  T* tau n - 2 scalings of the reflectors
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTSymmetricEigen<T>::tridiagonalize(std::size_t n, T* a, std::size_t ld, T* d, T* e, T* tau) {
+
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    std::vector<T> v(n), p(n);
+    for (std::size_t k = 0; k + 2 < n; ++k)
+    {
+        const std::size_t r = n - k - 1;
+        const T* x = a + k * ld + k + 1;
+        const T alpha = x[0];
+        const T sigma = blas.dot(r - 1, x + 1, x + 1);
+        d[k] = a[k * ld + k];
+        if (sigma == T(0))
+        {
+            tau[k] = T(0);
+            e[k] = alpha;
+            continue;
+        }
+
+        const T beta = -std::copysign(std::sqrt(alpha * alpha + sigma), alpha);
+        const T scale = T(1) / (alpha - beta);
+        tau[k] = (beta - alpha) / beta;
+        e[k] = beta;
+        v[0] = T(1);
+        for (std::size_t j = 1; j < r; ++j)
+        {
+            v[j] = x[j] * scale;
+            a[(k + 1 + j) * ld + k] = v[j];
+        }
+
+        // p = tau * A22 * v, w = p - (tau / 2) * (p^T * v) * v, A22 -= v * w^T + w * v^T
+        T* trailing = a + (k + 1) * ld + k + 1;
+        ZTGemv<T>::gemv(r, r, tau[k], trailing, ld, 1, v.data(), 1, T(0), p.data(), 1);
+        blas.axpy(r, -T(0.5) * tau[k] * blas.dot(r, p.data(), v.data()), v.data(), p.data());
+        for (std::size_t i = 0; i < r; ++i)
+        {
+            T* row = trailing + i * ld;
+            blas.axpy(r, -v[i], p.data(), row);
+            blas.axpy(r, -p[i], v.data(), row);
+        }
+    }
+    if (n >= 2)
+    {
+        d[n - 2] = a[(n - 2) * ld + n - 2];
+        e[n - 2] = a[(n - 2) * ld + n - 1];
+    }
+    if (n >= 1)
+    {
+        d[n - 1] = a[(n - 1) * ld + n - 1];
+        e[n - 1] = T(0);
+    }
+
+}
+
+/**
+ * ql : implicit QL iteration with Wilkinson shifts on a symmetric
+ *      tridiagonal matrix. The rotations are applied to the rows of W,
+ *      whose rows then hold the eigenvectors, unordered
+ *
+ * @param  std::size_t n order of the matrix
+ * @param  T* d n diagonal entries, overwritten by the eigenvalues
+ * @param  T* e n off-diagonal entries, e[n - 1] = 0, destroyed
+ * @param  T* w n x n rows to rotate, rows ldw elements apart, or nullptr
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTSymmetricEigen<T>::ql(std::size_t n, T* d, T* e, T* w, std::size_t ldw) {
+
+    const T eps = std::numeric_limits<T>::epsilon();
+    for (std::size_t l = 0; l < n; ++l)
+    {
+        std::size_t iterations = 0;
+        for (;;)
+        {
+            std::size_t m = l;
+            for (; m + 1 < n; ++m)
+            {
+                if (std::abs(e[m]) <= eps * (std::abs(d[m]) + std::abs(d[m + 1])))
+                {
+                    break;
+                }
+            }
+            if (m == l)
+            {
+                break;
+            }
+            if (++iterations > 60)
+            {
+                zt_raise<std::runtime_error>("Symmetric eigensolver failed to converge!.");
+            }
+
+            T g = (d[l + 1] - d[l]) / (T(2) * e[l]);
+            T r = std::hypot(g, T(1));
+            g = d[m] - d[l] + e[l] / (g + std::copysign(r, g));
+            T s = T(1), c = T(1), p = T(0);
+            bool underflow = false;
+            for (std::size_t i = m; i-- > l;)
+            {
+                const T f = s * e[i];
+                const T b = c * e[i];
+                r = std::hypot(f, g);
+                e[i + 1] = r;
+                if (r == T(0))
+                {
+                    d[i + 1] -= p;
+                    e[m] = T(0);
+                    underflow = true;
+                    break;
+                }
+                s = f / r;
+                c = g / r;
+                g = d[i + 1] - p;
+                r = (d[i] - g) * s + T(2) * c * b;
+                p = s * r;
+                d[i + 1] = g + p;
+                g = c * r - b;
+                if (w)
+                {
+                    T* upper = w + i * ldw;
+                    T* lower = w + (i + 1) * ldw;
+                    _Pragma("GCC ivdep")
+                    for (std::size_t k = 0; k < n; ++k)
+                    {
+                        const T h = lower[k];
+                        lower[k] = s * upper[k] + c * h;
+                        upper[k] = c * upper[k] - s * h;
+                    }
+                }
+            }
+            if (underflow)
+            {
+                continue;
+            }
+            d[l] -= p;
+            e[l] = g;
+            e[m] = T(0);
+        }
+    }
+
+}
+
+/**
+ * sort : orders eigenvalues ascending, moving the rows of W along
+ *
+ * @param  std::size_t n number of eigenvalues
+ * @param  T* d eigenvalues
+ * @param  T* w n x n eigenvectors by row, rows ldw elements apart
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTSymmetricEigen<T>::sort(std::size_t n, T* d, T* w, std::size_t ldw) {
+
+    for (std::size_t i = 0; i + 1 < n; ++i)
+    {
+        const std::size_t smallest = std::min_element(d + i, d + n) - d;
+        if (smallest != i)
+        {
+            std::swap(d[i], d[smallest]);
+            std::swap_ranges(w + i * ldw, w + i * ldw + n, w + smallest * ldw);
+        }
+    }
+
+}
+
+/**
+ * divide : Cuppen's divide and conquer on a symmetric tridiagonal matrix.
+ *          T is torn at its middle off-diagonal rho into two tridiagonal
+ *          halves plus rho * v * v^T, the halves are solved recursively and
+ *          merged. W, the identity on entry, is overwritten by the
+ *          eigenvectors as rows
+ *
+ * @param  std::size_t n order of the matrix
+ * @param  T* d n diagonal entries, overwritten by the ascending eigenvalues
+ * @param  T* e n off-diagonal entries, e[n - 1] = 0, destroyed
+ * @param  T* w n x n identity, rows ldw elements apart
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTSymmetricEigen<T>::divide(std::size_t n, T* d, T* e, T* w, std::size_t ldw) {
+
+    if (n <= base_size)
+    {
+        ql(n, d, e, w, ldw);
+        sort(n, d, w, ldw);
+        return;
+    }
+
+    const std::size_t n1 = n / 2;
+    const T rho = e[n1 - 1];
+    d[n1 - 1] -= rho;
+    d[n1] -= rho;
+    e[n1 - 1] = T(0);
+    divide(n1, d, e, w, ldw);
+    divide(n - n1, d + n1, e + n1, w + n1 * ldw + n1, ldw);
+    merge(n, n1, rho, d, w, ldw);
+
+}
+
+/**
+ * merge : eigendecomposition of D + rho * z * z^T, where D and the rows of
+ *         W are the solved halves and z the last and first components of
+ *         their eigenvectors. Components of z below the tolerance, and
+ *         pairs of nearly equal d resolved by a rotation, deflate with
+ *         their eigenpair unchanged. The remaining k roots come from the
+ *         secular equation, z is recomputed from them (Gu and Eisenstat) so
+ *         that the new eigenvectors are orthogonal, and those are formed as
+ *         one k x k by k x n GEMM
+ *
+ * @param  std::size_t n order of the merged matrix
+ * @param  std::size_t n1 order of the first half
+ * @param  T rho tearing off-diagonal
+ * @param  T* d n eigenvalues of the halves, overwritten by the ascending merged ones
+ * @param  T* w n x n eigenvectors of the halves as rows, block diagonal, overwritten
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTSymmetricEigen<T>::merge(std::size_t n, std::size_t n1, T rho, T* d, T* w, std::size_t ldw) {
+
+    const T eps = std::numeric_limits<T>::epsilon();
+    const T scale = T(1) / std::sqrt(T(2));
+    std::vector<T> z(n);
+    for (std::size_t j = 0; j < n; ++j)
+    {
+        z[j] = w[j * ldw + (j < n1 ? n1 - 1 : n1)] * scale;
+    }
+    rho *= T(2);
+
+    std::vector<std::size_t> index(n);
+    for (std::size_t j = 0; j < n; ++j)
+    {
+        index[j] = j;
+    }
+    std::stable_sort(index.begin(), index.end(), [d](std::size_t i, std::size_t j) { return d[i] < d[j]; });
+    std::vector<T> ds(n), zs(n);
+    T largest = std::abs(rho);
+    for (std::size_t s = 0; s < n; ++s)
+    {
+        ds[s] = d[index[s]];
+        zs[s] = z[index[s]];
+        largest = std::max(largest, T(std::abs(ds[s])));
+    }
+
+    // deflation
+    const T tolerance = T(8) * eps * largest;
+    std::vector<char> deflated(n, 0);
+    std::size_t last = n;
+    for (std::size_t s = 0; s < n; ++s)
+    {
+        if (std::abs(rho * zs[s]) <= tolerance)
+        {
+            deflated[s] = 1;
+            continue;
+        }
+        if (last != n)
+        {
+            const T t = std::hypot(zs[last], zs[s]);
+            const T c = zs[s] / t;
+            const T sn = zs[last] / t;
+            if (std::abs((ds[s] - ds[last]) * c * sn) <= tolerance)
+            {
+                T* first = w + index[last] * ldw;
+                T* second = w + index[s] * ldw;
+                _Pragma("GCC ivdep")
+                for (std::size_t k = 0; k < n; ++k)
+                {
+                    const T h = first[k];
+                    first[k] = c * h - sn * second[k];
+                    second[k] = sn * h + c * second[k];
+                }
+                const T kept = c * c * ds[last] + sn * sn * ds[s];
+                ds[s] = sn * sn * ds[last] + c * c * ds[s];
+                ds[last] = kept;
+                zs[s] = t;
+                zs[last] = T(0);
+                deflated[last] = 1;
+            }
+        }
+        last = s;
+    }
+
+    std::vector<std::size_t> rows;
+    std::vector<T> dk, zk;
+    for (std::size_t s = 0; s < n; ++s)
+    {
+        if (!deflated[s])
+        {
+            rows.push_back(index[s]);
+            dk.push_back(ds[s]);
+            zk.push_back(zs[s]);
+        }
+    }
+
+    // secular equation, roots as an origin pole and an offset from it
+    const std::size_t k = rows.size();
+    std::vector<std::size_t> origin(k);
+    std::vector<T> mu(k);
+    if (k > 0 && rho > T(0))
+    {
+        secular(k, dk.data(), zk.data(), rho, origin.data(), mu.data());
+    }
+    else if (k > 0)
+    {
+        std::vector<T> df(k), zf(k);
+        for (std::size_t j = 0; j < k; ++j)
+        {
+            df[j] = -dk[k - 1 - j];
+            zf[j] = zk[k - 1 - j];
+        }
+        secular(k, df.data(), zf.data(), -rho, origin.data(), mu.data());
+        std::reverse(origin.begin(), origin.end());
+        std::reverse(mu.begin(), mu.end());
+        for (std::size_t i = 0; i < k; ++i)
+        {
+            origin[i] = k - 1 - origin[i];
+            mu[i] = -mu[i];
+        }
+    }
+
+    // z from the computed roots, then the eigenvectors of D + rho * z * z^T
+    for (std::size_t j = 0; j < k; ++j)
+    {
+        T product = ((dk[origin[j]] - dk[j]) + mu[j]) / rho;
+        for (std::size_t i = 0; i < k; ++i)
+        {
+            if (i != j)
+            {
+                product *= ((dk[origin[i]] - dk[j]) + mu[i]) / (dk[i] - dk[j]);
+            }
+        }
+        zk[j] = std::copysign(std::sqrt(std::abs(product)), zk[j]);
+    }
+    std::vector<T> u(k * k);
+    for (std::size_t i = 0; i < k; ++i)
+    {
+        T norm = T(0);
+        for (std::size_t j = 0; j < k; ++j)
+        {
+            const T x = zk[j] / ((dk[j] - dk[origin[i]]) - mu[i]);
+            u[j * k + i] = x;
+            norm += x * x;
+        }
+        norm = T(1) / std::sqrt(norm);
+        for (std::size_t j = 0; j < k; ++j)
+        {
+            u[j * k + i] *= norm;
+        }
+    }
+    std::vector<T> gathered(k * n), merged(k * n);
+    for (std::size_t j = 0; j < k; ++j)
+    {
+        std::copy(w + rows[j] * ldw, w + rows[j] * ldw + n, gathered.data() + j * n);
+    }
+    if (k > 0)
+    {
+        ZTGemm<T>::gemm(k, n, k, T(1), u.data(), 1, k, gathered.data(), n, 1, T(0), merged.data(), n, 1);
+    }
+
+    // every eigenpair, deflated or not, in ascending order
+    std::vector<std::pair<T, const T*> > pairs;
+    pairs.reserve(n);
+    for (std::size_t s = 0; s < n; ++s)
+    {
+        if (deflated[s])
+        {
+            pairs.push_back(std::make_pair(ds[s], w + index[s] * ldw));
+        }
+    }
+    for (std::size_t i = 0; i < k; ++i)
+    {
+        pairs.push_back(std::make_pair(dk[origin[i]] + mu[i], merged.data() + i * n));
+    }
+    std::stable_sort(pairs.begin(), pairs.end(),
+                     [](const std::pair<T, const T*>& x, const std::pair<T, const T*>& y) { return x.first < y.first; });
+    std::vector<T> result(n * n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        d[i] = pairs[i].first;
+        std::copy(pairs[i].second, pairs[i].second + n, result.data() + i * n);
+    }
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        std::copy(result.data() + i * n, result.data() + (i + 1) * n, w + i * ldw);
+    }
+
+}
+
+/**
+ * secular : roots of 1 + rho * sum z_j^2 / (d_j - lambda) = 0 for rho > 0
+ *           and ascending d, one in each (d_i, d_i+1) and the last in
+ *           (d_k-1, d_k-1 + rho * ||z||^2). Each root is kept as the offset
+ *           mu from its nearest pole, so that d_j - lambda is formed without
+ *           cancellation, and found by Newton steps safeguarded by bisection
+ *
+ * @param  std::size_t k number of poles
+ * @param  T* d k poles, ascending
+ * @param  T* z k weights
+ * @param  T rho positive rank-one weight
+ * @param  std::size_t* origin k nearest poles of the roots
+ * @param  T* mu k offsets of the roots from their poles
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTSymmetricEigen<T>::secular(std::size_t k, const T* d, const T* z, T rho, std::size_t* origin, T* mu) {
+
+    const T eps = std::numeric_limits<T>::epsilon();
+    T weight = T(0);
+    for (std::size_t j = 0; j < k; ++j)
+    {
+        weight += z[j] * z[j];
+    }
+    for (std::size_t i = 0; i < k; ++i)
+    {
+        std::size_t o = i;
+        T lo = T(0), hi = rho * weight;
+        if (i + 1 < k)
+        {
+            const T middle = (d[i + 1] - d[i]) / T(2);
+            T f = T(1);
+            for (std::size_t j = 0; j < k; ++j)
+            {
+                f += rho * z[j] * z[j] / ((d[j] - d[i]) - middle);
+            }
+            if (f >= T(0))
+            {
+                hi = middle;
+            }
+            else
+            {
+                o = i + 1;
+                lo = -middle;
+                hi = T(0);
+            }
+        }
+
+        T x = (lo + hi) / T(2);
+        for (std::size_t iteration = 0; iteration < 200; ++iteration)
+        {
+            T f = T(1), df = T(0);
+            for (std::size_t j = 0; j < k; ++j)
+            {
+                const T q = T(1) / ((d[j] - d[o]) - x);
+                const T t = rho * z[j] * z[j] * q;
+                f += t;
+                df += t * q;
+            }
+            if (f == T(0))
+            {
+                break;
+            }
+            if (f < T(0))
+            {
+                lo = x;
+            }
+            else
+            {
+                hi = x;
+            }
+            T next = x - f / df;
+            if (!(next > lo && next < hi))
+            {
+                next = (lo + hi) / T(2);
+            }
+            const bool converged = std::abs(next - x) <= T(2) * eps * std::abs(next) ||
+                                   hi - lo <= T(2) * eps * std::max(std::abs(lo), std::abs(hi));
+            x = next;
+            if (converged)
+            {
+                break;
+            }
+        }
+        origin[i] = o;
+        mu[i] = x;
+    }
+
+}
+
+/**
+ * compute : reduces A to tridiagonal form and solves it, by divide and
+ *           conquer when the eigenvectors are wanted and by implicit QL
+ *           otherwise
+ *
+ * @param  ZTMatrix<T> a symmetric matrix, overwritten
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTSymmetricEigen<T>::compute(ZTMatrix<T>& a) {
+
+    const std::size_t n = order;
+    const std::size_t ld = a.stride();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        for (std::size_t j = i + 1; j < n; ++j)
+        {
+            a[i][j] = a[j][i];
+        }
+    }
+
+    std::vector<T> d(n), e(n), tau(n);
+    tridiagonalize(n, a.data(), ld, d.data(), e.data(), tau.data());
+    if (!with_vectors)
+    {
+        ql(n, d.data(), e.data(), nullptr, 0);
+        std::sort(d.begin(), d.end());
+        values.swap(d);
+        return;
+    }
+
+    ZTMatrix<T> w(n, n, T(0));
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        w[i][i] = T(1);
+    }
+    divide(n, d.data(), e.data(), w.data(), w.stride());
+    values.swap(d);
+
+    // V = Q * W^T, Q applied from the stored reflectors in compact WY form
+    vectors = ZTMatrix<T>(n, n, T(0));
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            vectors[i][j] = w[j][i];
+        }
+    }
+    if (n > 2)
+    {
+        const std::size_t bs = ZTQR<T>::block_size;
+        const std::size_t k = n - 2;
+        std::vector<T> t(k * bs);
+        for (std::size_t j0 = 0; j0 < k; j0 += bs)
+        {
+            const std::size_t width = std::min(bs, k - j0);
+            ZTQR<T>::triangle(n - 1 - j0, width, a.data() + (1 + j0) * ld + j0, ld, tau.data() + j0, t.data() + j0 * bs);
+        }
+        ZTQR<T>::apply_block(n - 1, k, a.data() + ld, ld, t.data(), false, n, vectors.data() + vectors.stride(), vectors.stride());
+    }
+
+}
+
+/**
+ * size : order of the decomposed matrix
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTSymmetricEigen<T>::size() const {
+
+    return order;
+
+}
+
+/**
+ * eigenvalues : eigenvalues in ascending order
+ *
+ * @param  nothing
+ * @return ZTVector<T> result
+ *
+ */
+template <typename T>
+ZTVector<T> ZTSymmetricEigen<T>::eigenvalues() const {
+
+    return ZTVector<T>(values);
+
+}
+
+/**
+ * eigenvectors : orthonormal eigenvectors, column i belonging to
+ *                eigenvalue i
+ *
+ * @param  nothing
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+const ZTMatrix<T>& ZTSymmetricEigen<T>::eigenvectors() const {
+
+    ZT_VALIDATE(valid_vectors());
+    return vectors;
+
+}
+
+/**
+ * valid_vectors : checks that the eigenvectors were computed
+ *
+ * @param  nothing
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTSymmetricEigen<T>::valid_vectors() const {
+
+    if (!with_vectors)
+    {
+        zt_raise<std::logic_error>("Eigenvectors were not computed for this decomposition!.");
+    }
+
+}
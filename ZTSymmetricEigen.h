@@ -0,0 +1,87 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ZTSYMMETRICEIGEN_H
+#define ZTSYMMETRICEIGEN_H
+
+#include <vector>
+#include <cstddef>
+
+#include "ZTMatrix.h"
+#include "ZTVector.h"
+#include "ZTMatrixView.h"
+
+/*
+ * ZTSymmetricEigen : eigenvalues and eigenvectors A = V * diag(w) * V^T of a
+ *                    symmetric matrix, of which only the lower triangle is
+ *                    read. Eigenvalues are in ascending order and the
+ *                    eigenvectors are the columns of V.
+ *
+ *                    A is first reduced to a tridiagonal matrix by Householder
+ *                    reflectors, whose symmetric matrix-vector products run on
+ *                    the GEMV engine. The tridiagonal problem is solved by
+ *                    Cuppen's divide and conquer: it is torn into two halves
+ *                    and a rank-one correction, the halves are solved
+ *                    recursively (by implicit QL below base_size), and their
+ *                    eigenvectors are merged through the secular equation
+ *                    with deflation and one GEMM. The reflectors are applied
+ *                    to the result in compact WY form, as in ZTQR.
+ *
+ *                    Eigenvalues alone are computed by implicit QL, which
+ *                    needs no eigenvectors.
+ */
+template <typename T>
+class ZTSymmetricEigen {
+
+private:
+    static constexpr std::size_t base_size = 32; // subproblems up to this order are solved by implicit QL
+
+    std::vector<T> values;  // ascending
+    ZTMatrix<T> vectors;    // eigenvectors by column, empty unless computed
+    std::size_t order;
+    bool with_vectors;
+
+    void compute(ZTMatrix<T>& a);
+
+    static void tridiagonalize(std::size_t n, T* a, std::size_t ld, T* d, T* e, T* tau);
+    static void ql(std::size_t n, T* d, T* e, T* w, std::size_t ldw);
+    static void sort(std::size_t n, T* d, T* w, std::size_t ldw);
+    static void divide(std::size_t n, T* d, T* e, T* w, std::size_t ldw);
+    static void merge(std::size_t n, std::size_t n1, T rho, T* d, T* w, std::size_t ldw);
+    static void secular(std::size_t k, const T* d, const T* z, T rho, std::size_t* origin, T* mu);
+
+public:
+    explicit ZTSymmetricEigen(const ZTMatrix<T>& m, bool compute_vectors = true);
+    explicit ZTSymmetricEigen(const ZTMatrixView<const T>& m, bool compute_vectors = true);
+
+    std::size_t size() const;
+
+    ZTVector<T> eigenvalues() const;          // ascending
+    const ZTMatrix<T>& eigenvectors() const;  // one column per eigenvalue
+
+    void valid_vectors() const;
+
+};
+
+#endif /* ZTSYMMETRICEIGEN_H */
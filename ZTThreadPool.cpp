@@ -0,0 +1,429 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <cstdlib>
+#include <exception>
+#include <stdexcept>
+#include <functional>
+#include <condition_variable>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "ZTThreadPool.h"
+
+/**
+ * Constructor : Constructs a pool that runs parallel work on the given number
+ *               of threads, the submitting thread being one of them
+ *
+ * @param  std::size_t threads total number of threads (at least 1)
+ * @param  bool pin pins every worker to its own CPU
+ * @return nothing
+ *
+ */
+ZTThreadPool::ZTThreadPool(std::size_t threads, bool pin) :
+                                                num_threads(threads == 0 ? 1 : threads),
+                                                pin_threads(pin),
+                                                pending(0),
+                                                stopping(false) {
+
+    start();
+
+}
+
+/**
+ * Destructor : joins the workers
+ *
+ * @param  nothing
+ * @return nothing
+ *
+ */
+ZTThreadPool::~ZTThreadPool() {
+
+    stop();
+
+}
+
+/**
+ * instance : the library-owned pool used by the parallel kernels, created on
+ *            first use and kept for the lifetime of the process
+ *
+ * @param  nothing
+ * @return ZTThreadPool& pool
+ *
+ */
+ZTThreadPool& ZTThreadPool::instance() {
+
+    static ZTThreadPool pool;
+    return pool;
+
+}
+
+/**
+ * default_num_threads : ZT_NUM_THREADS from the environment when set, the
+ *                       number of hardware threads otherwise
+ *
+ * @param  nothing
+ * @return std::size_t threads
+ *
+ */
+std::size_t ZTThreadPool::default_num_threads() {
+
+    const char* env = std::getenv("ZT_NUM_THREADS");
+    if (env != nullptr && std::atoi(env) > 0)
+    {
+        return static_cast<std::size_t>(std::atoi(env));
+    }
+    const unsigned hardware = std::thread::hardware_concurrency();
+    return hardware == 0 ? 1 : hardware;
+
+}
+
+/**
+ * inside_worker : flags the pool's own threads, a parallel_for issued from a
+ *                 task runs inline instead of waiting on its own workers
+ *
+ * @param  nothing
+ * @return bool& flag of the calling thread
+ *
+ */
+bool& ZTThreadPool::inside_worker() {
+
+    static thread_local bool flag = false;
+    return flag;
+
+}
+
+/**
+ * Getter : ZTThreadPool::num_threads getter method
+ *
+ * @param  nothing
+ * @return std::size_t num_threads
+ *
+ */
+std::size_t ZTThreadPool::get_num_threads() const {
+
+    return num_threads;
+
+}
+
+/**
+ * Setter : ZTThreadPool::num_threads setter method, restarts the workers and
+ *          must not race with a running parallel_for
+ *
+ * @param  std::size_t threads total number of threads (at least 1)
+ * @return nothing
+ *
+ */
+void ZTThreadPool::set_num_threads(std::size_t threads) {
+
+    if (threads == 0)
+    {
+        throw std::invalid_argument("thread pool needs at least one thread!.");
+    }
+    stop();
+    num_threads = threads;
+    start();
+
+}
+
+/**
+ * Getter : ZTThreadPool::pin_threads getter method
+ *
+ * @param  nothing
+ * @return bool pin_threads
+ *
+ */
+bool ZTThreadPool::get_pinning() const {
+
+    return pin_threads;
+
+}
+
+/**
+ * Setter : ZTThreadPool::pin_threads setter method, restarts the workers and
+ *          must not race with a running parallel_for
+ *
+ * @param  bool pin pins every worker to its own CPU
+ * @return nothing
+ *
+ */
+void ZTThreadPool::set_pinning(bool pin) {
+
+    stop();
+    pin_threads = pin;
+    start();
+
+}
+
+/**
+ * start : spawns num_threads - 1 workers, each with its own deque
+ *
+ * @param  nothing
+ * @return nothing
+ *
+ */
+void ZTThreadPool::start() {
+
+    stopping = false;
+    const std::size_t count = num_threads - 1;
+    for (std::size_t id = 0; id < count; ++id)
+    {
+        queues.push_back(new ZTWorkerQueue());
+    }
+    for (std::size_t id = 0; id < count; ++id)
+    {
+        workers.push_back(std::thread(&ZTThreadPool::worker_loop, this, id));
+    }
+
+}
+
+/**
+ * stop : wakes and joins every worker and releases the deques
+ *
+ * @param  nothing
+ * @return nothing
+ *
+ */
+void ZTThreadPool::stop() {
+
+    {
+        std::lock_guard<std::mutex> guard(idle_lock);
+        stopping = true;
+    }
+    idle.notify_all();
+    for (std::size_t id = 0; id < workers.size(); ++id)
+    {
+        workers[id].join();
+    }
+    for (std::size_t id = 0; id < queues.size(); ++id)
+    {
+        delete queues[id];
+    }
+    workers.clear();
+    queues.clear();
+
+}
+
+/**
+ * worker_loop : body of a worker thread, drains its own deque, steals when it
+ *               runs dry and sleeps when there is nothing left to steal
+ *
+ * @param  std::size_t id index of the worker
+ * @return nothing
+ *
+ */
+void ZTThreadPool::worker_loop(std::size_t id) {
+
+    inside_worker() = true;
+#ifdef __linux__
+    if (pin_threads)
+    {
+        const unsigned hardware = std::thread::hardware_concurrency();
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET((id + 1) % (hardware == 0 ? 1 : hardware), &cpus); // workers take cpus from 1 on, the submitting thread is not pinned
+        pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpus);
+    }
+#endif
+    ZTTask task;
+    for (;;)
+    {
+        if (pop(id, task) || steal(id, task))
+        {
+            run(task);
+            continue;
+        }
+        std::unique_lock<std::mutex> guard(idle_lock);
+        idle.wait(guard, [this] { return stopping || pending.load() > 0; });
+        if (stopping)
+        {
+            return;
+        }
+    }
+
+}
+
+/**
+ * pop : takes the most recently queued task of the given worker
+ *
+ * @param  std::size_t id index of the worker
+ * @param  ZTTask& task receives the task
+ * @return bool whether a task was taken
+ *
+ */
+bool ZTThreadPool::pop(std::size_t id, ZTTask& task) {
+
+    ZTWorkerQueue& queue = *queues[id];
+    std::lock_guard<std::mutex> guard(queue.lock);
+    if (queue.tasks.empty())
+    {
+        return false;
+    }
+    task = queue.tasks.back();
+    queue.tasks.pop_back();
+    --pending;
+    return true;
+
+}
+
+/**
+ * steal : takes the oldest task of another worker, visiting the deques in
+ *         order starting after the thief
+ *
+ * @param  std::size_t id index of the thief (queues.size() for a submitting thread)
+ * @param  ZTTask& task receives the task
+ * @return bool whether a task was stolen
+ *
+ */
+bool ZTThreadPool::steal(std::size_t id, ZTTask& task) {
+
+    const std::size_t count = queues.size();
+    for (std::size_t offset = 1; offset <= count; ++offset)
+    {
+        const std::size_t victim = (id + offset) % count;
+        if (victim == id)
+        {
+            continue;
+        }
+        ZTWorkerQueue& queue = *queues[victim];
+        std::lock_guard<std::mutex> guard(queue.lock);
+        if (!queue.tasks.empty())
+        {
+            task = queue.tasks.front();
+            queue.tasks.pop_front();
+            --pending;
+            return true;
+        }
+    }
+    return false;
+
+}
+
+/**
+ * run : executes a task and signals its job once the last task finishes. An
+ *       exception is kept in the job rather than let out of a worker, and
+ *       once a task has failed the remaining tasks of the job are counted
+ *       off without running
+ *
+ * @param  ZTTask task
+ * @return nothing
+ *
+ */
+void ZTThreadPool::run(const ZTTask& task) {
+
+    ZTJob& job = *task.job;
+    if (!job.failed.load())
+    {
+        try
+        {
+            (*job.task)(task.index);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> guard(job.error_lock);
+            if (!job.error)
+            {
+                job.error = std::current_exception();
+            }
+            job.failed = true;
+        }
+    }
+    if (--job.remaining == 0)
+    {
+        std::lock_guard<std::mutex> guard(idle_lock);
+        done.notify_all();
+    }
+
+}
+
+/**
+ * parallel_for : runs task(i) for every i in [0, count) on the pool and
+ *                returns once all of them have finished, the calling thread
+ *                takes part in the work. Small jobs, single-threaded pools and
+ *                calls made from inside a task run inline. If a task throws,
+ *                the tasks not started yet are skipped and the first
+ *                exception is rethrown once no task refers to the job.
+ *
+ * @param  std::size_t count number of tasks
+ * @param  std::function<void(std::size_t)> task body, called with the task index
+ * @return nothing
+ *
+ */
+void ZTThreadPool::parallel_for(std::size_t count, const std::function<void(std::size_t)>& task) {
+
+    if (count == 0)
+    {
+        return;
+    }
+    if (count == 1 || workers.empty() || inside_worker())
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            task(i);
+        }
+        return;
+    }
+
+    ZTJob job;
+    job.task = &task;
+    job.remaining = count;
+    job.failed = false;
+    const std::size_t worker_count = queues.size();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        ZTWorkerQueue& queue = *queues[i % worker_count];
+        std::lock_guard<std::mutex> guard(queue.lock);
+        queue.tasks.push_back(ZTTask{ &job, i });
+        ++pending;
+    }
+    {
+        std::lock_guard<std::mutex> guard(idle_lock);
+    }
+    idle.notify_all();
+
+    ZTTask stolen;
+    while (job.remaining.load() > 0)
+    {
+        if (steal(worker_count, stolen))
+        {
+            run(stolen);
+            continue;
+        }
+        std::unique_lock<std::mutex> guard(idle_lock);
+        done.wait(guard, [&job] { return job.remaining.load() == 0; });
+    }
+    if (job.error)
+    {
+        std::rethrow_exception(job.error);
+    }
+
+}
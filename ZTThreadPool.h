@@ -0,0 +1,104 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ZTTHREADPOOL_H
+#define ZTTHREADPOOL_H
+
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <exception>
+#include <functional>
+#include <condition_variable>
+
+/*
+ * ZTThreadPool : persistent pool of worker threads shared by the library's
+ *                parallel kernels. Every worker owns a deque of tasks, pops
+ *                its own work from the back and steals from the front of the
+ *                other deques once it runs dry; the thread that submits a
+ *                parallel_for works through the same deques until it is done.
+ */
+class ZTThreadPool {
+
+private:
+    struct ZTJob {
+        const std::function<void(std::size_t)>* task;
+        std::atomic<std::size_t> remaining;
+        std::atomic<bool> failed;
+        std::exception_ptr error;  // first exception thrown by a task, set under error_lock
+        std::mutex error_lock;
+    };
+
+    struct ZTTask {
+        ZTJob* job;
+        std::size_t index;
+    };
+
+    struct ZTWorkerQueue {
+        std::mutex lock;
+        std::deque<ZTTask> tasks;
+    };
+
+    std::vector<std::thread> workers;
+    std::vector<ZTWorkerQueue*> queues;  // one per worker
+    std::size_t num_threads;             // workers plus the submitting thread
+    bool pin_threads;
+
+    std::mutex idle_lock;
+    std::condition_variable idle;
+    std::condition_variable done;
+    std::atomic<std::size_t> pending;
+    bool stopping;
+
+    void start();
+    void stop();
+    void worker_loop(std::size_t id);
+    bool pop(std::size_t id, ZTTask& task);
+    bool steal(std::size_t id, ZTTask& task);
+    void run(const ZTTask& task);
+
+    static bool& inside_worker();
+    static std::size_t default_num_threads();
+
+public:
+    explicit ZTThreadPool(std::size_t threads = default_num_threads(), bool pin = false);
+    ZTThreadPool(const ZTThreadPool&) = delete;
+    ZTThreadPool& operator =(const ZTThreadPool&) = delete;
+    virtual ~ZTThreadPool();
+
+    static ZTThreadPool& instance();
+
+    std::size_t get_num_threads() const;
+    void set_num_threads(std::size_t threads);
+
+    bool get_pinning() const;
+    void set_pinning(bool pin);
+
+    void parallel_for(std::size_t count, const std::function<void(std::size_t)>& task);
+
+};
+
+#endif /* ZTTHREADPOOL_H */
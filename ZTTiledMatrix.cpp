@@ -0,0 +1,1145 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cmath>
+#include <mutex>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdio>
+#include <cstddef>
+#include <sstream>
+#include <utility>
+#include <stdexcept>
+#include <algorithm>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#define ZT_TILED_POSIX
+#endif
+
+#include "ZTBlas.h"
+#include "ZTGemm.h"
+#include "ZTError.h"
+#include "ZTTiledMatrix.h"
+
+/**
+ * zt_tiled_file_name : unique name for a scratch file in a directory
+ *
+ * @param  std::string directory
+ * @return std::string path
+ *
+ */
+inline std::string zt_tiled_file_name(const std::string& directory) {
+
+    static std::atomic<unsigned long> counter(0);
+    std::ostringstream name;
+    name << directory << (directory.empty() || directory.back() == '/' ? "" : "/") << "zt_tiles_";
+#ifdef ZT_TILED_POSIX
+    name << ::getpid() << "_";
+#endif
+    name << counter++ << ".bin";
+    return name.str();
+
+}
+
+/**
+ * Constructor : creates a zero-filled scratch file of count tiles of bytes
+ *               each and starts the prefetch thread
+ *
+ * @param  std::string directory
+ * @param  std::size_t bytes size of a tile
+ * @param  std::size_t count number of tiles
+ * @param  std::size_t tiles_cached capacity of the cache, at least one
+ *
+ */
+ZTTileCache::ZTTileCache(const std::string& directory, std::size_t bytes, std::size_t count, std::size_t tiles_cached) :
+                         file_path(zt_tiled_file_name(directory)),
+                         file_descriptor(-1),
+                         tile_bytes(bytes),
+                         tile_count(count),
+                         capacity(std::max<std::size_t>(tiles_cached, 1)),
+                         resident(0),
+                         reads(0),
+                         writes(0),
+                         stopping(false) {
+
+#ifdef ZT_TILED_POSIX
+    file_descriptor = ::open(file_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+    if (file_descriptor < 0 || ::ftruncate(file_descriptor, off_t(tile_bytes * tile_count)) != 0)
+    {
+        if (file_descriptor >= 0)
+        {
+            ::close(file_descriptor);
+            std::remove(file_path.c_str());
+        }
+        zt_raise<std::runtime_error>("File " + file_path + " cannot be created for the tiles!.");
+    }
+#else
+    file.open(file_path, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+    const std::vector<char> zeros(tile_bytes, 0);
+    for (std::size_t i = 0; i < tile_count && file; ++i)
+    {
+        file.write(zeros.data(), std::streamsize(tile_bytes));
+    }
+    if (!file)
+    {
+        zt_raise<std::runtime_error>("File " + file_path + " cannot be created for the tiles!.");
+    }
+#endif
+    prefetcher = std::thread(&ZTTileCache::prefetch_loop, this);
+
+}
+
+/**
+ * Destructor : stops the prefetch thread and removes the scratch file,
+ *              dirty tiles are dropped with it
+ *
+ */
+ZTTileCache::~ZTTileCache() {
+
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    wake.notify_all();
+    prefetcher.join();
+#ifdef ZT_TILED_POSIX
+    ::close(file_descriptor);
+#else
+    file.close();
+#endif
+    std::remove(file_path.c_str());
+
+}
+
+/**
+ * read_tile : reads a tile from the scratch file
+ *
+ * @param  std::size_t id
+ * @param  unsigned char* p destination of tile_bytes
+ * @return bool success
+ *
+ */
+bool ZTTileCache::read_tile(std::size_t id, unsigned char* p) {
+
+#ifdef ZT_TILED_POSIX
+    std::size_t done = 0;
+    while (done < tile_bytes)
+    {
+        const ssize_t got = ::pread(file_descriptor, p + done, tile_bytes - done, off_t(id * tile_bytes + done));
+        if (got <= 0)
+        {
+            return false;
+        }
+        done += std::size_t(got);
+    }
+    return true;
+#else
+    std::lock_guard<std::mutex> guard(file_lock);
+    file.seekg(std::streamoff(id * tile_bytes));
+    file.read(reinterpret_cast<char*>(p), std::streamsize(tile_bytes));
+    return bool(file);
+#endif
+
+}
+
+/**
+ * write_tile : writes a tile to the scratch file
+ *
+ * @param  std::size_t id
+ * @param  unsigned char* p source of tile_bytes
+ * @return bool success
+ *
+ */
+bool ZTTileCache::write_tile(std::size_t id, const unsigned char* p) {
+
+#ifdef ZT_TILED_POSIX
+    std::size_t done = 0;
+    while (done < tile_bytes)
+    {
+        const ssize_t put = ::pwrite(file_descriptor, p + done, tile_bytes - done, off_t(id * tile_bytes + done));
+        if (put <= 0)
+        {
+            return false;
+        }
+        done += std::size_t(put);
+    }
+    return true;
+#else
+    std::lock_guard<std::mutex> guard(file_lock);
+    file.seekp(std::streamoff(id * tile_bytes));
+    file.write(reinterpret_cast<const char*>(p), std::streamsize(tile_bytes));
+    return bool(file);
+#endif
+
+}
+
+/**
+ * make_room : evicts the least recently used unpinned tiles until the
+ *             resident tiles fit the capacity. Dirty tiles are written back
+ *             with the lock released and stay in the map meanwhile, so that
+ *             nobody reads them from disk before the write lands
+ *
+ * @param  std::unique_lock<std::mutex>& guard holding lock
+ * @return nothing
+ *
+ */
+void ZTTileCache::make_room(std::unique_lock<std::mutex>& guard) {
+
+    while (resident > capacity)
+    {
+        auto victim = recent.end();
+        for (auto it = recent.rbegin(); it != recent.rend(); ++it)
+        {
+            if (tiles[*it].pins == 0)
+            {
+                victim = std::prev(it.base());
+                break;
+            }
+        }
+        if (victim == recent.end())
+        {
+            return;  // everything is pinned, the cache grows past capacity
+        }
+        const std::size_t id = *victim;
+        ZTTile& tile = tiles[id];
+        recent.erase(victim);
+        --resident;
+        if (!tile.dirty)
+        {
+            tiles.erase(id);
+            continue;
+        }
+        tile.state = ZT_TILE_WRITING;
+        guard.unlock();
+        const bool written = write_tile(id, tile.bytes.data());
+        guard.lock();
+        if (!written)
+        {
+            tile.state = ZT_TILE_READY;  // kept dirty, flush() reports the failure
+            tile.position = recent.insert(recent.end(), id);
+            ++resident;
+            changed.notify_all();
+            return;
+        }
+        ++writes;
+        tiles.erase(id);
+        changed.notify_all();
+    }
+
+}
+
+/**
+ * fetch : makes a tile resident, waiting for a load or a write back of the
+ *         same tile in progress elsewhere, and marks it most recently used
+ *
+ * @param  std::size_t id
+ * @param  bool overwrite skip reading, the tile starts as zeros
+ * @param  std::unique_lock<std::mutex>& guard holding lock
+ * @return ZTTile* the tile, nullptr when it could not be read
+ *
+ */
+ZTTileCache::ZTTile* ZTTileCache::fetch(std::size_t id, bool overwrite, std::unique_lock<std::mutex>& guard) {
+
+    for (;;)
+    {
+        auto it = tiles.find(id);
+        if (it == tiles.end())
+        {
+            break;
+        }
+        if (it->second.state == ZT_TILE_READY)
+        {
+            recent.splice(recent.begin(), recent, it->second.position);
+            return &it->second;
+        }
+        changed.wait(guard);
+    }
+    ZTTile& tile = tiles[id];
+    tile.state = ZT_TILE_LOADING;
+    tile.dirty = false;
+    tile.pins = 1;  // held until the load lands so make_room leaves it alone
+    ++resident;
+    make_room(guard);
+    guard.unlock();
+    tile.bytes.resize(tile_bytes);
+    bool loaded = true;
+    if (overwrite)
+    {
+        std::fill(tile.bytes.begin(), tile.bytes.end(), 0);
+    }
+    else
+    {
+        loaded = read_tile(id, tile.bytes.data());
+    }
+    guard.lock();
+    --tile.pins;
+    if (!loaded)
+    {
+        --resident;
+        tiles.erase(id);
+        changed.notify_all();
+        return nullptr;
+    }
+    reads += overwrite ? 0 : 1;
+    tile.state = ZT_TILE_READY;
+    tile.position = recent.insert(recent.begin(), id);
+    changed.notify_all();
+    return &tile;
+
+}
+
+/**
+ * prefetch_loop : body of the prefetch thread, loads queued tiles that are
+ *                 not resident yet
+ *
+ * @param  nothing
+ * @return nothing
+ *
+ */
+void ZTTileCache::prefetch_loop() {
+
+    std::unique_lock<std::mutex> guard(lock);
+    for (;;)
+    {
+        wake.wait(guard, [this] { return stopping || !queue.empty(); });
+        if (stopping)
+        {
+            return;
+        }
+        const std::size_t id = queue.front();
+        queue.pop_front();
+        if (tiles.find(id) == tiles.end())
+        {
+            fetch(id, false, guard);
+        }
+    }
+
+}
+
+/**
+ * pin : makes a tile resident and keeps it so until unpin
+ *
+ * @param  std::size_t id
+ * @param  bool dirty the caller will modify the tile
+ * @param  bool overwrite the caller will replace every byte, skip reading
+ * @return unsigned char* tile_bytes of the tile
+ *
+ */
+unsigned char* ZTTileCache::pin(std::size_t id, bool dirty, bool overwrite) {
+
+    std::unique_lock<std::mutex> guard(lock);
+    ZTTile* tile = fetch(id, overwrite, guard);
+    if (tile == nullptr)
+    {
+        zt_raise<std::runtime_error>("File " + file_path + " tile " + std::to_string(id) + " cannot be read!.");
+    }
+    ++tile->pins;
+    tile->dirty = tile->dirty || dirty || overwrite;
+    return tile->bytes.data();
+
+}
+
+/**
+ * unpin : lets a pinned tile be evicted again
+ *
+ * @param  std::size_t id
+ * @return nothing
+ *
+ */
+void ZTTileCache::unpin(std::size_t id) {
+
+    std::unique_lock<std::mutex> guard(lock);
+    --tiles[id].pins;
+    make_room(guard);
+
+}
+
+/**
+ * prefetch : queues a tile for the prefetch thread
+ *
+ * @param  std::size_t id
+ * @return nothing
+ *
+ */
+void ZTTileCache::prefetch(std::size_t id) {
+
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        if (tiles.find(id) != tiles.end())
+        {
+            return;
+        }
+        queue.push_back(id);
+        if (queue.size() > capacity)
+        {
+            queue.pop_front();  // stale requests, the caller has moved on
+        }
+    }
+    wake.notify_one();
+
+}
+
+/**
+ * flush : writes every dirty resident tile back to the scratch file
+ *
+ * @param  nothing
+ * @return nothing
+ *
+ */
+void ZTTileCache::flush() {
+
+    std::unique_lock<std::mutex> guard(lock);
+    for (auto& entry : tiles)
+    {
+        ZTTile& tile = entry.second;
+        if (tile.state != ZT_TILE_READY || !tile.dirty)
+        {
+            continue;
+        }
+        if (!write_tile(entry.first, tile.bytes.data()))
+        {
+            zt_raise<std::runtime_error>("File " + file_path + " tile " + std::to_string(entry.first) + " cannot be written!.");
+        }
+        tile.dirty = false;
+        ++writes;
+    }
+
+}
+
+/**
+ * get_capacity : gets the number of tiles the cache holds
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+std::size_t ZTTileCache::get_capacity() const {
+
+    return capacity;
+
+}
+
+/**
+ * tile_reads : gets the number of tiles read from the scratch file
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+std::size_t ZTTileCache::tile_reads() {
+
+    std::lock_guard<std::mutex> guard(lock);
+    return reads;
+
+}
+
+/**
+ * tile_writes : gets the number of tiles written to the scratch file
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+std::size_t ZTTileCache::tile_writes() {
+
+    std::lock_guard<std::mutex> guard(lock);
+    return writes;
+
+}
+
+/**
+ * Constructor : rows x cols zeros in a scratch file under directory
+ *
+ * @param  std::size_t rows
+ * @param  std::size_t cols
+ * @param  std::string directory
+ * @param  std::size_t tile elements per side of a tile
+ * @param  std::size_t tiles_cached tiles resident at once
+ *
+ */
+template <typename T>
+ZTTiledMatrix<T>::ZTTiledMatrix(std::size_t rows, std::size_t cols, const std::string& directory,
+                                std::size_t tile, std::size_t tiles_cached) :
+                                tile_directory(directory),
+                                matrix_rows(rows),
+                                matrix_cols(cols),
+                                tile_size(std::max<std::size_t>(tile, 1)),
+                                grid_rows((rows + tile_size - 1) / tile_size),
+                                grid_cols((cols + tile_size - 1) / tile_size) {
+
+    cache.reset(new ZTTileCache(directory, tile_size * tile_size * sizeof(T), grid_rows * grid_cols, tiles_cached));
+
+}
+
+/**
+ * Constructor : copies a dense block into a scratch file under directory
+ *
+ * @param  ZTMatrixView<const T> m
+ * @param  std::string directory
+ * @param  std::size_t tile elements per side of a tile
+ * @param  std::size_t tiles_cached tiles resident at once
+ *
+ */
+template <typename T>
+ZTTiledMatrix<T>::ZTTiledMatrix(const ZTMatrixView<const T>& m, const std::string& directory,
+                                std::size_t tile, std::size_t tiles_cached) :
+                                ZTTiledMatrix(m.get_matrix_rows(), m.get_matrix_cols(), directory, tile, tiles_cached) {
+
+    write_block(0, 0, m);
+
+}
+
+/**
+ * tile_rows : rows of the tiles in tile row bi that lie inside the matrix
+ *
+ * @param  std::size_t bi
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTTiledMatrix<T>::tile_rows(std::size_t bi) const {
+
+    return std::min(tile_size, matrix_rows - bi * tile_size);
+
+}
+
+/**
+ * tile_cols : cols of the tiles in tile col bj that lie inside the matrix
+ *
+ * @param  std::size_t bj
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTTiledMatrix<T>::tile_cols(std::size_t bj) const {
+
+    return std::min(tile_size, matrix_cols - bj * tile_size);
+
+}
+
+/**
+ * pin : makes tile (bi, bj) resident until unpin
+ *
+ * @param  std::size_t bi
+ * @param  std::size_t bj
+ * @param  bool dirty the caller will modify the tile
+ * @param  bool overwrite the caller will replace the tile, skip reading
+ * @return T* tile x tile elements, row-major
+ *
+ */
+template <typename T>
+inline T* ZTTiledMatrix<T>::pin(std::size_t bi, std::size_t bj, bool dirty, bool overwrite) const {
+
+    return reinterpret_cast<T*>(cache->pin(bi * grid_cols + bj, dirty, overwrite));
+
+}
+
+/**
+ * unpin : releases tile (bi, bj)
+ *
+ * @param  std::size_t bi
+ * @param  std::size_t bj
+ * @return nothing
+ *
+ */
+template <typename T>
+inline void ZTTiledMatrix<T>::unpin(std::size_t bi, std::size_t bj) const {
+
+    cache->unpin(bi * grid_cols + bj);
+
+}
+
+/**
+ * prefetch : starts loading tile (bi, bj) in the background
+ *
+ * @param  std::size_t bi
+ * @param  std::size_t bj
+ * @return nothing
+ *
+ */
+template <typename T>
+inline void ZTTiledMatrix<T>::prefetch(std::size_t bi, std::size_t bj) const {
+
+    cache->prefetch(bi * grid_cols + bj);
+
+}
+
+/**
+ * map : element-wise operation into a new tiled matrix, tile by tile with
+ *       the next tiles prefetched. f(n, x, y, z) computes a row of n
+ *       elements of z from the rows x of this matrix and y of m
+ *
+ * @param  ZTTiledMatrix<T>* m second operand, or nullptr
+ * @param  F f row operation
+ * @return ZTTiledMatrix<T> result
+ *
+ */
+template <typename T>
+template <typename F>
+ZTTiledMatrix<T> ZTTiledMatrix<T>::map(const ZTTiledMatrix* m, F f) const {
+
+    ZTTiledMatrix<T> result(matrix_rows, matrix_cols, tile_directory, tile_size, cache->get_capacity());
+    for (std::size_t bi = 0; bi < grid_rows; ++bi)
+    {
+        for (std::size_t bj = 0; bj < grid_cols; ++bj)
+        {
+            const std::size_t next = bi * grid_cols + bj + 1;
+            if (next < grid_rows * grid_cols)
+            {
+                prefetch(next / grid_cols, next % grid_cols);
+                if (m != nullptr)
+                {
+                    m->prefetch(next / grid_cols, next % grid_cols);
+                }
+            }
+            const T* x = pin(bi, bj, false);
+            const T* y = m != nullptr ? m->pin(bi, bj, false) : nullptr;
+            T* z = result.pin(bi, bj, true, true);
+            for (std::size_t r = 0, rows = tile_rows(bi); r < rows; ++r)
+            {
+                f(tile_cols(bj), x + r * tile_size, y != nullptr ? y + r * tile_size : nullptr, z + r * tile_size);
+            }
+            result.unpin(bi, bj);
+            if (m != nullptr)
+            {
+                m->unpin(bi, bj);
+            }
+            unpin(bi, bj);
+        }
+    }
+    return result;
+
+}
+
+/**
+ * get_matrix_rows : gets the number of rows
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTTiledMatrix<T>::get_matrix_rows() const {
+
+    return matrix_rows;
+
+}
+
+/**
+ * get_matrix_cols : gets the number of columns
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTTiledMatrix<T>::get_matrix_cols() const {
+
+    return matrix_cols;
+
+}
+
+/**
+ * get_tile_size : gets the number of elements per side of a tile
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTTiledMatrix<T>::get_tile_size() const {
+
+    return tile_size;
+
+}
+
+/**
+ * get_cache_tiles : gets the number of tiles resident at once
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTTiledMatrix<T>::get_cache_tiles() const {
+
+    return cache->get_capacity();
+
+}
+
+/**
+ * tile_reads : gets the number of tiles read from disk so far
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTTiledMatrix<T>::tile_reads() const {
+
+    return cache->tile_reads();
+
+}
+
+/**
+ * tile_writes : gets the number of tiles written to disk so far
+ *
+ * @param  nothing
+ * @return std::size_t
+ *
+ */
+template <typename T>
+inline std::size_t ZTTiledMatrix<T>::tile_writes() const {
+
+    return cache->tile_writes();
+
+}
+
+/**
+ * at : element at a zero-based index
+ *
+ * @param  std::size_t row
+ * @param  std::size_t col
+ * @return T result
+ *
+ */
+template <typename T>
+T ZTTiledMatrix<T>::at(std::size_t row, std::size_t col) const {
+
+    valid_block(row, col, 1, 1);
+    const std::size_t bi = row / tile_size, bj = col / tile_size;
+    const T value = pin(bi, bj, false)[(row % tile_size) * tile_size + col % tile_size];
+    unpin(bi, bj);
+    return value;
+
+}
+
+/**
+ * set : sets the element at a zero-based index
+ *
+ * @param  std::size_t row
+ * @param  std::size_t col
+ * @param  T value
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTTiledMatrix<T>::set(std::size_t row, std::size_t col, const T& value) {
+
+    valid_block(row, col, 1, 1);
+    const std::size_t bi = row / tile_size, bj = col / tile_size;
+    pin(bi, bj, true)[(row % tile_size) * tile_size + col % tile_size] = value;
+    unpin(bi, bj);
+
+}
+
+/**
+ * read_block : copies a rows x cols block starting at (row, col) into a
+ *              dense matrix
+ *
+ * @param  std::size_t row
+ * @param  std::size_t col
+ * @param  std::size_t rows
+ * @param  std::size_t cols
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTTiledMatrix<T>::read_block(std::size_t row, std::size_t col, std::size_t rows, std::size_t cols) const {
+
+    ZT_VALIDATE(valid_block(row, col, rows, cols));
+    ZTMatrix<T> result(rows, cols, T(0));
+    if (rows == 0 || cols == 0)
+    {
+        return result;
+    }
+    for (std::size_t bi = row / tile_size; bi <= (row + rows - 1) / tile_size; ++bi)
+    {
+        for (std::size_t bj = col / tile_size; bj <= (col + cols - 1) / tile_size; ++bj)
+        {
+            const std::size_t r0 = std::max(row, bi * tile_size), r1 = std::min(row + rows, (bi + 1) * tile_size);
+            const std::size_t c0 = std::max(col, bj * tile_size), c1 = std::min(col + cols, (bj + 1) * tile_size);
+            const T* a = pin(bi, bj, false);
+            for (std::size_t r = r0; r < r1; ++r)
+            {
+                const T* src = a + (r - bi * tile_size) * tile_size + (c0 - bj * tile_size);
+                std::copy(src, src + (c1 - c0), result.data() + (r - row) * result.stride() + (c0 - col));
+            }
+            unpin(bi, bj);
+        }
+    }
+    return result;
+
+}
+
+/**
+ * write_block : copies a dense block into the matrix at (row, col)
+ *
+ * @param  std::size_t row
+ * @param  std::size_t col
+ * @param  ZTMatrixView<const T> m
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTTiledMatrix<T>::write_block(std::size_t row, std::size_t col, const ZTMatrixView<const T>& m) {
+
+    const std::size_t rows = m.get_matrix_rows(), cols = m.get_matrix_cols();
+    ZT_VALIDATE(valid_block(row, col, rows, cols));
+    if (rows == 0 || cols == 0)
+    {
+        return;
+    }
+    for (std::size_t bi = row / tile_size; bi <= (row + rows - 1) / tile_size; ++bi)
+    {
+        for (std::size_t bj = col / tile_size; bj <= (col + cols - 1) / tile_size; ++bj)
+        {
+            const std::size_t r0 = std::max(row, bi * tile_size), r1 = std::min(row + rows, (bi + 1) * tile_size);
+            const std::size_t c0 = std::max(col, bj * tile_size), c1 = std::min(col + cols, (bj + 1) * tile_size);
+            const bool whole = r0 == bi * tile_size && r1 == bi * tile_size + tile_rows(bi) &&
+                               c0 == bj * tile_size && c1 == bj * tile_size + tile_cols(bj);
+            T* a = pin(bi, bj, true, whole);
+            for (std::size_t r = r0; r < r1; ++r)
+            {
+                T* dst = a + (r - bi * tile_size) * tile_size - bj * tile_size;
+                for (std::size_t c = c0; c < c1; ++c)
+                {
+                    dst[c] = m.unsafe_get(r - row, c - col);
+                }
+            }
+            unpin(bi, bj);
+        }
+    }
+
+}
+
+/**
+ * to_matrix : copies the whole matrix into a dense matrix
+ *
+ * @param  nothing
+ * @return ZTMatrix<T> result
+ *
+ */
+template <typename T>
+ZTMatrix<T> ZTTiledMatrix<T>::to_matrix() const {
+
+    return read_block(0, 0, matrix_rows, matrix_cols);
+
+}
+
+/**
+ * add : performs tiled matrix to scalar addition
+ *
+ * @param  T scalar
+ * @return ZTTiledMatrix<T> result
+ *
+ */
+template <typename T>
+ZTTiledMatrix<T> ZTTiledMatrix<T>::add(const T& scalar) const {
+
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    return map(nullptr, [&](std::size_t n, const T* x, const T*, T* z) { blas.add_scalar(n, x, scalar, z); });
+
+}
+
+/**
+ * minus : performs tiled matrix to scalar subtraction
+ *
+ * @param  T scalar
+ * @return ZTTiledMatrix<T> result
+ *
+ */
+template <typename T>
+ZTTiledMatrix<T> ZTTiledMatrix<T>::minus(const T& scalar) const {
+
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    const T negated = -scalar;
+    return map(nullptr, [&](std::size_t n, const T* x, const T*, T* z) { blas.add_scalar(n, x, negated, z); });
+
+}
+
+/**
+ * multiply : performs tiled matrix to scalar multiplication
+ *
+ * @param  T scalar
+ * @return ZTTiledMatrix<T> result
+ *
+ */
+template <typename T>
+ZTTiledMatrix<T> ZTTiledMatrix<T>::multiply(const T& scalar) const {
+
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    return map(nullptr, [&](std::size_t n, const T* x, const T*, T* z) { blas.multiply_scalar(n, x, scalar, z); });
+
+}
+
+/**
+ * add : performs tiled matrix to tiled matrix addition
+ *
+ * @param  ZTTiledMatrix<T> m
+ * @return ZTTiledMatrix<T> result
+ *
+ */
+template <typename T>
+ZTTiledMatrix<T> ZTTiledMatrix<T>::add(const ZTTiledMatrix& m) const {
+
+    ZT_VALIDATE(valid_matrix_add_minus(m));
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    return map(&m, [&](std::size_t n, const T* x, const T* y, T* z) { blas.add(n, x, y, z); });
+
+}
+
+/**
+ * minus : performs tiled matrix to tiled matrix subtraction
+ *
+ * @param  ZTTiledMatrix<T> m
+ * @return ZTTiledMatrix<T> result
+ *
+ */
+template <typename T>
+ZTTiledMatrix<T> ZTTiledMatrix<T>::minus(const ZTTiledMatrix& m) const {
+
+    ZT_VALIDATE(valid_matrix_add_minus(m));
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    return map(&m, [&](std::size_t n, const T* x, const T* y, T* z) { blas.minus(n, x, y, z); });
+
+}
+
+/**
+ * multiply : performs tiled GEMM, C = A * B, over the tile products in snake
+ *            order with the next products prefetched
+ *
+ * @param  ZTTiledMatrix<T> m
+ * @return ZTTiledMatrix<T> result
+ *
+ */
+template <typename T>
+ZTTiledMatrix<T> ZTTiledMatrix<T>::multiply(const ZTTiledMatrix& m) const {
+
+    ZT_VALIDATE(valid_matrix_product(m));
+    ZTTiledMatrix<T> result(matrix_rows, m.matrix_cols, tile_directory, tile_size, cache->get_capacity());
+    const std::size_t mt = grid_rows, nt = m.grid_cols, kt = grid_cols;
+    struct ZTTileProduct {
+        std::size_t i, j, p;
+    };
+    std::vector<ZTTileProduct> order;
+    order.reserve(mt * nt * kt);
+    for (std::size_t i = 0; i < mt; ++i)
+    {
+        for (std::size_t jj = 0; jj < nt; ++jj)
+        {
+            const std::size_t j = i % 2 == 0 ? jj : nt - 1 - jj;
+            const bool forward = (i * nt + jj) % 2 == 0;
+            for (std::size_t pp = 0; pp < kt; ++pp)
+            {
+                order.push_back({ i, j, forward ? pp : kt - 1 - pp });
+            }
+        }
+    }
+    const std::size_t lookahead = 2;  // tile products prefetched ahead of the one computed
+    for (std::size_t s = 0; s < order.size(); ++s)
+    {
+        for (std::size_t ahead = s + 1; ahead <= s + lookahead && ahead < order.size(); ++ahead)
+        {
+            prefetch(order[ahead].i, order[ahead].p);
+            m.prefetch(order[ahead].p, order[ahead].j);
+        }
+        const ZTTileProduct& t = order[s];
+        const bool first = s % kt == 0;
+        T* c = first ? result.pin(t.i, t.j, true, true) : result.pin(t.i, t.j, true);
+        const T* a = pin(t.i, t.p, false);
+        const T* b = m.pin(t.p, t.j, false);
+        ZTGemm<T>::gemm(tile_rows(t.i), m.tile_cols(t.j), tile_cols(t.p), T(1),
+                        a, tile_size, 1, b, tile_size, 1, first ? T(0) : T(1), c, tile_size, 1);
+        m.unpin(t.p, t.j);
+        unpin(t.i, t.p);
+        result.unpin(t.i, t.j);
+    }
+    return result;
+
+}
+
+/**
+ * trace : sum of the diagonal, over the diagonal tiles
+ *
+ * @param  nothing
+ * @return T result
+ *
+ */
+template <typename T>
+T ZTTiledMatrix<T>::trace() const {
+
+    ZT_VALIDATE(valid_sqaure_matrix());
+    typename ZTAccumulator<T>::type sum = 0;
+    for (std::size_t b = 0; b < grid_rows; ++b)
+    {
+        if (b + 1 < grid_rows)
+        {
+            prefetch(b + 1, b + 1);
+        }
+        const T* a = pin(b, b, false);
+        for (std::size_t d = 0, n = tile_rows(b); d < n; ++d)
+        {
+            sum += typename ZTAccumulator<T>::type(a[d * tile_size + d]);
+        }
+        unpin(b, b);
+    }
+    return T(sum);
+
+}
+
+/**
+ * norm : Frobenius norm, tile by tile with the next tile prefetched
+ *
+ * @param  nothing
+ * @return T result
+ *
+ */
+template <typename T>
+T ZTTiledMatrix<T>::norm() const {
+
+    const ZTBlasKernels<T>& blas = ZTBlas<T>::kernels();
+    typename ZTAccumulator<T>::type sum = 0;
+    for (std::size_t id = 0; id < grid_rows * grid_cols; ++id)
+    {
+        const std::size_t bi = id / grid_cols, bj = id % grid_cols;
+        if (id + 1 < grid_rows * grid_cols)
+        {
+            prefetch((id + 1) / grid_cols, (id + 1) % grid_cols);
+        }
+        const T* a = pin(bi, bj, false);
+        for (std::size_t r = 0, rows = tile_rows(bi); r < rows; ++r)
+        {
+            sum += blas.dot(tile_cols(bj), a + r * tile_size, a + r * tile_size);
+        }
+        unpin(bi, bj);
+    }
+    return T(std::sqrt(sum));
+
+}
+
+/**
+ * valid_same_tiling : checks that two tiled matrices share a tile size
+ *
+ * @param  ZTTiledMatrix<T> m
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTTiledMatrix<T>::valid_same_tiling(const ZTTiledMatrix& m) const {
+
+    if (tile_size != m.tile_size)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Tiled matrices of tile sizes: " << tile_size << " and " << m.tile_size << " do not share a tiling!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * valid_matrix_add_minus : checks for dimensions valid matrix addition or subtraction
+ *
+ * @param  ZTTiledMatrix<T> m
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTTiledMatrix<T>::valid_matrix_add_minus(const ZTTiledMatrix& m) const {
+
+    if (matrix_rows != m.matrix_rows || matrix_cols != m.matrix_cols)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Matrices of dimensions: " << matrix_rows << "x" << matrix_cols << " and " << m.matrix_rows << "x" << m.matrix_cols << " are not suitable for addition or subtraction!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+    valid_same_tiling(m);
+
+}
+
+/**
+ * valid_matrix_product : checks for dimensions valid matrix product
+ *
+ * @param  ZTTiledMatrix<T> m
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTTiledMatrix<T>::valid_matrix_product(const ZTTiledMatrix& m) const {
+
+    if (matrix_cols != m.matrix_rows)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Matrices of dimensions: " << matrix_rows << "x" << matrix_cols << " and " << m.matrix_rows << "x" << m.matrix_cols << " are not suitable for matrix product!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+    valid_same_tiling(m);
+
+}
+
+/**
+ * valid_sqaure_matrix : checks for valid sqaure matrix dimensions
+ *
+ * @param  nothing
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTTiledMatrix<T>::valid_sqaure_matrix() const {
+
+    if (matrix_cols != matrix_rows)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Matrices of dimensions: " << matrix_rows << "x" << matrix_cols << " is not a sqaure matrix!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * valid_block : checks that a rows x cols block at (row, col) lies inside
+ *               the matrix
+ *
+ * @param  std::size_t row
+ * @param  std::size_t col
+ * @param  std::size_t rows
+ * @param  std::size_t cols
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTTiledMatrix<T>::valid_block(std::size_t row, std::size_t col, std::size_t rows, std::size_t cols) const {
+
+    if (row > matrix_rows || col > matrix_cols || rows > matrix_rows - row || cols > matrix_cols - col)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "Block " << rows << "x" << cols << " at (" << row << ", " << col << ") out of range for a " << matrix_rows << "x" << matrix_cols << " matrix!.";
+        zt_raise<std::out_of_range>(invalid_dimensions.str());
+    }
+
+}
@@ -0,0 +1,201 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ZTTILEDMATRIX_H
+#define ZTTILEDMATRIX_H
+
+#include <list>
+#include <deque>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <fstream>
+#include <unordered_map>
+#include <condition_variable>
+
+#include "ZTAlignedAllocator.h"
+#include "ZTMatrix.h"
+#include "ZTMatrixView.h"
+
+/*
+ * ZTTileCache : fixed-size tiles of bytes in a scratch file, with at most
+ *               capacity of them resident in an LRU cache. pin() returns a
+ *               tile that stays resident until unpin(); tiles pinned dirty
+ *               are written back when they are evicted. A tile that is
+ *               pinned for overwrite is not read first.
+ *
+ *               prefetch() queues a tile for a background I/O thread, which
+ *               loads it into the cache while the caller computes on other
+ *               tiles. Evictions write back outside the lock, and a tile
+ *               that is still loading or being written back makes pin()
+ *               wait for it rather than read stale data. The scratch file
+ *               starts as zeros and is removed with the cache.
+ */
+class ZTTileCache {
+
+private:
+    enum ZTTileState {
+        ZT_TILE_LOADING = 0,
+        ZT_TILE_READY = 1,
+        ZT_TILE_WRITING = 2
+    };
+
+    struct ZTTile {
+        std::vector<unsigned char, ZTAlignedAllocator<unsigned char> > bytes;
+        ZTTileState state;
+        bool dirty;
+        std::size_t pins;
+        std::list<std::size_t>::iterator position;  // in recent, when ready
+    };
+
+    std::string file_path;
+    int file_descriptor;
+    std::fstream file;     // used when positional I/O is unavailable
+    std::mutex file_lock;  // guards file
+    std::size_t tile_bytes;
+    std::size_t tile_count;
+    std::size_t capacity;
+
+    std::unordered_map<std::size_t, ZTTile> tiles;
+    std::list<std::size_t> recent;  // ready tiles, most recently used first
+    std::size_t resident;           // tiles loading or ready
+    std::size_t reads;
+    std::size_t writes;
+    std::mutex lock;
+    std::condition_variable changed;
+
+    std::deque<std::size_t> queue;
+    std::condition_variable wake;
+    std::thread prefetcher;
+    bool stopping;
+
+    bool read_tile(std::size_t id, unsigned char* p);
+    bool write_tile(std::size_t id, const unsigned char* p);
+    ZTTile* fetch(std::size_t id, bool overwrite, std::unique_lock<std::mutex>& guard);
+    void make_room(std::unique_lock<std::mutex>& guard);
+    void prefetch_loop();
+
+public:
+    ZTTileCache(const std::string& directory, std::size_t bytes, std::size_t count, std::size_t tiles_cached);
+    ZTTileCache(const ZTTileCache& cp) = delete;
+    ZTTileCache& operator =(const ZTTileCache& rhs) = delete;
+    ~ZTTileCache();
+
+    unsigned char* pin(std::size_t id, bool dirty, bool overwrite = false);
+    void unpin(std::size_t id);
+    void prefetch(std::size_t id);
+    void flush();
+
+    std::size_t get_capacity() const;
+    std::size_t tile_reads();
+    std::size_t tile_writes();
+
+};
+
+/*
+ * ZTTiledMatrix : out-of-core matrix stored as square tiles in a scratch
+ *                 file under a local directory, of which only the tiles in
+ *                 the LRU cache are in memory. Every tile is tile x tile
+ *                 elements, row-major, with the edge tiles padded.
+ *
+ *                 Element-wise operations stream the tiles in order with the
+ *                 next one prefetched. GEMM visits the tile products (i, j, p)
+ *                 of C = A * B in a snake order: the j of consecutive rows of
+ *                 C run in opposite directions, so the column panel of B last
+ *                 used is reused, and the p of consecutive tiles of C run in
+ *                 opposite directions, so the tiles of A and B last used are
+ *                 reused; with a cache of at least a row panel of A, A is read
+ *                 once. The tile products after the current one are
+ *                 prefetched while ZTGemm runs on it.
+ *
+ *                 Results are new tiled matrices in the same directory with
+ *                 the same tiling. Subscripts are zero-based.
+ */
+template <typename T>
+class ZTTiledMatrix {
+
+private:
+    std::unique_ptr<ZTTileCache> cache;
+    std::string tile_directory;
+    std::size_t matrix_rows;
+    std::size_t matrix_cols;
+    std::size_t tile_size;
+    std::size_t grid_rows;
+    std::size_t grid_cols;
+
+    std::size_t tile_rows(std::size_t bi) const;
+    std::size_t tile_cols(std::size_t bj) const;
+    T* pin(std::size_t bi, std::size_t bj, bool dirty, bool overwrite = false) const;
+    void unpin(std::size_t bi, std::size_t bj) const;
+    void prefetch(std::size_t bi, std::size_t bj) const;
+
+    template <typename F>
+    ZTTiledMatrix<T> map(const ZTTiledMatrix* m, F f) const;
+
+public:
+    static constexpr std::size_t default_tile_size = 1024;   // elements per side
+    static constexpr std::size_t default_cache_tiles = 64;   // tiles resident at once
+
+    ZTTiledMatrix(std::size_t rows, std::size_t cols, const std::string& directory,
+                  std::size_t tile = default_tile_size, std::size_t tiles_cached = default_cache_tiles);  // all zeros
+    ZTTiledMatrix(const ZTMatrixView<const T>& m, const std::string& directory,
+                  std::size_t tile = default_tile_size, std::size_t tiles_cached = default_cache_tiles);
+    ZTTiledMatrix(ZTTiledMatrix<T>&& mv) noexcept = default;
+
+    std::size_t get_matrix_rows() const;
+    std::size_t get_matrix_cols() const;
+    std::size_t get_tile_size() const;
+    std::size_t get_cache_tiles() const;
+    std::size_t tile_reads() const;   // tiles read from disk so far
+    std::size_t tile_writes() const;  // tiles written to disk so far
+
+    T at(std::size_t row, std::size_t col) const;  // checked
+    void set(std::size_t row, std::size_t col, const T& value);
+    ZTMatrix<T> read_block(std::size_t row, std::size_t col, std::size_t rows, std::size_t cols) const;
+    void write_block(std::size_t row, std::size_t col, const ZTMatrixView<const T>& m);
+    ZTMatrix<T> to_matrix() const;
+
+    ZTTiledMatrix<T> add(const T& scalar) const;
+    ZTTiledMatrix<T> minus(const T& scalar) const;
+    ZTTiledMatrix<T> multiply(const T& scalar) const;
+
+    ZTTiledMatrix<T> add(const ZTTiledMatrix& m) const;
+    ZTTiledMatrix<T> minus(const ZTTiledMatrix& m) const;
+    ZTTiledMatrix<T> multiply(const ZTTiledMatrix& m) const;  // tiled GEMM
+
+    T trace() const;
+    T norm() const;
+
+    void valid_same_tiling(const ZTTiledMatrix& m) const;
+    void valid_matrix_add_minus(const ZTTiledMatrix& m) const;
+    void valid_matrix_product(const ZTTiledMatrix& m) const;
+    void valid_sqaure_matrix() const;
+    void valid_block(std::size_t row, std::size_t col, std::size_t rows, std::size_t cols) const;
+
+};
+
+#endif /* ZTTILEDMATRIX_H */
@@ -27,11 +27,16 @@
 #include <cstdlib>
 #include <sstream>
 #include <numeric>
+#include <utility>
 #include <iostream>
 #include <stdexcept>
 #include <functional>
 
+#include "ZTBlas.h"
+#include "ZTError.h"
 #include "ZTVector.h"
+#include "ZTVectorView.h"
+#include "ZTExpression.h"
 
 /**
  * Constructor : Constructs a Vector whose elements are initialized to the provided vector
@@ -41,7 +46,20 @@
  *
  */
 template<typename T>
-ZTVector<T>::ZTVector(const std::vector<T>& v) : vector_data(v) {
+ZTVector<T>::ZTVector(const std::vector<T>& v) : vector_data(v.begin(), v.end()) {
+
+}
+
+/**
+ * Constructor : Constructs a Vector of the given size whose elements are left
+ *               uninitialized, for results that are about to be overwritten
+ *
+ * @param  std::size_t size size for initialization
+ * @return nothing
+ *
+ */
+template<typename T>
+ZTVector<T>::ZTVector(std::size_t size, uninitialized) : vector_data(size) {
 
 }
 
@@ -57,6 +75,59 @@ ZTVector<T>::ZTVector(const ZTVector<T>& cp) : vector_data(cp.vector_data) {
 
 }
 
+/**
+ * Constructor : Constructs a Vector by evaluating an expression in a single pass
+ *
+ * @param  ZTVectorExpression<T, E> e expression for initialization
+ * @return nothing
+ *
+ */
+template<typename T>
+template<typename E>
+ZTVector<T>::ZTVector(const ZTVectorExpression<T, E>& e) : vector_data(e.get_vector_size()) {
+
+    T* z = vector_data.data();
+    const std::size_t n = vector_data.size();
+    _Pragma("GCC ivdep")
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        z[i] = e[i];
+    }
+
+}
+
+/**
+ * Move Constructor : takes over the buffer of mv, which is left empty
+ *
+ * @param  ZTVector<T> mv vector to be moved
+ * @return nothing
+ *
+ */
+template<typename T>
+ZTVector<T>::ZTVector(ZTVector<T>&& mv) noexcept : vector_data(std::move(mv.vector_data)) {
+
+    mv.vector_data.clear();
+
+}
+
+/**
+ * Constructor : Constructs a Vector holding a copy of the elements of a view
+ *
+ * @param  ZTVectorView<const T> v view to be copied
+ * @return nothing
+ *
+ */
+template<typename T>
+ZTVector<T>::ZTVector(const ZTVectorView<const T>& v) : vector_data(v.size()) {
+
+    T* z = vector_data.data();
+    for (std::size_t i = 0, n = v.size(); i < n; ++i)
+    {
+        z[i] = v[i];
+    }
+
+}
+
 /**
  * Destructor
  *
@@ -70,19 +141,123 @@ ZTVector<T>::~ZTVector() {
 }
 
 /**
- * Getter : ZTVector::vector_data  getter method
+ * data : pointer to the contiguous vector elements
+ *
+ * @param  nothing
+ * @return T* vector_data
+ *
+ */
+template<typename T>
+inline T* ZTVector<T>::data() {
+
+    return vector_data.data();
+
+}
+
+/**
+ * data : pointer to the contiguous vector elements
  *
  * @param  nothing
- * @return std::std::vector<T> vector_data
+ * @return const T* vector_data
  *
  */
 template<typename T>
-std::vector<T> ZTVector<T>::get_vector_data() {
+inline const T* ZTVector<T>::data() const {
+
+    return vector_data.data();
+
+}
+
+/**
+ * view : view of all the elements of the vector
+ *
+ * @param  nothing
+ * @return ZTVectorView<T> view
+ *
+ */
+template<typename T>
+inline ZTVectorView<T> ZTVector<T>::view() {
+
+    return ZTVectorView<T>(*this);
+
+}
+
+/**
+ * view : read-only view of all the elements of the vector
+ *
+ * @param  nothing
+ * @return ZTVectorView<const T> view
+ *
+ */
+template<typename T>
+inline ZTVectorView<const T> ZTVector<T>::view() const {
+
+    return ZTVectorView<const T>(*this);
+
+}
+
+/**
+ * slice : view of size elements starting at offset and stride elements apart
+ *
+ * @param  std::size_t offset position of the first element
+ * @param  std::size_t size number of elements
+ * @param  std::size_t stride distance between elements
+ * @return ZTVectorView<T> view
+ *
+ */
+template<typename T>
+inline ZTVectorView<T> ZTVector<T>::slice(std::size_t offset, std::size_t size, std::size_t stride) {
+
+    return ZTVectorView<T>(vector_data.data(), size, stride, offset);
+
+}
+
+/**
+ * slice : read-only view of size elements starting at offset and stride elements apart
+ *
+ * @param  std::size_t offset position of the first element
+ * @param  std::size_t size number of elements
+ * @param  std::size_t stride distance between elements
+ * @return ZTVectorView<const T> view
+ *
+ */
+template<typename T>
+inline ZTVectorView<const T> ZTVector<T>::slice(std::size_t offset, std::size_t size, std::size_t stride) const {
+
+    return ZTVectorView<const T>(vector_data.data(), size, stride, offset);
+
+}
+
+/**
+ * Getter : ZTVector::vector_data getter method, returns the aligned storage
+ *          itself rather than a copy
+ *
+ * @param  nothing
+ * @return std::vector<T, ZTAlignedAllocator<T> > vector_data
+ *
+ */
+template<typename T>
+inline const std::vector<T, ZTAlignedAllocator<T> >& ZTVector<T>::get_vector_data() const {
 
     return vector_data;
 
 }
 
+/**
+ * Getter : ZTVector::vector_data getter method, copies into out reusing its
+ *          capacity instead of returning a new std::vector
+ *
+ * @param  std::vector<T>& out
+ * @return nothing
+ *
+ */
+template<typename T>
+void ZTVector<T>::get_vector_data(std::vector<T>& out) const {
+
+    out.assign(vector_data.begin(), vector_data.end());
+
+}
+
 /**
  * Setter : ZTVector::vector_data setter method
  *
@@ -93,7 +268,7 @@ std::vector<T> ZTVector<T>::get_vector_data() {
 template<typename T>
 void ZTVector<T>::set_vector_data(const std::vector<T>& v) {
 
-    vector_data = v;
+    vector_data.assign(v.begin(), v.end());
 
 }
 
@@ -105,9 +280,23 @@ void ZTVector<T>::set_vector_data(const std::vector<T>& v) {
  *
  */
 template<typename T>
-std::size_t ZTVector<T>::get_vector_size() {
+std::size_t ZTVector<T>::get_vector_size() const {
+
+    return vector_data.size();
+
+}
+
+/**
+ * size : number of elements, together with data() a view of the vector
+ *
+ * @param  nothing
+ * @return std::size_t size
+ *
+ */
+template<typename T>
+inline std::size_t ZTVector<T>::size() const {
 
-    return vector_size;
+    return vector_data.size();
 
 }
 
@@ -144,52 +333,190 @@ ZTVector<T>& ZTVector<T>::operator=(const ZTVector<T>& v) {
 }
 
 /**
- * add : performs vector to scalar addition
+ * move assignment operator : takes over the buffer of v, which is left empty
  *
- * @param  T& scalar
- * @return std::vector<T> result
+ * @param  ZTVector<T> v
+ * @return *this (instance of ZTVector<T>)
  *
  */
 template<typename T>
-ZTVector<T> ZTVector<T>::add(const T& scalar) {
+ZTVector<T>& ZTVector<T>::operator=(ZTVector<T>&& v) noexcept {
 
-    ZTVector<T> result(std::vector<T> (vector_size, 0)); // initialize with a zero-valued vector of size vector_size
-    for (int i = 0; i < vector_size; ++i)
+    if (this != &v)
     {
-        result.vector_data[i] = vector_data[i] + scalar;
+        vector_data.swap(v.vector_data);
+        v.vector_data.clear();
     }
-    return result;
+    return *this;
 
 }
 
 /**
- * cummulative_add : performs vector to scalar cummulative addition
+ * assignment operator : evaluates the expression into the instance in a single
+ *                       pass. The instance may appear in the expression as a
+ *                       whole; when a view in it may read elements of the
+ *                       instance out of place, the expression is evaluated
+ *                       into a temporary first
  *
- * @param  T& scalar
+ * @param  ZTVectorExpression<T, E> e
  * @return *this (instance of ZTVector<T>)
  *
  */
 template<typename T>
-ZTVector<T>& ZTVector<T>::cummulative_add(const T& scalar) {
+template<typename E>
+ZTVector<T>& ZTVector<T>::operator=(const ZTVectorExpression<T, E>& e) {
 
-    for (int i = 0; i < vector_size; ++i)
+    if (vector_data.size() != e.get_vector_size() || e.overlaps(vector_data.data()))
+    {
+        ZTVector<T> result(e);
+        vector_data.swap(result.vector_data);
+        return *this;
+    }
+    // no node reads an element of the instance other than i, so writing in place is safe
+    T* z = vector_data.data();
+    const std::size_t n = vector_data.size();
+    _Pragma("GCC ivdep")
+    for (std::size_t i = 0; i < n; ++i)
     {
-        vector_data[i] += scalar;
+        z[i] = e[i];
     }
     return *this;
 
 }
 
 /**
- * inline + operator : performs vector to scalar addition
+ * at : get the vector element at zero-based i, the index is checked
+ *      whatever the error policy
  *
- * @param  T& scalar
+ * @param  std::size_t i zero-based index
+ * @return T& element
+ *
+ */
+template <typename T>
+inline T& ZTVector<T>::at(std::size_t i) {
+
+    valid_vector_index(i);
+    return vector_data[i];
+
+}
+
+/**
+ * at : get the vector element at zero-based i, the index is checked
+ *      whatever the error policy
+ *
+ * @param  std::size_t i zero-based index
+ * @return const T& element
+ *
+ */
+template <typename T>
+inline const T& ZTVector<T>::at(std::size_t i) const {
+
+    valid_vector_index(i);
+    return vector_data[i];
+
+}
+
+/**
+ * [] operator : get the vector element at zero-based i without checks
+ *
+ * @param  std::size_t i zero-based index
+ * @return T& element
+ *
+ */
+template <typename T>
+inline T& ZTVector<T>::operator[](std::size_t i) {
+
+    return vector_data[i];
+
+}
+
+/**
+ * [] operator : get the vector element at zero-based i without checks
+ *
+ * @param  std::size_t i zero-based index
+ * @return const T& element
+ *
+ */
+template <typename T>
+inline const T& ZTVector<T>::operator[](std::size_t i) const {
+
+    return vector_data[i];
+
+}
+
+/**
+ * unsafe_get : get the vector element at zero-based i without checks
+ *
+ * @param  std::size_t i zero-based index
+ * @return T& element
  *
  */
 template <typename T>
-inline ZTVector<T> ZTVector<T>::operator+(const T& scalar) {
+inline T& ZTVector<T>::unsafe_get(std::size_t i) {
 
-    return ZTVector<T>::add(scalar);
+    return vector_data[i];
+
+}
+
+/**
+ * unsafe_get : get the vector element at zero-based i without checks
+ *
+ * @param  std::size_t i zero-based index
+ * @return const T& element
+ *
+ */
+template <typename T>
+inline const T& ZTVector<T>::unsafe_get(std::size_t i) const {
+
+    return vector_data[i];
+
+}
+
+/**
+ * add : performs vector to scalar addition
+ *
+ * @param  T& scalar
+ * @return ZTVector<T> result
+ *
+ */
+template<typename T>
+ZTVector<T> ZTVector<T>::add(const T& scalar) const {
+
+    ZTVector<T> result(vector_data.size(), uninitialized());
+    add(scalar, result);
+    return result;
+
+}
+
+/**
+ * add : performs vector to scalar addition into a preallocated result, out is
+ *       only reallocated when it is too small and may be *this
+ *
+ * @param  T& scalar
+ * @param  ZTVector<T>& out result
+ * @return nothing
+ *
+ */
+template<typename T>
+void ZTVector<T>::add(const T& scalar, ZTVector<T>& out) const {
+
+    out.vector_data.resize(vector_data.size());
+    ZTBlas<T>::kernels().add_scalar(vector_data.size(), vector_data.data(), scalar, out.vector_data.data());
+
+}
+
+/**
+ * cummulative_add : performs vector to scalar cummulative addition
+ *
+ * @param  T& scalar
+ * @return *this (instance of ZTVector<T>)
+ *
+ */
+template<typename T>
+ZTVector<T>& ZTVector<T>::cummulative_add(const T& scalar) {
+
+    ZTBlas<T>::kernels().add_scalar(vector_data.size(), vector_data.data(), scalar, vector_data.data());
+    return *this;
 
 }
 
@@ -210,49 +537,47 @@ inline ZTVector<T>& ZTVector<T>::operator+=(const T &scalar) {
  * minus : performs vector to scalar minus
  *
  * @param  T& scalar
- * @return std::vector<T> result
+ * @return ZTVector<T> result
  *
  */
 template<typename T>
-ZTVector<T> ZTVector<T>::minus(const T& scalar) {
+ZTVector<T> ZTVector<T>::minus(const T& scalar) const {
 
-    ZTVector<T> result(std::vector<T> (vector_size, 0)); // initialize with a zero-valued vector of size vector_size
-    for (int i = 0; i < vector_size; ++i)
-    {
-        result.vector_data[i] = vector_data[i] - scalar;
-    }
+    ZTVector<T> result(vector_data.size(), uninitialized());
+    minus(scalar, result);
     return result;
 
 }
 
 /**
- * cummulative_minus : performs vector to scalar cummulative minus
+ * minus : performs vector to scalar minus into a preallocated result, out is
+ *         only reallocated when it is too small and may be *this
  *
  * @param  T& scalar
- * @return *this (instance of ZTVector<T>)
+ * @param  ZTVector<T>& out result
+ * @return nothing
  *
  */
 template<typename T>
-ZTVector<T>& ZTVector<T>::cummulative_minus(const T& scalar) {
+void ZTVector<T>::minus(const T& scalar, ZTVector<T>& out) const {
 
-    for (int i = 0; i < vector_size; ++i)
-    {
-        vector_data[i] -= scalar;
-    }
-    return *this;
+    out.vector_data.resize(vector_data.size());
+    ZTBlas<T>::kernels().add_scalar(vector_data.size(), vector_data.data(), -scalar, out.vector_data.data());
 
 }
 
 /**
- * inline - operator : performs vector to scalar minus
+ * cummulative_minus : performs vector to scalar cummulative minus
  *
  * @param  T& scalar
+ * @return *this (instance of ZTVector<T>)
  *
  */
-template <typename T>
-inline ZTVector<T> ZTVector<T>::operator-(const T& scalar) {
+template<typename T>
+ZTVector<T>& ZTVector<T>::cummulative_minus(const T& scalar) {
 
-    return ZTVector<T>::minus(scalar);
+    ZTBlas<T>::kernels().add_scalar(vector_data.size(), vector_data.data(), -scalar, vector_data.data());
+    return *this;
 
 }
 
@@ -270,52 +595,50 @@ inline ZTVector<T>& ZTVector<T>::operator-=(const T& scalar) {
 }
 
 /**
- * multiply : performs vector to scalar multiply
+ * multiply : performs vector to scalar multiplication
  *
  * @param  T& scalar
- * @return std::vector<T> result
+ * @return ZTVector<T> result
  *
  */
 template<typename T>
-ZTVector<T> ZTVector<T>::multiply(const T& scalar) {
+ZTVector<T> ZTVector<T>::multiply(const T& scalar) const {
 
-    ZTVector<T> result(std::vector<T> (vector_size, 0)); // initialize with a zero-valued vector of size vector_size
-    for (int i = 0; i < vector_size; ++i)
-    {
-        result.vector_data[i] = vector_data[i] * scalar;
-    }
+    ZTVector<T> result(vector_data.size(), uninitialized());
+    multiply(scalar, result);
     return result;
 
 }
 
 /**
- * cummulative_multiply : performs cummulative vector to scalar multiplication
+ * multiply : performs vector to scalar multiplication into a preallocated result, out is
+ *            only reallocated when it is too small and may be *this
  *
  * @param  T& scalar
- * @return *this (instance of ZTVector<T>)
+ * @param  ZTVector<T>& out result
+ * @return nothing
  *
  */
 template<typename T>
-ZTVector<T>& ZTVector<T>::cummulative_multiply(const T& scalar) {
+void ZTVector<T>::multiply(const T& scalar, ZTVector<T>& out) const {
 
-    for (int i = 0; i < vector_size; ++i)
-    {
-        vector_data[i] *= scalar;
-    }
-    return *this;
+    out.vector_data.resize(vector_data.size());
+    ZTBlas<T>::kernels().multiply_scalar(vector_data.size(), vector_data.data(), scalar, out.vector_data.data());
 
 }
 
 /**
- * inline * operator : performs vector to scalar multiplication
+ * cummulative_multiply : performs cummulative vector to scalar multiplication
  *
  * @param  T& scalar
+ * @return *this (instance of ZTVector<T>)
  *
  */
-template <typename T>
-inline ZTVector<T> ZTVector<T>::operator*(const T& scalar) {
+template<typename T>
+ZTVector<T>& ZTVector<T>::cummulative_multiply(const T& scalar) {
 
-    return ZTVector<T>::multiply(scalar);
+    ZTBlas<T>::kernels().multiply_scalar(vector_data.size(), vector_data.data(), scalar, vector_data.data());
+    return *this;
 
 }
 
@@ -335,67 +658,50 @@ inline ZTVector<T>& ZTVector<T>::operator*=(const T& scalar) {
 /**
  * add : performs vector to vector addition
  *
- * @param  std::vector<T>& v
- * @return std::vector<T> result
+ * @param  std::vector<T> v
+ * @return ZTVector<T> result
  *
  */
 template<typename T>
-ZTVector<T> ZTVector<T>::add(const std::vector<T>& v) {
+ZTVector<T> ZTVector<T>::add(const std::vector<T>& v) const {
 
-    try
-    {
-        valid_vector_dimensions(v);
-        ZTVector<T> result(std::vector<T> (vector_size, 0)); // initialize with a zero-valued vector of size vector_size
-        for (int i = 0; i < vector_size; ++i)
-        {
-            result.vector_data[i] = vector_data[i] + v[i];
-        }
-        return result;
-    }
-    catch (const std::invalid_argument& e)
-    {
-        std::cerr << "Exception: " << e.what() << std::endl;
-        std::exit(0);
-    }
+    ZTVector<T> result(vector_data.size(), uninitialized());
+    add(v, result);
+    return result;
 
 }
 
 /**
- * cummulative_add : performs vector to vector cummulative addition
+ * add : performs vector to vector addition into a preallocated result, out is
+ *       only reallocated when it is too small and may be *this
  *
- * @param  std::vector<T>& v
- * @return *this (instance of ZTVector<T>)
+ * @param  std::vector<T> v
+ * @param  ZTVector<T>& out result
+ * @return nothing
  *
  */
 template<typename T>
-ZTVector<T>& ZTVector<T>::cummulative_add(const std::vector<T>& v) {
+void ZTVector<T>::add(const std::vector<T>& v, ZTVector<T>& out) const {
 
-    try
-    {
-        valid_vector_dimensions(v);
-        for (int i = 0; i < vector_size; ++i)
-        {
-            vector_data[i] += v[i];
-        }
-        return *this;
-    }
-    catch (const std::invalid_argument& e)
-    {
-        std::cerr << "Exception: " << e.what() << std::endl;
-        std::exit(0);
-    }
+    ZT_VALIDATE(valid_vector_dimensions(v));
+    out.vector_data.resize(vector_data.size());
+    ZTBlas<T>::kernels().add(vector_data.size(), vector_data.data(), v.data(), out.vector_data.data());
 
 }
 
 /**
- * inline + operator : performs vector to vector addition
+ * cummulative_add : performs vector to vector cummulative addition
+ *
+ * @param  std::vector<T>& v
+ * @return *this (instance of ZTVector<T>)
  *
- * @param  std::vector<T> v
  */
-template <typename T>
-inline ZTVector<T> ZTVector<T>::operator+(const std::vector<T>& v) {
+template<typename T>
+ZTVector<T>& ZTVector<T>::cummulative_add(const std::vector<T>& v) {
 
-    return ZTVector<T>::add(v);
+    ZT_VALIDATE(valid_vector_dimensions(v));
+    ZTBlas<T>::kernels().add(vector_data.size(), vector_data.data(), v.data(), vector_data.data());
+    return *this;
 
 }
 
@@ -413,30 +719,36 @@ inline ZTVector<T>& ZTVector<T>::operator+=(const std::vector<T>& v) {
 }
 
 /**
- * minus : performs vector to scalar minus
+ * minus : performs vector to vector minus
  *
- * @param  std::vector<T> v;
- * @return std::vector<T> result
+ * @param  std::vector<T> v
+ * @return ZTVector<T> result
  *
  */
 template<typename T>
-ZTVector<T> ZTVector<T>::minus(const std::vector<T>& v) {
+ZTVector<T> ZTVector<T>::minus(const std::vector<T>& v) const {
 
-    try
-    {
-        valid_vector_dimensions(v);
-        ZTVector<T> result(std::vector<T> (vector_size, 0)); // initialize with a zero-valued vector of size vector_size
-        for (int i = 0; i < vector_size; ++i)
-        {
-            result.vector_data[i] = vector_data[i] - v[i];
-        }
-        return result;
-    }
-    catch (const std::invalid_argument& e)
-    {
-        std::cerr << "Exception: " << e.what() << std::endl;
-        std::exit(0);
-    }
+    ZTVector<T> result(vector_data.size(), uninitialized());
+    minus(v, result);
+    return result;
+
+}
+
+/**
+ * minus : performs vector to vector minus into a preallocated result, out is
+ *         only reallocated when it is too small and may be *this
+ *
+ * @param  std::vector<T> v
+ * @param  ZTVector<T>& out result
+ * @return nothing
+ *
+ */
+template<typename T>
+void ZTVector<T>::minus(const std::vector<T>& v, ZTVector<T>& out) const {
+
+    ZT_VALIDATE(valid_vector_dimensions(v));
+    out.vector_data.resize(vector_data.size());
+    ZTBlas<T>::kernels().minus(vector_data.size(), vector_data.data(), v.data(), out.vector_data.data());
 
 }
 
@@ -450,74 +762,209 @@ ZTVector<T> ZTVector<T>::minus(const std::vector<T>& v) {
 template<typename T>
 ZTVector<T>& ZTVector<T>::cummulative_minus(const std::vector<T>& v) {
 
-    try
-    {
-        valid_vector_dimensions(v);
-        for (int i = 0; i < vector_size; ++i)
-        {
-            vector_data[i] -= v[i];
-        }
-        return *this;
-    }
-    catch (const std::invalid_argument& e)
-    {
-        std::cerr << "Exception: " << e.what() << std::endl;
-        std::exit(0);
-    }
+    ZT_VALIDATE(valid_vector_dimensions(v));
+    ZTBlas<T>::kernels().minus(vector_data.size(), vector_data.data(), v.data(), vector_data.data());
+    return *this;
 
 }
 
 /**
- * inline - operator : performs vector to vector minus
+ * inline -= operator : performs vector to vector cummulative minus
  *
- * @param  std::vector<T> v
+ * @param  T& scalar
  *
  */
 template <typename T>
-inline ZTVector<T> ZTVector<T>::operator-(const std::vector<T>& v) {
+inline ZTVector<T>& ZTVector<T>::operator-=(const std::vector<T>& v) {
 
-    return ZTVector<T>::minus(v);
+    return ZTVector<T>::cummulative_minus(v);
 
 }
 
 /**
- * inline -= operator : performs vector to vector cummulative minus
+ * add : performs vector to view addition, v may also be a ZTVector
  *
- * @param  T& scalar
+ * @param  ZTVectorView<const T> v
+ * @return ZTVector<T> result
+ *
+ */
+template<typename T>
+ZTVector<T> ZTVector<T>::add(const ZTVectorView<const T>& v) const {
+
+    ZTVector<T> result(vector_data.size(), uninitialized());
+    add(v, result);
+    return result;
+
+}
+
+/**
+ * add : performs vector to view addition into a preallocated result, out is
+ *       only reallocated when it is too small and may be *this
+ *
+ * @param  ZTVectorView<const T> v
+ * @param  ZTVector<T>& out result
+ * @return nothing
+ *
+ */
+template<typename T>
+void ZTVector<T>::add(const ZTVectorView<const T>& v, ZTVector<T>& out) const {
+
+    view().add(v, out);
+
+}
+
+/**
+ * cummulative_add : performs vector to view cummulative addition
+ *
+ * @param  ZTVectorView<const T> v
+ * @return *this (instance of ZTVector<T>)
+ *
+ */
+template<typename T>
+ZTVector<T>& ZTVector<T>::cummulative_add(const ZTVectorView<const T>& v) {
+
+    view().cummulative_add(v);
+    return *this;
+
+}
+
+/**
+ * minus : performs vector to view minus, v may also be a ZTVector
+ *
+ * @param  ZTVectorView<const T> v
+ * @return ZTVector<T> result
+ *
+ */
+template<typename T>
+ZTVector<T> ZTVector<T>::minus(const ZTVectorView<const T>& v) const {
+
+    ZTVector<T> result(vector_data.size(), uninitialized());
+    minus(v, result);
+    return result;
+
+}
+
+/**
+ * minus : performs vector to view minus into a preallocated result, out is
+ *         only reallocated when it is too small and may be *this
+ *
+ * @param  ZTVectorView<const T> v
+ * @param  ZTVector<T>& out result
+ * @return nothing
+ *
+ */
+template<typename T>
+void ZTVector<T>::minus(const ZTVectorView<const T>& v, ZTVector<T>& out) const {
+
+    view().minus(v, out);
+
+}
+
+/**
+ * cummulative_minus : performs vector to view cummulative minus
+ *
+ * @param  ZTVectorView<const T> v
+ * @return *this (instance of ZTVector<T>)
+ *
+ */
+template<typename T>
+ZTVector<T>& ZTVector<T>::cummulative_minus(const ZTVectorView<const T>& v) {
+
+    view().cummulative_minus(v);
+    return *this;
+
+}
+
+/**
+ * inline += operator : performs vector to view cummulative addition
+ *
+ * @param  ZTVectorView<const T> v
  *
  */
 template <typename T>
-inline ZTVector<T>& ZTVector<T>::operator-=(const std::vector<T>& v) {
+inline ZTVector<T>& ZTVector<T>::operator+=(const ZTVectorView<const T>& v) {
 
     return ZTVector<T>::cummulative_add(v);
 
 }
 
 /**
- * multiply : performs vector to vector multiply
+ * inline -= operator : performs vector to view cummulative minus
  *
- * @param  std::vector<T> v
- * @return std::vector<T> result
+ * @param  ZTVectorView<const T> v
  *
  */
-template<typename T>
-T ZTVector<T>::multiply(const std::vector<T>& v) {
+template <typename T>
+inline ZTVector<T>& ZTVector<T>::operator-=(const ZTVectorView<const T>& v) {
+
+    return ZTVector<T>::cummulative_minus(v);
+
+}
+
+/**
+ * inline += operator : performs vector to expression cummulative addition in a single pass
+ *
+ * @param  ZTVectorExpression<T, E> e
+ *
+ */
+template <typename T>
+template <typename E>
+inline ZTVector<T>& ZTVector<T>::operator+=(const ZTVectorExpression<T, E>& e) {
 
-    try
+    ZT_VALIDATE(zt_valid_expression_dimensions(vector_data.size(), 1, e.get_vector_size(), 1));
+    if (e.overlaps(vector_data.data()))
     {
-        valid_vector_dimensions(v);
-        T result = 0;
-        for (int i = 0; i < vector_size; ++i)
-        {
-            result += vector_data[i] * v[i];
-        }
-        return result;
+        return *this += ZTVector<T>(e);
     }
-    catch (const std::invalid_argument& e)
+    T* z = vector_data.data();
+    const std::size_t n = vector_data.size();
+    _Pragma("GCC ivdep")
+    for (std::size_t i = 0; i < n; ++i)
     {
-        std::cerr << "Exception: " << e.what() << std::endl;
-        std::exit(0);
+        z[i] += e[i];
     }
+    return *this;
+
+}
+
+/**
+ * inline -= operator : performs vector to expression cummulative minus in a single pass
+ *
+ * @param  ZTVectorExpression<T, E> e
+ *
+ */
+template <typename T>
+template <typename E>
+inline ZTVector<T>& ZTVector<T>::operator-=(const ZTVectorExpression<T, E>& e) {
+
+    ZT_VALIDATE(zt_valid_expression_dimensions(vector_data.size(), 1, e.get_vector_size(), 1));
+    if (e.overlaps(vector_data.data()))
+    {
+        return *this -= ZTVector<T>(e);
+    }
+    T* z = vector_data.data();
+    const std::size_t n = vector_data.size();
+    _Pragma("GCC ivdep")
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        z[i] -= e[i];
+    }
+    return *this;
+
+}
+
+/**
+ * multiply : performs vector to vector multiply
+ *
+ * @param  std::vector<T> v
+ * @return std::vector<T> result
+ *
+ */
+template<typename T>
+T ZTVector<T>::multiply(const std::vector<T>& v) const {
+
+    ZT_VALIDATE(valid_vector_dimensions(v));
+    return ZTBlas<T>::kernels().dot(vector_data.size(), vector_data.data(), v.data());
 
 }
 
@@ -528,7 +975,7 @@ T ZTVector<T>::multiply(const std::vector<T>& v) {
  *
  */
 template <typename T>
-inline T ZTVector<T>::operator*(const std::vector<T>& v) {
+inline T ZTVector<T>::operator*(const std::vector<T>& v) const {
 
     return ZTVector<T>::multiply(v);
 
@@ -542,18 +989,10 @@ inline T ZTVector<T>::operator*(const std::vector<T>& v) {
  *
  */
 template <typename T>
-T ZTVector<T>::dot(const std::vector<T>& v) {
+T ZTVector<T>::dot(const std::vector<T>& v) const {
 
-    try
-    {
-        valid_vector_dimensions(v);
-        return std::inner_product(vector_data.begin(), vector_data.end(), v.begin(), 0);
-    }
-    catch (const std::invalid_argument& e)
-    {
-        std::cerr << "Exception: " << e.what() << std::endl;
-        std::exit(0);
-    }
+    ZT_VALIDATE(valid_vector_dimensions(v));
+    return ZTBlas<T>::kernels().dot(vector_data.size(), vector_data.data(), v.data());
 
 }
 
@@ -565,18 +1004,65 @@ T ZTVector<T>::dot(const std::vector<T>& v) {
  *
  */
 template <typename T>
-T ZTVector<T>::norm(const std::vector<T>& v) {
+T ZTVector<T>::norm(const std::vector<T>& v) const {
 
-    try
-    {
-        valid_vector_dimensions(v);
-        return std::sqrt(ZTVector<T>::multiply(v));
-    }
-    catch (const std::invalid_argument& e)
-    {
-        std::cerr << "Exception: " << e.what() << std::endl;
-        std::exit(0);
-    }
+    ZT_VALIDATE(valid_vector_dimensions(v));
+    return std::sqrt(ZTVector<T>::multiply(v));
+
+}
+
+/**
+ * multiply : performs vector to view multiply
+ *
+ * @param  ZTVectorView<const T> v
+ * @return T result
+ *
+ */
+template<typename T>
+T ZTVector<T>::multiply(const ZTVectorView<const T>& v) const {
+
+    return view().dot(v);
+
+}
+
+/**
+ * inline * operator : performs vector to view multiplication
+ *
+ * @param  ZTVectorView<const T> v
+ *
+ */
+template <typename T>
+inline T ZTVector<T>::operator*(const ZTVectorView<const T>& v) const {
+
+    return ZTVector<T>::multiply(v);
+
+}
+
+/**
+ * dot : performs vector to view dot operation, v may also be a ZTVector
+ *
+ * @param  ZTVectorView<const T> v
+ * @return T result
+ *
+ */
+template<typename T>
+T ZTVector<T>::dot(const ZTVectorView<const T>& v) const {
+
+    return view().dot(v);
+
+}
+
+/**
+ * norm : performs vector to view norm operation
+ *
+ * @param  ZTVectorView<const T> v
+ * @return T result
+ *
+ */
+template<typename T>
+T ZTVector<T>::norm(const ZTVectorView<const T>& v) const {
+
+    return view().norm(v);
 
 }
 
@@ -588,9 +1074,9 @@ T ZTVector<T>::norm(const std::vector<T>& v) {
  *
  */
 template <typename T>
-T ZTVector<T>::norm() {
+T ZTVector<T>::norm() const {
 
-    return std::sqrt(ZTVector<T>::multiply(vector_data));
+    return std::sqrt(ZTBlas<T>::kernels().dot(vector_data.size(), vector_data.data(), vector_data.data()));
 
 }
 
@@ -602,13 +1088,32 @@ T ZTVector<T>::norm() {
  *
  */
 template<typename T>
-void ZTVector<T>::valid_vector_dimensions(const std::vector<T>& v) {
+void ZTVector<T>::valid_vector_dimensions(const std::vector<T>& v) const {
 
     if (vector_data.size() != v.size())
     {
         std::ostringstream invalid_dimensions;
         invalid_dimensions << "vector sizes " << vector_data.size() << " and " << v.size() << " do not match!.";
-        throw std::invalid_argument(invalid_dimensions.str());
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * valid_vector_index : checks for a valid zero-based vector index
+ *
+ * @param  std::size_t i zero-based index
+ * @return void
+ *
+ */
+template<typename T>
+inline void ZTVector<T>::valid_vector_index(std::size_t i) const {
+
+    if (i >= vector_data.size())
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "vector index " << i << " out of range for size " << vector_data.size() << "!.";
+        zt_raise<std::out_of_range>(invalid_dimensions.str());
     }
 
 }
@@ -27,62 +27,118 @@
 
 #include <vector>
 
+#include "ZTAlignedAllocator.h"
+
+template <typename T, typename E>
+class ZTVectorExpression;
+
+template <typename T>
+class ZTVectorView;
+
 template <typename T>
 class ZTVector {
 
 private:
-    std::vector<T> vector_data;
-    int vector_size = vector_data.size();
+    std::vector<T, ZTAlignedAllocator<T> > vector_data;
+
+    struct uninitialized {};
+    ZTVector(std::size_t size, uninitialized); // uninitialized storage for results
 
 public:
     ZTVector(const std::vector<T>& v);
     ZTVector(const ZTVector<T>& cp);
+    ZTVector(ZTVector<T>&& mv) noexcept;
+    explicit ZTVector(const ZTVectorView<const T>& v); // copies the elements of a view
+    template <typename E>
+    ZTVector(const ZTVectorExpression<T, E>& e); // evaluates the expression
     virtual ~ZTVector();
 
-    std::vector<T> get_vector_data();
+    T* data();
+    const T* data() const;
+    std::size_t size() const;
+
+    ZTVectorView<T> view();
+    ZTVectorView<const T> view() const;
+    ZTVectorView<T> slice(std::size_t offset, std::size_t size, std::size_t stride = 1);
+    ZTVectorView<const T> slice(std::size_t offset, std::size_t size, std::size_t stride = 1) const;
+
+    const std::vector<T, ZTAlignedAllocator<T> >& get_vector_data() const; // no copy, see also view()
+    void get_vector_data(std::vector<T>& out) const;
     void set_vector_data(const std::vector<T>& v);
 
-    std::size_t get_vector_size();
+    std::size_t get_vector_size() const;
     void set_vector_size(const std::size_t size);
 
-    ZTVector<T> add(const T& scalar);
-    ZTVector<T> minus(const T& scalar);
-    ZTVector<T> multiply(const T& scalar);
+    T& at(std::size_t i);                     // zero-based, always checked
+    const T& at(std::size_t i) const;
+
+    T& operator [](std::size_t i);            // zero-based, unchecked
+    const T& operator [](std::size_t i) const;
+
+    T& unsafe_get(std::size_t i);
+    const T& unsafe_get(std::size_t i) const;
+
+    ZTVector<T> add(const T& scalar) const;
+    ZTVector<T> minus(const T& scalar) const;
+    ZTVector<T> multiply(const T& scalar) const;
+
+    void add(const T& scalar, ZTVector<T>& out) const;      // results into a reused buffer
+    void minus(const T& scalar, ZTVector<T>& out) const;
+    void multiply(const T& scalar, ZTVector<T>& out) const;
 
     ZTVector<T>& cummulative_add(const T& scalar);
     ZTVector<T>& cummulative_minus(const T& scalar);
     ZTVector<T>& cummulative_multiply(const T& scalar);
 
-    ZTVector<T> add(const std::vector<T>& v);
-    ZTVector<T> minus(const std::vector<T>& v);
-    T multiply(const std::vector<T>& v);
+    ZTVector<T> add(const std::vector<T>& v) const;
+    ZTVector<T> minus(const std::vector<T>& v) const;
+    ZTVector<T> add(const ZTVectorView<const T>& v) const;     // also takes a ZTVector or a slice
+    ZTVector<T> minus(const ZTVectorView<const T>& v) const;
+
+    void add(const std::vector<T>& v, ZTVector<T>& out) const;
+    void minus(const std::vector<T>& v, ZTVector<T>& out) const;
+    void add(const ZTVectorView<const T>& v, ZTVector<T>& out) const;
+    void minus(const ZTVectorView<const T>& v, ZTVector<T>& out) const;
+
+    T multiply(const std::vector<T>& v) const;
+    T multiply(const ZTVectorView<const T>& v) const;
 
     ZTVector<T>& cummulative_add(const std::vector<T>& v);
     ZTVector<T>& cummulative_minus(const std::vector<T>& v);
-
-    ZTVector<T> operator +(const T& scalar);
-    ZTVector<T> operator -(const T& scalar);
-    ZTVector<T> operator *(const T &scalar);
+    ZTVector<T>& cummulative_add(const ZTVectorView<const T>& v);
+    ZTVector<T>& cummulative_minus(const ZTVectorView<const T>& v);
 
     ZTVector<T>& operator +=(const T& scalar);
     ZTVector<T>& operator -=(const T& scalar);
     ZTVector<T>& operator *=(const T& scalar);
 
-    ZTVector<T> operator +(const std::vector<T>& v);
-    ZTVector<T> operator -(const std::vector<T>& v);
-    T operator *(const std::vector<T>& v);
+    T operator *(const std::vector<T>& v) const;
+    T operator *(const ZTVectorView<const T>& v) const;
 
     ZTVector<T>& operator +=(const std::vector<T>& v);
     ZTVector<T>& operator -=(const std::vector<T>& v);
+    ZTVector<T>& operator +=(const ZTVectorView<const T>& v);
+    ZTVector<T>& operator -=(const ZTVectorView<const T>& v);
+
+    template <typename E>
+    ZTVector<T>& operator +=(const ZTVectorExpression<T, E>& e);
+    template <typename E>
+    ZTVector<T>& operator -=(const ZTVectorExpression<T, E>& e);
 
     ZTVector<T>& operator =(const ZTVector<T>& v);
+    ZTVector<T>& operator =(ZTVector<T>&& v) noexcept;
+    template <typename E>
+    ZTVector<T>& operator =(const ZTVectorExpression<T, E>& e);
 
-    T dot(const std::vector<T>& v); // dot product
+    T dot(const std::vector<T>& v) const; // dot product
+    T dot(const ZTVectorView<const T>& v) const;
 
-    T norm();
-    T norm(const std::vector<T>& v);
+    T norm() const;
+    T norm(const std::vector<T>& v) const;
+    T norm(const ZTVectorView<const T>& v) const;
 
-    void valid_vector_dimensions(const std::vector<T>& v);
+    void valid_vector_dimensions(const std::vector<T>& v) const;
+    void valid_vector_index(std::size_t i) const;
 
 };
 
@@ -0,0 +1,910 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cmath>
+#include <vector>
+#include <sstream>
+#include <stdexcept>
+#include <functional>
+
+#include "ZTBlas.h"
+#include "ZTError.h"
+#include "ZTVectorView.h"
+#include "ZTExpression.h"
+
+/**
+ * Constructor : Constructs a view of size elements of a caller-owned buffer
+ *
+ * @param  T* data buffer
+ * @param  std::size_t size number of elements
+ * @param  std::size_t stride distance between consecutive elements
+ * @param  std::size_t offset position of the first element in the buffer
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTVectorView<T>::ZTVectorView(T* data, std::size_t size, std::size_t stride, std::size_t offset) :
+                                                view_data(data + offset),
+                                                view_size(size),
+                                                view_stride(stride) {
+
+}
+
+/**
+ * Constructor : Constructs a view of all the elements of a ZTVector
+ *
+ * @param  ZTVector<T> v
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTVectorView<T>::ZTVectorView(ZTVector<value_type>& v) :
+                                                view_data(v.data()),
+                                                view_size(v.size()),
+                                                view_stride(1) {
+
+}
+
+/**
+ * Constructor : Constructs a read-only view of all the elements of a ZTVector
+ *
+ * @param  ZTVector<T> v
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTVectorView<T>::ZTVectorView(const ZTVector<value_type>& v) :
+                                                view_data(v.data()),
+                                                view_size(v.size()),
+                                                view_stride(1) {
+
+}
+
+/**
+ * Constructor : Constructs a view of all the elements of a std::vector
+ *
+ * @param  std::vector<T> v
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTVectorView<T>::ZTVectorView(std::vector<value_type>& v) :
+                                                view_data(v.data()),
+                                                view_size(v.size()),
+                                                view_stride(1) {
+
+}
+
+/**
+ * Constructor : Constructs a read-only view of all the elements of a std::vector
+ *
+ * @param  std::vector<T> v
+ * @return nothing
+ *
+ */
+template <typename T>
+ZTVectorView<T>::ZTVectorView(const std::vector<value_type>& v) :
+                                                view_data(v.data()),
+                                                view_size(v.size()),
+                                                view_stride(1) {
+
+}
+
+/**
+ * Converting Constructor : a read-only view of the elements of a writable view
+ *
+ * @param  ZTVectorView<U> cp view to be copied
+ * @return nothing
+ *
+ */
+template <typename T>
+template <typename U, typename>
+ZTVectorView<T>::ZTVectorView(const ZTVectorView<U>& cp) :
+                                                view_data(cp.data()),
+                                                view_size(cp.size()),
+                                                view_stride(cp.stride()) {
+
+}
+
+/**
+ * data : pointer to the first element of the view
+ *
+ * @param  nothing
+ * @return T* view_data
+ *
+ */
+template <typename T>
+inline T* ZTVectorView<T>::data() const {
+
+    return view_data;
+
+}
+
+/**
+ * size : number of elements of the view
+ *
+ * @param  nothing
+ * @return std::size_t view_size
+ *
+ */
+template <typename T>
+inline std::size_t ZTVectorView<T>::size() const {
+
+    return view_size;
+
+}
+
+/**
+ * stride : distance between consecutive elements of the view
+ *
+ * @param  nothing
+ * @return std::size_t view_stride
+ *
+ */
+template <typename T>
+inline std::size_t ZTVectorView<T>::stride() const {
+
+    return view_stride;
+
+}
+
+/**
+ * Getter : ZTVectorView::view_size getter method
+ *
+ * @param  nothing
+ * @return std::size_t view_size
+ *
+ */
+template <typename T>
+inline std::size_t ZTVectorView<T>::get_vector_size() const {
+
+    return view_size;
+
+}
+
+/**
+ * [] operator : element i of the view
+ *
+ * @param  std::size_t i zero-based index
+ * @return T& element
+ *
+ */
+template <typename T>
+inline T& ZTVectorView<T>::operator[](std::size_t i) const {
+
+    return view_data[i * view_stride];
+
+}
+
+/**
+ * at : element i of the view, the index is checked whatever the error policy
+ *
+ * @param  std::size_t i zero-based index
+ * @return T& element
+ *
+ */
+template <typename T>
+inline T& ZTVectorView<T>::at(std::size_t i) const {
+
+    valid_vector_index(i);
+    return view_data[i * view_stride];
+
+}
+
+/**
+ * unsafe_get : element i of the view without checks
+ *
+ * @param  std::size_t i zero-based index
+ * @return T& element
+ *
+ */
+template <typename T>
+inline T& ZTVectorView<T>::unsafe_get(std::size_t i) const {
+
+    return view_data[i * view_stride];
+
+}
+
+/**
+ * slice : view of size elements of this view, starting at offset and taking
+ *         every stride-th element
+ *
+ * @param  std::size_t offset position of the first element
+ * @param  std::size_t size number of elements
+ * @param  std::size_t stride step between elements of this view
+ * @return ZTVectorView<T> view
+ *
+ */
+template <typename T>
+ZTVectorView<T> ZTVectorView<T>::slice(std::size_t offset, std::size_t size, std::size_t stride) const {
+
+    return ZTVectorView<T>(view_data + offset * view_stride, size, stride * view_stride);
+
+}
+
+/**
+ * add : performs view to scalar addition
+ *
+ * @param  T& scalar
+ * @return ZTVector<T> result
+ *
+ */
+template <typename T>
+ZTVector<typename ZTVectorView<T>::value_type> ZTVectorView<T>::add(const value_type& scalar) const {
+
+    ZTVector<value_type> result((std::vector<value_type>()));
+    add(scalar, result);
+    return result;
+
+}
+
+/**
+ * minus : performs view to scalar minus
+ *
+ * @param  T& scalar
+ * @return ZTVector<T> result
+ *
+ */
+template <typename T>
+ZTVector<typename ZTVectorView<T>::value_type> ZTVectorView<T>::minus(const value_type& scalar) const {
+
+    ZTVector<value_type> result((std::vector<value_type>()));
+    minus(scalar, result);
+    return result;
+
+}
+
+/**
+ * multiply : performs view to scalar multiplication
+ *
+ * @param  T& scalar
+ * @return ZTVector<T> result
+ *
+ */
+template <typename T>
+ZTVector<typename ZTVectorView<T>::value_type> ZTVectorView<T>::multiply(const value_type& scalar) const {
+
+    ZTVector<value_type> result((std::vector<value_type>()));
+    multiply(scalar, result);
+    return result;
+
+}
+
+/**
+ * add : performs view to scalar addition into a preallocated result
+ *
+ * @param  T& scalar
+ * @param  ZTVector<T>& out result
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTVectorView<T>::add(const value_type& scalar, ZTVector<value_type>& out) const {
+
+    out.set_vector_size(view_size);
+    value_type* z = out.data();
+    if (view_stride == 1)
+    {
+        ZTBlas<value_type>::kernels().add_scalar(view_size, view_data, scalar, z);
+        return;
+    }
+    for (std::size_t i = 0; i < view_size; ++i)
+    {
+        z[i] = view_data[i * view_stride] + scalar;
+    }
+
+}
+
+/**
+ * minus : performs view to scalar minus into a preallocated result
+ *
+ * @param  T& scalar
+ * @param  ZTVector<T>& out result
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTVectorView<T>::minus(const value_type& scalar, ZTVector<value_type>& out) const {
+
+    add(-scalar, out);
+
+}
+
+/**
+ * multiply : performs view to scalar multiplication into a preallocated result
+ *
+ * @param  T& scalar
+ * @param  ZTVector<T>& out result
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTVectorView<T>::multiply(const value_type& scalar, ZTVector<value_type>& out) const {
+
+    out.set_vector_size(view_size);
+    value_type* z = out.data();
+    if (view_stride == 1)
+    {
+        ZTBlas<value_type>::kernels().multiply_scalar(view_size, view_data, scalar, z);
+        return;
+    }
+    for (std::size_t i = 0; i < view_size; ++i)
+    {
+        z[i] = view_data[i * view_stride] * scalar;
+    }
+
+}
+
+/**
+ * cummulative_add : performs view to scalar cummulative addition in place
+ *
+ * @param  T& scalar
+ * @return *this (instance of ZTVectorView<T>)
+ *
+ */
+template <typename T>
+const ZTVectorView<T>& ZTVectorView<T>::cummulative_add(const value_type& scalar) const {
+
+    if (view_stride == 1)
+    {
+        ZTBlas<value_type>::kernels().add_scalar(view_size, view_data, scalar, view_data);
+        return *this;
+    }
+    for (std::size_t i = 0; i < view_size; ++i)
+    {
+        view_data[i * view_stride] += scalar;
+    }
+    return *this;
+
+}
+
+/**
+ * cummulative_minus : performs view to scalar cummulative minus in place
+ *
+ * @param  T& scalar
+ * @return *this (instance of ZTVectorView<T>)
+ *
+ */
+template <typename T>
+const ZTVectorView<T>& ZTVectorView<T>::cummulative_minus(const value_type& scalar) const {
+
+    return cummulative_add(-scalar);
+
+}
+
+/**
+ * cummulative_multiply : performs view to scalar cummulative multiplication in place
+ *
+ * @param  T& scalar
+ * @return *this (instance of ZTVectorView<T>)
+ *
+ */
+template <typename T>
+const ZTVectorView<T>& ZTVectorView<T>::cummulative_multiply(const value_type& scalar) const {
+
+    if (view_stride == 1)
+    {
+        ZTBlas<value_type>::kernels().multiply_scalar(view_size, view_data, scalar, view_data);
+        return *this;
+    }
+    for (std::size_t i = 0; i < view_size; ++i)
+    {
+        view_data[i * view_stride] *= scalar;
+    }
+    return *this;
+
+}
+
+/**
+ * add : performs view to view addition
+ *
+ * @param  ZTVectorView<const T> v
+ * @return ZTVector<T> result
+ *
+ */
+template <typename T>
+ZTVector<typename ZTVectorView<T>::value_type> ZTVectorView<T>::add(const ZTVectorView<const value_type>& v) const {
+
+    ZTVector<value_type> result((std::vector<value_type>()));
+    add(v, result);
+    return result;
+
+}
+
+/**
+ * minus : performs view to view minus
+ *
+ * @param  ZTVectorView<const T> v
+ * @return ZTVector<T> result
+ *
+ */
+template <typename T>
+ZTVector<typename ZTVectorView<T>::value_type> ZTVectorView<T>::minus(const ZTVectorView<const value_type>& v) const {
+
+    ZTVector<value_type> result((std::vector<value_type>()));
+    minus(v, result);
+    return result;
+
+}
+
+/**
+ * multiply : performs view to view multiplication (dot product)
+ *
+ * @param  ZTVectorView<const T> v
+ * @return T result
+ *
+ */
+template <typename T>
+inline typename ZTVectorView<T>::value_type ZTVectorView<T>::multiply(const ZTVectorView<const value_type>& v) const {
+
+    return ZTVectorView<T>::dot(v);
+
+}
+
+/**
+ * add : performs view to view addition into a preallocated result
+ *
+ * @param  ZTVectorView<const T> v
+ * @param  ZTVector<T>& out result
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTVectorView<T>::add(const ZTVectorView<const value_type>& v, ZTVector<value_type>& out) const {
+
+    ZT_VALIDATE(valid_vector_dimensions(v));
+    out.set_vector_size(view_size);
+    value_type* z = out.data();
+    if (view_stride == 1 && v.stride() == 1)
+    {
+        ZTBlas<value_type>::kernels().add(view_size, view_data, v.data(), z);
+        return;
+    }
+    for (std::size_t i = 0; i < view_size; ++i)
+    {
+        z[i] = view_data[i * view_stride] + v[i];
+    }
+
+}
+
+/**
+ * minus : performs view to view minus into a preallocated result
+ *
+ * @param  ZTVectorView<const T> v
+ * @param  ZTVector<T>& out result
+ * @return nothing
+ *
+ */
+template <typename T>
+void ZTVectorView<T>::minus(const ZTVectorView<const value_type>& v, ZTVector<value_type>& out) const {
+
+    ZT_VALIDATE(valid_vector_dimensions(v));
+    out.set_vector_size(view_size);
+    value_type* z = out.data();
+    if (view_stride == 1 && v.stride() == 1)
+    {
+        ZTBlas<value_type>::kernels().minus(view_size, view_data, v.data(), z);
+        return;
+    }
+    for (std::size_t i = 0; i < view_size; ++i)
+    {
+        z[i] = view_data[i * view_stride] - v[i];
+    }
+
+}
+
+/**
+ * cummulative_add : performs view to view cummulative addition in place
+ *
+ * @param  ZTVectorView<const T> v
+ * @return *this (instance of ZTVectorView<T>)
+ *
+ */
+template <typename T>
+const ZTVectorView<T>& ZTVectorView<T>::cummulative_add(const ZTVectorView<const value_type>& v) const {
+
+    ZT_VALIDATE(valid_vector_dimensions(v));
+    if ((v.data() != view_data || v.stride() != view_stride) && v.overlaps(view_data, view_size, view_stride))
+    {
+        return ZTVectorView<T>::cummulative_add(ZTVector<value_type>(v));
+    }
+    if (view_stride == 1 && v.stride() == 1)
+    {
+        ZTBlas<value_type>::kernels().add(view_size, view_data, v.data(), view_data);
+        return *this;
+    }
+    for (std::size_t i = 0; i < view_size; ++i)
+    {
+        view_data[i * view_stride] += v[i];
+    }
+    return *this;
+
+}
+
+/**
+ * cummulative_minus : performs view to view cummulative minus in place
+ *
+ * @param  ZTVectorView<const T> v
+ * @return *this (instance of ZTVectorView<T>)
+ *
+ */
+template <typename T>
+const ZTVectorView<T>& ZTVectorView<T>::cummulative_minus(const ZTVectorView<const value_type>& v) const {
+
+    ZT_VALIDATE(valid_vector_dimensions(v));
+    if ((v.data() != view_data || v.stride() != view_stride) && v.overlaps(view_data, view_size, view_stride))
+    {
+        return ZTVectorView<T>::cummulative_minus(ZTVector<value_type>(v));
+    }
+    if (view_stride == 1 && v.stride() == 1)
+    {
+        ZTBlas<value_type>::kernels().minus(view_size, view_data, v.data(), view_data);
+        return *this;
+    }
+    for (std::size_t i = 0; i < view_size; ++i)
+    {
+        view_data[i * view_stride] -= v[i];
+    }
+    return *this;
+
+}
+
+/**
+ * inline += operator : performs view to scalar cummulative addition
+ *
+ * @param  T& scalar
+ *
+ */
+template <typename T>
+inline const ZTVectorView<T>& ZTVectorView<T>::operator+=(const value_type& scalar) const {
+
+    return ZTVectorView<T>::cummulative_add(scalar);
+
+}
+
+/**
+ * inline -= operator : performs view to scalar cummulative minus
+ *
+ * @param  T& scalar
+ *
+ */
+template <typename T>
+inline const ZTVectorView<T>& ZTVectorView<T>::operator-=(const value_type& scalar) const {
+
+    return ZTVectorView<T>::cummulative_minus(scalar);
+
+}
+
+/**
+ * inline *= operator : performs view to scalar cummulative multiplication
+ *
+ * @param  T& scalar
+ *
+ */
+template <typename T>
+inline const ZTVectorView<T>& ZTVectorView<T>::operator*=(const value_type& scalar) const {
+
+    return ZTVectorView<T>::cummulative_multiply(scalar);
+
+}
+
+/**
+ * inline * operator : performs view to view multiplication (dot product)
+ *
+ * @param  ZTVectorView<const T> v
+ *
+ */
+template <typename T>
+inline typename ZTVectorView<T>::value_type ZTVectorView<T>::operator*(const ZTVectorView<const value_type>& v) const {
+
+    return ZTVectorView<T>::dot(v);
+
+}
+
+/**
+ * inline += operator : performs view to view cummulative addition
+ *
+ * @param  ZTVectorView<const T> v
+ *
+ */
+template <typename T>
+inline const ZTVectorView<T>& ZTVectorView<T>::operator+=(const ZTVectorView<const value_type>& v) const {
+
+    return ZTVectorView<T>::cummulative_add(v);
+
+}
+
+/**
+ * inline -= operator : performs view to view cummulative minus
+ *
+ * @param  ZTVectorView<const T> v
+ *
+ */
+template <typename T>
+inline const ZTVectorView<T>& ZTVectorView<T>::operator-=(const ZTVectorView<const value_type>& v) const {
+
+    return ZTVectorView<T>::cummulative_minus(v);
+
+}
+
+/**
+ * inline += operator : performs view to expression cummulative addition in a single pass
+ *
+ * @param  ZTVectorExpression<T, E> e
+ *
+ */
+template <typename T>
+template <typename E>
+inline const ZTVectorView<T>& ZTVectorView<T>::operator+=(const ZTVectorExpression<value_type, E>& e) const {
+
+    ZT_VALIDATE(zt_valid_expression_dimensions(view_size, 1, e.get_vector_size(), 1));
+    if (e.overlaps(view_data, view_stride))
+    {
+        return *this += ZTVector<value_type>(e);
+    }
+    for (std::size_t i = 0; i < view_size; ++i)
+    {
+        view_data[i * view_stride] += e[i];
+    }
+    return *this;
+
+}
+
+/**
+ * inline -= operator : performs view to expression cummulative minus in a single pass
+ *
+ * @param  ZTVectorExpression<T, E> e
+ *
+ */
+template <typename T>
+template <typename E>
+inline const ZTVectorView<T>& ZTVectorView<T>::operator-=(const ZTVectorExpression<value_type, E>& e) const {
+
+    ZT_VALIDATE(zt_valid_expression_dimensions(view_size, 1, e.get_vector_size(), 1));
+    if (e.overlaps(view_data, view_stride))
+    {
+        return *this -= ZTVector<value_type>(e);
+    }
+    for (std::size_t i = 0; i < view_size; ++i)
+    {
+        view_data[i * view_stride] -= e[i];
+    }
+    return *this;
+
+}
+
+/**
+ * assign : copies the elements of v into the elements of the view
+ *
+ * @param  ZTVectorView<const T> v
+ * @return *this (instance of ZTVectorView<T>)
+ *
+ */
+template <typename T>
+const ZTVectorView<T>& ZTVectorView<T>::assign(const ZTVectorView<const value_type>& v) const {
+
+    ZT_VALIDATE(valid_vector_dimensions(v));
+    if (view_data == v.data() && view_stride == v.stride())
+    {
+        return *this;
+    }
+    if (v.overlaps(view_data, view_size, view_stride))
+    {
+        return ZTVectorView<T>::assign(ZTVector<value_type>(v));
+    }
+    for (std::size_t i = 0; i < view_size; ++i)
+    {
+        view_data[i * view_stride] = v[i];
+    }
+    return *this;
+
+}
+
+/**
+ * assignment operator : copies the elements of v into the elements of the view
+ *
+ * @param  ZTVectorView<T> v
+ * @return *this (instance of ZTVectorView<T>)
+ *
+ */
+template <typename T>
+inline const ZTVectorView<T>& ZTVectorView<T>::operator=(const ZTVectorView<T>& v) const {
+
+    return ZTVectorView<T>::assign(v);
+
+}
+
+/**
+ * assignment operator : copies the elements of v into the elements of the view
+ *
+ * @param  ZTVector<T> v
+ * @return *this (instance of ZTVectorView<T>)
+ *
+ */
+template <typename T>
+inline const ZTVectorView<T>& ZTVectorView<T>::operator=(const ZTVector<value_type>& v) const {
+
+    return ZTVectorView<T>::assign(v);
+
+}
+
+/**
+ * assignment operator : evaluates the expression into the elements of the view
+ *                       in a single pass. Views of the same elements may appear
+ *                       in the expression; when operands overlap them shifted,
+ *                       the expression is evaluated into a temporary first
+ *
+ * @param  ZTVectorExpression<T, E> e
+ * @return *this (instance of ZTVectorView<T>)
+ *
+ */
+template <typename T>
+template <typename E>
+const ZTVectorView<T>& ZTVectorView<T>::operator=(const ZTVectorExpression<value_type, E>& e) const {
+
+    ZT_VALIDATE(zt_valid_expression_dimensions(view_size, 1, e.get_vector_size(), 1));
+    if (e.overlaps(view_data, view_stride))
+    {
+        return ZTVectorView<T>::assign(ZTVector<value_type>(e));
+    }
+    for (std::size_t i = 0; i < view_size; ++i)
+    {
+        view_data[i * view_stride] = e[i];
+    }
+    return *this;
+
+}
+
+/**
+ * accumulate : view to view dot product kept in the accumulator type, so
+ *              that 16-bit storage types are summed in float
+ *
+ * @param  ZTVectorView<const T> v
+ * @return accumulator type result
+ *
+ */
+template <typename T>
+typename ZTAccumulator<typename std::remove_const<T>::type>::type ZTVectorView<T>::accumulate(const ZTVectorView<const value_type>& v) const {
+
+    typedef typename ZTAccumulator<value_type>::type accumulator_type;
+    if (view_stride == 1 && v.stride() == 1)
+    {
+        return ZTBlas<value_type>::kernels().dot(view_size, view_data, v.data());
+    }
+    accumulator_type result = 0;
+    for (std::size_t i = 0; i < view_size; ++i)
+    {
+        result += accumulator_type(view_data[i * view_stride]) * accumulator_type(v[i]);
+    }
+    return result;
+
+}
+
+/**
+ * dot : performs view to view dot product
+ *
+ * @param  ZTVectorView<const T> v
+ * @return T result
+ *
+ */
+template <typename T>
+typename ZTVectorView<T>::value_type ZTVectorView<T>::dot(const ZTVectorView<const value_type>& v) const {
+
+    ZT_VALIDATE(valid_vector_dimensions(v));
+    return ZTVectorView<T>::accumulate(v);
+
+}
+
+/**
+ * norm : performs view norm operation
+ *
+ * @param  nothing
+ * @return T result
+ *
+ */
+template <typename T>
+typename ZTVectorView<T>::value_type ZTVectorView<T>::norm() const {
+
+    return std::sqrt(ZTVectorView<T>::accumulate(*this));
+
+}
+
+/**
+ * norm : performs view to view norm operation
+ *
+ * @param  ZTVectorView<const T> v
+ * @return T result
+ *
+ */
+template <typename T>
+typename ZTVectorView<T>::value_type ZTVectorView<T>::norm(const ZTVectorView<const value_type>& v) const {
+
+    ZT_VALIDATE(valid_vector_dimensions(v));
+    return std::sqrt(ZTVectorView<T>::accumulate(v));
+
+}
+
+/**
+ * overlaps : whether the elements of the view may share memory with another
+ *            size elements stride apart, judged from the address ranges
+ *            they span
+ *
+ * @param  void* p first element of the other elements
+ * @param  std::size_t size, stride shape of the other elements
+ * @return bool overlap
+ *
+ */
+template <typename T>
+bool ZTVectorView<T>::overlaps(const void* p, std::size_t size, std::size_t stride) const {
+
+    if (size == 0 || view_size == 0)
+    {
+        return false;
+    }
+    const value_type* first = static_cast<const value_type*>(p);
+    const value_type* last = first + (size - 1) * stride;
+    const value_type* view_first = view_data;
+    const value_type* view_last = view_data + (view_size - 1) * view_stride;
+    std::less_equal<const value_type*> before;
+    return before(first, view_last) && before(view_first, last);
+
+}
+
+/**
+ * valid_vector_dimensions : checks for valid vector dimensions
+ *
+ * @param  ZTVectorView<const T> v
+ * @return void
+ *
+ */
+template <typename T>
+void ZTVectorView<T>::valid_vector_dimensions(const ZTVectorView<const value_type>& v) const {
+
+    if (view_size != v.size())
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "vector sizes " << view_size << " and " << v.size() << " do not match!.";
+        zt_raise<std::invalid_argument>(invalid_dimensions.str());
+    }
+
+}
+
+/**
+ * valid_vector_index : checks for a valid zero-based view index
+ *
+ * @param  std::size_t i zero-based index
+ * @return void
+ *
+ */
+template <typename T>
+inline void ZTVectorView<T>::valid_vector_index(std::size_t i) const {
+
+    if (i >= view_size)
+    {
+        std::ostringstream invalid_dimensions;
+        invalid_dimensions << "vector index " << i << " out of range for size " << view_size << "!.";
+        zt_raise<std::out_of_range>(invalid_dimensions.str());
+    }
+
+}
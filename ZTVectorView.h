@@ -0,0 +1,135 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ZTVECTORVIEW_H
+#define ZTVECTORVIEW_H
+
+#include <vector>
+#include <type_traits>
+
+#include "ZTHalf.h"
+#include "ZTVector.h"
+
+template <typename T, typename E>
+class ZTVectorExpression;
+
+/*
+ * ZTVectorView : non-owning view of size elements that are stride elements
+ *                apart, over a ZTVector, a std::vector, a row or column of a
+ *                matrix, or any caller-owned buffer. ZTVectorView<const T> is
+ *                read-only.
+ *
+ *                Copying a view copies the reference, assigning to a view
+ *                copies the elements, which must outlive the view.
+ */
+template <typename T>
+class ZTVectorView {
+
+private:
+    T* view_data;
+    std::size_t view_size;
+    std::size_t view_stride;
+
+    typename ZTAccumulator<typename std::remove_const<T>::type>::type accumulate(const ZTVectorView<const typename std::remove_const<T>::type>& v) const;
+    bool overlaps(const void* p, std::size_t size, std::size_t stride) const;
+
+    template <typename U>
+    friend class ZTVectorView;
+
+public:
+    typedef typename std::remove_const<T>::type value_type;
+
+    ZTVectorView(T* data, std::size_t size, std::size_t stride = 1, std::size_t offset = 0);
+    ZTVectorView(ZTVector<value_type>& v);
+    ZTVectorView(const ZTVector<value_type>& v);
+    ZTVectorView(std::vector<value_type>& v);
+    ZTVectorView(const std::vector<value_type>& v);
+    ZTVectorView(const ZTVectorView<T>& cp) = default;
+    template <typename U, typename = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+    ZTVectorView(const ZTVectorView<U>& cp);
+
+    T* data() const;
+    std::size_t size() const;
+    std::size_t stride() const;
+    std::size_t get_vector_size() const;
+
+    T& operator [](std::size_t i) const;     // zero-based, unchecked
+    T& at(std::size_t i) const;              // zero-based, always checked
+    T& unsafe_get(std::size_t i) const;
+
+    ZTVectorView<T> slice(std::size_t offset, std::size_t size, std::size_t stride = 1) const;
+
+    ZTVector<value_type> add(const value_type& scalar) const;
+    ZTVector<value_type> minus(const value_type& scalar) const;
+    ZTVector<value_type> multiply(const value_type& scalar) const;
+
+    void add(const value_type& scalar, ZTVector<value_type>& out) const;
+    void minus(const value_type& scalar, ZTVector<value_type>& out) const;
+    void multiply(const value_type& scalar, ZTVector<value_type>& out) const;
+
+    const ZTVectorView<T>& cummulative_add(const value_type& scalar) const;
+    const ZTVectorView<T>& cummulative_minus(const value_type& scalar) const;
+    const ZTVectorView<T>& cummulative_multiply(const value_type& scalar) const;
+
+    ZTVector<value_type> add(const ZTVectorView<const value_type>& v) const;
+    ZTVector<value_type> minus(const ZTVectorView<const value_type>& v) const;
+    value_type multiply(const ZTVectorView<const value_type>& v) const;
+
+    void add(const ZTVectorView<const value_type>& v, ZTVector<value_type>& out) const;
+    void minus(const ZTVectorView<const value_type>& v, ZTVector<value_type>& out) const;
+
+    const ZTVectorView<T>& cummulative_add(const ZTVectorView<const value_type>& v) const;
+    const ZTVectorView<T>& cummulative_minus(const ZTVectorView<const value_type>& v) const;
+
+    const ZTVectorView<T>& operator +=(const value_type& scalar) const;
+    const ZTVectorView<T>& operator -=(const value_type& scalar) const;
+    const ZTVectorView<T>& operator *=(const value_type& scalar) const;
+
+    value_type operator *(const ZTVectorView<const value_type>& v) const;
+
+    const ZTVectorView<T>& operator +=(const ZTVectorView<const value_type>& v) const;
+    const ZTVectorView<T>& operator -=(const ZTVectorView<const value_type>& v) const;
+
+    template <typename E>
+    const ZTVectorView<T>& operator +=(const ZTVectorExpression<value_type, E>& e) const;
+    template <typename E>
+    const ZTVectorView<T>& operator -=(const ZTVectorExpression<value_type, E>& e) const;
+
+    const ZTVectorView<T>& assign(const ZTVectorView<const value_type>& v) const; // copies the elements
+    const ZTVectorView<T>& operator =(const ZTVectorView<T>& v) const;
+    const ZTVectorView<T>& operator =(const ZTVector<value_type>& v) const;
+    template <typename E>
+    const ZTVectorView<T>& operator =(const ZTVectorExpression<value_type, E>& e) const;
+
+    value_type dot(const ZTVectorView<const value_type>& v) const; // dot product
+
+    value_type norm() const;
+    value_type norm(const ZTVectorView<const value_type>& v) const;
+
+    void valid_vector_dimensions(const ZTVectorView<const value_type>& v) const;
+    void valid_vector_index(std::size_t i) const;
+
+};
+
+#endif /* ZTVECTORVIEW_H */
@@ -0,0 +1,416 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <new>
+#include <atomic>
+#include <limits>
+#include <thread>
+#include <cstddef>
+
+#include "ZTWorkspace.h"
+
+/**
+ * Constructor : Constructs an empty workspace and makes it the active one on
+ *               the calling thread until it is destroyed
+ *
+ * @param  std::size_t chunk_bytes size of the chunks blocks are carved from
+ * @return nothing
+ *
+ */
+ZTWorkspace::ZTWorkspace(std::size_t chunk_bytes) :
+                                                arena(create_arena(chunk_bytes)),
+                                                previous(active_arena()) {
+
+    active_arena() = arena;
+
+}
+
+/**
+ * Destructor : restores the previously active workspace and releases every
+ *              chunk at once, unless blocks are still alive elsewhere
+ *
+ * @param  nothing
+ * @return nothing
+ *
+ */
+ZTWorkspace::~ZTWorkspace() {
+
+    active_arena() = previous;
+    release_arena(arena);
+
+}
+
+/**
+ * Getter : bytes of chunk storage held by the workspace
+ *
+ * @param  nothing
+ * @return std::size_t reserved_bytes
+ *
+ */
+std::size_t ZTWorkspace::get_reserved_bytes() const {
+
+    return arena->reserved_bytes;
+
+}
+
+/**
+ * Getter : number of blocks handed out and not yet freed
+ *
+ * @param  nothing
+ * @return std::size_t live blocks
+ *
+ */
+std::size_t ZTWorkspace::get_live_blocks() const {
+
+    return arena->references.load(std::memory_order_relaxed) - 1;
+
+}
+
+/**
+ * active_arena : the arena allocations of the calling thread are drawn from,
+ *                nullptr when they go to the heap
+ *
+ * @param  nothing
+ * @return ZTArena*& arena of the calling thread
+ *
+ */
+ZTWorkspace::ZTArena*& ZTWorkspace::active_arena() {
+
+    static thread_local ZTArena* active = nullptr;
+    return active;
+
+}
+
+/**
+ * create_arena : allocates the bookkeeping of an arena owned by the calling
+ *                thread, chunks are added on demand
+ *
+ * @param  std::size_t chunk_bytes size of the chunks
+ * @return ZTArena* arena holding one reference for its creator
+ *
+ */
+ZTWorkspace::ZTArena* ZTWorkspace::create_arena(std::size_t chunk_bytes) {
+
+    ZTArena* a = new ZTArena;
+    a->owner = std::this_thread::get_id();
+    a->chunk_bytes = chunk_bytes < 4 * alignment ? 4 * alignment : chunk_bytes;
+    a->reserved_bytes = 0;
+    a->cursor = nullptr;
+    a->limit = nullptr;
+    a->chunks = nullptr;
+    for (std::size_t i = 0; i < num_size_classes; ++i)
+    {
+        a->free_lists[i] = nullptr;
+    }
+    a->remote_frees.store(nullptr, std::memory_order_relaxed);
+    a->references.store(1, std::memory_order_relaxed);
+    return a;
+
+}
+
+/**
+ * release_arena : drops one reference, the last one frees every chunk in a
+ *                 single walk over the chunk list
+ *
+ * @param  ZTArena* a
+ * @return nothing
+ *
+ */
+void ZTWorkspace::release_arena(ZTArena* a) noexcept {
+
+    if (a->references.fetch_sub(1, std::memory_order_acq_rel) != 1)
+    {
+        return;
+    }
+    void* chunk = a->chunks;
+    while (chunk != nullptr)
+    {
+        void* next = *static_cast<void**>(chunk);
+        ::operator delete(chunk, std::align_val_t(alignment));
+        chunk = next;
+    }
+    delete a;
+
+}
+
+/**
+ * add_chunk : takes a new chunk from the heap and links it into the arena
+ *
+ * @param  ZTArena* a
+ * @param  std::size_t bytes usable bytes after the link
+ * @return void* first usable byte, 64-byte aligned
+ *
+ */
+void* ZTWorkspace::add_chunk(ZTArena* a, std::size_t bytes) {
+
+    char* chunk = static_cast<char*>(::operator new(bytes + alignment, std::align_val_t(alignment)));
+    *reinterpret_cast<void**>(chunk) = a->chunks;
+    a->chunks = chunk;
+    a->reserved_bytes += bytes + alignment;
+    return chunk + alignment;
+
+}
+
+/**
+ * carve : cuts a fresh block of the given class from the current chunk, large
+ *         blocks get a chunk of their own
+ *
+ * @param  ZTArena* a
+ * @param  std::size_t size_class
+ * @return ZTBlockHeader* block
+ *
+ */
+ZTWorkspace::ZTBlockHeader* ZTWorkspace::carve(ZTArena* a, std::size_t size_class) {
+
+    const std::size_t bytes = class_bytes(size_class);
+    void* block;
+    if (bytes > a->chunk_bytes / 2)
+    {
+        block = add_chunk(a, bytes);
+    }
+    else
+    {
+        if (a->cursor == nullptr || static_cast<std::size_t>(a->limit - a->cursor) < bytes)
+        {
+            a->cursor = static_cast<char*>(add_chunk(a, a->chunk_bytes - alignment));
+            a->limit = a->cursor + (a->chunk_bytes - alignment);
+        }
+        block = a->cursor;
+        a->cursor += bytes;
+    }
+    ZTBlockHeader* header = static_cast<ZTBlockHeader*>(block);
+    header->arena = a;
+    header->size_class = size_class;
+    return header;
+
+}
+
+/**
+ * size_class : class of a block of the given size. Up to 256 bytes classes are
+ *              64 bytes apart, above that every power of two is split in four
+ *              classes, so a block wastes at most a quarter of its size
+ *
+ * @param  std::size_t bytes block size including its header
+ * @return std::size_t size_class
+ *
+ */
+std::size_t ZTWorkspace::size_class(std::size_t bytes) {
+
+    if (bytes <= 4 * alignment)
+    {
+        return (bytes + alignment - 1) / alignment - 1;
+    }
+    std::size_t lg = 0;
+    for (std::size_t v = bytes - 1; v > 1; v >>= 1)
+    {
+        ++lg;
+    }
+    const std::size_t step = std::size_t(1) << (lg - 2);
+    const std::size_t mult = (bytes + step - 1) / step;
+    return 4 + (lg - 8) * 4 + (mult - 5);
+
+}
+
+/**
+ * class_bytes : size of the blocks of a class
+ *
+ * @param  std::size_t size_class
+ * @return std::size_t bytes
+ *
+ */
+std::size_t ZTWorkspace::class_bytes(std::size_t size_class) {
+
+    if (size_class < 4)
+    {
+        return (size_class + 1) * alignment;
+    }
+    const std::size_t lg = 8 + (size_class - 4) / 4;
+    return (5 + (size_class - 4) % 4) * (std::size_t(1) << (lg - 2));
+
+}
+
+/**
+ * allocate : returns 64-byte aligned storage for the given number of bytes,
+ *            recycled or carved from the active arena of the calling thread,
+ *            or taken from the heap when no workspace is active
+ *
+ * @param  std::size_t bytes
+ * @return void* storage
+ *
+ */
+void* ZTWorkspace::allocate(std::size_t bytes) {
+
+    if (bytes > std::numeric_limits<std::size_t>::max() / 4)
+    {
+        throw std::bad_alloc();
+    }
+    ZTArena* a = active_arena();
+    ZTBlockHeader* header;
+    if (a == nullptr)
+    {
+        header = static_cast<ZTBlockHeader*>(::operator new(bytes + alignment, std::align_val_t(alignment)));
+        header->arena = nullptr;
+        header->size_class = 0;
+        return header + 1;
+    }
+    const std::size_t c = size_class(bytes + alignment);
+    header = a->free_lists[c];
+    if (header == nullptr && a->remote_frees.load(std::memory_order_relaxed) != nullptr)
+    {
+        ZTBlockHeader* remote = a->remote_frees.exchange(nullptr, std::memory_order_acquire);
+        while (remote != nullptr)
+        {
+            ZTBlockHeader* next = remote->next;
+            remote->next = a->free_lists[remote->size_class];
+            a->free_lists[remote->size_class] = remote;
+            remote = next;
+        }
+        header = a->free_lists[c];
+    }
+    if (header != nullptr)
+    {
+        a->free_lists[c] = header->next;
+    }
+    else
+    {
+        header = carve(a, c);
+    }
+    a->references.fetch_add(1, std::memory_order_relaxed);
+    return header + 1;
+
+}
+
+/**
+ * deallocate : returns storage obtained from allocate to the free list of its
+ *              arena, or to the heap. Blocks freed by a thread other than the
+ *              owner of the arena are handed over through a lock-free list
+ *
+ * @param  void* p storage returned by allocate
+ * @return nothing
+ *
+ */
+void ZTWorkspace::deallocate(void* p) noexcept {
+
+    if (p == nullptr)
+    {
+        return;
+    }
+    ZTBlockHeader* header = static_cast<ZTBlockHeader*>(p) - 1;
+    ZTArena* a = header->arena;
+    if (a == nullptr)
+    {
+        ::operator delete(header, std::align_val_t(alignment));
+        return;
+    }
+    if (a->owner == std::this_thread::get_id())
+    {
+        header->next = a->free_lists[header->size_class];
+        a->free_lists[header->size_class] = header;
+    }
+    else
+    {
+        header->next = a->remote_frees.load(std::memory_order_relaxed);
+        while (!a->remote_frees.compare_exchange_weak(header->next, header,
+                                                      std::memory_order_release,
+                                                      std::memory_order_relaxed))
+        {
+        }
+    }
+    release_arena(a);
+
+}
+
+/**
+ * Constructor : makes the calling thread's persistent arena the active one
+ *               until it is destroyed
+ *
+ * @param  nothing
+ * @return nothing
+ *
+ */
+ZTLocalWorkspace::ZTLocalWorkspace() : previous(ZTWorkspace::active_arena()) {
+
+    ZTWorkspace::active_arena() = thread_arena();
+
+}
+
+/**
+ * Destructor : restores the previously active workspace, the blocks freed in
+ *              the scope stay in the thread's arena for the next one
+ *
+ * @param  nothing
+ * @return nothing
+ *
+ */
+ZTLocalWorkspace::~ZTLocalWorkspace() {
+
+    ZTWorkspace::active_arena() = previous;
+
+}
+
+/**
+ * thread_arena : the arena of the calling thread, created on first use and
+ *                released when the thread exits
+ *
+ * @param  nothing
+ * @return ZTArena* arena
+ *
+ */
+ZTWorkspace::ZTArena* ZTLocalWorkspace::thread_arena() {
+
+    struct ZTThreadArena {
+        ZTWorkspace::ZTArena* arena;
+        ~ZTThreadArena() { ZTWorkspace::release_arena(arena); }
+    };
+    static thread_local ZTThreadArena local = { ZTWorkspace::create_arena(ZTWorkspace::default_chunk_bytes) };
+    return local.arena;
+
+}
+
+/**
+ * Constructor : sends the allocations of the calling thread to the heap until
+ *               it is destroyed
+ *
+ * @param  nothing
+ * @return nothing
+ *
+ */
+ZTHeapScope::ZTHeapScope() : previous(ZTWorkspace::active_arena()) {
+
+    ZTWorkspace::active_arena() = nullptr;
+
+}
+
+/**
+ * Destructor : restores the previously active workspace
+ *
+ * @param  nothing
+ * @return nothing
+ *
+ */
+ZTHeapScope::~ZTHeapScope() {
+
+    ZTWorkspace::active_arena() = previous;
+
+}
@@ -0,0 +1,140 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ZTWORKSPACE_H
+#define ZTWORKSPACE_H
+
+#include <atomic>
+#include <thread>
+#include <cstddef>
+
+/*
+ * ZTWorkspace : scoped arena for matrix and vector storage. While a workspace
+ *               is alive, every ZTAlignedAllocator allocation made on the
+ *               thread that created it (so every ZTMatrix/ZTVector buffer) is
+ *               carved from large chunks owned by the workspace instead of the
+ *               heap. Freed blocks go back to per size-class free lists and are
+ *               recycled by the next allocation of the same class, and the
+ *               chunks are released together when the workspace goes out of
+ *               scope. Workspaces nest, the innermost one is used.
+ *
+ *               Every block records its owner, so any thread may free it, and
+ *               a block that outlives its workspace keeps the chunks alive
+ *               until it is freed itself.
+ *
+ * ZTLocalWorkspace : activates the calling thread's own persistent arena for
+ *                    its scope. The arena lives as long as the thread, so the
+ *                    blocks recycled in one scope serve the next one, e.g. for
+ *                    tasks run repeatedly by the same pool worker, without any
+ *                    shared heap lock.
+ *
+ * ZTHeapScope : suspends the active workspace for its scope, for storage that
+ *               is meant to outlive it.
+ */
+class ZTWorkspace {
+
+private:
+    struct ZTArena;
+
+    struct alignas(64) ZTBlockHeader {
+        ZTArena* arena;            // nullptr : block taken from the heap
+        std::size_t size_class;
+        ZTBlockHeader* next;       // free-list link while the block is free
+    };
+
+    static constexpr std::size_t num_size_classes = 228;
+
+    struct ZTArena {
+        std::thread::id owner;
+        std::size_t chunk_bytes;
+        std::size_t reserved_bytes;
+        char* cursor;              // bump region of the current chunk
+        char* limit;
+        void* chunks;              // every chunk, linked through its first bytes
+        ZTBlockHeader* free_lists[num_size_classes];
+        std::atomic<ZTBlockHeader*> remote_frees;  // blocks freed by other threads
+        std::atomic<std::size_t> references;       // live blocks, plus one while in use
+    };
+
+    ZTArena* arena;
+    ZTArena* previous;
+
+    static ZTArena*& active_arena();
+    static ZTArena* create_arena(std::size_t chunk_bytes);
+    static void release_arena(ZTArena* a) noexcept;
+    static ZTBlockHeader* carve(ZTArena* a, std::size_t size_class);
+    static void* add_chunk(ZTArena* a, std::size_t bytes);
+
+    static std::size_t size_class(std::size_t bytes);
+    static std::size_t class_bytes(std::size_t size_class);
+
+    friend class ZTLocalWorkspace;
+    friend class ZTHeapScope;
+
+public:
+    static constexpr std::size_t alignment = 64;
+    static constexpr std::size_t default_chunk_bytes = std::size_t(1) << 20;
+
+    explicit ZTWorkspace(std::size_t chunk_bytes = default_chunk_bytes);
+    ZTWorkspace(const ZTWorkspace&) = delete;
+    ZTWorkspace& operator =(const ZTWorkspace&) = delete;
+    virtual ~ZTWorkspace();
+
+    std::size_t get_reserved_bytes() const;
+    std::size_t get_live_blocks() const;
+
+    static void* allocate(std::size_t bytes);  // 64-byte aligned, from the active arena or the heap
+    static void deallocate(void* p) noexcept;
+
+};
+
+class ZTLocalWorkspace {
+
+private:
+    ZTWorkspace::ZTArena* previous;
+
+    static ZTWorkspace::ZTArena* thread_arena();
+
+public:
+    ZTLocalWorkspace();
+    ZTLocalWorkspace(const ZTLocalWorkspace&) = delete;
+    ZTLocalWorkspace& operator =(const ZTLocalWorkspace&) = delete;
+    virtual ~ZTLocalWorkspace();
+
+};
+
+class ZTHeapScope {
+
+private:
+    ZTWorkspace::ZTArena* previous;
+
+public:
+    ZTHeapScope();
+    ZTHeapScope(const ZTHeapScope&) = delete;
+    ZTHeapScope& operator =(const ZTHeapScope&) = delete;
+    virtual ~ZTHeapScope();
+
+};
+
+#endif /* ZTWORKSPACE_H */
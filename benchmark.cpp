@@ -0,0 +1,396 @@
+/*
+ * The MIT License
+ *
+ * Copyright 2018 jefkine.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "ZTError.cpp"
+#include "ZTWorkspace.cpp"
+#include "ZTAlignedAllocator.cpp"
+#include "ZTCpu.cpp"
+#include "ZTHalf.cpp"
+#include "ZTThreadPool.cpp"
+#include "ZTBlas.cpp"
+#include "ZTVector.cpp"
+#include "ZTGemm.cpp"
+#include "ZTGemv.cpp"
+#include "ZTMatrix.cpp"
+#include "ZTVectorView.cpp"
+#include "ZTMatrixView.cpp"
+#include "ZTFixedVector.cpp"
+#include "ZTFixedMatrix.cpp"
+#include "ZTExpression.cpp"
+#include "ZTLU.cpp"
+#include "ZTCholesky.cpp"
+#include "ZTQR.cpp"
+#include "ZTSymmetricEigen.cpp"
+#include "ZTSVD.cpp"
+#include "ZTSparseMatrix.cpp"
+#include "ZTPreconditioner.cpp"
+#include "ZTKrylov.cpp"
+#include "ZTStructuredMatrix.cpp"
+#include "ZTBatch.cpp"
+#include "ZTQuantized.cpp"
+#include "ZTMatrixFile.cpp"
+#include "ZTTiledMatrix.cpp"
+#include "ZTMatrixMarket.cpp"
+#include "ZTNpy.cpp"
+#include "ZTBenchmark.cpp"
+
+#include <memory>
+#include <cstdlib>
+#include <iostream>
+
+/*
+ * benchmark : sweeps the ZTVector and ZTMatrix operations over element
+ *             counts from 3 up to --max-size, float and double, at every
+ *             thread count given, and reports time, GFLOP/s and GB/s
+ *             against a STREAM triad measured at the same thread count.
+ *             Matrices are square with about as many elements as the
+ *             vectors. Cases whose operands exceed --max-memory bytes or
+ *             whose iteration exceeds --max-flops are skipped.
+ *
+ *             --json=FILE      writes the results as JSON
+ *             --baseline=FILE  compares against a stored JSON run and exits
+ *                              with 1 when a case is slower than the
+ *                              baseline by more than --tolerance
+ *             --input=FILE     compares a stored run instead of running
+ *
+ *             g++ -std=c++17 -O3 -march=native -pthread benchmark.cpp -o benchmark
+ *             ./benchmark --max-size=1000000 --threads=1,4 --json=current.json
+ *             ./benchmark --input=current.json --baseline=baseline.json --tolerance=0.05
+ */
+
+struct ZTBenchmarkOptions {
+    std::size_t max_size = 100000000;
+    double max_flops = 2e10;
+    double max_memory = 4.0 * 1024 * 1024 * 1024;
+    double min_time = 0.05;
+    std::size_t repetitions = 3;
+    std::size_t stream_size = std::size_t(1) << 25;
+    std::vector<std::size_t> threads;
+    std::string types = "float,double";
+    std::string filter;
+    std::string json;
+    std::string baseline;
+    std::string input;
+    double tolerance = 0.1;
+};
+
+/**
+ * zt_benchmark_case : registers a case whose operands live in a state S
+ *                     created by make before timing and freed after it
+ *
+ * @param  ZTBenchmark bench
+ * @param  std::string operation
+ * @param  std::string type
+ * @param  std::size_t elements
+ * @param  double flops per iteration
+ * @param  double bytes per iteration
+ * @param  std::function make creates the state
+ * @param  F body one iteration on the state
+ * @return nothing
+ *
+ */
+template <typename S, typename F>
+void zt_benchmark_case(ZTBenchmark& bench, const std::string& operation, const std::string& type, std::size_t elements,
+                       double flops, double bytes, const std::function<S*()>& make, F body) {
+
+    std::shared_ptr<std::unique_ptr<S> > state = std::make_shared<std::unique_ptr<S> >();
+    bench.add(operation, type, elements, flops, bytes,
+              [state, make] { state->reset(make()); },
+              [state, body] { body(**state); },
+              [state] { state->reset(); });
+
+}
+
+/**
+ * zt_benchmark_data : n deterministic values that keep sums and products
+ *                     of every size finite and away from denormals
+ *
+ * @param  std::size_t n
+ * @return std::vector<T>
+ *
+ */
+template <typename T>
+std::vector<T> zt_benchmark_data(std::size_t n) {
+
+    std::vector<T> v(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        v[i] = T(1) + T(i % 7) / T(8);
+    }
+    return v;
+
+}
+
+template <typename T>
+struct ZTVectorOperands {
+    ZTVector<T> x;
+    std::vector<T> y;
+    ZTVector<T> out;
+    explicit ZTVectorOperands(std::size_t n) : x(zt_benchmark_data<T>(n)), y(zt_benchmark_data<T>(n)), out(x) {}
+};
+
+template <typename T>
+struct ZTMatrixOperands {
+    ZTMatrix<T> a;
+    ZTMatrix<T> b;
+    ZTMatrix<T> out;
+    ZTVector<T> v;
+    ZTVector<T> w;
+    explicit ZTMatrixOperands(std::size_t n) : a(n, n, T(1)), b(n, n, T(0.5)), out(n, n, T(0)),
+                                               v(zt_benchmark_data<T>(n)), w(zt_benchmark_data<T>(n)) {}
+};
+
+/**
+ * zt_benchmark_register : registers every vector and matrix operation of T
+ *                         at every size the options allow
+ *
+ * @param  ZTBenchmark bench
+ * @param  std::string type name of T
+ * @param  ZTBenchmarkOptions options
+ * @return nothing
+ *
+ */
+template <typename T>
+void zt_benchmark_register(ZTBenchmark& bench, const std::string& type, const ZTBenchmarkOptions& options) {
+
+    std::vector<std::size_t> sizes = { 3 };
+    for (std::size_t size = 10; size <= options.max_size; size *= 10)
+    {
+        sizes.push_back(size);
+    }
+    const double s = double(sizeof(T));
+    const T scalar = T(1.5);
+    for (std::size_t n : sizes)
+    {
+        if (n > options.max_size || 3.0 * double(n) * s > options.max_memory)
+        {
+            continue;
+        }
+        const double e = double(n);
+        const std::function<ZTVectorOperands<T>*()> vectors = [n] { return new ZTVectorOperands<T>(n); };
+        typedef ZTVectorOperands<T> V;
+        zt_benchmark_case<V>(bench, "vector_add_scalar", type, n, e, 2 * e * s, vectors, [scalar](V& o) { o.x.add(scalar, o.out); zt_benchmark_keep(o.out[0]); });
+        zt_benchmark_case<V>(bench, "vector_minus_scalar", type, n, e, 2 * e * s, vectors, [scalar](V& o) { o.x.minus(scalar, o.out); zt_benchmark_keep(o.out[0]); });
+        zt_benchmark_case<V>(bench, "vector_multiply_scalar", type, n, e, 2 * e * s, vectors, [scalar](V& o) { o.x.multiply(scalar, o.out); zt_benchmark_keep(o.out[0]); });
+        zt_benchmark_case<V>(bench, "vector_add", type, n, e, 3 * e * s, vectors, [](V& o) { o.x.add(o.y, o.out); zt_benchmark_keep(o.out[0]); });
+        zt_benchmark_case<V>(bench, "vector_minus", type, n, e, 3 * e * s, vectors, [](V& o) { o.x.minus(o.y, o.out); zt_benchmark_keep(o.out[0]); });
+        zt_benchmark_case<V>(bench, "vector_dot", type, n, 2 * e, 2 * e * s, vectors, [](V& o) { zt_benchmark_keep(o.x.dot(o.y)); });
+        zt_benchmark_case<V>(bench, "vector_norm", type, n, 2 * e, e * s, vectors, [](V& o) { zt_benchmark_keep(o.x.norm()); });
+    }
+    for (std::size_t size : sizes)
+    {
+        std::size_t n = 1;
+        while (n * n < size)
+        {
+            ++n;
+        }
+        const double d = double(n), e = d * d;
+        if (3.0 * e * s > options.max_memory)
+        {
+            continue;
+        }
+        const std::function<ZTMatrixOperands<T>*()> matrices = [n] { return new ZTMatrixOperands<T>(n); };
+        typedef ZTMatrixOperands<T> M;
+        const std::size_t elements = n * n;
+        zt_benchmark_case<M>(bench, "matrix_add_scalar", type, elements, e, 2 * e * s, matrices, [scalar](M& o) { o.a.add(scalar, o.out); zt_benchmark_keep(o.out[0][0]); });
+        zt_benchmark_case<M>(bench, "matrix_minus_scalar", type, elements, e, 2 * e * s, matrices, [scalar](M& o) { o.a.minus(scalar, o.out); zt_benchmark_keep(o.out[0][0]); });
+        zt_benchmark_case<M>(bench, "matrix_multiply_scalar", type, elements, e, 2 * e * s, matrices, [scalar](M& o) { o.a.multiply(scalar, o.out); zt_benchmark_keep(o.out[0][0]); });
+        zt_benchmark_case<M>(bench, "matrix_add", type, elements, e, 3 * e * s, matrices, [](M& o) { o.a.add(o.b, o.out); zt_benchmark_keep(o.out[0][0]); });
+        zt_benchmark_case<M>(bench, "matrix_minus", type, elements, e, 3 * e * s, matrices, [](M& o) { o.a.minus(o.b, o.out); zt_benchmark_keep(o.out[0][0]); });
+        if (2.0 * e * d <= options.max_flops)
+        {
+            zt_benchmark_case<M>(bench, "matrix_multiply", type, elements, 2 * e * d, 3 * e * s, matrices, [](M& o) { o.a.matmul(o.b, o.out); zt_benchmark_keep(o.out[0][0]); });
+        }
+        zt_benchmark_case<M>(bench, "matrix_matvec", type, elements, 2 * e, (e + 2 * d) * s, matrices, [](M& o) { o.a.matvec(o.v, o.w); zt_benchmark_keep(o.w[0]); });
+        zt_benchmark_case<M>(bench, "matrix_trace", type, elements, d, d * s, matrices, [](M& o) { zt_benchmark_keep(o.a.trace()); });
+        zt_benchmark_case<M>(bench, "matrix_norm", type, elements, 2 * e, e * s, matrices, [](M& o) { zt_benchmark_keep(o.a.norm()); });
+    }
+
+}
+
+/**
+ * zt_benchmark_option : value of --name=value when arg is that option
+ *
+ * @param  std::string arg
+ * @param  std::string name without the dashes
+ * @param  std::string value set when arg matches
+ * @return bool whether arg matched
+ *
+ */
+inline bool zt_benchmark_option(const std::string& arg, const std::string& name, std::string& value) {
+
+    const std::string prefix = "--" + name + "=";
+    if (arg.compare(0, prefix.size(), prefix) != 0)
+    {
+        return false;
+    }
+    value = arg.substr(prefix.size());
+    return true;
+
+}
+
+/**
+ * zt_benchmark_options : parses the command line
+ *
+ * @param  int argc
+ * @param  char** argv
+ * @param  ZTBenchmarkOptions options
+ * @return bool whether every argument was understood
+ *
+ */
+bool zt_benchmark_options(int argc, char** argv, ZTBenchmarkOptions& options) {
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        std::string value;
+        if (zt_benchmark_option(arg, "max-size", value))
+        {
+            options.max_size = std::strtoull(value.c_str(), nullptr, 10);
+        }
+        else if (zt_benchmark_option(arg, "max-flops", value))
+        {
+            options.max_flops = std::strtod(value.c_str(), nullptr);
+        }
+        else if (zt_benchmark_option(arg, "max-memory", value))
+        {
+            options.max_memory = std::strtod(value.c_str(), nullptr);
+        }
+        else if (zt_benchmark_option(arg, "min-time", value))
+        {
+            options.min_time = std::strtod(value.c_str(), nullptr);
+        }
+        else if (zt_benchmark_option(arg, "repetitions", value))
+        {
+            options.repetitions = std::strtoull(value.c_str(), nullptr, 10);
+        }
+        else if (zt_benchmark_option(arg, "stream-size", value))
+        {
+            options.stream_size = std::strtoull(value.c_str(), nullptr, 10);
+        }
+        else if (zt_benchmark_option(arg, "threads", value))
+        {
+            std::istringstream list(value);
+            std::string item;
+            while (std::getline(list, item, ','))
+            {
+                const std::size_t threads = std::strtoull(item.c_str(), nullptr, 10);
+                if (threads == 0)
+                {
+                    return false;
+                }
+                options.threads.push_back(threads);
+            }
+        }
+        else if (zt_benchmark_option(arg, "tolerance", value))
+        {
+            options.tolerance = std::strtod(value.c_str(), nullptr);
+        }
+        else if (!zt_benchmark_option(arg, "types", options.types) && !zt_benchmark_option(arg, "filter", options.filter) &&
+                 !zt_benchmark_option(arg, "json", options.json) && !zt_benchmark_option(arg, "baseline", options.baseline) &&
+                 !zt_benchmark_option(arg, "input", options.input))
+        {
+            return false;
+        }
+    }
+    if (options.threads.empty())
+    {
+        options.threads.push_back(1);
+        const std::size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+        if (hardware > 1)
+        {
+            options.threads.push_back(hardware);
+        }
+    }
+    return true;
+
+}
+
+int main(int argc, char** argv) {
+
+    ZTBenchmarkOptions options;
+    if (!zt_benchmark_options(argc, argv, options))
+    {
+        std::cerr << "usage: " << argv[0] << " [--max-size=N] [--max-flops=F] [--max-memory=BYTES] [--min-time=S]"
+                  << " [--repetitions=N] [--stream-size=N] [--threads=1,2,...] [--types=float,double] [--filter=TEXT]"
+                  << " [--json=FILE] [--baseline=FILE] [--tolerance=0.1] [--input=FILE]" << std::endl;
+        return 2;
+    }
+
+    try
+    {
+        std::vector<ZTBenchmarkResult> results;
+        if (options.input.empty())
+        {
+            ZTBenchmark bench(options.min_time, options.repetitions, options.stream_size);
+            if (options.types.find("float") != std::string::npos)
+            {
+                zt_benchmark_register<float>(bench, "float", options);
+            }
+            if (options.types.find("double") != std::string::npos)
+            {
+                zt_benchmark_register<double>(bench, "double", options);
+            }
+            results = bench.run(options.threads, options.filter, std::cout);
+            if (!options.json.empty())
+            {
+                std::ofstream out(options.json);
+                ZTBenchmark::write_json(out, results, bench.get_stream_bandwidth());
+                if (!out)
+                {
+                    zt_raise<std::runtime_error>("File " + options.json + " could not be written!.");
+                }
+            }
+        }
+        else
+        {
+            results = ZTBenchmark::read_json(options.input);
+        }
+
+        if (options.baseline.empty())
+        {
+            return 0;
+        }
+        const std::vector<ZTBenchmarkComparison> comparisons = ZTBenchmark::compare(results, ZTBenchmark::read_json(options.baseline), options.tolerance);
+        std::size_t regressions = 0;
+        char line[256];
+        std::cout << "Comparison against " << options.baseline << ", tolerance " << 100.0 * options.tolerance << "%\n";
+        for (const ZTBenchmarkComparison& c : comparisons)
+        {
+            std::snprintf(line, sizeof(line), "%-52s %14.0f %14.0f %+8.1f%% %s\n", c.name.c_str(), c.baseline_time,
+                          c.current_time, 100.0 * (c.ratio - 1.0), c.regressed ? "REGRESSED" : "");
+            std::cout << line;
+            regressions += c.regressed ? 1 : 0;
+        }
+        std::cout << regressions << " of " << comparisons.size() << " benchmarks regressed" << std::endl;
+        return regressions == 0 ? 0 : 1;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 2;
+    }
+
+}
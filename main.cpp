@@ -22,8 +22,37 @@
  * THE SOFTWARE.
  */
 
+#include "ZTError.cpp"
+#include "ZTWorkspace.cpp"
+#include "ZTAlignedAllocator.cpp"
+#include "ZTCpu.cpp"
+#include "ZTHalf.cpp"
+#include "ZTThreadPool.cpp"
+#include "ZTBlas.cpp"
 #include "ZTVector.cpp"
+#include "ZTGemm.cpp"
+#include "ZTGemv.cpp"
 #include "ZTMatrix.cpp"
+#include "ZTVectorView.cpp"
+#include "ZTMatrixView.cpp"
+#include "ZTFixedVector.cpp"
+#include "ZTFixedMatrix.cpp"
+#include "ZTExpression.cpp"
+#include "ZTLU.cpp"
+#include "ZTCholesky.cpp"
+#include "ZTQR.cpp"
+#include "ZTSymmetricEigen.cpp"
+#include "ZTSVD.cpp"
+#include "ZTSparseMatrix.cpp"
+#include "ZTPreconditioner.cpp"
+#include "ZTKrylov.cpp"
+#include "ZTStructuredMatrix.cpp"
+#include "ZTBatch.cpp"
+#include "ZTQuantized.cpp"
+#include "ZTMatrixFile.cpp"
+#include "ZTTiledMatrix.cpp"
+#include "ZTMatrixMarket.cpp"
+#include "ZTNpy.cpp"
 
 int main() {
 
@@ -56,6 +85,7 @@ int main() {
   // perfom vector to vector addition
   // vec_result = vec_x.add(y);
   // vec_result = vec_x + y;
+  // vec_x.add(y, vec_result);  // reuses the buffer of vec_result
 
   // perfom vector to vector subtraction
   // vec_result = vec_x.minus(y);
@@ -96,15 +126,128 @@ int main() {
   // perfom matrix to matrix addition
   // mat_result = X.add(Y);
   // mat_result = X + Y;
+  // X.add(Y, mat_result);  // reuses the buffer of mat_result
 
   // perfom matrix to matrix subtraction
   // mat_result = X.minus(Y);
   // mat_result = X - Y;
 
-  // perfom matrix to matrix multiplication
+  // perfom matrix to matrix multiplication (large products run on the thread pool)
+  // ZTThreadPool::instance().set_num_threads(8);
   // mat_result = X.multiply(Y);
   // mat_result = X * Y;
+  // gemm(1.0, X, Y, 0.0, mat_result);
+
+  // perfom matrix to matrix element-wise multiplication
+  // mat_result = X.hadamard(Y);
+
+  // perfom matrix to vector multiplication
+  // vec_result = X * vec_x;
+  // vec_result = X.matvec_transposed(vec_x);
+  // gemv(1.0, X, vec_x, 0.0, vec_result);
+  // gemv_batch(1.0, X, Y, 0.0, mat_result);  // one vector per row of Y
+
+  // chained operators are fused into a single pass, without temporaries
+  // mat_result = X + Y - X * scalar;
+  // vec_result = vec_x * scalar + vec_y - y;
   
+  // operate on blocks, rows and columns in place through non-owning views
+  // X.block(1, 1, 2, 2) += Y.block(2, 2, 2, 2);
+  // scalar_result = X.row(1).dot(Y.col(1));
+  // mat_result = X.view().transpose() * Y;
+
+  // small shapes on the stack, with dimensions checked at compile time
+  // ZTFixedMatrix<double, 3, 3> F(2.0), G(1.5);
+  // ZTFixedMatrix<double, 3, 3> FG = F * G + F;  // F * ZTFixedMatrix<double, 2, 3>(...) does not compile
+  // ZTFixedVector<double, 3> u({1.0, 2.0, 3.0});
+  // scalar_result = u.dot(u * scalar);
+
+  // element access: X(1, 1) and X.at(0, 0) are checked, X[0][0] and X.unsafe_get(0, 0) are not
+  // for (std::size_t r = 0; r < 3; ++r) { for (std::size_t c = 0; c < 3; ++c) { X[r][c] *= scalar; } }
+
+  // failed checks throw (build with -DZT_ASSERT_CHECKS for debug-only assertions)
+  // try { mat_result = X.matmul(ZTMatrix<double>(2, 2, 1.0)); }
+  // catch (const std::invalid_argument& e) { std::cerr << e.what() << std::endl; }
+
+  // draw loop temporaries from a scoped arena, released together at scope end
+  // {
+  //   ZTWorkspace workspace;  // or ZTLocalWorkspace for the thread's own arena
+  //   for (int i = 0; i < 1000; ++i) { mat_result = X.add(Y); }
+  // }
+
+  // factorize once, then solve for many right-hand sides
+  // ZTLU<double> lu = X.lu();
+  // vec_result = lu.solve(vec_y);
+  // mat_result = lu.solve(Y);
+  // scalar_result = lu.determinant();
+  // mat_result = lu.inverse();
+
+  // symmetric positive definite systems at half the cost of LU
+  // ZTCholesky<double> chol = X.cholesky();
+  // if (chol.is_positive_definite()) { vec_result = chol.solve(vec_y); scalar_result = chol.log_determinant(); }
+  // ZTLDLT<double> ldlt = X.ldlt();
+
+  // least squares through QR, Q is applied without being formed (tsqr() for tall-skinny matrices)
+  // ZTQR<double> qr = X.qr();
+  // vec_result = qr.solve(vec_y);
+  // vec_result = qr.apply_qt(vec_y);
+
+  // eigenpairs of a symmetric matrix, singular values and the top-k components of any matrix
+  // ZTSymmetricEigen<double> eig = X.symmetric_eigen();
+  // vec_result = eig.eigenvalues();
+  // ZTSVD<double> svd = X.svd();
+  // vec_result = svd.singular_values();
+  // ZTSVD<double> top = X.truncated_svd(2);
+
+  // sparse matrices in CSR or CSC, only the nonzeros are stored
+  // ZTSparseMatrix<double> S(X, ZT_SPARSE_CSR);
+  // vec_result = S.matvec(vec_y);
+  // ZTSparseMatrix<double> S2 = S.multiply(S.transpose());
+  // mat_result = S.multiply(Y);
+
+  // iterative solvers on any operator with apply(x, y), x holds the initial guess
+  // ZTKrylovResult<double> info = ZTKrylov<double>::cg(S, vec_y, vec_result, ZTIC0Preconditioner<double>(S));
+  // info = ZTKrylov<double>::gmres(S, vec_y, vec_result, ZTILU0Preconditioner<double>(S));
+
+  // structured matrices in packed storage, promoted to dense only by to_dense() or a dense operand
+  // ZTBandedMatrix<double> tri = ZTBandedMatrix<double>::tridiagonal(sub, diag, super);
+  // vec_result = tri.solve(vec_y);
+  // ZTSymmetricMatrix<double> sym(X);
+  // vec_result = sym.matvec(vec_y);
+  // ZTTriangularMatrix<double> low(X, ZT_LOWER);
+  // mat_result = low.solve(Y);
+
+  // many small problems at once, element (i, j) of every matrix stored contiguously
+  // ZTMatrixBatch<double> jacobians(100000, 6, 6);
+  // ZTVectorBatch<double> residuals(100000, 6);
+  // ZTVectorBatch<double> steps = jacobians.solve(residuals);
+
+  // half and bfloat16 storage, widened to float inside dot, norm, GEMV and GEMM
+  // ZTMatrix<ZTBFloat16> W(1024, 1024, ZTBFloat16(0.5f));
+  // ZTMatrix<ZTHalf> activations(1024, 64, ZTHalf(1.0f));
+  // float scale = W.norm();
+
+  // int8 weights against uint8 activations, int32 accumulation dequantized into float
+  // ZTQuantizedMatrix<std::int8_t> weights(X, ZT_PER_ROW);
+  // ZTQuantizedVector<std::uint8_t> input(vec_y);
+  // ZTVector<float> output = weights.matvec(input);
+
+  // binary matrix files, written a row at a time and mapped back without copying
+  // ZTMatrixWriter<double>::save("factors.ztm", X);
+  // ZTMappedMatrix<double> factors("factors.ztm");
+  // mat_result = factors.view().multiply(Y);
+
+  // out-of-core matrices, tiles on local disk behind an LRU cache
+  // ZTTiledMatrix<double> big(X, "/tmp", 512, 16);
+  // ZTTiledMatrix<double> product = big.multiply(big);
+  // std::cout << product.norm() << std::endl;
+
+  // Matrix Market files parsed on the thread pool, .npy arrays mapped in place
+  // ZTSparseMatrix<double> graph = ZTMatrixMarket<double>::read_sparse("graph.mtx");
+  // ZTNpyArray<double> embeddings("embeddings.npy");
+  // mat_result = embeddings.view().multiply(Y);
+  // ZTNpyArray<double>::save("result.npy", mat_result);
+
   // perfom matrix trace and norm
   // std::cout <<  X.trace() << std::endl;
   // std::cout <<  X.norm() << std::endl;